@@ -140,6 +140,9 @@ namespace EE
 
         // Initialize entity world manager and load startup map
         m_pEntityWorldManager->Initialize( *m_pSystemRegistry );
+        m_pEntityWorldManager->SetParallelWorldUpdateEnabled( iniFile.GetBoolOrDefault( "Entity:ParallelWorldUpdate", false ) );
+        m_pEntityWorldManager->SetDeferredTransformUpdateEnabled( iniFile.GetBoolOrDefault( "Entity:DeferredTransformUpdate", false ) );
+        m_pEntityWorldManager->SetPooledComponentStorageEnabled( iniFile.GetBoolOrDefault( "Entity:PooledComponentStorage", false ) );
         if ( m_startupMap.IsValid() )
         {
             auto const mapResourceID = EE::ResourceID( m_startupMap );
@@ -147,7 +150,8 @@ namespace EE
         }
 
         // Initialize rendering system
-        m_renderingSystem.Initialize( m_pRenderDevice, Float2( windowDimensions ), m_engineModule.GetRendererRegistry(), m_pEntityWorldManager );
+        m_renderingSystem.Initialize( m_pRenderDevice, m_pTaskSystem, Float2( windowDimensions ), m_engineModule.GetRendererRegistry(), m_pEntityWorldManager );
+        m_renderingSystem.SetPipelinedRenderingEnabled( iniFile.GetBoolOrDefault( "Render:PipelinedRendering", false ) );
         m_pSystemRegistry->RegisterSystem( &m_renderingSystem );
 
         // Create tools UI
@@ -332,12 +336,24 @@ namespace EE
                 {
                     EE_PROFILE_SCOPE_RESOURCE( "Resource System" );
 
+                    // The in-flight frame packet references meshes and materials directly, so nothing it uses can be released while it renders.
+                    // Entity unloads (in the loading update below) only queue unload requests, these are only started here during the next frame's
+                    // resource update, so we only need to wait for the in-flight frame when there are queued unloads. This keeps the render
+                    // pipelined with the simulation whenever nothing is being unloaded.
+                    if ( m_pResourceSystem->HasPendingUnloadRequests() )
+                    {
+                        m_renderingSystem.WaitForFrameToComplete();
+                    }
+
                     m_pResourceSystem->Update();
 
                     // Handle hot-reloading of entities
                     #if EE_DEVELOPMENT_TOOLS
                     if ( m_pResourceSystem->RequiresHotReloading() )
                     {
+                        // Resources are about to be unloaded, so the in-flight frame needs to complete first
+                        m_renderingSystem.WaitForFrameToComplete();
+
                         m_pToolsUI->HotReload_UnloadResources( m_pResourceSystem->GetUsersToBeReloaded(), m_pResourceSystem->GetResourcesToBeReloaded() );
                         m_pEntityWorldManager->HotReload_UnloadEntities( m_pResourceSystem->GetUsersToBeReloaded() );
 
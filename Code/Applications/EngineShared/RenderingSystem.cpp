@@ -14,11 +14,19 @@
 
 namespace EE::Render
 {
+    RenderingSystem::RenderingSystem()
+        : m_renderTask( [this] ( TaskSetPartition range, uint32_t threadnum ) { RenderFrame(); } )
+    {}
+
+    //-------------------------------------------------------------------------
+
     void RenderingSystem::CreateCustomRenderTargetForViewport( Viewport const* pViewport, bool requiresPickingBuffer )
     {
         EE_ASSERT( pViewport != nullptr && pViewport->IsValid() );
         EE_ASSERT( FindRenderTargetForViewport( pViewport ) == nullptr );
 
+        WaitForFrameToComplete();
+
         m_pRenderDevice->LockDevice();
         {
             auto& vrt = m_viewportRenderTargets.emplace_back( pViewport->GetID(), EE::New<RenderTarget>() );
@@ -36,14 +44,15 @@ namespace EE::Render
         EE_ASSERT( pViewportRenderTarget != nullptr );
         EE_ASSERT( pViewportRenderTarget->m_pRenderTarget != nullptr && pViewportRenderTarget->m_pRenderTarget->IsValid() );
 
+        WaitForFrameToComplete();
+
         m_pRenderDevice->LockDevice();
         {
             m_pRenderDevice->DestroyRenderTarget( *pViewportRenderTarget->m_pRenderTarget );
             EE::Delete( pViewportRenderTarget->m_pRenderTarget );
+            m_viewportRenderTargets.erase( pViewportRenderTarget );
         }
         m_pRenderDevice->UnlockDevice();
-
-        m_viewportRenderTargets.erase( pViewportRenderTarget );
     }
 
     ViewSRVHandle const& RenderingSystem::GetRenderTargetTextureForViewport( Viewport const* pViewport ) const
@@ -66,6 +75,8 @@ namespace EE::Render
         EE_ASSERT( pViewportRenderTarget->m_pRenderTarget != nullptr && pViewportRenderTarget->m_pRenderTarget->IsValid() );
         if ( pViewportRenderTarget->m_pRenderTarget->HasPickingRT() )
         {
+            // Reading back the picking buffer would stall on the in-flight frame anyway, so make sure it has been rendered
+            const_cast<RenderingSystem*>( this )->WaitForFrameToComplete();
             return m_pRenderDevice->ReadBackPickingID( *pViewportRenderTarget->m_pRenderTarget, pixelCoords );
         }
         else
@@ -88,14 +99,16 @@ namespace EE::Render
 
     //-------------------------------------------------------------------------
 
-    void RenderingSystem::Initialize( RenderDevice* pRenderDevice, Float2 primaryWindowDimensions, RendererRegistry* pRegistry, EntityWorldManager* pWorldManager )
+    void RenderingSystem::Initialize( RenderDevice* pRenderDevice, TaskSystem* pTaskSystem, Float2 primaryWindowDimensions, RendererRegistry* pRegistry, EntityWorldManager* pWorldManager )
     {
         EE_ASSERT( m_pRenderDevice == nullptr );
-        EE_ASSERT( pRenderDevice != nullptr && pRegistry != nullptr );
+        EE_ASSERT( pRenderDevice != nullptr && pTaskSystem != nullptr && pRegistry != nullptr );
         EE_ASSERT( pWorldManager != nullptr );
 
         m_pRenderDevice = pRenderDevice;
+        m_pTaskSystem = pTaskSystem;
         m_pWorldManager = pWorldManager;
+        m_worldDestroyedEventBindingID = m_pWorldManager->OnWorldDestroyed().Bind( [this] ( EntityWorld* pWorld ) { OnWorldDestroyed( pWorld ); } );
 
         // Set initial render device size
         //-------------------------------------------------------------------------
@@ -122,8 +135,12 @@ namespace EE::Render
         // Get renderers
         //-------------------------------------------------------------------------
 
+        m_canUsePipelinedRendering = true;
+
         for ( auto pRenderer : pRegistry->GetRegisteredRenderers() )
         {
+            m_canUsePipelinedRendering &= pRenderer->SupportsPipelinedRendering();
+
             if ( pRenderer->GetRendererID() == WorldRenderer::RendererID )
             {
                 EE_ASSERT( m_pWorldRenderer == nullptr );
@@ -171,6 +188,12 @@ namespace EE::Render
 
     void RenderingSystem::Shutdown()
     {
+        WaitForFrameToComplete();
+        m_worldRenderJobs.clear();
+        m_isPipelinedRenderingEnabled = false;
+
+        m_pWorldManager->OnWorldDestroyed().Unbind( m_worldDestroyedEventBindingID );
+
         // Destroy any viewport render targets created
         //-------------------------------------------------------------------------
 
@@ -194,6 +217,7 @@ namespace EE::Render
         #endif
 
         m_pWorldManager = nullptr;
+        m_pTaskSystem = nullptr;
         m_pRenderDevice = nullptr;
     }
 
@@ -202,6 +226,8 @@ namespace EE::Render
         Float2 const newWindowDimensions = Float2( newMainWindowDimensions );
         Float2 const oldWindowDimensions = Float2( m_pRenderDevice->GetPrimaryWindowDimensions() );
 
+        WaitForFrameToComplete();
+
         //-------------------------------------------------------------------------
 
         m_pRenderDevice->LockDevice();
@@ -222,19 +248,94 @@ namespace EE::Render
         }
     }
 
+    void RenderingSystem::SetPipelinedRenderingEnabled( bool isEnabled )
+    {
+        EE_ASSERT( Threading::IsMainThread() );
+
+        if ( isEnabled && !m_canUsePipelinedRendering )
+        {
+            EE_LOG_WARNING( "Render", "Rendering System", "Pipelined rendering requested but not all registered renderers support it!" );
+            return;
+        }
+
+        WaitForFrameToComplete();
+        m_isPipelinedRenderingEnabled = isEnabled;
+    }
+
+    void RenderingSystem::WaitForFrameToComplete()
+    {
+        EE_ASSERT( Threading::IsMainThread() );
+
+        if ( m_isRenderTaskScheduled )
+        {
+            EE_PROFILE_SCOPE_RENDER( "Wait For Render" );
+            m_pTaskSystem->WaitForTask( &m_renderTask );
+            m_isRenderTaskScheduled = false;
+        }
+    }
+
+    void RenderingSystem::OnWorldDestroyed( EntityWorld* pWorld )
+    {
+        // The in-flight frame might still be referencing the world
+        WaitForFrameToComplete();
+
+        m_pWorldRenderer->OnWorldDestroyed( pWorld );
+
+        for ( auto const& pCustomRenderer : m_customRenderers )
+        {
+            pCustomRenderer->OnWorldDestroyed( pWorld );
+        }
+
+        #if EE_DEVELOPMENT_TOOLS
+        m_pDebugRenderer->OnWorldDestroyed( pWorld );
+        #endif
+
+        //-------------------------------------------------------------------------
+
+        for ( int32_t i = (int32_t) m_worldRenderJobs.size() - 1; i >= 0; i-- )
+        {
+            if ( m_worldRenderJobs[i].m_pWorld == pWorld )
+            {
+                m_worldRenderJobs.erase( m_worldRenderJobs.begin() + i );
+            }
+        }
+    }
+
+    //-------------------------------------------------------------------------
+
     void RenderingSystem::Update( UpdateContext const& ctx )
     {
         EE_ASSERT( m_pRenderDevice != nullptr );
         EE_ASSERT( ctx.GetUpdateStage() == UpdateStage::FrameEnd );
         EE_PROFILE_SCOPE_RENDER( "Rendering Post-Physics" );
 
-        //-------------------------------------------------------------------------
+        // We cant touch any of the prepared state until the previous frame has been rendered
+        WaitForFrameToComplete();
 
-        m_pRenderDevice->LockDevice();
+        PrepareFrame( ctx.GetDeltaTime() );
+
+        if ( m_isPipelinedRenderingEnabled )
+        {
+            m_pTaskSystem->ScheduleTask( &m_renderTask );
+            m_isRenderTaskScheduled = true;
+        }
+        else
+        {
+            RenderFrame();
+        }
+    }
+
+    void RenderingSystem::PrepareFrame( Seconds const deltaTime )
+    {
+        EE_ASSERT( Threading::IsMainThread() && !m_isRenderTaskScheduled );
+        EE_PROFILE_FUNCTION_RENDER();
+
+        m_frameDeltaTime = deltaTime;
+        m_worldRenderJobs.clear();
 
         RenderTarget* pPrimaryRT = m_pRenderDevice->GetPrimaryWindowRenderTarget();
 
-        // Render into active viewports
+        // Prepare active viewports
         //-------------------------------------------------------------------------
 
         for ( auto pWorld : m_pWorldManager->GetWorlds() )
@@ -244,21 +345,66 @@ namespace EE::Render
                 continue;
             }
 
-            Render::Viewport* pViewport = pWorld->GetViewport();
+            WorldRenderJob& job = m_worldRenderJobs.emplace_back();
+            job.m_pWorld = pWorld;
+            job.m_viewport = *pWorld->GetViewport();
+            job.m_pRenderTarget = pPrimaryRT;
+
+            ViewportRenderTarget const* pVRT = FindRenderTargetForViewport( pWorld->GetViewport() );
+            if ( pVRT != nullptr )
+            {
+                job.m_pRenderTarget = pVRT->m_pRenderTarget;
+                job.m_isCustomRenderTarget = true;
+            }
 
-            // Set and clear render target
             //-------------------------------------------------------------------------
 
-            RenderTarget* pViewportRT = pPrimaryRT;
-            ViewportRenderTarget const* pVRT = FindRenderTargetForViewport( pViewport );
-            if ( pVRT != nullptr )
+            m_pWorldRenderer->PrepareWorld( deltaTime, job.m_viewport, pWorld );
+
+            for ( auto const& pCustomRenderer : m_customRenderers )
             {
-                pViewportRT = pVRT->m_pRenderTarget;
+                pCustomRenderer->PrepareWorld( deltaTime, job.m_viewport, pWorld );
+                pCustomRenderer->PrepareViewport( deltaTime, job.m_viewport );
+            }
 
+            #if EE_DEVELOPMENT_TOOLS
+            m_pDebugRenderer->PrepareWorld( deltaTime, job.m_viewport, pWorld );
+            m_pDebugRenderer->PrepareViewport( deltaTime, job.m_viewport );
+            #endif
+        }
+
+        // Prepare development UI
+        //-------------------------------------------------------------------------
+
+        #if EE_DEVELOPMENT_TOOLS
+        if ( m_pImguiRenderer != nullptr )
+        {
+            m_pImguiRenderer->PrepareViewport( deltaTime, m_toolsViewport );
+        }
+        #endif
+    }
+
+    void RenderingSystem::RenderFrame()
+    {
+        EE_PROFILE_FUNCTION_RENDER();
+
+        m_pRenderDevice->LockDevice();
+
+        // Render into active viewports
+        //-------------------------------------------------------------------------
+
+        for ( WorldRenderJob const& job : m_worldRenderJobs )
+        {
+            // Set and clear render target
+            //-------------------------------------------------------------------------
+
+            RenderTarget* pViewportRT = job.m_pRenderTarget;
+            if ( job.m_isCustomRenderTarget )
+            {
                 // Resize render target if needed
-                if ( Int2( pViewport->GetDimensions() ) != pViewportRT->GetDimensions() )
+                if ( Int2( job.m_viewport.GetDimensions() ) != pViewportRT->GetDimensions() )
                 {
-                    m_pRenderDevice->ResizeRenderTarget( *pViewportRT, pViewport->GetDimensions() );
+                    m_pRenderDevice->ResizeRenderTarget( *pViewportRT, job.m_viewport.GetDimensions() );
                 }
 
                 // Clear render target and depth stencil textures
@@ -268,17 +414,17 @@ namespace EE::Render
             // Draw
             //-------------------------------------------------------------------------
 
-            m_pWorldRenderer->RenderWorld( ctx.GetDeltaTime(), *pViewport, *pViewportRT, pWorld );
+            m_pWorldRenderer->RenderWorld( m_frameDeltaTime, job.m_viewport, *pViewportRT, job.m_pWorld );
 
             for ( auto const& pCustomRenderer : m_customRenderers )
             {
-                pCustomRenderer->RenderWorld( ctx.GetDeltaTime(), *pViewport, *pViewportRT, pWorld );
-                pCustomRenderer->RenderViewport( ctx.GetDeltaTime(), *pViewport, *pViewportRT );
+                pCustomRenderer->RenderWorld( m_frameDeltaTime, job.m_viewport, *pViewportRT, job.m_pWorld );
+                pCustomRenderer->RenderViewport( m_frameDeltaTime, job.m_viewport, *pViewportRT );
             }
 
             #if EE_DEVELOPMENT_TOOLS
-            m_pDebugRenderer->RenderWorld( ctx.GetDeltaTime(), *pViewport, *pViewportRT, pWorld );
-            m_pDebugRenderer->RenderViewport( ctx.GetDeltaTime(), *pViewport, *pViewportRT );
+            m_pDebugRenderer->RenderWorld( m_frameDeltaTime, job.m_viewport, *pViewportRT, job.m_pWorld );
+            m_pDebugRenderer->RenderViewport( m_frameDeltaTime, job.m_viewport, *pViewportRT );
             #endif
         }
 
@@ -288,7 +434,7 @@ namespace EE::Render
         #if EE_DEVELOPMENT_TOOLS
         if ( m_pImguiRenderer != nullptr )
         {
-            m_pImguiRenderer->RenderViewport( ctx.GetDeltaTime(), m_toolsViewport, *pPrimaryRT );
+            m_pImguiRenderer->RenderViewport( m_frameDeltaTime, m_toolsViewport, *m_pRenderDevice->GetPrimaryWindowRenderTarget() );
         }
         #endif
 
@@ -2,17 +2,24 @@
 
 #include "Engine/Render/RendererRegistry.h"
 #include "Base/Render/RenderViewport.h"
+#include "Base/Threading/TaskSystem.h"
+#include "Base/Types/Event.h"
 #include "Base/Systems.h"
 
 //-------------------------------------------------------------------------
 // EE Renderer System
 //-------------------------------------------------------------------------
 // This class allows us to define the exact rendering order and task scheduling for a frame
+//
+// A frame is rendered in two phases: prepare (main thread, copies all the needed state out of the worlds) and render.
+// With pipelined rendering enabled, the render phase runs as a task and overlaps the simulation of the next frame.
+// Anything that modifies render state (render targets, worlds, resources) needs to wait for the in-flight frame first.
 
 namespace EE
 {
     class UpdateContext;
     class EntityWorldManager;
+    class EntityWorld;
 
     //-------------------------------------------------------------------------
 
@@ -41,18 +48,40 @@ namespace EE
                 RenderTarget*           m_pRenderTarget = nullptr;
             };
 
+            // Everything needed to render a world, copied during prepare
+            struct WorldRenderJob
+            {
+                EntityWorld*            m_pWorld = nullptr;
+                Viewport                m_viewport;
+                RenderTarget*           m_pRenderTarget = nullptr;
+                bool                    m_isCustomRenderTarget = false;
+            };
+
         public:
 
             EE_SYSTEM( RenderingSystem );
 
         public:
 
-            void Initialize( RenderDevice* pRenderDevice, Float2 primaryWindowDimensions, RendererRegistry* pRegistry, EntityWorldManager* pWorldManager );
+            RenderingSystem();
+
+            void Initialize( RenderDevice* pRenderDevice, TaskSystem* pTaskSystem, Float2 primaryWindowDimensions, RendererRegistry* pRegistry, EntityWorldManager* pWorldManager );
             void Shutdown();
 
             void ResizePrimaryRenderTarget( Int2 newMainWindowDimensions );
             void Update( UpdateContext const& ctx );
 
+            // Pipelined Rendering
+            //-------------------------------------------------------------------------
+
+            // Only possible if all registered renderers support it
+            inline bool CanUsePipelinedRendering() const { return m_canUsePipelinedRendering; }
+            inline bool IsPipelinedRenderingEnabled() const { return m_isPipelinedRenderingEnabled; }
+            void SetPipelinedRenderingEnabled( bool isEnabled );
+
+            // Block until any in-flight frame has been rendered
+            void WaitForFrameToComplete();
+
             //-------------------------------------------------------------------------
 
             void CreateCustomRenderTargetForViewport( Viewport const* pViewport, bool requiresPickingBuffer = false );
@@ -66,15 +95,33 @@ namespace EE
             ViewportRenderTarget* FindRenderTargetForViewport( Viewport const* pViewport );
             inline ViewportRenderTarget const* FindRenderTargetForViewport( Viewport const* pViewport ) const { return const_cast<RenderingSystem*>( this )->FindRenderTargetForViewport( pViewport ); }
 
+            // Copy out all state needed to render the frame, needs to be called on the main thread
+            void PrepareFrame( Seconds const deltaTime );
+
+            // Render and present the prepared frame
+            void RenderFrame();
+
+            void OnWorldDestroyed( EntityWorld* pWorld );
+
         private:
 
             RenderDevice*                                   m_pRenderDevice = nullptr;
+            TaskSystem*                                     m_pTaskSystem = nullptr;
             EntityWorldManager*                             m_pWorldManager = nullptr;
             WorldRenderer*                                  m_pWorldRenderer = nullptr;
             TVector<IRenderer*>                             m_customRenderers;
+            EventBindingID                                  m_worldDestroyedEventBindingID;
 
             TInlineVector<ViewportRenderTarget, 5>          m_viewportRenderTargets;
 
+            // Frame
+            TInlineVector<WorldRenderJob, 5>                m_worldRenderJobs;
+            Seconds                                         m_frameDeltaTime = 0.0f;
+            AsyncTask                                       m_renderTask;
+            bool                                            m_isRenderTaskScheduled = false;
+            bool                                            m_canUsePipelinedRendering = false;
+            bool                                            m_isPipelinedRenderingEnabled = false;
+
             //-------------------------------------------------------------------------
 
             #if EE_DEVELOPMENT_TOOLS
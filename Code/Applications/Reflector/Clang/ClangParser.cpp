@@ -2,6 +2,7 @@
 #include "ClangVisitors_TranslationUnit.h"
 #include "Applications/Reflector/ReflectorSettingsAndUtils.h"
 #include "Applications/Reflector/Database/ReflectionDatabase.h"
+#include "Base/Threading/TaskSystem.h"
 #include "Base/Time/Timers.h"
 #include "Base/Platform/PlatformUtils_Win32.h"
 #include <fstream>
@@ -10,53 +11,60 @@
 
 namespace EE::TypeSystem::Reflection
 {
-    ClangParser::ClangParser( SolutionInfo* pSolution, ReflectionDatabase* pDatabase, FileSystem::Path const& reflectionDataPath )
-        : m_context( pSolution, pDatabase )
-        , m_totalParsingTime( 0 )
-        , m_totalVisitingTime( 0 )
-        , m_reflectionDataPath( reflectionDataPath )
-    {}
-
-    bool ClangParser::Parse( TVector<HeaderInfo*> const& headers, Pass pass )
+    namespace
     {
-        m_context.m_detectDevOnlyTypesAndProperties = ( pass == NoDevToolsPass );
-
-        // Create single amalgamated header file for all headers to parse
-        //-------------------------------------------------------------------------
-
-        std::ofstream reflectorFileStream;
-        FileSystem::Path const reflectorHeader = m_reflectionDataPath + "Reflector.h";
-        reflectorHeader.EnsureDirectoryExists();
-        reflectorFileStream.open( reflectorHeader.c_str(), std::ios::out | std::ios::trunc );
-        EE_ASSERT( !reflectorFileStream.fail() );
+        // Each translation unit is parsed on a separate thread so each one needs its own index
+        struct ProjectTranslationUnit
+        {
+            String                          m_projectName;
+            TVector<HeaderInfo const*>      m_headers;
+            FileSystem::Path                m_headerPath;
+            CXIndex                         m_index = nullptr;
+            CXTranslationUnit               m_tu = nullptr;
+            CXErrorCode                     m_result = CXError_Failure;
+            Milliseconds                    m_parsingTime = 0;
+        };
 
-        String includeStr;
-        m_context.m_headersToVisit.clear();
-        for ( HeaderInfo const* pHeader : headers )
+        static bool WriteHeaderFile( FileSystem::Path const& headerPath, String const& contents )
         {
-            // Exclude dev tools
-            if ( pass == NoDevToolsPass && pHeader->IsInToolsLayer() )
+            headerPath.EnsureDirectoryExists();
+
+            std::ofstream fileStream;
+            fileStream.open( headerPath.c_str(), std::ios::out | std::ios::trunc );
+            if ( fileStream.fail() )
             {
-                continue;
+                return false;
             }
 
-            m_context.m_headersToVisit.emplace_back( pHeader->m_ID, pHeader );
-            includeStr += "#include \"" + pHeader->m_filePath.GetString() + "\"\n";
+            fileStream.write( contents.c_str(), contents.size() );
+            fileStream.close();
+            return true;
         }
+    }
 
-        reflectorFileStream.write( includeStr.c_str(), includeStr.size() );
-        reflectorFileStream.close();
+    //-------------------------------------------------------------------------
+
+    ClangParser::ClangParser( SolutionInfo* pSolution, ReflectionDatabase* pDatabase, FileSystem::Path const& reflectionDataPath, TaskSystem* pTaskSystem )
+        : m_context( pSolution, pDatabase )
+        , m_pTaskSystem( pTaskSystem )
+        , m_totalParsingTime( 0 )
+        , m_totalVisitingTime( 0 )
+        , m_preambleTime( 0 )
+        , m_reflectionDataPath( reflectionDataPath )
+    {
+        EE_ASSERT( m_pTaskSystem != nullptr && m_pTaskSystem->IsInitialized() );
+    }
+
+    bool ClangParser::CreateClangArgs( Pass pass, TVector<String>& outArgs ) const
+    {
+        outArgs.clear();
 
-        // Clang args
-        TInlineVector<String, 10> fullIncludePaths;
-        TInlineVector<char const*, 10> clangArgs;
         int32_t const numIncludePaths = sizeof( Settings::g_includePaths ) / sizeof( Settings::g_includePaths[0] );
         for ( auto i = 0; i < numIncludePaths; i++ )
         {
             String const fullPath = m_context.m_pSolution->m_path.GetString() + Settings::g_includePaths[i];
             String const shortPath = Platform::Win32::GetShortPath( fullPath );
-            fullIncludePaths.push_back( "-I" + shortPath );
-            clangArgs.push_back( fullIncludePaths.back().c_str() );
+            outArgs.emplace_back( "-I" + shortPath );
 
             if ( !FileSystem::Exists( fullPath ) )
             {
@@ -65,85 +73,269 @@ namespace EE::TypeSystem::Reflection
             }
         }
 
-        clangArgs.push_back( "-x" );
-        clangArgs.push_back( "c++" );
-        clangArgs.push_back( "-std=c++17" );
-        clangArgs.push_back( "-O0" );
-        clangArgs.push_back( "-D NDEBUG" );
-        clangArgs.push_back( "-Werror" );
-        clangArgs.push_back( "-Wno-deprecated-builtins" );
-        clangArgs.push_back( "-fparse-all-comments" );
-        clangArgs.push_back( "-fms-extensions" );
-        clangArgs.push_back( "-fms-compatibility" );
-        clangArgs.push_back( "-Wno-unknown-warning-option" );
-        clangArgs.push_back( "-Wno-return-type-c-linkage" );
-        clangArgs.push_back( "-Wno-gnu-folding-constant" );
+        outArgs.emplace_back( "-x" );
+        outArgs.emplace_back( "c++" );
+        outArgs.emplace_back( "-std=c++17" );
+        outArgs.emplace_back( "-O0" );
+        outArgs.emplace_back( "-D NDEBUG" );
+        outArgs.emplace_back( "-Werror" );
+        outArgs.emplace_back( "-Wno-deprecated-builtins" );
+        outArgs.emplace_back( "-fparse-all-comments" );
+        outArgs.emplace_back( "-fms-extensions" );
+        outArgs.emplace_back( "-fms-compatibility" );
+        outArgs.emplace_back( "-Wno-unknown-warning-option" );
+        outArgs.emplace_back( "-Wno-return-type-c-linkage" );
+        outArgs.emplace_back( "-Wno-gnu-folding-constant" );
 
         // Exclude dev tools
         if ( pass == NoDevToolsPass )
         {
-            clangArgs.push_back( Settings::g_devToolsExclusionDefine );
+            outArgs.emplace_back( Settings::g_devToolsExclusionDefine );
         }
 
         // Note: i am not sure if this is the proper way to add custom macro
-        clangArgs.push_back( Settings::g_engineGraphicBackendMacroDefine );
-        
-        //-------------------------------------------------------------------------
+        outArgs.emplace_back( Settings::g_engineGraphicBackendMacroDefine );
+
+        return true;
+    }
+
+    FileSystem::Path ClangParser::CreatePrecompiledPreamble( Pass pass, TVector<char const*> const& clangArgs )
+    {
+        ScopedTimer<PlatformClock> timer( m_preambleTime );
+
+        String includeStr;
+        for ( auto pHeader : Settings::g_preambleHeaders )
+        {
+            includeStr += String( String::CtorSprintf(), "#include <%s>\n", pHeader );
+        }
+
+        FileSystem::Path const preambleHeaderPath = m_reflectionDataPath + "ReflectorPreamble.h";
+        if ( !WriteHeaderFile( preambleHeaderPath, includeStr ) )
+        {
+            return FileSystem::Path();
+        }
+
+        // The preamble needs to be built with the exact same defines as the translation units that use it
+        FileSystem::Path const preamblePath = m_reflectionDataPath + ( ( pass == DevToolsPass ) ? "ReflectorPreamble.pch" : "ReflectorPreamble_NoDevTools.pch" );
 
-        // Set up clang
         auto idx = clang_createIndex( 0, 1 );
-        uint32_t const clangOptions = CXTranslationUnit_DetailedPreprocessingRecord | CXTranslationUnit_SkipFunctionBodies | CXTranslationUnit_IncludeBriefCommentsInCodeCompletion;
+        uint32_t const clangOptions = CXTranslationUnit_ForSerialization | CXTranslationUnit_Incomplete | CXTranslationUnit_SkipFunctionBodies;
 
-        // Parse Headers
+        bool preambleSaved = false;
         CXTranslationUnit tu;
-        CXErrorCode result = CXError_Failure;
+        CXErrorCode const result = clang_parseTranslationUnit2( idx, preambleHeaderPath.c_str(), clangArgs.data(), (int32_t) clangArgs.size(), 0, 0, clangOptions, &tu );
+        if ( result == CXError_Success )
         {
-            ScopedTimer<PlatformClock> timer( m_totalParsingTime );
-            result = clang_parseTranslationUnit2( idx, reflectorHeader.c_str(), clangArgs.data(), clangArgs.size(), 0, 0, clangOptions, &tu );
+            preambleSaved = ( clang_saveTranslationUnit( tu, preamblePath.c_str(), clang_defaultSaveOptions( tu ) ) == CXSaveError_None );
+            clang_disposeTranslationUnit( tu );
         }
+        clang_disposeIndex( idx );
 
-        // Handle result of parse
-        if ( result == CXError_Success )
+        return preambleSaved ? preamblePath : FileSystem::Path();
+    }
+
+    void ClangParser::LogClangError( CXErrorCode result )
+    {
+        switch ( result )
         {
-            ScopedTimer<PlatformClock> timer( m_totalVisitingTime );
-            m_context.Reset( &tu );
-            auto cursor = clang_getTranslationUnitCursor( tu );
-            clang_visitChildren( cursor, VisitTranslationUnit, &m_context );
+            case CXError_Failure:
+            m_context.LogError( "Clang Unknown failure" );
+            break;
+
+            case CXError_Crashed:
+            m_context.LogError( "Clang crashed" );
+            break;
+
+            case CXError_InvalidArguments:
+            m_context.LogError( "Clang Invalid arguments" );
+            break;
+
+            case CXError_ASTReadError:
+            m_context.LogError( "Clang AST read error" );
+            break;
+
+            default:
+            break;
         }
-        else
+    }
+
+    //-------------------------------------------------------------------------
+
+    bool ClangParser::Parse( TVector<HeaderInfo*> const& headers, Pass pass )
+    {
+        m_context.m_detectDevOnlyTypesAndProperties = ( pass == NoDevToolsPass );
+        m_totalParsingTime = 0;
+        m_totalVisitingTime = 0;
+        m_preambleTime = 0;
+        m_projectTimings.clear();
+
+        // Create a translation unit per project, the headers are supplied grouped by project in dependency order
+        //-------------------------------------------------------------------------
+
+        TVector<ProjectTranslationUnit> translationUnits;
+        for ( HeaderInfo const* pHeader : headers )
         {
-            switch ( result )
+            // Exclude dev tools as well as all headers that declare the same types with and without dev tools
+            if ( pass == NoDevToolsPass && !pHeader->RequiresNoDevToolsPass() )
+            {
+                continue;
+            }
+
+            if ( translationUnits.empty() || translationUnits.back().m_headers.back()->m_projectID != pHeader->m_projectID )
             {
-                case CXError_Failure:
-                m_context.LogError( "Clang Unknown failure" );
-                break;
+                ProjectTranslationUnit& translationUnit = translationUnits.emplace_back();
+                for ( auto const& prj : m_context.m_pSolution->m_projects )
+                {
+                    if ( prj.m_ID == pHeader->m_projectID )
+                    {
+                        translationUnit.m_projectName = prj.m_name;
+                        break;
+                    }
+                }
+            }
+
+            translationUnits.back().m_headers.emplace_back( pHeader );
+        }
+
+        if ( translationUnits.empty() )
+        {
+            return true;
+        }
+
+        // Clang args
+        //-------------------------------------------------------------------------
+
+        TVector<String> clangArgStorage;
+        if ( !CreateClangArgs( pass, clangArgStorage ) )
+        {
+            return false;
+        }
 
-                case CXError_Crashed:
-                m_context.LogError( "Clang crashed" );
-                break;
+        TVector<char const*> clangArgs;
+        for ( auto const& arg : clangArgStorage )
+        {
+            clangArgs.emplace_back( arg.c_str() );
+        }
 
-                case CXError_InvalidArguments:
-                m_context.LogError( "Clang Invalid arguments" );
-                break;
+        // Precompile the common third party headers, if this fails we just parse each translation unit without it
+        FileSystem::Path const preamblePath = CreatePrecompiledPreamble( pass, clangArgs );
+        if ( preamblePath.IsValid() )
+        {
+            clangArgs.emplace_back( "-include-pch" );
+            clangArgs.emplace_back( preamblePath.c_str() );
+        }
+
+        // Create the per-project header files
+        //-------------------------------------------------------------------------
 
-                case CXError_ASTReadError:
-                m_context.LogError( "Clang AST read error" );
-                break;
+        for ( auto& translationUnit : translationUnits )
+        {
+            String includeStr;
+            for ( HeaderInfo const* pHeader : translationUnit.m_headers )
+            {
+                includeStr += "#include \"" + pHeader->m_filePath.GetString() + "\"\n";
+            }
+
+            translationUnit.m_headerPath = m_reflectionDataPath + String( String::CtorSprintf(), "Reflector_%s.h", translationUnit.m_projectName.c_str() );
+            if ( !WriteHeaderFile( translationUnit.m_headerPath, includeStr ) )
+            {
+                m_context.LogError( "Failed to write translation unit header: %s", translationUnit.m_headerPath.c_str() );
+                return false;
             }
         }
-        clang_disposeIndex( idx );
 
+        // Parse all translation units in parallel
         //-------------------------------------------------------------------------
 
-        if ( !m_context.HasErrorOccured() )
         {
-            m_context.CheckForOrphanedReflectionMacros();
+            ScopedTimer<PlatformClock> timer( m_totalParsingTime );
+
+            bool const excludeDeclarationsFromPreamble = preamblePath.IsValid();
+            uint32_t const clangOptions = CXTranslationUnit_DetailedPreprocessingRecord | CXTranslationUnit_SkipFunctionBodies | CXTranslationUnit_IncludeBriefCommentsInCodeCompletion;
+
+            auto ParseTranslationUnits = [&translationUnits, &clangArgs, excludeDeclarationsFromPreamble, clangOptions] ( TaskSetPartition range, uint32_t threadnum )
+            {
+                for ( uint32_t i = range.start; i < range.end; i++ )
+                {
+                    ProjectTranslationUnit& translationUnit = translationUnits[i];
+                    ScopedTimer<PlatformClock> translationUnitTimer( translationUnit.m_parsingTime );
+                    translationUnit.m_index = clang_createIndex( excludeDeclarationsFromPreamble ? 1 : 0, 1 );
+                    translationUnit.m_result = clang_parseTranslationUnit2( translationUnit.m_index, translationUnit.m_headerPath.c_str(), clangArgs.data(), (int32_t) clangArgs.size(), 0, 0, clangOptions, &translationUnit.m_tu );
+                }
+            };
+
+            AsyncTask parseTask( (uint32_t) translationUnits.size(), ParseTranslationUnits );
+            m_pTaskSystem->ScheduleTask( &parseTask );
+            m_pTaskSystem->WaitForTask( &parseTask );
         }
 
-        // If we have an error from the parser, prepend the header to it
-        if ( m_context.HasErrorOccured() )
+        // Visit the translation units in project dependency order, since types can only be registered once their parents are
+        //-------------------------------------------------------------------------
+
+        for ( auto& translationUnit : translationUnits )
         {
-            m_context.LogError( "\n%s", m_context.GetErrorMessage() );
+            bool const shouldVisit = !m_context.HasErrorOccured();
+            if ( shouldVisit )
+            {
+                ProjectTiming& timing = m_projectTimings.emplace_back();
+                timing.m_projectName = translationUnit.m_projectName;
+                timing.m_numHeaders = (int32_t) translationUnit.m_headers.size();
+                timing.m_parsingTime = translationUnit.m_parsingTime;
+
+                m_context.m_headersToVisit.clear();
+                for ( HeaderInfo const* pHeader : translationUnit.m_headers )
+                {
+                    m_context.m_headersToVisit.emplace_back( pHeader->m_ID, pHeader );
+                }
+
+                m_context.Reset( &translationUnit.m_tu );
+
+                if ( translationUnit.m_result == CXError_Success )
+                {
+                    {
+                        ScopedTimer<PlatformClock> timer( timing.m_visitingTime );
+                        auto cursor = clang_getTranslationUnitCursor( translationUnit.m_tu );
+                        clang_visitChildren( cursor, VisitTranslationUnit, &m_context );
+                    }
+                    m_totalVisitingTime += timing.m_visitingTime;
+
+                    if ( !m_context.HasErrorOccured() )
+                    {
+                        m_context.CheckForOrphanedReflectionMacros();
+                    }
+
+                    // Headers without any dev tools conditionals are not reparsed in the second pass, so flag their types now
+                    if ( pass == DevToolsPass && !m_context.HasErrorOccured() )
+                    {
+                        for ( HeaderInfo const* pHeader : translationUnit.m_headers )
+                        {
+                            if ( !pHeader->IsInToolsLayer() && !pHeader->RequiresNoDevToolsPass() )
+                            {
+                                m_context.m_pDatabase->ClearDevOnlyFlagsForHeader( pHeader->m_ID );
+                            }
+                        }
+                    }
+                }
+                else
+                {
+                    LogClangError( translationUnit.m_result );
+                }
+
+                // If we have an error from the parser, prepend the project to it
+                if ( m_context.HasErrorOccured() )
+                {
+                    m_context.LogError( "%s:\n%s", translationUnit.m_projectName.c_str(), m_context.GetErrorMessage() );
+                }
+            }
+
+            //-------------------------------------------------------------------------
+
+            if ( translationUnit.m_result == CXError_Success )
+            {
+                clang_disposeTranslationUnit( translationUnit.m_tu );
+            }
+
+            clang_disposeIndex( translationUnit.m_index );
         }
 
         return !m_context.HasErrorOccured();
@@ -3,6 +3,15 @@
 #include "ClangParserContext.h"
 #include "Base/Time/Time.h"
 
+//-------------------------------------------------------------------------
+// Clang Parser
+//-------------------------------------------------------------------------
+// Each project with headers to reflect gets its own translation unit. All translation units for a pass are parsed in parallel
+// (sharing a precompiled preamble of common third party headers) and are then visited serially in project dependency order,
+// since visiting a project's types requires the types of all its dependencies to already be registered in the database.
+
+namespace EE { class TaskSystem; }
+
 //-------------------------------------------------------------------------
 
 namespace EE::TypeSystem::Reflection
@@ -17,21 +26,44 @@ namespace EE::TypeSystem::Reflection
             NoDevToolsPass
         };
 
+        struct ProjectTiming
+        {
+            String                          m_projectName;
+            int32_t                         m_numHeaders = 0;
+            Milliseconds                    m_parsingTime = 0;
+            Milliseconds                    m_visitingTime = 0;
+        };
+
     public:
 
-        ClangParser( SolutionInfo* pSolution, ReflectionDatabase* pDatabase, FileSystem::Path const& reflectionDataPath );
+        ClangParser( SolutionInfo* pSolution, ReflectionDatabase* pDatabase, FileSystem::Path const& reflectionDataPath, TaskSystem* pTaskSystem );
 
         inline Milliseconds GetParsingTime() const { return m_totalParsingTime; }
         inline Milliseconds GetVisitingTime() const { return m_totalVisitingTime; }
+        inline Milliseconds GetPreambleTime() const { return m_preambleTime; }
+        inline TVector<ProjectTiming> const& GetProjectTimings() const { return m_projectTimings; }
 
         bool Parse( TVector<HeaderInfo*> const& headers, Pass pass );
         String GetErrorMessage() const { return m_context.GetErrorMessage(); }
 
+    private:
+
+        // Build the clang args for the specified pass, returns false if the include paths are invalid
+        bool CreateClangArgs( Pass pass, TVector<String>& outArgs ) const;
+
+        // Try to create the precompiled preamble for the specified pass, returns an empty path if this fails
+        FileSystem::Path CreatePrecompiledPreamble( Pass pass, TVector<char const*> const& clangArgs );
+
+        void LogClangError( CXErrorCode result );
+
     private:
 
         ClangParserContext                  m_context;
+        TaskSystem*                         m_pTaskSystem = nullptr;
         Milliseconds                        m_totalParsingTime;
         Milliseconds                        m_totalVisitingTime;
+        Milliseconds                        m_preambleTime;
         FileSystem::Path                    m_reflectionDataPath;
+        TVector<ProjectTiming>              m_projectTimings;
     };
-}
+}
\ No newline at end of file
@@ -334,6 +334,21 @@ namespace EE::TypeSystem::Reflection
         }
     }
 
+    void ReflectionDatabase::ClearDevOnlyFlagsForHeader( HeaderID headerID )
+    {
+        for ( auto& type : m_reflectedTypes )
+        {
+            if ( type.m_headerID == headerID )
+            {
+                type.m_isDevOnly = false;
+                for ( auto& property : type.m_properties )
+                {
+                    property.m_isDevOnly = false;
+                }
+            }
+        }
+    }
+
     ReflectedProperty const* ReflectionDatabase::GetPropertyTypeDescriptor( TypeID typeID, PropertyPath const& pathID ) const
     {
         ReflectedProperty const* pResolvedPropertyTypeDesc = nullptr;
@@ -53,6 +53,9 @@ namespace EE::TypeSystem::Reflection
         void GetAllTypesForProject( ProjectID projectID, TVector<ReflectedType>& types ) const;
         void RegisterType( ReflectedType const* pType, bool onlyUpdateDevFlag );
 
+        // Flag all types (and their properties) declared in the specified header as available without dev tools
+        void ClearDevOnlyFlagsForHeader( HeaderID headerID );
+
         // Property functions
         //-------------------------------------------------------------------------
 
@@ -29,6 +29,12 @@ namespace EE::TypeSystem::Reflection
             return Utils::IsFileUnderToolsProject( m_filePath );
         }
 
+        // Only runtime headers that have dev tools conditionals can declare different types/properties without dev tools
+        inline bool RequiresNoDevToolsPass() const
+        {
+            return !IsInToolsLayer() && m_hasDevToolsConditionals;
+        }
+
         inline FileSystem::Path GetAutogeneratedTypeInfoFileName( FileSystem::Path const& directoryPath ) const
         {
             EE_ASSERT( directoryPath.IsDirectoryPath() );
@@ -53,6 +59,7 @@ namespace EE::TypeSystem::Reflection
         uint64_t                        m_timestamp = 0;
         uint64_t                        m_checksum = 0;
         TVector<String>                 m_fileContents;
+        bool                            m_hasDevToolsConditionals = true;
     };
 
     //-------------------------------------------------------------------------
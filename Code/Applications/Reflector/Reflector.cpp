@@ -7,6 +7,8 @@
 
 #include "Base/FileSystem/FileSystemUtils.h"
 #include "Base/Time/Timers.h"
+#include "Base/Threading/TaskSystem.h"
+#include "Base/Threading/Threading.h"
 #include "Base/Utils/TopologicalSort.h"
 
 #include "Base/Types/Arrays.h"
@@ -295,6 +297,7 @@ namespace EE::TypeSystem::Reflection
                         headerInfo.m_filePath = headerFileFullPath;
                         headerInfo.m_timestamp = FileSystem::GetFileModifiedTime( headerFileFullPath );
                         headerInfo.m_fileContents.swap( headerFileContents );
+                        headerInfo.m_hasDevToolsConditionals = Utils::HasDevToolsConditionals( headerInfo.m_fileContents );
 
                         // Add to registered timestamp cache, use in up to date checks
                         m_registeredHeaderTimestamps.push_back( HeaderTimestamp( headerInfo.m_ID, headerInfo.m_timestamp ) );
@@ -691,30 +694,46 @@ namespace EE::TypeSystem::Reflection
 
         if ( !headersToParse.empty() )
         {
-            std::cout << " * Reflecting C++ Code - First Pass (With Dev Tools) - ";
+            // Project translation units are parsed in parallel
+            TaskSystem taskSystem( Threading::GetProcessorInfo().m_numLogicalCores );
+            taskSystem.Initialize();
 
-            // Parse headers
-            ClangParser clangParser( &m_solution, &m_database, m_reflectionDataPath );
-            if ( !clangParser.Parse( headersToParse, ClangParser::DevToolsPass ) )
+            ClangParser clangParser( &m_solution, &m_database, m_reflectionDataPath, &taskSystem );
+
+            auto ParseHeaders = [&clangParser, &headersToParse] ( ClangParser::Pass pass, char const* pPassName )
             {
-                std::cout << "Error occurred!\n\n  Error: " << clangParser.GetErrorMessage().c_str() << std::endl;
-                return false;
-            }
-            Milliseconds clangParsingTime = clangParser.GetParsingTime();
-            Milliseconds clangVisitingTime = clangParser.GetVisitingTime();
-            std::cout << "Complete! ( P:" << (float) clangParsingTime << "ms, V:" << (float) clangVisitingTime << "ms )" << std::endl;
+                std::cout << " * Reflecting C++ Code - " << pPassName << " - ";
+
+                if ( !clangParser.Parse( headersToParse, pass ) )
+                {
+                    std::cout << "Error occurred!\n\n  Error: " << clangParser.GetErrorMessage().c_str() << std::endl;
+                    return false;
+                }
+
+                std::cout << "Complete! ( P:" << (float) clangParser.GetParsingTime() << "ms, V:" << (float) clangParser.GetVisitingTime() << "ms )" << std::endl;
+
+                // Per-project breakdown, the projects are parsed in parallel so their parsing times overlap
+                if ( !clangParser.GetProjectTimings().empty() )
+                {
+                    std::cout << "    - Preamble ( " << (float) clangParser.GetPreambleTime() << "ms )" << std::endl;
+                }
+
+                for ( auto const& timing : clangParser.GetProjectTimings() )
+                {
+                    std::cout << "    - " << timing.m_projectName.c_str() << " - " << timing.m_numHeaders << " header(s) ( P:" << (float) timing.m_parsingTime << "ms, V:" << (float) timing.m_visitingTime << "ms )" << std::endl;
+                }
+
+                return true;
+            };
 
-            std::cout << " * Reflecting C++ Code - Second Pass (No Dev Tools) - ";
+            // The second pass only needs to parse the runtime headers that have dev tools conditionals to detect dev-only types
+            bool const parsingSucceeded = ParseHeaders( ClangParser::DevToolsPass, "First Pass (With Dev Tools)" ) && ParseHeaders( ClangParser::NoDevToolsPass, "Second Pass (No Dev Tools)" );
+            taskSystem.Shutdown();
 
-            // Second parse to detect dev-only types
-            if ( !clangParser.Parse( headersToParse, ClangParser::NoDevToolsPass ) )
+            if ( !parsingSucceeded )
             {
-                std::cout << "Error occurred!\n\n  Error: " << clangParser.GetErrorMessage().c_str() << std::endl;
                 return false;
             }
-            clangParsingTime = clangParser.GetParsingTime();
-            clangVisitingTime = clangParser.GetVisitingTime();
-            std::cout << "Complete! ( P:" << (float) clangParsingTime << "ms, V:" << (float) clangVisitingTime << "ms )" << std::endl;
 
             // Finalize database data
             m_database.UpdateProjectList( m_solution.m_projects );
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "Base/Types/String.h"
+#include "Base/Types/Arrays.h"
 #include "Base/FileSystem/FileSystemPath.h"
 
 //-------------------------------------------------------------------------
@@ -93,6 +94,37 @@ namespace EE::TypeSystem::Reflection
             "External\\NavPower\\include\\"
             #endif
         };
+
+        // Third party headers that are precompiled once per pass and then shared by all the project translation units
+        // The contents of the preamble are never visited, so these must never include any solution headers with reflection macros
+        char const* const g_preambleHeaders[] =
+        {
+            "type_traits",
+            "limits",
+            "utility",
+            "cstring",
+            "cstdio",
+            "math.h",
+            "EASTL/vector.h",
+            "EASTL/fixed_vector.h",
+            "EASTL/string.h",
+            "EASTL/fixed_string.h",
+            "EASTL/hash_map.h",
+            "EASTL/fixed_hash_map.h",
+            "EASTL/map.h",
+            "EASTL/set.h",
+            "EASTL/functional.h",
+            "EASTL/array.h",
+            "EASTL/sort.h",
+        };
+
+        // Headers that dont reference any of these macros declare the same types and properties with and without dev tools,
+        // so they dont need to be reparsed in the no dev tools pass
+        char const* const g_devToolsConditionalMacros[] =
+        {
+            "EE_DEVELOPMENT_TOOLS",
+            "EE_SHIPPING",
+        };
     }
 
     //-------------------------------------------------------------------------
@@ -115,5 +147,21 @@ namespace EE::TypeSystem::Reflection
 
             return false;
         }
+
+        inline bool HasDevToolsConditionals( TVector<String> const& fileContents )
+        {
+            for ( auto const& line : fileContents )
+            {
+                for ( auto pMacro : Settings::g_devToolsConditionalMacros )
+                {
+                    if ( line.find( pMacro ) != String::npos )
+                    {
+                        return true;
+                    }
+                }
+            }
+
+            return false;
+        }
     }
 }
\ No newline at end of file
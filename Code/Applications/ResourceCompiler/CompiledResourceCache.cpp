@@ -0,0 +1,93 @@
+#include "CompiledResourceCache.h"
+#include "Base/FileSystem/FileSystem.h"
+#include "Base/Types/UUID.h"
+#include <filesystem>
+
+//-------------------------------------------------------------------------
+
+namespace EE::Resource
+{
+    void CompiledResourceCache::Initialize( FileSystem::Path const& cacheDirectoryPath )
+    {
+        m_cacheDirectoryPath.Clear();
+
+        if ( cacheDirectoryPath.IsValid() )
+        {
+            EE_ASSERT( cacheDirectoryPath.IsDirectoryPath() );
+            if ( cacheDirectoryPath.EnsureDirectoryExists() )
+            {
+                m_cacheDirectoryPath = cacheDirectoryPath;
+            }
+            else
+            {
+                EE_LOG_WARNING( "Resource", "Compiled Resource Cache", "Failed to create cache directory, the cache is disabled: %s", cacheDirectoryPath.c_str() );
+            }
+        }
+    }
+
+    FileSystem::Path CompiledResourceCache::GetEntryPath( ResourceID const& resourceID, uint64_t cacheKey ) const
+    {
+        EE_ASSERT( IsEnabled() );
+
+        InlineString entryPath;
+        entryPath.sprintf( "%s/%016llx", resourceID.GetResourceTypeID().ToString().c_str(), cacheKey );
+        return m_cacheDirectoryPath + entryPath.c_str();
+    }
+
+    //-------------------------------------------------------------------------
+
+    bool CompiledResourceCache::TryRestore( ResourceID const& resourceID, uint64_t cacheKey, FileSystem::Path const& outputFilePath ) const
+    {
+        EE_ASSERT( resourceID.IsValid() && outputFilePath.IsFilePath() );
+
+        FileSystem::Path const entryPath = GetEntryPath( resourceID, cacheKey );
+        if ( !FileSystem::Exists( entryPath ) )
+        {
+            return false;
+        }
+
+        std::error_code ec;
+        std::filesystem::copy_file( entryPath.c_str(), outputFilePath.c_str(), std::filesystem::copy_options::overwrite_existing, ec );
+        if ( ec )
+        {
+            EE_LOG_WARNING( "Resource", "Compiled Resource Cache", "Failed to restore '%s' from cache: %s", resourceID.c_str(), ec.message().c_str() );
+            return false;
+        }
+
+        return true;
+    }
+
+    bool CompiledResourceCache::Store( ResourceID const& resourceID, uint64_t cacheKey, FileSystem::Path const& compiledFilePath ) const
+    {
+        EE_ASSERT( resourceID.IsValid() && compiledFilePath.IsFilePath() );
+
+        FileSystem::Path const entryPath = GetEntryPath( resourceID, cacheKey );
+        if ( FileSystem::Exists( entryPath ) )
+        {
+            return true;
+        }
+
+        entryPath.EnsureDirectoryExists();
+
+        // Write to a temporary file first so that other readers of the cache never see a partially written entry
+        InlineString tempFilePathStr;
+        tempFilePathStr.sprintf( "%s.%s.tmp", entryPath.c_str(), UUID::GenerateID().ToString().c_str() );
+        FileSystem::Path const tempFilePath( tempFilePathStr.c_str() );
+
+        std::error_code ec;
+        std::filesystem::copy_file( compiledFilePath.c_str(), tempFilePath.c_str(), std::filesystem::copy_options::overwrite_existing, ec );
+        if ( !ec )
+        {
+            std::filesystem::rename( tempFilePath.c_str(), entryPath.c_str(), ec );
+        }
+
+        if ( ec )
+        {
+            EE_LOG_WARNING( "Resource", "Compiled Resource Cache", "Failed to store '%s' in cache: %s", resourceID.c_str(), ec.message().c_str() );
+            FileSystem::EraseFile( tempFilePath );
+            return false;
+        }
+
+        return true;
+    }
+}
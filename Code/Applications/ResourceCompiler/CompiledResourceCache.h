@@ -0,0 +1,39 @@
+#pragma once
+
+#include "Base/Resource/ResourceID.h"
+#include "Base/FileSystem/FileSystemPath.h"
+
+//-------------------------------------------------------------------------
+// Content addressed cache of compiled resources
+//-------------------------------------------------------------------------
+// Compiled outputs are stored under a key derived from the contents of all the source files used to compile them.
+// The cache is a plain directory ( <cache>/<resource type>/<key> ) with no index, entries are written to a temporary
+// file first and then renamed into place, so the directory can be safely shared between machines.
+//-------------------------------------------------------------------------
+
+namespace EE::Resource
+{
+    class CompiledResourceCache final
+    {
+    public:
+
+        // An invalid path disables the cache
+        void Initialize( FileSystem::Path const& cacheDirectoryPath );
+
+        inline bool IsEnabled() const { return m_cacheDirectoryPath.IsValid(); }
+
+        // Copy the cached output for this key to the output path, returns false if there is no cached entry
+        bool TryRestore( ResourceID const& resourceID, uint64_t cacheKey, FileSystem::Path const& outputFilePath ) const;
+
+        // Copy a compiled output into the cache
+        bool Store( ResourceID const& resourceID, uint64_t cacheKey, FileSystem::Path const& compiledFilePath ) const;
+
+    private:
+
+        FileSystem::Path GetEntryPath( ResourceID const& resourceID, uint64_t cacheKey ) const;
+
+    private:
+
+        FileSystem::Path                    m_cacheDirectoryPath;
+    };
+}
@@ -32,7 +32,7 @@ namespace EE::Resource
             return false;
         }
 
-        CreateTables();
+        UpdateTables();
 
         return true;
     }
@@ -51,11 +51,54 @@ namespace EE::Resource
 
     //-------------------------------------------------------------------------
 
+    bool CompiledResourceDatabase::UpdateTables()
+    {
+        EE_ASSERT( m_pDatabase != nullptr );
+
+        // Read the version of the existing tables
+        //-------------------------------------------------------------------------
+
+        int32_t databaseVersion = 0;
+
+        sqlite3_stmt* pStatement = nullptr;
+        int32_t result = sqlite3_prepare_v2( m_pDatabase, "PRAGMA user_version;", -1, &pStatement, nullptr );
+        if ( result == SQLITE_OK )
+        {
+            if ( sqlite3_step( pStatement ) == SQLITE_ROW )
+            {
+                databaseVersion = sqlite3_column_int( pStatement, 0 );
+            }
+
+            sqlite3_finalize( pStatement );
+        }
+
+        // Recreate outdated tables, this only loses the up-to-date information so resources will be recompiled
+        //-------------------------------------------------------------------------
+
+        if ( databaseVersion != s_version )
+        {
+            if ( !DropTables() )
+            {
+                return false;
+            }
+
+            sqlite3_snprintf( s_defaultStatementBufferSize, m_statementBuffer, "PRAGMA user_version = %d;", s_version );
+            result = sqlite3_exec( m_pDatabase, m_statementBuffer, nullptr, nullptr, nullptr );
+            if ( result != SQLITE_OK )
+            {
+                m_errorMessage = String( sqlite3_errstr( result ) ) + " (" + sqlite3_errmsg( m_pDatabase ) + ")";
+                return false;
+            }
+        }
+
+        return CreateTables();
+    }
+
     bool CompiledResourceDatabase::CreateTables()
     {
         EE_ASSERT( m_pDatabase != nullptr );
 
-        constexpr char const* const statement = "CREATE TABLE IF NOT EXISTS `CompiledResources` ( `ResourcePath` TEXT UNIQUE,`ResourceType` INTEGER,`CompilerVersion` INTEGER,`FileTimestamp` INTEGER, `SourceTimestampHash` INTEGER, PRIMARY KEY( ResourcePath, ResourceType ) );";
+        constexpr char const* const statement = "CREATE TABLE IF NOT EXISTS `CompiledResources` ( `ResourcePath` TEXT UNIQUE,`ResourceType` INTEGER,`CompilerVersion` INTEGER,`FileTimestamp` INTEGER, `SourceTimestampHash` INTEGER, `SourceContentHash` INTEGER, PRIMARY KEY( ResourcePath, ResourceType ) );";
         sqlite3_snprintf( s_defaultStatementBufferSize, m_statementBuffer, statement );
         int32_t result = sqlite3_exec( m_pDatabase, m_statementBuffer, nullptr, nullptr, nullptr );
 
@@ -119,6 +162,7 @@ namespace EE::Resource
             outRecord.m_compilerVersion = sqlite3_column_int( pStatement, 2 );
             outRecord.m_fileTimestamp = sqlite3_column_int64( pStatement, 3 );
             outRecord.m_sourceTimestampHash = sqlite3_column_int64( pStatement, 4 );
+            outRecord.m_sourceContentHash = sqlite3_column_int64( pStatement, 5 );
         }
 
         result = sqlite3_finalize( pStatement );
@@ -135,8 +179,9 @@ namespace EE::Resource
     {
         EE_ASSERT( IsConnected() );
 
-        constexpr char const* const statement = "BEGIN TRANSACTION;INSERT OR REPLACE INTO `CompiledResources` ( `ResourcePath`, `ResourceType`, `CompilerVersion`, `FileTimestamp`, `SourceTimestampHash` ) VALUES ( \"%s\", %d, %d, %llu, %llu );END TRANSACTION;";
-        sqlite3_snprintf( s_defaultStatementBufferSize, m_statementBuffer, statement, record.m_resourceID.GetResourcePath().c_str(), (uint32_t)record.m_resourceID.GetResourceTypeID(), record.m_compilerVersion, record.m_fileTimestamp, record.m_sourceTimestampHash );
+        // Content hashes use the full 64 bits so need to be written as signed integers, sqlite would convert larger values to floats
+        constexpr char const* const statement = "BEGIN TRANSACTION;INSERT OR REPLACE INTO `CompiledResources` ( `ResourcePath`, `ResourceType`, `CompilerVersion`, `FileTimestamp`, `SourceTimestampHash`, `SourceContentHash` ) VALUES ( \"%s\", %d, %d, %llu, %llu, %lld );END TRANSACTION;";
+        sqlite3_snprintf( s_defaultStatementBufferSize, m_statementBuffer, statement, record.m_resourceID.GetResourcePath().c_str(), (uint32_t)record.m_resourceID.GetResourceTypeID(), record.m_compilerVersion, record.m_fileTimestamp, record.m_sourceTimestampHash, (int64_t) record.m_sourceContentHash );
         int32_t result = sqlite3_exec( m_pDatabase, m_statementBuffer, nullptr, nullptr, nullptr );
 
         if ( result != SQLITE_OK )
@@ -20,6 +20,7 @@ namespace EE::Resource
         int32_t               m_compilerVersion = -1;         // The compiler version used for the last compilation
         uint64_t              m_fileTimestamp = 0;            // The timestamp of the resource file
         uint64_t              m_sourceTimestampHash = 0;      // The timestamp hash of any source assets used in the compilation
+        uint64_t              m_sourceContentHash = 0;        // The content hash of any source assets used in the compilation, zero if the resource cant be content hashed
     };
 
     //-------------------------------------------------------------------------
@@ -27,6 +28,7 @@ namespace EE::Resource
     class CompiledResourceDatabase final
     {
         constexpr static uint32_t const s_defaultStatementBufferSize = 8096;
+        constexpr static int32_t const s_version = 1; // Bump this whenever the table layout changes, outdated tables are recreated
 
     public:
 
@@ -51,6 +53,8 @@ namespace EE::Resource
 
         bool CreateTables();
 
+        bool UpdateTables();
+
         bool DropTables();
 
     private:
@@ -1,5 +1,6 @@
 #include "ResourceCompilerApplication.h"
 #include "CompiledResourceDatabase.h"
+#include "Base/Encoding/Hash.h"
 #include "_AutoGenerated/ToolsTypeRegistration.h"
 #include "EngineTools/Resource/ResourceCompilerRegistry.h"
 #include "Base/Application/ApplicationGlobalState.h"
@@ -32,12 +33,21 @@ namespace EE
             cmdParser.set_optional<bool>( "debug", "debug", false, "Trigger debug break before execution." );
             cmdParser.set_optional<bool>( "force", "force", false, "Force compilation" );
             cmdParser.set_optional<bool>( "package", "package", false, "Compile resource for packaged build." );
+            cmdParser.set_optional<bool>( "worker", "worker", false, "Run as a persistent compiler worker, requests are read from stdin." );
 
             if ( cmdParser.run() )
             {
                 m_triggerDebugBreak = cmdParser.get<bool>( "debug" );
                 m_isForcedCompilation = cmdParser.get<bool>( "force" );
                 m_isForPackagedBuild = cmdParser.get<bool>( "package" );
+                m_isWorker = cmdParser.get<bool>( "worker" );
+
+                // Workers receive their compile requests once they are running
+                if ( m_isWorker )
+                {
+                    m_isValid = true;
+                    return;
+                }
 
                 // Get compile argument
                 ResourcePath const resourcePath( cmdParser.get<std::string>( "compile" ).c_str() );
@@ -67,6 +77,7 @@ namespace EE
         bool                m_triggerDebugBreak = false;
         bool                m_isForPackagedBuild = false;
         bool                m_isForcedCompilation = false;
+        bool                m_isWorker = false;
         bool                m_isValid = false;
     };
 }
@@ -86,6 +97,7 @@ namespace EE::Resource
         m_timestamp = m_combinedHash = 0;
         m_sourceExists = m_targetExists = false;
         m_errorOccurredReadingDependencies = false;
+        m_forceRecompile = false;
         m_compilerVersion = -1;
         DestroyDependencies();
     }
@@ -157,21 +169,23 @@ namespace EE::Resource
 
     //-------------------------------------------------------------------------
 
-    ResourceCompilerApplication::ResourceCompilerApplication( CommandLineArgumentParser& argParser, ResourceSettings const& settings )
-        : m_compileContext( settings.m_rawResourcePath, argParser.m_isForPackagedBuild ? settings.m_packagedBuildCompiledResourcePath : settings.m_compiledResourcePath, argParser.m_resourceID, argParser.m_isForPackagedBuild )
-        , m_forceCompilation( argParser.m_isForcedCompilation )
+    ResourceCompilerApplication::ResourceCompilerApplication( ResourceSettings const& settings )
+        : m_rawResourcePath( settings.m_rawResourcePath )
+        , m_compiledResourcePath( settings.m_compiledResourcePath )
+        , m_packagedBuildCompiledResourcePath( settings.m_packagedBuildCompiledResourcePath )
     {
         AutoGenerated::Tools::RegisterTypes( m_typeRegistry );
         m_pCompilerRegistry = EE::New<CompilerRegistry>( m_typeRegistry, settings.m_rawResourcePath );
 
         //-------------------------------------------------------------------------
 
-        m_compileContext.m_rawResourceDirectoryPath.EnsureDirectoryExists();
-        m_compileContext.m_compiledResourceDirectoryPath.EnsureDirectoryExists();
+        m_rawResourcePath.EnsureDirectoryExists();
+        m_compiledResourcePath.EnsureDirectoryExists();
 
         //-------------------------------------------------------------------------
 
         m_compiledResourceDB.Connect( settings.m_compiledResourceDatabasePath );
+        m_compiledResourceCache.Initialize( settings.m_compiledResourceCachePath );
     }
 
     ResourceCompilerApplication::~ResourceCompilerApplication()
@@ -196,7 +210,7 @@ namespace EE::Resource
         return true;
     }
 
-    CompilationResult ResourceCompilerApplication::Run()
+    CompilationResult ResourceCompilerApplication::Compile( ResourceID const& resourceID, bool isForPackagedBuild, bool forceCompilation )
     {
         if ( !m_compiledResourceDB.IsConnected() )
         {
@@ -205,16 +219,17 @@ namespace EE::Resource
         }
 
         // Try create compilation context
-        if ( !m_compileContext.IsValid() )
+        CompileContext compileContext( m_rawResourcePath, isForPackagedBuild ? m_packagedBuildCompiledResourcePath : m_compiledResourcePath, resourceID, isForPackagedBuild );
+        if ( !compileContext.IsValid() )
         {
             return Resource::CompilationResult::Failure;
         }
 
         // Try find compiler
-        auto pCompiler = m_pCompilerRegistry->GetCompilerForResourceType( m_compileContext.m_resourceID.GetResourceTypeID() );
+        auto pCompiler = m_pCompilerRegistry->GetCompilerForResourceType( compileContext.m_resourceID.GetResourceTypeID() );
         if ( pCompiler == nullptr )
         {
-            EE_LOG_ERROR( "Resource", "Resource Compiler", "Cant find appropriate resource compiler for type: %u", m_compileContext.m_resourceID.GetResourceTypeID() );
+            EE_LOG_ERROR( "Resource", "Resource Compiler", "Cant find appropriate resource compiler for type: %u", compileContext.m_resourceID.GetResourceTypeID() );
             return Resource::CompilationResult::Failure;
         }
 
@@ -222,23 +237,23 @@ namespace EE::Resource
         //-------------------------------------------------------------------------
 
         // Validate input path
-        if ( pCompiler->IsInputFileRequired() && !FileSystem::Exists( m_compileContext.m_inputFilePath ) )
+        if ( pCompiler->IsInputFileRequired() && !FileSystem::Exists( compileContext.m_inputFilePath ) )
         {
-            EE_LOG_ERROR( "Resource", "Resource Compiler", "Source file for data path ('%s') does not exist: '%s'\n", m_compileContext.m_rawResourceDirectoryPath.c_str(), m_compileContext.m_inputFilePath.c_str() );
+            EE_LOG_ERROR( "Resource", "Resource Compiler", "Source file for data path ('%s') does not exist: '%s'\n", compileContext.m_rawResourceDirectoryPath.c_str(), compileContext.m_inputFilePath.c_str() );
             return Resource::CompilationResult::Failure;
         }
 
         // Try create target directory
-        if ( !m_compileContext.m_outputFilePath.EnsureDirectoryExists() )
+        if ( !compileContext.m_outputFilePath.EnsureDirectoryExists() )
         {
-            EE_LOG_ERROR( "Resource", "Resource Compiler", "Error: Destination path (%s) doesnt exist!", m_compileContext.m_outputFilePath.GetParentDirectory().c_str() );
+            EE_LOG_ERROR( "Resource", "Resource Compiler", "Error: Destination path (%s) doesnt exist!", compileContext.m_outputFilePath.GetParentDirectory().c_str() );
             return Resource::CompilationResult::Failure;
         }
 
         // Check that target file isnt read-only
-        if ( FileSystem::Exists( m_compileContext.m_outputFilePath ) && FileSystem::IsFileReadOnly( m_compileContext.m_outputFilePath ) )
+        if ( FileSystem::Exists( compileContext.m_outputFilePath ) && FileSystem::IsFileReadOnly( compileContext.m_outputFilePath ) )
         {
-            EE_LOG_ERROR( "Resource", "Resource Compiler", "Error: Destination file (%s) is read-only!", m_compileContext.m_outputFilePath.GetFullPath().c_str() );
+            EE_LOG_ERROR( "Resource", "Resource Compiler", "Error: Destination file (%s) is read-only!", compileContext.m_outputFilePath.GetFullPath().c_str() );
             return Resource::CompilationResult::Failure;
         }
 
@@ -246,42 +261,163 @@ namespace EE::Resource
         //-------------------------------------------------------------------------
 
         // Check compile dependency and if this resource needs compilation
+        m_errorMessage.clear();
         m_uniqueCompileDependencies.clear();
         m_compileDependencyTreeRoot.Reset();
-        if ( !FillCompileDependencyNode( &m_compileDependencyTreeRoot, m_compileContext.m_resourceID ) )
+        if ( !FillCompileDependencyNode( compileContext, &m_compileDependencyTreeRoot, compileContext.m_resourceID ) )
         {
             EE_LOG_ERROR( "Resource", "Resource Compiler", "Failed to create dependency tree: %s", m_errorMessage.c_str() );
             return Resource::CompilationResult::Failure;
         }
 
         // If we are not forcing the compilation and we're up to date, there's nothing to do
-        if ( m_compileDependencyTreeRoot.IsUpToDate() && !m_forceCompilation )
+        if ( m_compileDependencyTreeRoot.IsUpToDate() && !forceCompilation )
         {
             return Resource::CompilationResult::SuccessUpToDate;
         }
 
-        m_compileContext.m_sourceResourceHash = m_compileDependencyTreeRoot.m_combinedHash;
+        // Content Check
+        //-------------------------------------------------------------------------
+        // Timestamps only tell us that something might have changed, so check the actual contents of the sources before compiling
+
+        Resource::CompiledResourceRecord record;
+        record.m_resourceID = compileContext.m_resourceID;
+        record.m_compilerVersion = m_compileDependencyTreeRoot.m_compilerVersion;
+        record.m_fileTimestamp = m_compileDependencyTreeRoot.m_timestamp;
+        record.m_sourceTimestampHash = m_compileDependencyTreeRoot.m_combinedHash;
+        record.m_sourceContentHash = ShouldCheckCompileDependenciesForResourceType( resourceID ) ? CalculateContentHash( &m_compileDependencyTreeRoot ) : 0;
+
+        bool const hasContentHash = record.m_sourceContentHash != 0;
+        if ( hasContentHash && !forceCompilation )
+        {
+            // The sources were touched but not changed, so just update the record
+            if ( m_compileDependencyTreeRoot.m_targetExists && m_compileDependencyTreeRoot.m_compiledRecord.m_compilerVersion == record.m_compilerVersion && m_compileDependencyTreeRoot.m_compiledRecord.m_sourceContentHash == record.m_sourceContentHash )
+            {
+                m_compiledResourceDB.WriteRecord( record );
+                return Resource::CompilationResult::SuccessUpToDate;
+            }
+
+            // Someone has already compiled these sources
+            uint64_t const cacheKey = GetCompiledResourceCacheKey( record.m_sourceContentHash, isForPackagedBuild );
+            if ( m_compiledResourceCache.IsEnabled() && m_compiledResourceCache.TryRestore( resourceID, cacheKey, compileContext.m_outputFilePath ) )
+            {
+                EE_LOG_INFO( "Resource", "Resource Compiler", "Restored '%s' from the compiled resource cache", resourceID.c_str() );
+                m_compiledResourceDB.WriteRecord( record );
+                return Resource::CompilationResult::Success;
+            }
+        }
+
+        // The content hash is the same on every machine so prefer it, this keeps cached outputs identical to locally compiled ones
+        compileContext.m_sourceResourceHash = hasContentHash ? record.m_sourceContentHash : record.m_sourceTimestampHash;
 
         // Compile
         //-------------------------------------------------------------------------
 
-        Resource::CompilationResult const compilationResult = pCompiler->Compile( m_compileContext );
+        Resource::CompilationResult const compilationResult = pCompiler->Compile( compileContext );
 
         // Update database
         if ( compilationResult == Resource::CompilationResult::Success || compilationResult == Resource::CompilationResult::SuccessWithWarnings )
         {
-            Resource::CompiledResourceRecord record;
-            record.m_resourceID = m_compileContext.m_resourceID;
-            record.m_compilerVersion = m_compileDependencyTreeRoot.m_compilerVersion;
-            record.m_fileTimestamp = m_compileDependencyTreeRoot.m_timestamp;
-            record.m_sourceTimestampHash = m_compileDependencyTreeRoot.m_combinedHash;
             m_compiledResourceDB.WriteRecord( record );
         }
 
+        // Only cache outputs without warnings, otherwise restoring them would hide the warnings
+        if ( compilationResult == Resource::CompilationResult::Success && hasContentHash && m_compiledResourceCache.IsEnabled() )
+        {
+            m_compiledResourceCache.Store( resourceID, GetCompiledResourceCacheKey( record.m_sourceContentHash, isForPackagedBuild ), compileContext.m_outputFilePath );
+        }
+
         return compilationResult;
     }
 
-    bool ResourceCompilerApplication::BuildCompileDependencyTree( ResourceID const& resourceID )
+    int32_t ResourceCompilerApplication::RunWorker()
+    {
+        if ( !m_compiledResourceDB.IsConnected() )
+        {
+            EE_LOG_ERROR( "Resource", "Resource Compiler", "Database connection error: %s", m_compiledResourceDB.GetError().c_str() );
+            return -1;
+        }
+
+        // Process requests until the resource server closes the input stream
+        //-------------------------------------------------------------------------
+
+        std::string requestLine;
+        while ( std::getline( std::cin, requestLine ) )
+        {
+            if ( !requestLine.empty() && requestLine.back() == '\r' )
+            {
+                requestLine.pop_back();
+            }
+
+            CompilationResult result = CompilationResult::Failure;
+
+            // Request format: "<force> <package> <resource path>"
+            ResourcePath const resourcePath( ( requestLine.length() > 4 ) ? requestLine.c_str() + 4 : "" );
+            if ( resourcePath.IsValid() && ResourceID( resourcePath ).IsValid() )
+            {
+                bool const forceCompilation = requestLine[0] == '1';
+                bool const isForPackagedBuild = requestLine[2] == '1';
+                result = Compile( ResourceID( resourcePath ), isForPackagedBuild, forceCompilation );
+            }
+            else
+            {
+                EE_LOG_ERROR( "Resource", "Resource Compiler", "Invalid compile request: %s", requestLine.c_str() );
+            }
+
+            // Signal completion, the server reads all output up to this line as the log for the request
+            // The marker always starts on a new line since the compile output isnt guaranteed to end with one
+            printf( "\n%s %d\n", CompilerWorker::s_resultMarker, (int32_t) result );
+            fflush( stdout );
+        }
+
+        return 0;
+    }
+
+    uint64_t ResourceCompilerApplication::CalculateContentHash( CompileDependencyNode const* pNode ) const
+    {
+        EE_ASSERT( pNode != nullptr );
+
+        // Resources that are always recompiled or that are missing their sources cant be identified by their content
+        if ( !pNode->m_sourceExists || pNode->m_forceRecompile )
+        {
+            return 0;
+        }
+
+        Blob fileData;
+        if ( !FileSystem::LoadFile( pNode->m_sourcePath, fileData ) )
+        {
+            return 0;
+        }
+
+        // Hash the path, the source contents, the compiler version and the content hashes of all dependencies
+        TInlineVector<uint64_t, 8> hashes;
+        hashes.emplace_back( Hash::GetHash64( pNode->m_ID.GetResourcePath().GetString() ) );
+        hashes.emplace_back( Hash::GetHash64( fileData ) );
+        hashes.emplace_back( (uint64_t) pNode->m_compilerVersion );
+
+        for ( auto const pDep : pNode->m_dependencies )
+        {
+            uint64_t const dependencyContentHash = CalculateContentHash( pDep );
+            if ( dependencyContentHash == 0 )
+            {
+                return 0;
+            }
+
+            hashes.emplace_back( dependencyContentHash );
+        }
+
+        uint64_t const contentHash = Hash::GetHash64( hashes.data(), hashes.size() * sizeof( uint64_t ) );
+        return ( contentHash != 0 ) ? contentHash : 1;
+    }
+
+    uint64_t ResourceCompilerApplication::GetCompiledResourceCacheKey( uint64_t sourceContentHash, bool isForPackagedBuild )
+    {
+        // Development and packaged builds can produce different outputs for the same sources
+        uint64_t const keyData[2] = { sourceContentHash, isForPackagedBuild ? 1ull : 0ull };
+        return Hash::GetHash64( keyData, sizeof( keyData ) );
+    }
+
+    bool ResourceCompilerApplication::BuildCompileDependencyTree( CompileContext const& ctx, ResourceID const& resourceID )
     {
         EE_ASSERT( resourceID.IsValid() );
 
@@ -290,7 +426,7 @@ namespace EE::Resource
         m_errorMessage.clear();
         m_uniqueCompileDependencies.clear();
         m_compileDependencyTreeRoot.Reset();
-        return FillCompileDependencyNode( &m_compileDependencyTreeRoot, resourceID );
+        return FillCompileDependencyNode( ctx, &m_compileDependencyTreeRoot, resourceID );
     }
 
     bool ResourceCompilerApplication::TryReadCompileDependencies( FileSystem::Path const& resourceFilePath, TVector<ResourceID>& outDependencies ) const
@@ -310,7 +446,7 @@ namespace EE::Resource
         return true;
     }
 
-    bool ResourceCompilerApplication::FillCompileDependencyNode( CompileDependencyNode* pNode, ResourceID const& resourceID )
+    bool ResourceCompilerApplication::FillCompileDependencyNode( CompileContext const& ctx, CompileDependencyNode* pNode, ResourceID const& resourceID )
     {
         EE_ASSERT( pNode != nullptr );
 
@@ -319,7 +455,7 @@ namespace EE::Resource
 
         pNode->m_ID = resourceID;
 
-        pNode->m_sourcePath = ResourcePath::ToFileSystemPath( m_compileContext.m_rawResourceDirectoryPath, resourceID.GetResourcePath() );
+        pNode->m_sourcePath = ResourcePath::ToFileSystemPath( ctx.m_rawResourceDirectoryPath, resourceID.GetResourcePath() );
         pNode->m_sourceExists = FileSystem::Exists( pNode->m_sourcePath );
         pNode->m_timestamp = pNode->m_sourceExists ? FileSystem::GetFileModifiedTime( pNode->m_sourcePath ) : 0;
 
@@ -331,7 +467,7 @@ namespace EE::Resource
         bool skipDependencyCheck = !isCompilableResource || !ShouldCheckCompileDependenciesForResourceType( resourceID );
         if ( isCompilableResource )
         {
-            pNode->m_targetPath = ResourcePath::ToFileSystemPath( m_compileContext.m_compiledResourceDirectoryPath, resourceID.GetResourcePath() );
+            pNode->m_targetPath = ResourcePath::ToFileSystemPath( ctx.m_compiledResourceDirectoryPath, resourceID.GetResourcePath() );
             pNode->m_targetExists = FileSystem::Exists( pNode->m_targetPath );
 
             pNode->m_compilerVersion = pCompiler->GetVersion();
@@ -381,7 +517,7 @@ namespace EE::Resource
 
                     auto pChildDependencyNode = pNode->m_dependencies.emplace_back( EE::New<CompileDependencyNode>() );
                     pChildDependencyNode->m_pParentNode = pNode;
-                    if ( !FillCompileDependencyNode( pChildDependencyNode, dependencyResourceID ) )
+                    if ( !FillCompileDependencyNode( ctx, pChildDependencyNode, dependencyResourceID ) )
                     {
                         return false;
                     }
@@ -422,11 +558,6 @@ int main( int argc, char* argv[] )
 
     CommandLineArgumentParser argParser( argc, argv );
 
-    for ( int i = 0; i < argc; i++ )
-    {
-        std::cout << argv[i] << std::endl;
-    }
-
     if ( !argParser.IsValid() )
     {
         EE_LOG_ERROR( "Resource", "Resource Compiler", "Invalid command line arguments" );
@@ -472,6 +603,17 @@ int main( int argc, char* argv[] )
     // Compile Resource
     //-------------------------------------------------------------------------
 
-    Resource::ResourceCompilerApplication application( argParser, settings );
-    return (int32_t) application.Run();
+    Resource::ResourceCompilerApplication application( settings );
+
+    if ( argParser.m_isWorker )
+    {
+        return application.RunWorker();
+    }
+
+    for ( int i = 0; i < argc; i++ )
+    {
+        std::cout << argv[i] << std::endl;
+    }
+
+    return (int32_t) application.Compile( argParser.m_resourceID, argParser.m_isForPackagedBuild, argParser.m_isForcedCompilation );
 }
\ No newline at end of file
@@ -1,17 +1,11 @@
 #pragma once
 #include "EngineTools/Resource/ResourceCompiler.h"
 #include "CompiledResourceDatabase.h"
+#include "CompiledResourceCache.h"
 #include "Base/TypeSystem/TypeRegistry.h"
 
 //-------------------------------------------------------------------------
 
-namespace EE
-{
-    struct CommandLineArgumentParser;
-}
-
-//-------------------------------------------------------------------------
-
 namespace EE::Resource
 {
     class ResourceSettings;
@@ -53,24 +47,35 @@ namespace EE::Resource
 
     public:
 
-        ResourceCompilerApplication( CommandLineArgumentParser& argParser, ResourceSettings const& settings );
+        ResourceCompilerApplication( ResourceSettings const& settings );
         ~ResourceCompilerApplication();
 
-        CompilationResult Run();
+        // Compile a single resource
+        CompilationResult Compile( ResourceID const& resourceID, bool isForPackagedBuild, bool forceCompilation );
+
+        // Run as a persistent worker, compiling the requests received on stdin until the stream is closed
+        int32_t RunWorker();
 
     private:
 
-        bool BuildCompileDependencyTree( ResourceID const& resourceID );
+        bool BuildCompileDependencyTree( CompileContext const& ctx, ResourceID const& resourceID );
         bool TryReadCompileDependencies( FileSystem::Path const& resourceFilePath, TVector<ResourceID>& outDependencies ) const;
-        bool FillCompileDependencyNode( CompileDependencyNode* pNode, ResourceID const& resourceID );
+        bool FillCompileDependencyNode( CompileContext const& ctx, CompileDependencyNode* pNode, ResourceID const& resourceID );
+
+        // Hash the contents of all the source files in the dependency tree, returns 0 if the resource cant be identified by its content
+        uint64_t CalculateContentHash( CompileDependencyNode const* pNode ) const;
+
+        static uint64_t GetCompiledResourceCacheKey( uint64_t sourceContentHash, bool isForPackagedBuild );
 
     private:
 
         TypeSystem::TypeRegistry                m_typeRegistry;
         CompiledResourceDatabase                m_compiledResourceDB;
+        CompiledResourceCache                   m_compiledResourceCache;
         CompilerRegistry*                       m_pCompilerRegistry = nullptr;
-        CompileContext                          m_compileContext;
-        bool                                    m_forceCompilation = false;
+        FileSystem::Path                        m_rawResourcePath;
+        FileSystem::Path                        m_compiledResourcePath;
+        FileSystem::Path                        m_packagedBuildCompiledResourcePath;
 
         TVector<ResourceID>                     m_uniqueCompileDependencies;
         CompileDependencyNode                   m_compileDependencyTreeRoot;
@@ -0,0 +1,248 @@
+#include "ResourceCompilerWorkerPool.h"
+#include "EngineTools/ThirdParty/subprocess/subprocess.h"
+#include "Base/Memory/Memory.h"
+
+//-------------------------------------------------------------------------
+
+namespace EE::Resource
+{
+    ResourceCompilerWorkerPool::~ResourceCompilerWorkerPool()
+    {
+        EE_ASSERT( m_workers.empty() );
+    }
+
+    void ResourceCompilerWorkerPool::Initialize( FileSystem::Path const& compilerExecutablePath, int32_t maxWorkers )
+    {
+        EE_ASSERT( m_workers.empty() );
+        EE_ASSERT( compilerExecutablePath.IsFilePath() && maxWorkers > 0 );
+
+        m_compilerExecutablePath = compilerExecutablePath;
+        m_workers.resize( maxWorkers );
+
+        for ( auto& worker : m_workers )
+        {
+            m_idleWorkers.emplace_back( &worker );
+        }
+
+        m_isShuttingDown = false;
+        m_watchdogThread = Threading::Thread( [this] () { RunWatchdog(); } );
+    }
+
+    void ResourceCompilerWorkerPool::Shutdown()
+    {
+        {
+            Threading::ScopeLock watchdogLock( m_watchdogMutex );
+            m_isShuttingDown = true;
+        }
+
+        m_watchdogShutdownCondition.notify_all();
+        m_watchdogThread.join();
+
+        //-------------------------------------------------------------------------
+
+        Threading::ScopeLock lock( m_mutex );
+        EE_ASSERT( m_idleWorkers.size() == m_workers.size() );
+
+        for ( auto& worker : m_workers )
+        {
+            if ( worker.m_pProcess != nullptr )
+            {
+                StopWorker( &worker );
+            }
+        }
+
+        m_idleWorkers.clear();
+        m_workers.clear();
+    }
+
+    //-------------------------------------------------------------------------
+
+    CompilationResult ResourceCompilerWorkerPool::Compile( ResourceID const& resourceID, bool forceCompilation, bool isForPackagedBuild, String& outLog )
+    {
+        EE_ASSERT( resourceID.IsValid() );
+
+        Worker* pWorker = AcquireWorker();
+
+        // Send request
+        //-------------------------------------------------------------------------
+        // If we fail to send the request then the worker died while idle, so restart it and try once more
+
+        bool wasRequestSent = false;
+        for ( int32_t attempt = 0; attempt < 2 && !wasRequestSent; attempt++ )
+        {
+            if ( pWorker->m_pProcess == nullptr && !StartWorker( pWorker ) )
+            {
+                break;
+            }
+
+            wasRequestSent = SendRequest( pWorker, resourceID, forceCompilation, isForPackagedBuild );
+            if ( !wasRequestSent )
+            {
+                StopWorker( pWorker );
+                m_numWorkerCrashes++;
+            }
+        }
+
+        if ( !wasRequestSent )
+        {
+            outLog = "Resource compiler failed to start!";
+            ReleaseWorker( pWorker );
+            return CompilationResult::Failure;
+        }
+
+        // Start the timeout, the watchdog will kill the worker if we dont get a result in time
+        {
+            Threading::ScopeLock watchdogLock( m_watchdogMutex );
+            pWorker->m_requestStartTime = PlatformClock::GetTime();
+            pWorker->m_wasTerminated = false;
+        }
+
+        // Read output until we receive the result
+        //-------------------------------------------------------------------------
+        // The worker starts the result on a new line, but we still search the whole line in case any output was left unterminated
+
+        CompilationResult compilationResult = CompilationResult::Failure;
+        bool wasResultReceived = false;
+
+        size_t const resultMarkerLength = strlen( CompilerWorker::s_resultMarker );
+        FILE* pOutputStream = subprocess_stdout( pWorker->m_pProcess );
+
+        char readBuffer[512];
+        while ( fgets( readBuffer, 512, pOutputStream ) )
+        {
+            char* pResultMarker = strstr( readBuffer, CompilerWorker::s_resultMarker );
+            if ( pResultMarker != nullptr )
+            {
+                compilationResult = (CompilationResult) atoi( pResultMarker + resultMarkerLength );
+                wasResultReceived = true;
+
+                *pResultMarker = 0;
+                outLog += readBuffer;
+                break;
+            }
+
+            outLog += readBuffer;
+        }
+
+        bool wasTerminated = false;
+        {
+            Threading::ScopeLock watchdogLock( m_watchdogMutex );
+            wasTerminated = pWorker->m_wasTerminated;
+            pWorker->m_requestStartTime = 0;
+            pWorker->m_wasTerminated = false;
+        }
+
+        // If the output stream was closed before we got a result, the worker crashed or was killed - it will be restarted on its next use
+        if ( !wasResultReceived )
+        {
+            outLog += wasTerminated ? "Resource compiler timed out!" : "Resource compiler crashed!";
+            StopWorker( pWorker );
+            m_numWorkerCrashes++;
+        }
+
+        //-------------------------------------------------------------------------
+
+        ReleaseWorker( pWorker );
+        return compilationResult;
+    }
+
+    //-------------------------------------------------------------------------
+
+    ResourceCompilerWorkerPool::Worker* ResourceCompilerWorkerPool::AcquireWorker()
+    {
+        Threading::Lock lock( m_mutex );
+        m_workerReleasedCondition.wait( lock, [this] () { return !m_idleWorkers.empty(); } );
+
+        // The idle list is used as a stack so that we prefer workers that are already running
+        Worker* pWorker = m_idleWorkers.back();
+        m_idleWorkers.pop_back();
+        return pWorker;
+    }
+
+    void ResourceCompilerWorkerPool::ReleaseWorker( Worker* pWorker )
+    {
+        EE_ASSERT( pWorker != nullptr );
+
+        {
+            Threading::ScopeLock lock( m_mutex );
+            m_idleWorkers.emplace_back( pWorker );
+        }
+
+        m_workerReleasedCondition.notify_one();
+    }
+
+    //-------------------------------------------------------------------------
+
+    bool ResourceCompilerWorkerPool::StartWorker( Worker* pWorker )
+    {
+        EE_ASSERT( pWorker != nullptr && pWorker->m_pProcess == nullptr );
+
+        // No default ctor for subprocess struct, so zero-init
+        pWorker->m_pProcess = EE::New<subprocess_s>();
+        Memory::MemsetZero( pWorker->m_pProcess );
+
+        char const* processCommandLineArgs[3] = { m_compilerExecutablePath.c_str(), "-worker", nullptr };
+        int32_t const result = subprocess_create( processCommandLineArgs, subprocess_option_combined_stdout_stderr | subprocess_option_inherit_environment | subprocess_option_no_window, pWorker->m_pProcess );
+        if ( result != 0 )
+        {
+            EE::Delete( pWorker->m_pProcess );
+            return false;
+        }
+
+        m_numRunningWorkers++;
+        return true;
+    }
+
+    void ResourceCompilerWorkerPool::StopWorker( Worker* pWorker )
+    {
+        EE_ASSERT( pWorker != nullptr && pWorker->m_pProcess != nullptr );
+
+        // Joining closes the worker's input stream which tells it to exit, if it has already exited this only cleans up the process
+        subprocess_join( pWorker->m_pProcess, nullptr );
+        subprocess_destroy( pWorker->m_pProcess );
+        EE::Delete( pWorker->m_pProcess );
+        m_numRunningWorkers--;
+    }
+
+    bool ResourceCompilerWorkerPool::SendRequest( Worker* pWorker, ResourceID const& resourceID, bool forceCompilation, bool isForPackagedBuild )
+    {
+        EE_ASSERT( pWorker != nullptr && pWorker->m_pProcess != nullptr );
+
+        FILE* pInputStream = subprocess_stdin( pWorker->m_pProcess );
+        if ( fprintf( pInputStream, "%d %d %s\n", forceCompilation ? 1 : 0, isForPackagedBuild ? 1 : 0, resourceID.GetResourcePath().c_str() ) < 0 )
+        {
+            return false;
+        }
+
+        return fflush( pInputStream ) == 0;
+    }
+
+    //-------------------------------------------------------------------------
+
+    void ResourceCompilerWorkerPool::RunWatchdog()
+    {
+        Threading::Lock lock( m_watchdogMutex );
+        while ( !m_isShuttingDown )
+        {
+            m_watchdogShutdownCondition.wait_for( lock, std::chrono::seconds( 1 ) );
+
+            // Killing the process closes its output stream, which unblocks the thread waiting on the result
+            // Workers are only stopped once their start time is cleared under this lock, so the process is always valid here
+            Nanoseconds const currentTime = PlatformClock::GetTime();
+            for ( auto& worker : m_workers )
+            {
+                if ( worker.m_requestStartTime == 0 || worker.m_wasTerminated )
+                {
+                    continue;
+                }
+
+                if ( Seconds( currentTime - worker.m_requestStartTime ) > s_workerTimeoutSeconds )
+                {
+                    EE_ASSERT( worker.m_pProcess != nullptr );
+                    subprocess_terminate( worker.m_pProcess );
+                    worker.m_wasTerminated = true;
+                }
+            }
+        }
+    }
+}
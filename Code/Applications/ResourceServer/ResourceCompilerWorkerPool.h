@@ -0,0 +1,84 @@
+#pragma once
+
+#include "EngineTools/Resource/ResourceCompiler.h"
+#include "Base/FileSystem/FileSystemPath.h"
+#include "Base/Threading/Threading.h"
+#include "Base/Time/Time.h"
+
+//-------------------------------------------------------------------------
+
+struct subprocess_s;
+
+//-------------------------------------------------------------------------
+// A pool of persistent resource compiler processes
+//-------------------------------------------------------------------------
+// Starting a compiler process per resource means re-registering all types and compilers and reconnecting to the compiled
+// resource database for every compile. Workers are long-lived and keep all of that warm between requests.
+// Each worker is still a separate process, so a crashing compiler only takes down its own worker which is restarted on its next use.
+// A watchdog thread kills any worker whose request exceeds the timeout, the request fails and the worker is restarted on its next use.
+//-------------------------------------------------------------------------
+
+namespace EE::Resource
+{
+    class ResourceCompilerWorkerPool
+    {
+        struct Worker
+        {
+            subprocess_s*                       m_pProcess = nullptr;
+            Nanoseconds                         m_requestStartTime = 0;     // Zero when no request is in flight, guarded by the watchdog mutex
+            bool                                m_wasTerminated = false;    // Set when the watchdog killed the worker, guarded by the watchdog mutex
+        };
+
+    public:
+
+        // Some resources (e.g. navmeshes) take minutes to compile, so this only catches workers that are actually hung
+        constexpr static float const s_workerTimeoutSeconds = 600.0f;
+
+        ResourceCompilerWorkerPool() = default;
+        ResourceCompilerWorkerPool( ResourceCompilerWorkerPool const& ) = delete;
+        ~ResourceCompilerWorkerPool();
+
+        ResourceCompilerWorkerPool& operator=( ResourceCompilerWorkerPool const& ) = delete;
+
+        // Workers are created on demand, so this doesnt start any processes
+        void Initialize( FileSystem::Path const& compilerExecutablePath, int32_t maxWorkers );
+        void Shutdown();
+
+        // Compile a resource on the first available worker, blocks until the compilation is complete
+        CompilationResult Compile( ResourceID const& resourceID, bool forceCompilation, bool isForPackagedBuild, String& outLog );
+
+        // Info
+        //-------------------------------------------------------------------------
+
+        inline int32_t GetMaxWorkers() const { return (int32_t) m_workers.size(); }
+        inline int32_t GetNumRunningWorkers() const { return m_numRunningWorkers; }
+        inline int32_t GetNumWorkerCrashes() const { return m_numWorkerCrashes; }
+
+    private:
+
+        Worker* AcquireWorker();
+        void ReleaseWorker( Worker* pWorker );
+
+        bool StartWorker( Worker* pWorker );
+        void StopWorker( Worker* pWorker );
+
+        bool SendRequest( Worker* pWorker, ResourceID const& resourceID, bool forceCompilation, bool isForPackagedBuild );
+
+        // Kills any workers whose current request has exceeded the timeout
+        void RunWatchdog();
+
+    private:
+
+        FileSystem::Path                        m_compilerExecutablePath;
+        TVector<Worker>                         m_workers;
+        TVector<Worker*>                        m_idleWorkers;
+        Threading::Mutex                        m_mutex;
+        Threading::ConditionVariable            m_workerReleasedCondition;
+        Threading::Thread                       m_watchdogThread;
+        Threading::Mutex                        m_watchdogMutex;
+        Threading::ConditionVariable            m_watchdogShutdownCondition;
+        bool                                    m_isShuttingDown = false;
+        std::atomic<int32_t>                    m_numRunningWorkers = 0;
+        std::atomic<int32_t>                    m_numWorkerCrashes = 0;
+    };
+}
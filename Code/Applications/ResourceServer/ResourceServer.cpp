@@ -1,10 +1,10 @@
 #include "ResourceServer.h"
 #include "_AutoGenerated/ToolsTypeRegistration.h"
 #include "EngineTools/Resource/ResourceCompiler.h"
-#include "EngineTools/ThirdParty/subprocess/subprocess.h"
 #include "Engine/Entity/EntityDescriptors.h"
 #include "Engine/Entity/EntitySerialization.h"
 #include "Base/Resource/ResourceProviders/ResourceNetworkMessages.h"
+#include "Base/Resource/ResourceArchive.h"
 #include "Base/IniFile.h"
 #include "Base/FileSystem/FileSystem.h"
 #include "Base/FileSystem/FileSystemUtils.h"
@@ -24,14 +24,6 @@ namespace EE::Resource
             , m_pRequest( pRequest )
         {
             EE_ASSERT( m_context.IsValid() );
-
-            // No default ctor for subprocess struct, so zero-init
-            Memory::MemsetZero( &m_subProcess );
-        }
-
-        ~CompilationTask()
-        {
-            EE_ASSERT( !subprocess_alive( &m_subProcess ) );
         }
 
         inline CompilationRequest* GetRequest() const { return m_pRequest; }
@@ -45,55 +37,20 @@ namespace EE::Resource
             if ( !m_context.m_isExiting && !m_pRequest->IsComplete() )
             {
                 EE_ASSERT( !m_pRequest->m_compilerArgs.empty() );
-                char const* processCommandLineArgs[6] = { m_context.m_compilerExecutablePath.c_str(), "-compile", m_pRequest->m_compilerArgs.c_str(), nullptr, nullptr, nullptr };
-
-                // Set force compilation flag
-                if ( m_pRequest->RequiresForcedRecompiliation() )
-                {
-                    processCommandLineArgs[3] = "-force";
-                }
 
-                // Set package flag for packing request
-                if ( m_pRequest->m_origin == CompilationRequest::Origin::Package )
-                {
-                    processCommandLineArgs[3] = "-package";
-                }
-
-                // Start compiler process
+                // Compile on a persistent compiler worker
                 //-------------------------------------------------------------------------
 
                 m_pRequest->m_compilationTimeStarted = PlatformClock::GetTime();
 
-                int32_t result = subprocess_create( processCommandLineArgs, subprocess_option_combined_stdout_stderr | subprocess_option_inherit_environment | subprocess_option_no_window, &m_subProcess );
-                if ( result != 0 )
-                {
-                    m_pRequest->m_status = CompilationRequest::Status::Failed;
-                    m_pRequest->m_log = "Resource compiler failed to start!";
-                    m_pRequest->m_compilationTimeFinished = PlatformClock::GetTime();
-                    return;
-                }
-
-                // Wait for compilation to complete
-                //-------------------------------------------------------------------------
+                bool const isForPackagedBuild = m_pRequest->m_origin == CompilationRequest::Origin::Package;
+                CompilationResult const compilationResult = m_context.m_pCompilerWorkerPool->Compile( m_pRequest->m_resourceID, m_pRequest->RequiresForcedRecompiliation(), isForPackagedBuild, m_pRequest->m_log );
 
-                int32_t exitCode;
-                result = subprocess_join( &m_subProcess, &exitCode );
-                if ( result != 0 )
-                {
-                    m_pRequest->m_status = CompilationRequest::Status::Failed;
-                    m_pRequest->m_log = "Resource compiler failed to complete!";
-                    m_pRequest->m_compilationTimeFinished = PlatformClock::GetTime();
-                    subprocess_destroy( &m_subProcess );
-                    return;
-                }
+                m_pRequest->m_compilationTimeFinished = PlatformClock::GetTime();
 
                 // Handle completed compilation
                 //-------------------------------------------------------------------------
 
-                m_pRequest->m_compilationTimeFinished = PlatformClock::GetTime();
-
-                CompilationResult const compilationResult = (CompilationResult) exitCode;
-
                 switch ( compilationResult )
                 {
                     case CompilationResult::SuccessUpToDate:
@@ -120,19 +77,6 @@ namespace EE::Resource
                     }
                     break;
                 }
-
-                // Read error and output of process
-                //-------------------------------------------------------------------------
-
-                char readBuffer[512];
-                while ( fgets( readBuffer, 512, subprocess_stdout( &m_subProcess ) ) )
-                {
-                    m_pRequest->m_log += readBuffer;
-                }
-
-                //-------------------------------------------------------------------------
-
-                subprocess_destroy( &m_subProcess );
             }
         }
 
@@ -140,7 +84,6 @@ namespace EE::Resource
 
         ResourceServerContext const&                        m_context;
         CompilationRequest*                                 m_pRequest = nullptr;
-        subprocess_s                                        m_subProcess;
     };
 
     //-------------------------------------------------------------------------
@@ -256,11 +199,14 @@ namespace EE::Resource
 
         m_taskSystem.Initialize();
 
+        // Each compilation task blocks on a compiler worker, so there is no point in having more workers than task threads
+        m_compilerWorkerPool.Initialize( m_settings.m_resourceCompilerExecutablePath, (int32_t) m_taskSystem.GetNumWorkers() );
+
         m_context.m_rawResourcePath = m_settings.m_rawResourcePath;
         m_context.m_compiledResourcePath = m_settings.m_compiledResourcePath;
-        m_context.m_compilerExecutablePath = m_settings.m_resourceCompilerExecutablePath;
         m_context.m_pTypeRegistry = &m_typeRegistry;
         m_context.m_pCompilerRegistry = m_pCompilerRegistry;
+        m_context.m_pCompilerWorkerPool = &m_compilerWorkerPool;
 
         // Packaging
         //-------------------------------------------------------------------------
@@ -283,6 +229,8 @@ namespace EE::Resource
 
         EE_ASSERT( m_numScheduledTasks == 0 );
 
+        m_compilerWorkerPool.Shutdown();
+
         // Packaging
         //-------------------------------------------------------------------------
 
@@ -380,6 +328,7 @@ namespace EE::Resource
 
             if ( isComplete )
             {
+                WritePackagedResourceArchive();
                 m_packagingRequests.clear();
                 m_packagingStage = PackagingStage::Complete;
             }
@@ -449,6 +398,18 @@ namespace EE::Resource
         return IsPackaging() || m_numScheduledTasks != 0;
     }
 
+    float ResourceServer::GetCompilationThroughput() const
+    {
+        Nanoseconds const periodEndTime = ( m_numScheduledTasks != 0 ) ? PlatformClock::GetTime() : m_throughputPeriodEndTime;
+        if ( periodEndTime <= m_throughputPeriodStartTime )
+        {
+            return 0.0f;
+        }
+
+        Seconds const elapsedTime = ( periodEndTime - m_throughputPeriodStartTime ).ToSeconds();
+        return m_numRequestsCompletedInPeriod / elapsedTime.ToFloat();
+    }
+
     //-------------------------------------------------------------------------
 
     CompilationRequest* ResourceServer::CreateResourceRequest( ResourceID const& resourceID, uint32_t clientID, CompilationRequest::Origin origin )
@@ -495,6 +456,15 @@ namespace EE::Resource
         //-------------------------------------------------------------------------
 
         m_requests.emplace_back( pRequest );
+
+        // Start a new throughput measurement period if we were idle
+        if ( m_numScheduledTasks == 0 )
+        {
+            m_throughputPeriodStartTime = PlatformClock::GetTime();
+            m_throughputPeriodEndTime = m_throughputPeriodStartTime;
+            m_numRequestsCompletedInPeriod = 0;
+        }
+
         auto pTask = EE::New<CompilationTask>( m_context, pRequest );
         m_taskSystem.ScheduleTask( pTask );
         m_activeTasks.emplace_back( pTask );
@@ -598,6 +568,8 @@ namespace EE::Resource
 
                 // Decrement task counter
                 m_numScheduledTasks--;
+                m_numRequestsCompletedInPeriod++;
+                m_throughputPeriodEndTime = PlatformClock::GetTime();
             }
         }
 
@@ -669,6 +641,27 @@ namespace EE::Resource
         m_packagingStage = PackagingStage::Preparing;
     }
 
+    void ResourceServer::WritePackagedResourceArchive()
+    {
+        // Resources are written in the order they were requested, which keeps each map's dependencies close together in the archive
+        TVector<ResourceID> packagedResourceIDs;
+        packagedResourceIDs.reserve( m_packagingRequests.size() );
+
+        for ( auto pRequest : m_packagingRequests )
+        {
+            if ( pRequest->HasSucceeded() )
+            {
+                VectorEmplaceBackUnique( packagedResourceIDs, pRequest->GetResourceID() );
+            }
+        }
+
+        FileSystem::Path const archivePath = m_settings.m_packagedBuildCompiledResourcePath + ResourceArchive::s_archiveFileName;
+        if ( !ResourceArchive::Write( archivePath, m_settings.m_packagedBuildCompiledResourcePath, packagedResourceIDs ) )
+        {
+            EE_LOG_ERROR( "Resource", "Packaging", "Failed to write packaged resource archive: %s", archivePath.c_str() );
+        }
+    }
+
     float ResourceServer::GetPackagingProgress() const
     {
         switch ( m_packagingStage )
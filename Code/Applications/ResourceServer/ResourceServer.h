@@ -2,6 +2,7 @@
 
 #include "ResourceServerContext.h"
 #include "ResourceCompilationRequest.h"
+#include "ResourceCompilerWorkerPool.h"
 #include "EngineTools/Core/FileSystem/FileSystemWatcher.h"
 #include "Base/Network/IPC/IPCMessageServer.h"
 #include "Base/Resource/ResourceSettings.h"
@@ -63,6 +64,7 @@ namespace EE::Resource
         //-------------------------------------------------------------------------
 
         inline CompilerRegistry const* GetCompilerRegistry() const { return m_pCompilerRegistry; }
+        inline ResourceCompilerWorkerPool const& GetCompilerWorkerPool() const { return m_compilerWorkerPool; }
         inline void CompileResource( ResourceID const& resourceID, bool forceRecompile = true ) { CreateResourceRequest( resourceID, 0, forceRecompile ? CompilationRequest::Origin::ManualCompileForced : CompilationRequest::Origin::ManualCompile ); }
         inline void PackageResource( ResourceID const& resourceID ) { CreateResourceRequest( resourceID, 0, CompilationRequest::Origin::Package ); }
 
@@ -72,6 +74,9 @@ namespace EE::Resource
         TVector<CompilationRequest const*> const& GetRequests() const { return ( TVector<CompilationRequest const*>& ) m_requests; }
         inline void CleanHistory() { m_cleanupRequested = true; }
 
+        // Get the number of requests completed per second for the current (or last) period of activity
+        float GetCompilationThroughput() const;
+
         // Clients
         //-------------------------------------------------------------------------
 
@@ -120,6 +125,12 @@ namespace EE::Resource
         CompilationRequest* CreateResourceRequest( ResourceID const& resourceID, uint32_t clientID = 0, CompilationRequest::Origin origin = CompilationRequest::Origin::External );
         void ProcessCompletedRequests();
 
+        // Packaging
+        //-------------------------------------------------------------------------
+
+        // Write all successfully packaged resources into a single archive for the packaged resource provider
+        void WritePackagedResourceArchive();
+
     private:
 
         Network::IPC::Server                                        m_networkServer;
@@ -137,8 +148,14 @@ namespace EE::Resource
         TVector<CompilationTask*>                                   m_activeTasks;
         std::atomic<int64_t>                                        m_numScheduledTasks = 0;
 
+        // Throughput
+        Nanoseconds                                                 m_throughputPeriodStartTime = 0;
+        Nanoseconds                                                 m_throughputPeriodEndTime = 0;
+        int32_t                                                     m_numRequestsCompletedInPeriod = 0;
+
         // Workers
         ResourceServerContext                                       m_context;
+        ResourceCompilerWorkerPool                                  m_compilerWorkerPool;
 
         // Packaging
         TVector<ResourceID>                                         m_allMaps;
@@ -5,6 +5,10 @@
 
 namespace EE::Resource
 {
+    class ResourceCompilerWorkerPool;
+
+    //-------------------------------------------------------------------------
+
     struct ResourceServerContext
     {
         bool IsValid() const;
@@ -13,9 +17,9 @@ namespace EE::Resource
 
         FileSystem::Path                        m_rawResourcePath;
         FileSystem::Path                        m_compiledResourcePath;
-        FileSystem::Path                        m_compilerExecutablePath;
         TypeSystem::TypeRegistry const*         m_pTypeRegistry = nullptr;
         CompilerRegistry const*                 m_pCompilerRegistry = nullptr;
+        ResourceCompilerWorkerPool*             m_pCompilerWorkerPool = nullptr;
 
         // Set when we shutdown the server to skip processing of any scheduled tasks
         bool                                    m_isExiting = false;
@@ -442,6 +442,14 @@ namespace EE::Resource
 
             //-------------------------------------------------------------------------
 
+            ImGuiX::TextSeparator( "Compilation" );
+
+            ResourceCompilerWorkerPool const& workerPool = m_resourceServer.GetCompilerWorkerPool();
+            ImGui::Text( "Compiler Workers: %d / %d (Crashes: %d)", workerPool.GetNumRunningWorkers(), workerPool.GetMaxWorkers(), workerPool.GetNumWorkerCrashes() );
+            ImGui::Text( "Throughput: %.2f resources/s", m_resourceServer.GetCompilationThroughput() );
+
+            //-------------------------------------------------------------------------
+
             ImGuiX::TextSeparator( "Tools" );
 
             ImVec2 buttonSize( 155, 0 );
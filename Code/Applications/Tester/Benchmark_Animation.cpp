@@ -0,0 +1,694 @@
+#include "Tester.h"
+#include "Engine/Animation/AnimationClip.h"
+#include "Engine/Animation/AnimationBlender.h"
+#include "Engine/Animation/TaskSystem/Animation_TaskSystem.h"
+#include "Engine/Animation/TaskSystem/Tasks/Animation_Task_Blend.h"
+#include "Engine/Animation/TaskSystem/Tasks/Animation_Task_DefaultPose.h"
+#include "Base/Threading/TaskSystem.h"
+#include "Base/Threading/Threading.h"
+#include "Base/Math/MathRandom.h"
+#include "Base/Time/Timers.h"
+#include "EASTL/sort.h"
+#include <iostream>
+
+//-------------------------------------------------------------------------
+
+namespace EE::Animation
+{
+    // Compares the SoA clip decoder with the previous per-bone decoder, both paths sample the same randomly generated clip
+    class AnimationClipBenchmark
+    {
+        // The previous per-bone track settings, see 'TrackCompressionSettings' in the old clip format
+        struct LegacyTrackSettings
+        {
+            Quaternion                      m_staticRotation = Quaternion::Identity;
+            Float3                          m_translationRangeStart = Float3::Zero;
+            Float3                          m_translationRangeLength = Float3::Zero;
+            float                           m_staticScale = 1.0f;
+            bool                            m_isRotationStatic = false;
+            bool                            m_isTranslationStatic = false;
+        };
+
+        struct LegacyClip
+        {
+            // The previous decode path, each bone is decoded separately and the upper frame is decoded into a temporary pose
+            void GetPose( FrameTime const& frameTime, Transform* pOutTransforms ) const
+            {
+                auto ReadCompressedPose = [&] ( int32_t poseIdx, Transform outTransforms[] )
+                {
+                    uint16_t const* pReadPtr = m_compressedPoseData.data() + m_compressedPoseOffsets[poseIdx];
+
+                    for ( auto i = 0; i < m_numBones; i++ )
+                    {
+                        LegacyTrackSettings const& trackSettings = m_trackSettings[i];
+                        if ( trackSettings.m_isRotationStatic )
+                        {
+                            Transform::DirectlySetRotation( outTransforms[i], trackSettings.m_staticRotation );
+                        }
+                        else
+                        {
+                            Transform::DirectlySetRotation( outTransforms[i], Quantization::EncodedQuaternion( pReadPtr[0], pReadPtr[1], pReadPtr[2] ).ToQuaternion() );
+                            pReadPtr += 3;
+                        }
+                    }
+
+                    for ( auto i = 0; i < m_numBones; i++ )
+                    {
+                        LegacyTrackSettings const& trackSettings = m_trackSettings[i];
+
+                        Float4 translationScale;
+                        if ( trackSettings.m_isTranslationStatic )
+                        {
+                            translationScale = Float4( trackSettings.m_translationRangeStart );
+                        }
+                        else
+                        {
+                            translationScale.m_x = Quantization::DecodeFloat( pReadPtr[0], trackSettings.m_translationRangeStart.m_x, trackSettings.m_translationRangeLength.m_x );
+                            translationScale.m_y = Quantization::DecodeFloat( pReadPtr[1], trackSettings.m_translationRangeStart.m_y, trackSettings.m_translationRangeLength.m_y );
+                            translationScale.m_z = Quantization::DecodeFloat( pReadPtr[2], trackSettings.m_translationRangeStart.m_z, trackSettings.m_translationRangeLength.m_z );
+                            pReadPtr += 3;
+                        }
+
+                        translationScale.m_w = trackSettings.m_staticScale;
+                        Transform::DirectlySetTranslationScale( outTransforms[i], translationScale );
+                    }
+                };
+
+                ReadCompressedPose( frameTime.GetLowerBoundFrameIndex(), pOutTransforms );
+
+                if ( !frameTime.IsExactlyAtKeyFrame() )
+                {
+                    TInlineVector<Transform, 200> tmpPose;
+                    tmpPose.resize( m_numBones );
+                    ReadCompressedPose( frameTime.GetUpperBoundFrameIndex(), tmpPose.data() );
+
+                    float const percentageThrough = frameTime.GetPercentageThrough().ToFloat();
+                    for ( auto i = 0; i < m_numBones; i++ )
+                    {
+                        pOutTransforms[i] = Transform::FastSlerp( pOutTransforms[i], tmpPose[i], percentageThrough );
+                    }
+                }
+            }
+
+            int32_t                         m_numBones = 0;
+            TVector<LegacyTrackSettings>    m_trackSettings;
+            TVector<uint16_t>               m_compressedPoseData;
+            TVector<uint32_t>               m_compressedPoseOffsets;
+        };
+
+    public:
+
+        static void Run( int32_t numBones, int32_t numFrames, int32_t numSamples )
+        {
+            // Generate a clip where every rotation track and every 4th translation track is animated, scale is always static
+            //-------------------------------------------------------------------------
+
+            auto IsTranslationDynamic = [] ( int32_t boneIdx ) { return ( boneIdx % 4 ) == 0; };
+
+            TVector<Transform> rawFrames( numFrames * numBones );
+            for ( int32_t frameIdx = 0; frameIdx < numFrames; frameIdx++ )
+            {
+                for ( int32_t boneIdx = 0; boneIdx < numBones; boneIdx++ )
+                {
+                    Quaternion const rotation( EulerAngles( Math::GetRandomFloat( -90, 90 ), Math::GetRandomFloat( -90, 90 ), Math::GetRandomFloat( -90, 90 ) ) );
+                    Vector const translation = IsTranslationDynamic( boneIdx ) ? Vector( Math::GetRandomFloat( -1, 1 ), Math::GetRandomFloat( -1, 1 ), Math::GetRandomFloat( -1, 1 ) ) : Vector( 0, 0.1f, 0 );
+                    rawFrames[( frameIdx * numBones ) + boneIdx] = Transform( rotation, translation );
+                }
+            }
+
+            auto GetRawTransform = [&] ( int32_t frameIdx, int32_t boneIdx ) -> Transform const& { return rawFrames[( frameIdx * numBones ) + boneIdx]; };
+
+            // All dynamic translations use the same range to keep the encoding simple
+            float const translationRangeStart = -1.0f;
+            float const translationRangeLength = 2.0f;
+
+            // Legacy layout
+            //-------------------------------------------------------------------------
+
+            LegacyClip legacyClip;
+            legacyClip.m_numBones = numBones;
+            legacyClip.m_trackSettings.resize( numBones );
+
+            for ( int32_t boneIdx = 0; boneIdx < numBones; boneIdx++ )
+            {
+                LegacyTrackSettings& settings = legacyClip.m_trackSettings[boneIdx];
+                settings.m_isTranslationStatic = !IsTranslationDynamic( boneIdx );
+                if ( settings.m_isTranslationStatic )
+                {
+                    settings.m_translationRangeStart = GetRawTransform( 0, boneIdx ).GetTranslation().ToFloat3();
+                }
+                else
+                {
+                    settings.m_translationRangeStart = Float3( translationRangeStart );
+                    settings.m_translationRangeLength = Float3( translationRangeLength );
+                }
+            }
+
+            for ( int32_t frameIdx = 0; frameIdx < numFrames; frameIdx++ )
+            {
+                legacyClip.m_compressedPoseOffsets.emplace_back( (uint32_t) legacyClip.m_compressedPoseData.size() );
+
+                for ( int32_t boneIdx = 0; boneIdx < numBones; boneIdx++ )
+                {
+                    Quantization::EncodedQuaternion const encodedQuat( GetRawTransform( frameIdx, boneIdx ).GetRotation() );
+                    legacyClip.m_compressedPoseData.emplace_back( encodedQuat.GetData0() );
+                    legacyClip.m_compressedPoseData.emplace_back( encodedQuat.GetData1() );
+                    legacyClip.m_compressedPoseData.emplace_back( encodedQuat.GetData2() );
+                }
+
+                for ( int32_t boneIdx = 0; boneIdx < numBones; boneIdx++ )
+                {
+                    if ( IsTranslationDynamic( boneIdx ) )
+                    {
+                        Vector const& translation = GetRawTransform( frameIdx, boneIdx ).GetTranslation();
+                        legacyClip.m_compressedPoseData.emplace_back( Quantization::EncodeFloat( translation.GetX(), translationRangeStart, translationRangeLength ) );
+                        legacyClip.m_compressedPoseData.emplace_back( Quantization::EncodeFloat( translation.GetY(), translationRangeStart, translationRangeLength ) );
+                        legacyClip.m_compressedPoseData.emplace_back( Quantization::EncodeFloat( translation.GetZ(), translationRangeStart, translationRangeLength ) );
+                    }
+                }
+            }
+
+            // SoA layout, this mirrors what the clip compiler generates
+            //-------------------------------------------------------------------------
+
+            AnimationClip clip;
+            clip.m_numFrames = numFrames;
+            clip.m_duration = Seconds( float( numFrames - 1 ) / 30.0f );
+            clip.m_staticPose.resize( numBones, Transform::Identity );
+
+            for ( int32_t boneIdx = 0; boneIdx < numBones; boneIdx++ )
+            {
+                clip.m_dynamicRotationBoneIndices.emplace_back( (uint16_t) boneIdx );
+
+                if ( IsTranslationDynamic( boneIdx ) )
+                {
+                    clip.m_dynamicTranslationBoneIndices.emplace_back( (uint16_t) boneIdx );
+                }
+                else
+                {
+                    clip.m_staticPose[boneIdx].SetTranslation( GetRawTransform( 0, boneIdx ).GetTranslation() );
+                }
+            }
+
+            int32_t const numRotationTracks = (int32_t) clip.m_dynamicRotationBoneIndices.size();
+            int32_t const numTranslationTracks = (int32_t) clip.m_dynamicTranslationBoneIndices.size();
+            int32_t const numRotationGroups = AnimationClip::GetNumTrackGroups( numRotationTracks );
+            int32_t const numTranslationGroups = AnimationClip::GetNumTrackGroups( numTranslationTracks );
+
+            clip.m_translationQuantizationRanges.resize( numTranslationGroups * AnimationClip::s_translationGroupRangeSize, translationRangeLength );
+            for ( int32_t groupIdx = 0; groupIdx < numTranslationGroups; groupIdx++ )
+            {
+                float* pRanges = clip.m_translationQuantizationRanges.data() + ( groupIdx * AnimationClip::s_translationGroupRangeSize );
+                for ( int32_t i = 0; i < 12; i++ )
+                {
+                    pRanges[i] = translationRangeStart;
+                }
+            }
+
+            Quantization::EncodedQuaternion const encodedIdentity( Quaternion::Identity );
+            clip.m_compressedFrameSize = ( numRotationGroups * AnimationClip::s_rotationGroupDataSize ) + ( numTranslationGroups * AnimationClip::s_translationGroupDataSize );
+            clip.m_compressedPoseData.resize( numFrames * clip.m_compressedFrameSize, 0 );
+
+            for ( int32_t frameIdx = 0; frameIdx < numFrames; frameIdx++ )
+            {
+                uint16_t* pFrameData = clip.m_compressedPoseData.data() + ( frameIdx * clip.m_compressedFrameSize );
+
+                for ( int32_t trackIdx = 0; trackIdx < numRotationGroups * AnimationClip::s_trackGroupSize; trackIdx++ )
+                {
+                    Quantization::EncodedQuaternion encodedQuat = encodedIdentity;
+                    if ( trackIdx < numRotationTracks )
+                    {
+                        encodedQuat = Quantization::EncodedQuaternion( GetRawTransform( frameIdx, clip.m_dynamicRotationBoneIndices[trackIdx] ).GetRotation() );
+                    }
+
+                    uint16_t* pGroupData = pFrameData + ( ( trackIdx / AnimationClip::s_trackGroupSize ) * AnimationClip::s_rotationGroupDataSize );
+                    int32_t const laneIdx = trackIdx % AnimationClip::s_trackGroupSize;
+                    pGroupData[laneIdx] = encodedQuat.GetData0();
+                    pGroupData[laneIdx + 4] = encodedQuat.GetData1();
+                    pGroupData[laneIdx + 8] = encodedQuat.GetData2();
+                }
+                pFrameData += numRotationGroups * AnimationClip::s_rotationGroupDataSize;
+
+                for ( int32_t trackIdx = 0; trackIdx < numTranslationTracks; trackIdx++ )
+                {
+                    Vector const& translation = GetRawTransform( frameIdx, clip.m_dynamicTranslationBoneIndices[trackIdx] ).GetTranslation();
+                    uint16_t* pGroupData = pFrameData + ( ( trackIdx / AnimationClip::s_trackGroupSize ) * AnimationClip::s_translationGroupDataSize );
+                    int32_t const laneIdx = trackIdx % AnimationClip::s_trackGroupSize;
+                    pGroupData[laneIdx] = Quantization::EncodeFloat( translation.GetX(), translationRangeStart, translationRangeLength );
+                    pGroupData[laneIdx + 4] = Quantization::EncodeFloat( translation.GetY(), translationRangeStart, translationRangeLength );
+                    pGroupData[laneIdx + 8] = Quantization::EncodeFloat( translation.GetZ(), translationRangeStart, translationRangeLength );
+                }
+            }
+
+            // Benchmark
+            //-------------------------------------------------------------------------
+
+            TVector<FrameTime> sampleTimes;
+            sampleTimes.reserve( numSamples );
+            for ( int32_t i = 0; i < numSamples; i++ )
+            {
+                sampleTimes.emplace_back( clip.GetFrameTime( Percentage( Math::GetRandomFloat() ) ) );
+            }
+
+            TVector<Transform> legacyPose( numBones );
+            TVector<Transform> pose( numBones );
+            Milliseconds legacyTime, time;
+            float sink = 0.0f;
+
+            {
+                ScopedTimer<PlatformClock> t( legacyTime );
+                for ( auto const& frameTime : sampleTimes )
+                {
+                    legacyClip.GetPose( frameTime, legacyPose.data() );
+                    sink += legacyPose[numBones - 1].GetTranslation().GetX();
+                }
+            }
+
+            {
+                ScopedTimer<PlatformClock> t( time );
+                for ( auto const& frameTime : sampleTimes )
+                {
+                    clip.DecodePose( frameTime, numBones, pose.data() );
+                    sink += pose[numBones - 1].GetTranslation().GetX();
+                }
+            }
+
+            // Both decoders need to produce the same pose (within the quantization error)
+            float maxRotationError = 0.0f;
+            float maxTranslationError = 0.0f;
+            for ( int32_t i = 0; i < numBones; i++ )
+            {
+                maxRotationError = Math::Max( maxRotationError, Quaternion::Distance( legacyPose[i].GetRotation(), pose[i].GetRotation() ).ToFloat() );
+                maxTranslationError = Math::Max( maxTranslationError, legacyPose[i].GetTranslation().GetDistance3( pose[i].GetTranslation() ) );
+            }
+
+            std::cout << "Clip Decode (Per-Bone, " << numBones << " bones, " << numSamples << " samples): " << legacyTime.ToFloat() << "ms" << std::endl;
+            std::cout << "Clip Decode (SoA SIMD, " << numBones << " bones, " << numSamples << " samples): " << time.ToFloat() << "ms" << std::endl;
+            std::cout << "Clip Decode Max Error: " << maxRotationError << " rad, " << maxTranslationError << "m (" << sink << ")" << std::endl;
+        }
+    };
+}
+
+//-------------------------------------------------------------------------
+
+namespace EE::Animation
+{
+    // Compares the event timeline range queries with the previous linear scan over the start time sorted events
+    // The clip contains long events with shorter events contained within them, so that the max end time search needs to keep candidates that start well before the range
+    class AnimationEventQueryTest
+    {
+        class TestEvent final : public Event
+        {
+        public:
+
+            TestEvent( float startTime, float duration )
+            {
+                m_startTime = startTime;
+                m_duration = duration;
+            }
+        };
+
+        // The previous query, every event up to the end of the range is tested for overlap
+        static void GetEventsForRangeLinear( AnimationClip const& clip, Seconds fromTime, Seconds toTime, TInlineVector<Event const*, 10>& outEvents )
+        {
+            auto GetEventsForRangeNoLooping = [&clip] ( Seconds fromTime, Seconds toTime, TInlineVector<Event const*, 10>& outEvents )
+            {
+                for ( auto const& pEvent : clip.GetEvents() )
+                {
+                    if ( pEvent->GetStartTime() > toTime )
+                    {
+                        break;
+                    }
+
+                    if ( FloatRange( fromTime, toTime ).Overlaps( pEvent->GetTimeRange() ) )
+                    {
+                        outEvents.emplace_back( pEvent );
+                    }
+                }
+            };
+
+            if ( fromTime <= toTime )
+            {
+                GetEventsForRangeNoLooping( fromTime, toTime, outEvents );
+            }
+            else
+            {
+                GetEventsForRangeNoLooping( fromTime, clip.GetDuration(), outEvents );
+                GetEventsForRangeNoLooping( 0, toTime, outEvents );
+            }
+        }
+
+        static bool ValidateRange( AnimationClip const& clip, Seconds fromTime, Seconds toTime )
+        {
+            TInlineVector<Event const*, 10> expectedEvents, events;
+            TInlineVector<int32_t, 10> eventIndices;
+            GetEventsForRangeLinear( clip, fromTime, toTime, expectedEvents );
+            clip.GetEventsForRange( fromTime, toTime, events );
+            clip.GetEventIndicesForRange( fromTime, toTime, eventIndices );
+
+            if ( events != expectedEvents || eventIndices.size() != expectedEvents.size() )
+            {
+                return false;
+            }
+
+            for ( size_t i = 0; i < eventIndices.size(); i++ )
+            {
+                Event const* pEvent = clip.GetEvent( eventIndices[i] );
+                AnimationClip::EventInterval const& interval = clip.GetEventInterval( eventIndices[i] );
+                if ( pEvent != expectedEvents[i] || interval.m_typeID != pEvent->GetTypeID() || interval.m_isDurationEvent != pEvent->IsDurationEvent() )
+                {
+                    return false;
+                }
+            }
+
+            return true;
+        }
+
+    public:
+
+        static void Run( int32_t numEvents, int32_t numRandomRanges )
+        {
+            float const duration = 10.0f;
+
+            // Create the events, every 10th event is a long event that contains the following ones
+            //-------------------------------------------------------------------------
+
+            TVector<float> startTimes( numEvents );
+            Math::GetRandomFloats( startTimes.data(), startTimes.size(), 0.0f, duration );
+            eastl::sort( startTimes.begin(), startTimes.end() );
+
+            TVector<TestEvent> events;
+            events.reserve( numEvents );
+            for ( int32_t i = 0; i < numEvents; i++ )
+            {
+                float eventDuration = 0.0f;
+                if ( ( i % 10 ) == 0 )
+                {
+                    eventDuration = Math::GetRandomFloat( 2.0f, 5.0f );
+                }
+                else if ( ( i % 3 ) != 0 )
+                {
+                    eventDuration = Math::GetRandomFloat( 0.01f, 0.2f );
+                }
+
+                events.emplace_back( startTimes[i], Math::Min( eventDuration, duration - startTimes[i] ) );
+            }
+
+            AnimationClip clip;
+            clip.m_duration = duration;
+            for ( auto& event : events )
+            {
+                clip.m_events.emplace_back( &event );
+            }
+            clip.CreateEventTimeline();
+
+            // Ranges
+            //-------------------------------------------------------------------------
+
+            bool overlappingSucceeded = true, containedSucceeded = true, loopingSucceeded = true;
+
+            for ( int32_t i = 0; i < numRandomRanges; i++ )
+            {
+                float const fromTime = Math::GetRandomFloat( 0.0f, duration );
+                float const toTime = Math::GetRandomFloat( 0.0f, duration );
+
+                if ( fromTime <= toTime )
+                {
+                    overlappingSucceeded &= ValidateRange( clip, fromTime, toTime );
+                }
+                else
+                {
+                    loopingSucceeded &= ValidateRange( clip, fromTime, toTime );
+                }
+            }
+
+            for ( auto const& event : events )
+            {
+                float const startTime = event.GetStartTime().ToFloat();
+                float const endTime = startTime + event.GetDuration().ToFloat();
+
+                // Ranges starting and ending exactly on the event boundaries, and zero length ranges at the boundaries
+                overlappingSucceeded &= ValidateRange( clip, startTime, endTime );
+                overlappingSucceeded &= ValidateRange( clip, startTime, startTime );
+                overlappingSucceeded &= ValidateRange( clip, endTime, endTime );
+                overlappingSucceeded &= ValidateRange( clip, endTime, Math::Min( endTime + 0.5f, duration ) );
+
+                // Ranges contained within the event
+                if ( event.IsDurationEvent() )
+                {
+                    float const length = endTime - startTime;
+                    containedSucceeded &= ValidateRange( clip, startTime + ( length * 0.25f ), startTime + ( length * 0.75f ) );
+                }
+
+                // Ranges wrapping around the end of the clip
+                loopingSucceeded &= ValidateRange( clip, endTime, startTime * 0.5f );
+            }
+
+            overlappingSucceeded &= ValidateRange( clip, 0.0f, duration );
+            loopingSucceeded &= ValidateRange( clip, duration, 0.0f );
+
+            clip.m_events.clear();
+
+            std::cout << "Clip Event Query (Overlapping, " << numEvents << " events): " << ( overlappingSucceeded ? "PASSED" : "FAILED" ) << std::endl;
+            std::cout << "Clip Event Query (Contained, " << numEvents << " events): " << ( containedSucceeded ? "PASSED" : "FAILED" ) << std::endl;
+            std::cout << "Clip Event Query (Looping, " << numEvents << " events): " << ( loopingSucceeded ? "PASSED" : "FAILED" ) << std::endl;
+        }
+    };
+}
+
+//-------------------------------------------------------------------------
+
+namespace EE::Animation
+{
+    // Skeletons are normally only created by the skeleton compiler, this creates a simple bone chain for the benchmarks
+    class BenchmarkSkeletonBuilder
+    {
+    public:
+
+        static void Create( Skeleton& skeleton, int32_t numBones )
+        {
+            for ( int32_t i = 0; i < numBones; i++ )
+            {
+                skeleton.m_boneIDs.emplace_back( StringID( String( String::CtorSprintf(), "Bone%d", i ).c_str() ) );
+                skeleton.m_parentIndices.emplace_back( i - 1 );
+                skeleton.m_localReferencePose.emplace_back( Transform( Quaternion( EulerAngles( 0, 0, 5 ) ), Vector( 0, 0.1f, 0 ) ) );
+                skeleton.m_boneFlags.emplace_back();
+            }
+
+            skeleton.m_globalReferencePose = skeleton.m_localReferencePose;
+            skeleton.m_numBonesToSampleAtLowLOD = numBones;
+        }
+    };
+
+    //-------------------------------------------------------------------------
+
+    // Compares the 4-wide local (FastSLerp) and additive blends with the per-bone path, for both the unmasked and masked blends
+    class AnimationBlendBenchmark
+    {
+        static void SetRandomPose( Pose& pose )
+        {
+            for ( int32_t i = 0; i < pose.GetNumBones(); i++ )
+            {
+                Quaternion const rotation( EulerAngles( Math::GetRandomFloat( -90, 90 ), Math::GetRandomFloat( -90, 90 ), Math::GetRandomFloat( -90, 90 ) ) );
+                pose.SetTransform( i, Transform( rotation, Vector( Math::GetRandomFloat( -1, 1 ), Math::GetRandomFloat( -1, 1 ), Math::GetRandomFloat( -1, 1 ) ) ) );
+            }
+        }
+
+        // The per-bone blend, this matches the remainder loop in 'Blender::LocalBlend' and 'Blender::LocalBlendMasked'
+        static void BlendPerBone( Pose const& source, Pose const& target, float blendWeight, BoneMask const* pBoneMask, bool isAdditive, TVector<Transform>& result )
+        {
+            int32_t const numBones = source.GetNumBones();
+            for ( int32_t i = 0; i < numBones; i++ )
+            {
+                float const boneBlendWeight = ( pBoneMask != nullptr ) ? blendWeight * pBoneMask->GetWeight( i ) : blendWeight;
+                Transform const& sourceTransform = source.GetTransform( i );
+                Transform const& targetTransform = target.GetTransform( i );
+
+                if ( isAdditive )
+                {
+                    Transform::DirectlySetRotation( result[i], Quaternion::SLerp( sourceTransform.GetRotation(), targetTransform.GetRotation() * sourceTransform.GetRotation(), boneBlendWeight ) );
+                    Transform::DirectlySetTranslationScale( result[i], Vector::MultiplyAdd( targetTransform.GetTranslationAndScale(), Vector( boneBlendWeight ), sourceTransform.GetTranslationAndScale() ) );
+                }
+                else
+                {
+                    Transform::DirectlySetRotation( result[i], Quaternion::FastSLerp( sourceTransform.GetRotation(), targetTransform.GetRotation(), boneBlendWeight ) );
+                    Transform::DirectlySetTranslationScale( result[i], Vector::Lerp( sourceTransform.GetTranslationAndScale(), targetTransform.GetTranslationAndScale(), boneBlendWeight ) );
+                }
+            }
+        }
+
+    public:
+
+        static void Run( int32_t numBones, int32_t numBlends )
+        {
+            Skeleton skeleton;
+            BenchmarkSkeletonBuilder::Create( skeleton, numBones );
+
+            Pose sourcePose( &skeleton );
+            Pose targetPose( &skeleton );
+            Pose resultPose( &skeleton );
+            SetRandomPose( sourcePose );
+            SetRandomPose( targetPose );
+
+            // Weights are never 0 or 1 so that every bone is actually blended
+            TVector<float> maskWeights( numBones );
+            Math::GetRandomFloats( maskWeights.data(), maskWeights.size(), 0.05f, 0.95f );
+            BoneMask boneMask( &skeleton );
+            boneMask.ResetWeights( maskWeights );
+
+            TVector<Transform> perBoneResult( numBones );
+            float const blendWeight = 0.35f;
+            float sink = 0.0f;
+
+            for ( bool const isAdditive : { false, true } )
+            {
+                for ( BoneMask const* pBoneMask : { (BoneMask const*) nullptr, (BoneMask const*) &boneMask } )
+                {
+                    Milliseconds perBoneTime, batchedTime;
+
+                    {
+                        ScopedTimer<PlatformClock> t( perBoneTime );
+                        for ( int32_t i = 0; i < numBlends; i++ )
+                        {
+                            BlendPerBone( sourcePose, targetPose, blendWeight, pBoneMask, isAdditive, perBoneResult );
+                            sink += perBoneResult[i % numBones].GetTranslation().GetX();
+                        }
+                    }
+
+                    {
+                        ScopedTimer<PlatformClock> t( batchedTime );
+                        for ( int32_t i = 0; i < numBlends; i++ )
+                        {
+                            if ( isAdditive )
+                            {
+                                Blender::AdditiveBlend( Skeleton::LOD::High, &sourcePose, &targetPose, blendWeight, pBoneMask, &resultPose );
+                            }
+                            else
+                            {
+                                Blender::LocalBlend( Skeleton::LOD::High, &sourcePose, &targetPose, blendWeight, pBoneMask, &resultPose, true );
+                            }
+                            sink += resultPose.GetTransform( i % numBones ).GetTranslation().GetX();
+                        }
+                    }
+
+                    float maxRotationError = 0.0f;
+                    for ( int32_t i = 0; i < numBones; i++ )
+                    {
+                        maxRotationError = Math::Max( maxRotationError, Quaternion::Distance( perBoneResult[i].GetRotation(), resultPose.GetTransform( i ).GetRotation() ).ToFloat() );
+                    }
+
+                    char const* pBlendMode = isAdditive ? "Additive" : "Local";
+                    char const* pBlendType = ( pBoneMask != nullptr ) ? "Masked" : "Full";
+                    std::cout << pBlendMode << " Blend " << pBlendType << " (Per-Bone, " << numBones << " bones, " << numBlends << " blends): " << perBoneTime.ToFloat() << "ms" << std::endl;
+                    std::cout << pBlendMode << " Blend " << pBlendType << " (4-Wide, " << numBones << " bones, " << numBlends << " blends): " << batchedTime.ToFloat() << "ms (Max Error: " << maxRotationError << " rad)" << std::endl;
+                }
+            }
+
+            std::cout << sink << std::endl;
+        }
+    };
+
+    //-------------------------------------------------------------------------
+
+    // Compares serial and parallel execution of a deep layered blend tree
+    class AnimationTaskSystemBenchmark
+    {
+        // A 2D blend space blends three inputs, each input is itself a 2D blend until we reach the leaf poses
+        static TaskIndex RegisterBlend2DTree( TaskSystem& taskSystem, int32_t depth )
+        {
+            if ( depth == 0 )
+            {
+                return taskSystem.RegisterTask<Tasks::DefaultPoseTask>( TaskSourceID( 0 ), Pose::Type::ReferencePose );
+            }
+
+            TaskIndex const inputA = RegisterBlend2DTree( taskSystem, depth - 1 );
+            TaskIndex const inputB = RegisterBlend2DTree( taskSystem, depth - 1 );
+            TaskIndex const inputC = RegisterBlend2DTree( taskSystem, depth - 1 );
+            TaskIndex const blendAB = taskSystem.RegisterTask<Tasks::BlendTask>( TaskSourceID( 0 ), inputA, inputB, 0.5f );
+            return taskSystem.RegisterTask<Tasks::BlendTask>( TaskSourceID( 0 ), blendAB, inputC, 0.3f );
+        }
+
+        // A depth 3 base blend space with 3 depth 2 layers on top of it, this stays below the task and pose buffer limits
+        static void RegisterLayeredGraph( TaskSystem& taskSystem )
+        {
+            TaskIndex resultTaskIdx = RegisterBlend2DTree( taskSystem, 3 );
+            for ( int32_t i = 0; i < 3; i++ )
+            {
+                TaskIndex const layerTaskIdx = RegisterBlend2DTree( taskSystem, 2 );
+                resultTaskIdx = taskSystem.RegisterTask<Tasks::BlendTask>( TaskSourceID( 0 ), resultTaskIdx, layerTaskIdx, 0.25f );
+            }
+        }
+
+    public:
+
+        static void Run( int32_t numBones, int32_t numFrames )
+        {
+            Skeleton skeleton;
+            BenchmarkSkeletonBuilder::Create( skeleton, numBones );
+
+            EE::TaskSystem workerTaskSystem( Threading::GetProcessorInfo().m_numLogicalCores );
+            workerTaskSystem.Initialize();
+
+            auto RunFrames = [&] ( TaskSystem& taskSystem, Milliseconds& outTime )
+            {
+                ScopedTimer<PlatformClock> t( outTime );
+                for ( int32_t i = 0; i < numFrames; i++ )
+                {
+                    taskSystem.Reset();
+                    RegisterLayeredGraph( taskSystem );
+                    taskSystem.UpdatePrePhysics( 1.0f / 30.0f, Transform::Identity, Transform::Identity );
+                    taskSystem.UpdatePostPhysics();
+                }
+            };
+
+            Milliseconds serialTime, parallelTime;
+            int32_t numTasks = 0;
+
+            {
+                TaskSystem taskSystem( &skeleton );
+                RunFrames( taskSystem, serialTime );
+                numTasks = (int32_t) taskSystem.GetRegisteredTasks().size();
+            }
+
+            {
+                TaskSystem taskSystem( &skeleton );
+                taskSystem.EnableParallelExecution( &workerTaskSystem );
+                RunFrames( taskSystem, parallelTime );
+                taskSystem.DisableParallelExecution();
+            }
+
+            workerTaskSystem.Shutdown();
+
+            std::cout << "Anim Tasks (Serial, " << numTasks << " tasks, " << numBones << " bones, " << numFrames << " frames): " << serialTime.ToFloat() << "ms" << std::endl;
+            std::cout << "Anim Tasks (Parallel, " << workerTaskSystem.GetNumWorkers() << " workers): " << parallelTime.ToFloat() << "ms" << std::endl;
+        }
+    };
+}
+
+//-------------------------------------------------------------------------
+
+namespace EE::Tester
+{
+    void RunAnimationClipBenchmark()
+    {
+        Animation::AnimationClipBenchmark::Run( 200, 60, 100000 );
+    }
+
+    void RunAnimationEventQueryTest()
+    {
+        Animation::AnimationEventQueryTest::Run( 500, 10000 );
+    }
+
+    void RunAnimationBlendBenchmark()
+    {
+        for ( int32_t numBones : { 50, 150, 300 } )
+        {
+            Animation::AnimationBlendBenchmark::Run( numBones, 100000 );
+        }
+    }
+
+    void RunAnimationTaskSystemBenchmark()
+    {
+        Animation::AnimationTaskSystemBenchmark::Run( 200, 2000 );
+    }
+}
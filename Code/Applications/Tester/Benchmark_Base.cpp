@@ -0,0 +1,341 @@
+#include "Tester.h"
+#include "Base/Types/StringID.h"
+#include "Base/Types/String.h"
+#include "Base/Math/MathRandom.h"
+#include "Base/Drawing/DebugDrawingSystem.h"
+#include "Base/Encoding/Hash.h"
+#include "Base/Threading/Threading.h"
+#include "Base/Threading/TaskSystem.h"
+#include "Base/Time/Timers.h"
+#include <iostream>
+#include <atomic>
+
+//-------------------------------------------------------------------------
+
+namespace EE
+{
+    // Measures StringID construction from a single thread and from all the task system workers at once
+    // Each string is constructed several times so that the parallel runs have multiple threads registering the same new strings concurrently
+    // The first run for a set of strings registers them in the intern table, the second run only finds the existing entries
+    class StringIDBenchmark
+    {
+        struct ConstructionTask final : public ITaskSet
+        {
+            ConstructionTask( TVector<String> const& strings, TVector<StringID>& outIDs )
+                : m_strings( strings )
+                , m_IDs( outIDs )
+            {
+                m_SetSize = (uint32_t) outIDs.size();
+                m_MinRange = 100;
+            }
+
+            virtual void ExecuteRange( TaskSetPartition range, uint32_t threadnum ) override final
+            {
+                for ( uint64_t i = range.start; i < range.end; ++i )
+                {
+                    m_IDs[i] = StringID( m_strings[i % m_strings.size()] );
+                }
+            }
+
+        private:
+
+            TVector<String> const&                  m_strings;
+            TVector<StringID>&                      m_IDs;
+        };
+
+    public:
+
+        static void Run( int32_t numStrings, int32_t numConstructionsPerString )
+        {
+            EE::TaskSystem taskSystem( Threading::GetProcessorInfo().m_numLogicalCores );
+            taskSystem.Initialize();
+
+            TVector<String> serialStrings, parallelStrings;
+            CreateStrings( "Serial", numStrings, serialStrings );
+            CreateStrings( "Parallel", numStrings, parallelStrings );
+
+            TVector<StringID> IDs;
+            IDs.resize( numStrings * numConstructionsPerString );
+
+            // Construction
+            //-------------------------------------------------------------------------
+
+            Milliseconds newSerialTime, existingSerialTime, newParallelTime, existingParallelTime;
+            bool succeeded = true;
+
+            for ( Milliseconds* pTime : { &newSerialTime, &existingSerialTime } )
+            {
+                ScopedTimer<PlatformClock> t( *pTime );
+                for ( size_t i = 0; i < IDs.size(); i++ )
+                {
+                    IDs[i] = StringID( serialStrings[i % serialStrings.size()] );
+                }
+            }
+
+            succeeded &= Validate( serialStrings, IDs );
+
+            for ( Milliseconds* pTime : { &newParallelTime, &existingParallelTime } )
+            {
+                ScopedTimer<PlatformClock> t( *pTime );
+                ConstructionTask task( parallelStrings, IDs );
+                taskSystem.ScheduleTask( &task );
+                taskSystem.WaitForTask( &task );
+            }
+
+            succeeded &= Validate( parallelStrings, IDs );
+
+            // Literal IDs must match runtime created IDs
+            //-------------------------------------------------------------------------
+
+            constexpr static StringID const s_literalID = StringID::FromLiteral( "StringID Benchmark Literal" );
+            succeeded &= ( s_literalID == StringID( "StringID Benchmark Literal" ) );
+
+            //-------------------------------------------------------------------------
+
+            taskSystem.Shutdown();
+
+            std::cout << "StringID Construction (Serial, " << numStrings << " strings, " << numConstructionsPerString << " constructions per string): " << newSerialTime.ToFloat() << "ms (new), " << existingSerialTime.ToFloat() << "ms (existing)" << std::endl;
+            std::cout << "StringID Construction (Parallel, " << taskSystem.GetNumWorkers() << " workers): " << newParallelTime.ToFloat() << "ms (new), " << existingParallelTime.ToFloat() << "ms (existing)" << std::endl;
+            std::cout << "StringID Construction: " << ( succeeded ? "PASSED" : "FAILED" ) << std::endl;
+        }
+
+    private:
+
+        static void CreateStrings( char const* pPrefix, int32_t numStrings, TVector<String>& outStrings )
+        {
+            char buffer[64];
+            outStrings.reserve( numStrings );
+            for ( int32_t i = 0; i < numStrings; i++ )
+            {
+                Printf( buffer, 64, "StringIDBenchmark_%s_%d", pPrefix, i );
+                outStrings.emplace_back( buffer );
+            }
+        }
+
+        // Every ID must match the hash of its string and must be able to return the registered string
+        static bool Validate( TVector<String> const& strings, TVector<StringID> const& IDs )
+        {
+            for ( size_t i = 0; i < IDs.size(); i++ )
+            {
+                String const& str = strings[i % strings.size()];
+                if ( IDs[i].ToUint() != Hash::XXHash::GetHash32( str ) )
+                {
+                    return false;
+                }
+
+                char const* pRegisteredString = IDs[i].c_str();
+                if ( pRegisteredString == nullptr || str != pRegisteredString )
+                {
+                    return false;
+                }
+            }
+
+            return true;
+        }
+    };
+
+    //-------------------------------------------------------------------------
+
+    // Measures random number generation contention with every logical core drawing at once
+    // Compares the old single mutex-guarded generator against the per-thread streams and the per-thread batched API
+    class RandomBenchmark
+    {
+    public:
+
+        static void Run( int32_t numDrawsPerThread, int32_t batchSize )
+        {
+            uint32_t const numThreads = Math::Max<uint32_t>( 1, Threading::GetProcessorInfo().m_numLogicalCores );
+            std::atomic<uint32_t> sink = 0;
+
+            // Single shared generator behind a mutex
+            //-------------------------------------------------------------------------
+
+            Math::RNG sharedRNG;
+            Threading::Mutex sharedRNGMutex;
+            Milliseconds const sharedTime = RunOnAllThreads( numThreads, [&] ()
+            {
+                float sum = 0.0f;
+                for ( int32_t i = 0; i < numDrawsPerThread; i++ )
+                {
+                    Threading::ScopeLock lock( sharedRNGMutex );
+                    sum += sharedRNG.GetFloat();
+                }
+                sink += (uint32_t) sum;
+            } );
+
+            // Per-thread streams
+            //-------------------------------------------------------------------------
+
+            Milliseconds const perThreadTime = RunOnAllThreads( numThreads, [&] ()
+            {
+                float sum = 0.0f;
+                for ( int32_t i = 0; i < numDrawsPerThread; i++ )
+                {
+                    sum += Math::GetRandomFloat();
+                }
+                sink += (uint32_t) sum;
+            } );
+
+            // Per-thread streams with batch generation
+            //-------------------------------------------------------------------------
+
+            Milliseconds const batchedTime = RunOnAllThreads( numThreads, [&] ()
+            {
+                TVector<float> values( batchSize );
+                float sum = 0.0f;
+                for ( int32_t i = 0; i < numDrawsPerThread; i += batchSize )
+                {
+                    Math::GetRandomFloats( values.data(), values.size() );
+                    sum += values[0];
+                }
+                sink += (uint32_t) sum;
+            } );
+
+            //-------------------------------------------------------------------------
+
+            bool const succeeded = ValidateStreams( 1234, batchSize );
+
+            std::cout << "Random (Shared Mutex, " << numThreads << " threads): " << sharedTime.ToFloat() << "ms" << std::endl;
+            std::cout << "Random (Per-Thread, " << numThreads << " threads): " << perThreadTime.ToFloat() << "ms" << std::endl;
+            std::cout << "Random (Per-Thread Batched, " << numThreads << " threads): " << batchedTime.ToFloat() << "ms (" << sink.load() << ")" << std::endl;
+            std::cout << "Random Streams: " << ( succeeded ? "PASSED" : "FAILED" ) << std::endl;
+        }
+
+    private:
+
+        template<typename F>
+        static Milliseconds RunOnAllThreads( uint32_t numThreads, F&& func )
+        {
+            Milliseconds time;
+            ScopedTimer<PlatformClock> t( time );
+
+            TVector<Threading::Thread> threads;
+            for ( uint32_t i = 0; i < numThreads; i++ )
+            {
+                threads.emplace_back( func );
+            }
+
+            for ( auto& thread : threads )
+            {
+                thread.join();
+            }
+
+            return time;
+        }
+
+        // Generators with the same seed and stream must produce identical sequences, different streams must diverge
+        static bool ValidateStreams( uint32_t seed, int32_t numValues )
+        {
+            TVector<float> valuesA( numValues ), valuesB( numValues ), valuesOtherStream( numValues );
+
+            Math::RNG rngA( seed, 7 );
+            Math::RNG rngB( seed, 7 );
+            Math::RNG rngOtherStream( seed, 8 );
+
+            rngA.GetFloats( valuesA.data(), valuesA.size() );
+            rngB.GetFloats( valuesB.data(), valuesB.size() );
+            rngOtherStream.GetFloats( valuesOtherStream.data(), valuesOtherStream.size() );
+
+            if ( valuesA != valuesB )
+            {
+                return false;
+            }
+
+            int32_t numMatchingValues = 0;
+            for ( int32_t i = 0; i < numValues; i++ )
+            {
+                if ( valuesA[i] == valuesOtherStream[i] )
+                {
+                    numMatchingValues++;
+                }
+            }
+
+            return numMatchingValues < numValues;
+        }
+    };
+
+    //-------------------------------------------------------------------------
+
+    #if EE_DEVELOPMENT_TOOLS
+    // Simulates the frame loop of the drawing system: reset at the start of the frame, record, then flip at the end of the frame
+    // Commands with a TTL must survive frame resets and flips until their TTL expires, all other commands only last a single frame
+    class DebugDrawingTest
+    {
+    public:
+
+        static void Run( int32_t numFrames, Seconds frameDeltaTime )
+        {
+            Drawing::DrawingSystem drawingSystem;
+            Seconds const TTL = frameDeltaTime.ToFloat() * ( numFrames + 0.5f );
+            bool succeeded = true;
+
+            // Record a TTL command and a single frame command
+            drawingSystem.Reset();
+            {
+                auto ctx = drawingSystem.GetDrawingContext();
+                ctx.DrawLine( Float3( 0, 0, 0 ), Float3( 1, 0, 0 ), Float4( 1, 0, 0, 1 ), 1.0f, Drawing::DepthTest::Disable, TTL );
+                ctx.DrawLine( Float3( 0, 0, 0 ), Float3( 0, 1, 0 ), Float4( 0, 1, 0, 1 ), 1.0f, Drawing::DepthTest::Disable );
+            }
+            drawingSystem.FlipFrameCommandBuffers( frameDeltaTime );
+            succeeded &= ( GetNumFrameLineCommands( drawingSystem ) == 2 );
+
+            // Only the TTL command should remain for the following frames
+            for ( int32_t i = 0; i < numFrames; i++ )
+            {
+                drawingSystem.Reset();
+                succeeded &= ( GetNumFrameLineCommands( drawingSystem ) == ( i == 0 ? 2 : 1 ) );
+                drawingSystem.FlipFrameCommandBuffers( frameDeltaTime );
+                succeeded &= ( GetNumFrameLineCommands( drawingSystem ) == 1 );
+            }
+
+            // Once the TTL has expired, the command should be removed
+            drawingSystem.Reset();
+            drawingSystem.FlipFrameCommandBuffers( frameDeltaTime );
+            succeeded &= ( GetNumFrameLineCommands( drawingSystem ) == 0 );
+
+            std::cout << "Debug Drawing TTL (" << numFrames << " frames): " << ( succeeded ? "PASSED" : "FAILED" ) << std::endl;
+        }
+
+    private:
+
+        static size_t GetNumFrameLineCommands( Drawing::DrawingSystem const& drawingSystem )
+        {
+            TInlineVector<Drawing::ThreadCommandBuffer const*, 32> frameBuffers;
+            drawingSystem.GetFrameCommandBuffers( frameBuffers );
+
+            size_t numCommands = 0;
+            for ( auto pBuffer : frameBuffers )
+            {
+                numCommands += pBuffer->GetOpaqueDepthTestEnabledBuffer().m_lineCommands.size();
+                numCommands += pBuffer->GetOpaqueDepthTestDisabledBuffer().m_lineCommands.size();
+                numCommands += pBuffer->GetTransparentDepthTestEnabledBuffer().m_lineCommands.size();
+                numCommands += pBuffer->GetTransparentDepthTestDisabledBuffer().m_lineCommands.size();
+            }
+
+            return numCommands;
+        }
+    };
+    #endif
+}
+
+//-------------------------------------------------------------------------
+
+namespace EE::Tester
+{
+    void RunStringIDBenchmark()
+    {
+        StringIDBenchmark::Run( 100000, 4 );
+    }
+
+    void RunRandomBenchmark()
+    {
+        RandomBenchmark::Run( 1000000, 256 );
+    }
+
+    void RunDebugDrawingTest()
+    {
+        #if EE_DEVELOPMENT_TOOLS
+        DebugDrawingTest::Run( 8, Seconds( 1.0f / 60 ) );
+        #endif
+    }
+}
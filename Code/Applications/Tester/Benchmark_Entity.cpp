@@ -0,0 +1,800 @@
+#include "Tester.h"
+#include "Engine/Entity/EntityWorld.h"
+#include "Engine/Entity/EntityWorldManager.h"
+#include "Engine/Entity/EntityComponentStorage.h"
+#include "Engine/Entity/EntityDescriptors.h"
+#include "Engine/Entity/EntitySerialization.h"
+#include "Engine/Render/Components/Component_Lights.h"
+#include "Engine/Render/Components/Component_StaticMesh.h"
+#include "Engine/Physics/Systems/WorldSystem_Physics.h"
+#include "Engine/Animation/Systems/WorldSystem_Animation.h"
+#include "Engine/AI/Systems/WorldSystem_AIManager.h"
+#include "Engine/Entity/Systems/WorldSystem_EntityCollectionSpawner.h"
+#include "Engine/Player/Systems/WorldSystem_PlayerManager.h"
+#include "Engine/Camera/Systems/WorldSystem_CameraManager.h"
+#include "Engine/UpdateContext.h"
+#include "Base/Resource/ResourceSystem.h"
+#include "Base/TypeSystem/TypeRegistry.h"
+#include "Base/Threading/TaskSystem.h"
+#include "Base/Math/MathRandom.h"
+#include "Base/Types/Set.h"
+#include "Base/Time/Timers.h"
+#include <iostream>
+
+//-------------------------------------------------------------------------
+
+namespace EE
+{
+    // The minimal set of systems needed to create and update entity worlds outside of the engine
+    // Worlds are created without any world systems, and all entities are built from resource-free spatial components (point lights)
+    // The type registry only contains the point light component type, which is enough to create entities from serialized descriptors
+    class EntityTestEnvironment
+    {
+        class TestUpdateContext final : public UpdateContext
+        {
+        public:
+
+            TestUpdateContext( SystemRegistry* pSystemRegistry ) { m_pSystemRegistry = pSystemRegistry; }
+
+            inline void StartFrame() { UpdateDeltaTime( Milliseconds( 1000.0f / 60.0f ) ); m_stage = UpdateStage::FrameStart; }
+            inline void SetStage( UpdateStage stage ) { m_stage = stage; }
+        };
+
+    public:
+
+        EntityTestEnvironment()
+            : m_taskSystem( Threading::GetProcessorInfo().m_numLogicalCores )
+            , m_resourceSystem( m_taskSystem )
+            , m_updateContext( &m_systemRegistry )
+        {
+            m_taskSystem.Initialize();
+            m_typeRegistry.RegisterType( Render::PointLightComponent::s_pTypeInfo );
+            m_systemRegistry.RegisterSystem( &m_taskSystem );
+            m_systemRegistry.RegisterSystem( &m_typeRegistry );
+            m_systemRegistry.RegisterSystem( &m_resourceSystem );
+        }
+
+        ~EntityTestEnvironment()
+        {
+            m_systemRegistry.UnregisterSystem( &m_resourceSystem );
+            m_systemRegistry.UnregisterSystem( &m_typeRegistry );
+            m_systemRegistry.UnregisterSystem( &m_taskSystem );
+            m_typeRegistry.UnregisterType( Render::PointLightComponent::s_pTypeInfo );
+            m_taskSystem.Shutdown();
+        }
+
+        inline TaskSystem* GetTaskSystem() { return &m_taskSystem; }
+        inline TypeSystem::TypeRegistry const& GetTypeRegistry() const { return m_typeRegistry; }
+
+        // Worlds
+        //-------------------------------------------------------------------------
+
+        EntityWorld* CreateWorld()
+        {
+            auto pWorld = EE::New<EntityWorld>( EntityWorldType::Tools );
+            pWorld->Initialize( m_systemRegistry, {} );
+            return pWorld;
+        }
+
+        void DestroyWorld( EntityWorld*& pWorld )
+        {
+            pWorld->Shutdown();
+            EE::Delete( pWorld );
+        }
+
+        // Run the loading update until all entity additions and removals have completed
+        void CompleteLoading( EntityWorld* pWorld )
+        {
+            while ( pWorld->HasPendingMapChangeActions() )
+            {
+                pWorld->UpdateLoading();
+            }
+        }
+
+        // Start a new frame and run the loading for the supplied worlds, this also resolves any pending transforms
+        void StartFrame( TInlineVector<EntityWorld*, 5>& worlds )
+        {
+            m_updateContext.StartFrame();
+
+            for ( auto pWorld : worlds )
+            {
+                pWorld->UpdateLoading();
+            }
+        }
+
+        // Run all the frame's update stages for the supplied worlds, this must be called after StartFrame
+        void UpdateWorlds( TInlineVector<EntityWorld*, 5>& worlds, bool updateInParallel )
+        {
+            for ( auto stage : { UpdateStage::FrameStart, UpdateStage::PrePhysics, UpdateStage::Physics, UpdateStage::PostPhysics, UpdateStage::FrameEnd } )
+            {
+                m_updateContext.SetStage( stage );
+                EntityWorldManager::RunWorldUpdates( &m_taskSystem, m_updateContext, worlds, updateInParallel );
+            }
+        }
+
+        // Entities
+        //-------------------------------------------------------------------------
+
+        // Create an entity with a root point light and a chain of attached point lights
+        static Entity* CreateEntity( int32_t numChildren )
+        {
+            auto pEntity = EE::New<Entity>( StringID( "Entity" ) );
+
+            ComponentID parentID;
+            for ( int32_t i = 0; i <= numChildren; i++ )
+            {
+                auto pComponent = EE::New<Render::PointLightComponent>();
+                pEntity->AddComponent( pComponent, parentID );
+                parentID = pComponent->GetID();
+            }
+
+            return pEntity;
+        }
+
+    private:
+
+        EE::TaskSystem                      m_taskSystem;
+        TypeSystem::TypeRegistry            m_typeRegistry;
+        Resource::ResourceSystem            m_resourceSystem;
+        SystemRegistry                      m_systemRegistry;
+        TestUpdateContext                   m_updateContext;
+    };
+
+    //-------------------------------------------------------------------------
+
+    // Runs N worlds with entity churn and deferred transform updates, with the worlds updated either serially or concurrently.
+    // Every frame, each world destroys and re-adds a portion of its entities on the main thread (loading) and then moves all its remaining
+    // entities, the deferred transforms are then resolved inside each world's update (i.e. on the worker threads when updating in parallel).
+    class MultiWorldStressTest
+    {
+    public:
+
+        static void Run( int32_t numWorlds, int32_t numEntitiesPerWorld, int32_t numFrames )
+        {
+            EntityTestEnvironment environment;
+
+            Milliseconds serialTime, parallelTime;
+            bool const serialSucceeded = RunWorlds( environment, numWorlds, numEntitiesPerWorld, numFrames, false, serialTime );
+            bool const parallelSucceeded = RunWorlds( environment, numWorlds, numEntitiesPerWorld, numFrames, true, parallelTime );
+
+            std::cout << "Multi-World Update (Serial, " << numWorlds << " worlds, " << numEntitiesPerWorld << " entities per world, " << numFrames << " frames): " << serialTime.ToFloat() << "ms" << ( serialSucceeded ? "" : " FAILED" ) << std::endl;
+            std::cout << "Multi-World Update (Parallel, " << environment.GetTaskSystem()->GetNumWorkers() << " workers): " << parallelTime.ToFloat() << "ms" << ( parallelSucceeded ? "" : " FAILED" ) << std::endl;
+        }
+
+    private:
+
+        static bool RunWorlds( EntityTestEnvironment& environment, int32_t numWorlds, int32_t numEntitiesPerWorld, int32_t numFrames, bool updateInParallel, Milliseconds& outTime )
+        {
+            constexpr static int32_t const numChildrenPerEntity = 4;
+            int32_t const numEntitiesToReplacePerFrame = Math::Max( 1, numEntitiesPerWorld / 20 );
+
+            TInlineVector<EntityWorld*, 5> worlds;
+            TVector<TVector<Entity*>> worldEntities;
+            worldEntities.resize( numWorlds );
+
+            for ( int32_t i = 0; i < numWorlds; i++ )
+            {
+                auto pWorld = worlds.emplace_back( environment.CreateWorld() );
+                pWorld->SetDeferredTransformUpdateEnabled( true );
+
+                for ( int32_t j = 0; j < numEntitiesPerWorld; j++ )
+                {
+                    auto pEntity = worldEntities[i].emplace_back( EntityTestEnvironment::CreateEntity( numChildrenPerEntity ) );
+                    pWorld->GetPersistentMap()->AddEntity( pEntity );
+                }
+
+                environment.CompleteLoading( pWorld );
+            }
+
+            //-------------------------------------------------------------------------
+
+            {
+                ScopedTimer<PlatformClock> t( outTime );
+
+                for ( int32_t frameIdx = 0; frameIdx < numFrames; frameIdx++ )
+                {
+                    // Replace some of the entities
+                    for ( int32_t i = 0; i < numWorlds; i++ )
+                    {
+                        auto pMap = worlds[i]->GetPersistentMap();
+                        auto& entities = worldEntities[i];
+
+                        for ( int32_t j = 0; j < numEntitiesToReplacePerFrame; j++ )
+                        {
+                            int32_t const entityIdx = (int32_t) Math::GetRandomInt( 0, (int32_t) entities.size() - 1 );
+                            pMap->DestroyEntity( entities[entityIdx]->GetID() );
+
+                            entities[entityIdx] = EntityTestEnvironment::CreateEntity( numChildrenPerEntity );
+                            pMap->AddEntity( entities[entityIdx] );
+                        }
+                    }
+
+                    environment.StartFrame( worlds );
+
+                    // Move all entities after the loading, these are only queued and will be resolved as part of the world updates
+                    Transform const frameTransform = Transform::FromTranslation( Vector( (float) frameIdx, 0.0f, 0.0f ) );
+                    for ( int32_t i = 0; i < numWorlds; i++ )
+                    {
+                        for ( auto pEntity : worldEntities[i] )
+                        {
+                            if ( pEntity->IsInitialized() )
+                            {
+                                pEntity->SetWorldTransform( frameTransform );
+                            }
+                        }
+                    }
+
+                    environment.UpdateWorlds( worlds, updateInParallel );
+                }
+            }
+
+            // Validate that all worlds ended up with the expected entities
+            //-------------------------------------------------------------------------
+
+            bool succeeded = true;
+
+            for ( int32_t i = 0; i < numWorlds; i++ )
+            {
+                environment.CompleteLoading( worlds[i] );
+
+                auto pMap = worlds[i]->GetPersistentMap();
+                if ( pMap->GetNumEntities() != numEntitiesPerWorld )
+                {
+                    succeeded = false;
+                }
+
+                for ( auto pEntity : worldEntities[i] )
+                {
+                    if ( !pEntity->IsInitialized() || !pMap->ContainsEntity( pEntity->GetID() ) )
+                    {
+                        succeeded = false;
+                    }
+                }
+
+                environment.DestroyWorld( worlds[i] );
+            }
+
+            return succeeded;
+        }
+    };
+
+    //-------------------------------------------------------------------------
+
+    // Applies the same sequence of transform changes to a world with immediate transform updates and a world with deferred transform updates and compares the results.
+    // Small entity counts exercise the serial resolve while larger counts exercise the parallel resolve. Each frame, for every entity (a chain of 4 components):
+    // a child's world transform is set and then the root is moved (the child needs to move with the root), a local transform is set and the last child's world
+    // transform is set directly while its ancestors are waiting to be resolved.
+    class TransformResolverTest
+    {
+        constexpr static int32_t const s_numChildrenPerEntity = 3;
+        constexpr static int32_t const s_numComponentsPerEntity = s_numChildrenPerEntity + 1;
+
+    public:
+
+        static void Run( int32_t numEntities, int32_t numFrames )
+        {
+            EntityTestEnvironment environment;
+
+            TInlineVector<EntityWorld*, 5> worlds;
+            EntityWorld* pImmediateWorld = worlds.emplace_back( environment.CreateWorld() );
+            EntityWorld* pDeferredWorld = worlds.emplace_back( environment.CreateWorld() );
+            pDeferredWorld->SetDeferredTransformUpdateEnabled( true );
+
+            // Create the same entities in both worlds
+            //-------------------------------------------------------------------------
+
+            TVector<Transform> transforms;
+            GenerateTransforms( numEntities * s_numComponentsPerEntity, transforms );
+
+            TVector<SpatialEntityComponent*> immediateComponents;
+            TVector<SpatialEntityComponent*> deferredComponents;
+            CreateEntities( pImmediateWorld, transforms, immediateComponents );
+            CreateEntities( pDeferredWorld, transforms, deferredComponents );
+
+            environment.CompleteLoading( pImmediateWorld );
+            environment.CompleteLoading( pDeferredWorld );
+
+            // Run frames
+            //-------------------------------------------------------------------------
+
+            bool succeeded = true;
+
+            for ( int32_t frameIdx = 0; frameIdx < numFrames; frameIdx++ )
+            {
+                environment.StartFrame( worlds );
+
+                GenerateTransforms( numEntities * 4, transforms );
+                ApplyTransforms( transforms, immediateComponents );
+                ApplyTransforms( transforms, deferredComponents );
+
+                environment.UpdateWorlds( worlds, false );
+
+                succeeded &= CompareTransforms( immediateComponents, deferredComponents );
+            }
+
+            environment.DestroyWorld( worlds[0] );
+            environment.DestroyWorld( worlds[1] );
+
+            std::cout << "Deferred Transforms (" << numEntities << " entities, " << numFrames << " frames): " << ( succeeded ? "PASSED" : "FAILED" ) << std::endl;
+        }
+
+    private:
+
+        static void GenerateTransforms( int32_t numTransforms, TVector<Transform>& outTransforms )
+        {
+            outTransforms.clear();
+            for ( int32_t i = 0; i < numTransforms; i++ )
+            {
+                Quaternion const rotation( Radians( Math::GetRandomFloat( -Math::Pi, Math::Pi ) ), Radians( Math::GetRandomFloat( -Math::Pi, Math::Pi ) ), Radians( Math::GetRandomFloat( -Math::Pi, Math::Pi ) ) );
+                Vector const translation( Math::GetRandomFloat( -10, 10 ), Math::GetRandomFloat( -10, 10 ), Math::GetRandomFloat( -10, 10 ) );
+                outTransforms.emplace_back( Transform( rotation, translation ) );
+            }
+        }
+
+        static void CreateEntities( EntityWorld* pWorld, TVector<Transform> const& localTransforms, TVector<SpatialEntityComponent*>& outComponents )
+        {
+            int32_t const numEntities = (int32_t) localTransforms.size() / s_numComponentsPerEntity;
+            for ( int32_t i = 0; i < numEntities; i++ )
+            {
+                auto pEntity = EntityTestEnvironment::CreateEntity( s_numChildrenPerEntity );
+                for ( auto pComponent : pEntity->GetComponents() )
+                {
+                    auto pSpatialComponent = outComponents.emplace_back( Cast<SpatialEntityComponent>( pComponent ) );
+                    pSpatialComponent->SetLocalTransform( localTransforms[outComponents.size() - 1] );
+                }
+
+                pWorld->GetPersistentMap()->AddEntity( pEntity );
+            }
+        }
+
+        static void ApplyTransforms( TVector<Transform> const& transforms, TVector<SpatialEntityComponent*>& components )
+        {
+            int32_t const numEntities = (int32_t) components.size() / s_numComponentsPerEntity;
+            for ( int32_t i = 0; i < numEntities; i++ )
+            {
+                SpatialEntityComponent** pEntityComponents = &components[i * s_numComponentsPerEntity];
+                Transform const* pTransforms = &transforms[i * 4];
+
+                // Set a child's world transform and then move the root, the child needs to move with the root
+                pEntityComponents[2]->SetWorldTransform( pTransforms[0] );
+                pEntityComponents[0]->SetWorldTransform( pTransforms[1] );
+
+                // Set a local transform within a dirty hierarchy
+                pEntityComponents[1]->SetLocalTransform( pTransforms[2] );
+
+                // Set the last child's world transform directly while all its ancestors are dirty
+                pEntityComponents[3]->SetWorldTransform( pTransforms[3] );
+            }
+        }
+
+        static bool CompareTransforms( TVector<SpatialEntityComponent*> const& immediateComponents, TVector<SpatialEntityComponent*> const& deferredComponents )
+        {
+            for ( int32_t i = 0; i < (int32_t) immediateComponents.size(); i++ )
+            {
+                if ( deferredComponents[i]->IsTransformDirty() )
+                {
+                    return false;
+                }
+
+                Transform const& immediateTransform = immediateComponents[i]->GetWorldTransform();
+                Transform const& deferredTransform = deferredComponents[i]->GetWorldTransform();
+
+                if ( !immediateTransform.GetTranslation().IsNearEqual3( deferredTransform.GetTranslation(), 0.001f ) )
+                {
+                    return false;
+                }
+
+                if ( !immediateTransform.GetForwardVector().IsNearEqual3( deferredTransform.GetForwardVector(), 0.001f ) || !immediateTransform.GetUpVector().IsNearEqual3( deferredTransform.GetUpVector(), 0.001f ) )
+                {
+                    return false;
+                }
+            }
+
+            return true;
+        }
+    };
+
+    //-------------------------------------------------------------------------
+
+    // Validates the pooled component storage: slot allocation, ownership, handles, slot reuse and iteration over the components of entities in a world
+    class ComponentStorageTest
+    {
+    public:
+
+        static void Run( int32_t numComponents )
+        {
+            TypeSystem::TypeRegistry typeRegistry;
+
+            EntityModel::SerializedComponentDescriptor componentDesc;
+            componentDesc.m_typeID = Render::PointLightComponent::GetStaticTypeID();
+            componentDesc.m_name = StringID( "Light" );
+            componentDesc.m_isSpatialComponent = true;
+
+            std::cout << "Component Pool (Allocation, " << numComponents << " components): " << ( TestAllocation( typeRegistry, componentDesc, numComponents ) ? "PASSED" : "FAILED" ) << std::endl;
+            std::cout << "Component Pool (Reuse, " << numComponents << " components): " << ( TestReuse( typeRegistry, componentDesc, numComponents ) ? "PASSED" : "FAILED" ) << std::endl;
+
+            #if EE_DEVELOPMENT_TOOLS
+            std::cout << "Component Pool (Iteration, " << numComponents << " entities): " << ( TestIteration( componentDesc, numComponents ) ? "PASSED" : "FAILED" ) << std::endl;
+            #endif
+        }
+
+    private:
+
+        static bool TestAllocation( TypeSystem::TypeRegistry const& typeRegistry, EntityModel::SerializedComponentDescriptor const& componentDesc, int32_t numComponents )
+        {
+            bool succeeded = true;
+
+            EntityModel::ComponentPool pool( Render::PointLightComponent::s_pTypeInfo );
+            EntityModel::ComponentPool otherPool( Render::PointLightComponent::s_pTypeInfo );
+            pool.Reserve( numComponents );
+
+            TVector<EntityComponent*> components;
+            TVector<EntityModel::ComponentHandle> handles;
+            for ( int32_t i = 0; i < numComponents; i++ )
+            {
+                auto pComponent = components.emplace_back( pool.CreateComponent( typeRegistry, componentDesc ) );
+                handles.emplace_back( pool.GetHandle( pComponent ) );
+            }
+
+            succeeded &= pool.GetNumComponents() == numComponents;
+
+            // All components are unique and owned by the pool, and their handles resolve back to them
+            TUnorderedSet<EntityComponent*> uniqueComponents( components.begin(), components.end() );
+            succeeded &= (int32_t) uniqueComponents.size() == numComponents;
+
+            for ( int32_t i = 0; i < numComponents; i++ )
+            {
+                succeeded &= pool.OwnsComponent( components[i] );
+                succeeded &= handles[i].IsValid() && pool.GetComponent( handles[i] ) == components[i];
+            }
+
+            // Components from another pool or from the heap are not owned, even if they have a valid slot index
+            auto pOtherPoolComponent = otherPool.CreateComponent( typeRegistry, componentDesc );
+            auto pHeapComponent = EE::New<Render::PointLightComponent>();
+            succeeded &= !pool.OwnsComponent( pOtherPoolComponent ) && !pool.GetHandle( pOtherPoolComponent ).IsValid();
+            succeeded &= !pool.OwnsComponent( pHeapComponent ) && otherPool.OwnsComponent( pOtherPoolComponent );
+            EE::Delete( pHeapComponent );
+            otherPool.DestroyComponent( pOtherPoolComponent );
+
+            //-------------------------------------------------------------------------
+
+            for ( auto pComponent : components )
+            {
+                pool.DestroyComponent( pComponent );
+            }
+
+            succeeded &= pool.GetNumComponents() == 0;
+            return succeeded;
+        }
+
+        static bool TestReuse( TypeSystem::TypeRegistry const& typeRegistry, EntityModel::SerializedComponentDescriptor const& componentDesc, int32_t numComponents )
+        {
+            bool succeeded = true;
+
+            EntityModel::ComponentPool pool( Render::PointLightComponent::s_pTypeInfo );
+            pool.Reserve( numComponents );
+
+            TVector<EntityComponent*> components;
+            for ( int32_t i = 0; i < numComponents; i++ )
+            {
+                components.emplace_back( pool.CreateComponent( typeRegistry, componentDesc ) );
+            }
+
+            // Destroy every other component, their handles need to be invalidated
+            TVector<EntityModel::ComponentHandle> destroyedHandles;
+            TUnorderedSet<EntityComponent*> freedSlots;
+            for ( int32_t i = 0; i < numComponents; i += 2 )
+            {
+                destroyedHandles.emplace_back( pool.GetHandle( components[i] ) );
+                freedSlots.insert( components[i] );
+                pool.DestroyComponent( components[i] );
+                components[i] = nullptr;
+            }
+
+            for ( auto const& handle : destroyedHandles )
+            {
+                succeeded &= pool.GetComponent( handle ) == nullptr;
+            }
+
+            // New components need to reuse the freed slots, and the old handles must not resolve to the new components
+            for ( int32_t i = 0; i < numComponents; i += 2 )
+            {
+                components[i] = pool.CreateComponent( typeRegistry, componentDesc );
+                succeeded &= freedSlots.erase( components[i] ) == 1;
+            }
+
+            succeeded &= freedSlots.empty() && pool.GetNumComponents() == numComponents;
+
+            for ( auto const& handle : destroyedHandles )
+            {
+                succeeded &= pool.GetComponent( handle ) == nullptr;
+            }
+
+            //-------------------------------------------------------------------------
+
+            for ( auto pComponent : components )
+            {
+                pool.DestroyComponent( pComponent );
+            }
+
+            return succeeded;
+        }
+
+        #if EE_DEVELOPMENT_TOOLS
+        // Create entities from a collection using the pooled storage and check that iteration visits exactly the components of the initialized entities
+        static bool TestIteration( EntityModel::SerializedComponentDescriptor const& componentDesc, int32_t numEntities )
+        {
+            bool succeeded = true;
+
+            EntityTestEnvironment environment;
+            EntityModel::ComponentStorage storage;
+
+            EntityModel::SerializedEntityCollection collection;
+            {
+                TVector<EntityModel::SerializedEntityDescriptor> entityDescs;
+                for ( int32_t i = 0; i < numEntities; i++ )
+                {
+                    char name[32];
+                    Printf( name, 32, "Entity_%d", i );
+
+                    auto& entityDesc = entityDescs.emplace_back();
+                    entityDesc.m_name = StringID( name );
+                    entityDesc.m_components.emplace_back( componentDesc );
+                    entityDesc.m_numSpatialComponents = 1;
+                }
+                collection.SetCollectionData( eastl::move( entityDescs ) );
+            }
+
+            EntityWorld* pWorld = environment.CreateWorld();
+            auto pMap = pWorld->GetPersistentMap();
+
+            auto CountPooledComponents = [&] ()
+            {
+                int32_t numVisited = 0;
+                storage.ForEach<Render::PointLightComponent>( [&] ( Render::PointLightComponent* pComponent )
+                {
+                    succeeded &= pComponent->IsInitialized() && pMap->ContainsEntity( pComponent->GetEntityID() );
+                    numVisited++;
+                } );
+                return numVisited;
+            };
+
+            // Create all entities
+            TVector<Entity*> entities = EntityModel::Serializer::CreateEntities( environment.GetTaskSystem(), environment.GetTypeRegistry(), collection, &storage );
+            for ( auto pEntity : entities )
+            {
+                pMap->AddEntity( pEntity );
+            }
+            environment.CompleteLoading( pWorld );
+            succeeded &= CountPooledComponents() == numEntities;
+
+            // Destroy half of the entities, their components are returned to the pool
+            for ( int32_t i = 0; i < numEntities; i += 2 )
+            {
+                pMap->DestroyEntity( entities[i]->GetID() );
+            }
+            environment.CompleteLoading( pWorld );
+            succeeded &= CountPooledComponents() == ( numEntities / 2 ) && storage.GetPool( Render::PointLightComponent::GetStaticTypeID() )->GetNumComponents() == ( numEntities / 2 );
+
+            // Create a new set of entities reusing the freed slots
+            entities = EntityModel::Serializer::CreateEntities( environment.GetTaskSystem(), environment.GetTypeRegistry(), collection, &storage );
+            for ( auto pEntity : entities )
+            {
+                pMap->AddEntity( pEntity );
+            }
+            environment.CompleteLoading( pWorld );
+            succeeded &= CountPooledComponents() == ( numEntities + ( numEntities / 2 ) );
+
+            //-------------------------------------------------------------------------
+
+            environment.DestroyWorld( pWorld );
+            succeeded &= storage.GetPool( Render::PointLightComponent::GetStaticTypeID() )->GetNumComponents() == 0;
+            storage.Shutdown();
+
+            return succeeded;
+        }
+        #endif
+    };
+
+    //-------------------------------------------------------------------------
+
+    // Compares looking up entities by searching each map in turn (how the world used to find entities) with the world entity index and with entity handles
+    // The entities are spread evenly across several maps and are looked up in a random order
+    class EntityLookupBenchmark
+    {
+    public:
+
+        static void Run( int32_t numEntities, int32_t numMaps, int32_t numIterations )
+        {
+            EntityTestEnvironment environment;
+            EntityWorld* pWorld = environment.CreateWorld();
+
+            // Spread the entities across the maps
+            //-------------------------------------------------------------------------
+
+            TVector<EntityModel::EntityMap*> maps;
+            maps.emplace_back( pWorld->GetPersistentMap() );
+            for ( int32_t i = 1; i < numMaps; i++ )
+            {
+                maps.emplace_back( pWorld->CreateTransientMap() );
+            }
+
+            TVector<Entity*> entities;
+            entities.reserve( numEntities );
+            for ( int32_t i = 0; i < numEntities; i++ )
+            {
+                auto pEntity = entities.emplace_back( EE::New<Entity>( StringID( "Entity" ) ) );
+                maps[i % numMaps]->AddEntity( pEntity );
+            }
+
+            environment.CompleteLoading( pWorld );
+
+            TVector<EntityID> lookupIDs;
+            TVector<EntityHandle> lookupHandles;
+            lookupIDs.reserve( numEntities );
+            lookupHandles.reserve( numEntities );
+            for ( int32_t i = 0; i < numEntities; i++ )
+            {
+                EntityID const entityID = entities[Math::GetRandomInt( 0, numEntities - 1 )]->GetID();
+                lookupIDs.emplace_back( entityID );
+                lookupHandles.emplace_back( pWorld->GetEntityHandle( entityID ) );
+            }
+
+            // Lookups
+            //-------------------------------------------------------------------------
+
+            Milliseconds mapSearchTime, indexTime, handleTime;
+            int32_t numFoundByMapSearch = 0, numFoundByIndex = 0, numFoundByHandle = 0;
+
+            {
+                ScopedTimer<PlatformClock> t( mapSearchTime );
+                for ( int32_t j = 0; j < numIterations; j++ )
+                {
+                    numFoundByMapSearch = 0;
+                    for ( EntityID const& entityID : lookupIDs )
+                    {
+                        for ( auto pMap : maps )
+                        {
+                            if ( pMap->FindEntity( entityID ) != nullptr )
+                            {
+                                numFoundByMapSearch++;
+                                break;
+                            }
+                        }
+                    }
+                }
+            }
+
+            {
+                ScopedTimer<PlatformClock> t( indexTime );
+                for ( int32_t j = 0; j < numIterations; j++ )
+                {
+                    numFoundByIndex = 0;
+                    for ( EntityID const& entityID : lookupIDs )
+                    {
+                        numFoundByIndex += ( pWorld->FindEntity( entityID ) != nullptr ) ? 1 : 0;
+                    }
+                }
+            }
+
+            {
+                ScopedTimer<PlatformClock> t( handleTime );
+                for ( int32_t j = 0; j < numIterations; j++ )
+                {
+                    numFoundByHandle = 0;
+                    for ( EntityHandle const& handle : lookupHandles )
+                    {
+                        numFoundByHandle += ( pWorld->ResolveEntityHandle( handle ) != nullptr ) ? 1 : 0;
+                    }
+                }
+            }
+
+            // Removed entities must no longer be found, and their handles must be stale
+            //-------------------------------------------------------------------------
+
+            Entity* pEntityToRemove = entities[0];
+            EntityID const removedEntityID = pEntityToRemove->GetID();
+            EntityHandle const removedEntityHandle = pWorld->GetEntityHandle( removedEntityID );
+            maps[0]->DestroyEntity( removedEntityID );
+            environment.CompleteLoading( pWorld );
+
+            bool const succeeded = numFoundByMapSearch == numEntities && numFoundByIndex == numEntities && numFoundByHandle == numEntities && pWorld->FindEntity( removedEntityID ) == nullptr && pWorld->ResolveEntityHandle( removedEntityHandle ) == nullptr;
+
+            environment.DestroyWorld( pWorld );
+
+            //-------------------------------------------------------------------------
+
+            std::cout << "Entity Lookup (Per-Map Search, " << numEntities << " entities, " << numMaps << " maps, " << numIterations << " iterations): " << mapSearchTime.ToFloat() << "ms" << std::endl;
+            std::cout << "Entity Lookup (World Index): " << indexTime.ToFloat() << "ms" << std::endl;
+            std::cout << "Entity Lookup (Handles): " << handleTime.ToFloat() << "ms" << std::endl;
+            std::cout << "Entity Lookup: " << ( succeeded ? "PASSED" : "FAILED" ) << std::endl;
+        }
+    };
+
+    //-------------------------------------------------------------------------
+
+    // Validates the world system update groups built from the declared system access, the systems are listed in the same (priority) order as the world would sort them
+    class WorldSystemGroupingTest
+    {
+    public:
+
+        static void Run()
+        {
+            Physics::PhysicsWorldSystem physicsSystem;
+            Animation::AnimationWorldSystem animationSystem;
+            AI::AIManager aiManager;
+            EntityModel::EntityCollectionSpawner spawner;
+            PlayerManager playerManager;
+            CameraManager cameraManager;
+
+            // The player manager and camera manager run at the highest priority, the camera manager doesnt declare its access so is exclusive
+            ValidateGroups( "Frame Start", { GetAccess( &playerManager ), GetAccess( &cameraManager ), GetAccess( &animationSystem ) }, { 0, 1, 2 } );
+
+            // Spawning systems only read their own components, animation moves spatial components so needs to wait for them
+            ValidateGroups( "Pre-Physics", { GetAccess( &spawner ), GetAccess( &aiManager ), GetAccess( &animationSystem ) }, { 0, 0, 1 } );
+
+            // Animation reads the physics system so has to be updated after it
+            ValidateGroups( "Post-Physics", { GetAccess( &physicsSystem ), GetAccess( &animationSystem ) }, { 0, 1 } );
+
+            // Access is checked against the type hierarchy, so writing spatial components conflicts with reading mesh components
+            WorldSystemAccess meshReader;
+            meshReader.Reads<Render::StaticMeshComponent>();
+            ValidateGroups( "Type Hierarchy", { GetAccess( &physicsSystem ), meshReader, WorldSystemAccess() }, { 0, 1, 0 } );
+
+            // Systems with no declared shared access only conflict with exclusive systems
+            ValidateGroups( "Own State", { WorldSystemAccess(), WorldSystemAccess(), WorldSystemAccess::Exclusive(), WorldSystemAccess() }, { 0, 0, 1, 2 } );
+        }
+
+    private:
+
+        // Get the access as the world would use it, all systems implicitly write to their own state
+        static WorldSystemAccess GetAccess( EntityWorldSystem const* pSystem )
+        {
+            WorldSystemAccess access = pSystem->GetUpdateAccess();
+            access.m_writes.emplace_back( pSystem->GetTypeInfo() );
+            return access;
+        }
+
+        static void ValidateGroups( char const* pTestName, TInlineVector<WorldSystemAccess, 10> const& accesses, TInlineVector<int32_t, 10> const& expectedGroupIndices )
+        {
+            TInlineVector<int32_t, 10> groupIndices;
+            WorldSystemAccess::CalculateUpdateGroups( accesses, groupIndices );
+
+            std::cout << "World System Grouping (" << pTestName << "): " << ( groupIndices == expectedGroupIndices ? "PASSED" : "FAILED" ) << std::endl;
+        }
+    };
+}
+
+//-------------------------------------------------------------------------
+
+namespace EE::Tester
+{
+    void RunMultiWorldStressTest()
+    {
+        for ( int32_t numWorlds : { 2, 4, 8 } )
+        {
+            MultiWorldStressTest::Run( numWorlds, 1000, 300 );
+        }
+    }
+
+    void RunDeferredTransformTest()
+    {
+        TransformResolverTest::Run( 8, 10 );
+        TransformResolverTest::Run( 2000, 10 );
+    }
+
+    void RunComponentStorageTest()
+    {
+        ComponentStorageTest::Run( 5000 );
+    }
+
+    void RunEntityLookupBenchmark()
+    {
+        EntityLookupBenchmark::Run( 100000, 4, 10 );
+    }
+
+    void RunWorldSystemGroupingTest()
+    {
+        WorldSystemGroupingTest::Run();
+    }
+}
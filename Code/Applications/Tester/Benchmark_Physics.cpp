@@ -0,0 +1,156 @@
+#include "Tester.h"
+#include "Engine/Physics/Physics.h"
+#include "Engine/Physics/PhysicsWorld.h"
+#include "Engine/Physics/PhysicsMaterial.h"
+#include "Base/Threading/TaskSystem.h"
+#include "Base/Math/MathRandom.h"
+#include "Base/Time/Timers.h"
+#include <iostream>
+
+//-------------------------------------------------------------------------
+
+namespace EE::Physics
+{
+    // Compares issuing ray casts one at a time (each under the world read lock) with gathering them in a query batch that is executed in parallel
+    class QueryBatchBenchmark
+    {
+        constexpr static int32_t const s_numBoxes = 2000;
+
+    public:
+
+        static void Run( int32_t numRayCasts, int32_t numIterations )
+        {
+            Core::Initialize();
+
+            {
+                EE::TaskSystem taskSystem( Threading::GetProcessorInfo().m_numLogicalCores );
+                taskSystem.Initialize();
+
+                MaterialRegistry materialRegistry;
+                materialRegistry.Initialize();
+
+                Milliseconds individualTime, batchTime;
+                int32_t numIndividualHits = 0, numBatchHits = 0;
+
+                PhysicsWorld* pWorld = EE::New<PhysicsWorld>( &materialRegistry, &taskSystem, false );
+
+                // Scatter static boxes across a ground plane for the rays to hit
+                //-------------------------------------------------------------------------
+
+                QueryRules rules;
+                rules.SetCollidesWith( CollisionCategory::Environment );
+
+                physx::PxFilterData const shapeQueryFilterData( 1u << (uint8_t) CollisionCategory::Environment, 0, 0, 0 );
+                physx::PxPhysics* pPhysics = Core::GetPxPhysics();
+                TVector<physx::PxRigidStatic*> actors;
+                actors.reserve( s_numBoxes );
+
+                pWorld->AcquireWriteLock();
+                for ( int32_t i = 0; i < s_numBoxes; i++ )
+                {
+                    physx::PxTransform const pxTransform( physx::PxVec3( Math::GetRandomFloat( -200, 200 ), Math::GetRandomFloat( -200, 200 ), 0.0f ) );
+                    physx::PxBoxGeometry const boxGeo( Math::GetRandomFloat( 0.5f, 5.0f ), Math::GetRandomFloat( 0.5f, 5.0f ), Math::GetRandomFloat( 0.5f, 5.0f ) );
+
+                    physx::PxRigidStatic* pActor = pPhysics->createRigidStatic( pxTransform );
+                    physx::PxShape* pShape = physx::PxRigidActorExt::createExclusiveShape( *pActor, boxGeo, *materialRegistry.GetDefaultMaterial() );
+                    pShape->setQueryFilterData( shapeQueryFilterData );
+                    pWorld->m_pScene->addActor( *pActor );
+                    actors.emplace_back( pActor );
+                }
+                pWorld->ReleaseWriteLock();
+
+                // Cast down from above the boxes
+                //-------------------------------------------------------------------------
+
+                TVector<Vector> rayStarts;
+                TVector<Vector> rayEnds;
+                rayStarts.reserve( numRayCasts );
+                rayEnds.reserve( numRayCasts );
+
+                for ( int32_t i = 0; i < numRayCasts; i++ )
+                {
+                    Vector const start( Math::GetRandomFloat( -200, 200 ), Math::GetRandomFloat( -200, 200 ), 20.0f );
+                    rayStarts.emplace_back( start );
+                    rayEnds.emplace_back( start + Vector( Math::GetRandomFloat( -10, 10 ), Math::GetRandomFloat( -10, 10 ), -40.0f ) );
+                }
+
+                // Individual
+                //-------------------------------------------------------------------------
+
+                {
+                    TVector<RayCastResults> results;
+                    results.resize( numRayCasts );
+
+                    ScopedTimer<PlatformClock> t( individualTime );
+                    for ( int32_t j = 0; j < numIterations; j++ )
+                    {
+                        numIndividualHits = 0;
+
+                        pWorld->AcquireReadLock();
+                        for ( int32_t i = 0; i < numRayCasts; i++ )
+                        {
+                            results[i].Reset();
+                            numIndividualHits += pWorld->RayCast( rayStarts[i], rayEnds[i], rules, results[i] ) ? 1 : 0;
+                        }
+                        pWorld->ReleaseReadLock();
+                    }
+                }
+
+                // Batched
+                //-------------------------------------------------------------------------
+
+                {
+                    QueryBatch batch;
+                    batch.Reserve( numRayCasts, 0 );
+
+                    ScopedTimer<PlatformClock> t( batchTime );
+                    for ( int32_t j = 0; j < numIterations; j++ )
+                    {
+                        numBatchHits = 0;
+
+                        batch.Reset();
+                        for ( int32_t i = 0; i < numRayCasts; i++ )
+                        {
+                            batch.AddRayCast( rayStarts[i], rayEnds[i], rules );
+                        }
+
+                        pWorld->ExecuteQueryBatch( batch );
+
+                        for ( int32_t i = 0; i < numRayCasts; i++ )
+                        {
+                            numBatchHits += batch.GetRayCastResults( i ).HasHits() ? 1 : 0;
+                        }
+                    }
+                }
+
+                //-------------------------------------------------------------------------
+
+                pWorld->AcquireWriteLock();
+                for ( auto pActor : actors )
+                {
+                    pActor->release();
+                }
+                pWorld->ReleaseWriteLock();
+
+                EE::Delete( pWorld );
+                materialRegistry.Shutdown();
+                taskSystem.Shutdown();
+
+                std::cout << "Ray Casts (Individual, " << numRayCasts << " rays, " << numIterations << " iterations): " << individualTime.ToFloat() << "ms (" << numIndividualHits << " hits)" << std::endl;
+                std::cout << "Ray Casts (Query Batch, " << taskSystem.GetNumWorkers() << " workers): " << batchTime.ToFloat() << "ms (" << numBatchHits << " hits)" << std::endl;
+            }
+
+            Core::Shutdown();
+        }
+    };
+}
+
+//-------------------------------------------------------------------------
+
+namespace EE::Tester
+{
+    void RunPhysicsQueryBatchBenchmark()
+    {
+        Physics::QueryBatchBenchmark::Run( 10000, 100 );
+    }
+}
@@ -0,0 +1,339 @@
+#include "Tester.h"
+#include "Engine/Render/Culling/SunShadowVolume.h"
+#include "Base/RenderGraph/RenderGraph.h"
+#include "Base/RHI/RHIDevice.h"
+#include "Base/RHI/Resource/RHIBuffer.h"
+#include "Base/RHI/Resource/RHITexture.h"
+#include "Base/Math/AABBTree.h"
+#include "Base/Math/ViewVolume.h"
+#include "Base/Math/MathRandom.h"
+#include "Base/Time/Timers.h"
+#include <iostream>
+
+//-------------------------------------------------------------------------
+
+namespace EE::Render
+{
+    // Compares the previous view AABB culling with the frustum plane culling used by the renderer world system
+    // Static meshes are culled via the AABB tree and dynamic meshes are tested individually, so both paths are measured
+    class CullingBenchmark
+    {
+    public:
+
+        static void Run( int32_t numMeshes, int32_t numIterations )
+        {
+            // Scatter meshes of varying size around the camera
+            //-------------------------------------------------------------------------
+
+            TVector<AABB> meshBounds;
+            meshBounds.reserve( numMeshes );
+
+            Math::AABBTree tree;
+            for ( int32_t i = 0; i < numMeshes; i++ )
+            {
+                Vector const center( Math::GetRandomFloat( -400, 400 ), Math::GetRandomFloat( -400, 400 ), Math::GetRandomFloat( 0, 20 ) );
+                Vector const extents( Math::GetRandomFloat( 0.25f, 5.0f ), Math::GetRandomFloat( 0.25f, 5.0f ), Math::GetRandomFloat( 0.25f, 5.0f ) );
+                AABB const& bounds = meshBounds.emplace_back( center, extents );
+                tree.InsertBox( bounds, uint64_t( i ) );
+            }
+
+            Math::ViewVolume const viewVolume( Float2( 1920, 1080 ), FloatRange( 0.1f, 500.0f ), Radians( Degrees( 90.0f ) ), Matrix::FromTranslation( Vector( 0, 0, 2 ) ) );
+            AABB const viewBounds = viewVolume.GetAABB();
+
+            Transform const sunTransform( Quaternion( EulerAngles( -60.0f, 0.0f, 30.0f ) ) );
+            Math::ViewVolume const shadowVolume = SunShadows::CalculateShadowVolume( viewVolume, sunTransform );
+
+            TVector<uint64_t> results;
+            results.reserve( numMeshes );
+
+            // Static meshes
+            //-------------------------------------------------------------------------
+
+            Milliseconds treeAABBTime, treeFrustumTime, treeShadowTime;
+            size_t numTreeAABB = 0, numTreeFrustum = 0, numTreeShadow = 0;
+
+            {
+                ScopedTimer<PlatformClock> t( treeAABBTime );
+                for ( int32_t i = 0; i < numIterations; i++ )
+                {
+                    results.clear();
+                    tree.FindOverlaps( viewBounds, results );
+                    numTreeAABB = results.size();
+                }
+            }
+
+            {
+                ScopedTimer<PlatformClock> t( treeFrustumTime );
+                for ( int32_t i = 0; i < numIterations; i++ )
+                {
+                    results.clear();
+                    tree.FindVisible( viewVolume, results );
+                    numTreeFrustum = results.size();
+                }
+            }
+
+            {
+                ScopedTimer<PlatformClock> t( treeShadowTime );
+                for ( int32_t i = 0; i < numIterations; i++ )
+                {
+                    results.clear();
+                    tree.FindVisible( shadowVolume, results );
+                    numTreeShadow = results.size();
+                }
+            }
+
+            // Dynamic meshes
+            //-------------------------------------------------------------------------
+
+            Milliseconds dynamicAABBTime, dynamicFrustumTime;
+            int32_t numDynamicAABB = 0, numDynamicFrustum = 0;
+
+            {
+                ScopedTimer<PlatformClock> t( dynamicAABBTime );
+                for ( int32_t i = 0; i < numIterations; i++ )
+                {
+                    numDynamicAABB = 0;
+                    for ( AABB const& bounds : meshBounds )
+                    {
+                        numDynamicAABB += viewBounds.Overlaps( bounds ) ? 1 : 0;
+                    }
+                }
+            }
+
+            {
+                ScopedTimer<PlatformClock> t( dynamicFrustumTime );
+                for ( int32_t i = 0; i < numIterations; i++ )
+                {
+                    numDynamicFrustum = 0;
+                    for ( AABB const& bounds : meshBounds )
+                    {
+                        uint32_t planeMask = Math::ViewVolume::s_allPlanesMask;
+                        numDynamicFrustum += ( viewVolume.Intersect( bounds, planeMask ) != Math::ViewVolume::IntersectionResult::FullyOutside ) ? 1 : 0;
+                    }
+                }
+            }
+
+            //-------------------------------------------------------------------------
+
+            std::cout << "Static Mesh Cull (View AABB, " << numMeshes << " meshes, " << numIterations << " iterations): " << treeAABBTime.ToFloat() << "ms (" << numTreeAABB << " visible)" << std::endl;
+            std::cout << "Static Mesh Cull (Frustum, " << numMeshes << " meshes, " << numIterations << " iterations): " << treeFrustumTime.ToFloat() << "ms (" << numTreeFrustum << " visible)" << std::endl;
+            std::cout << "Static Mesh Cull (Sun Shadow Volume, " << numMeshes << " meshes, " << numIterations << " iterations): " << treeShadowTime.ToFloat() << "ms (" << numTreeShadow << " shadow casters)" << std::endl;
+            std::cout << "Dynamic Mesh Cull (View AABB, " << numMeshes << " meshes, " << numIterations << " iterations): " << dynamicAABBTime.ToFloat() << "ms (" << numDynamicAABB << " visible)" << std::endl;
+            std::cout << "Dynamic Mesh Cull (Frustum, " << numMeshes << " meshes, " << numIterations << " iterations): " << dynamicFrustumTime.ToFloat() << "ms (" << numDynamicFrustum << " visible)" << std::endl;
+        }
+    };
+}
+
+//-------------------------------------------------------------------------
+
+namespace EE::RG
+{
+    // Compiles and executes a small deferred-style graph against a mock RHI device (no GPU), recording everything the graph issues during execution.
+    // The graph contains a node whose output is never used (culled), transient textures with disjoint lifetimes (aliased) and a never-culled buffer
+    // writer, so culling, aliasing, the barrier set and the execution order are all validated.
+    class RenderGraphTest
+    {
+        class MockRHIDevice final : public RHI::RHIDevice
+        {
+            class MockTexture final : public RHI::RHITexture {};
+            class MockBuffer final : public RHI::RHIBuffer {};
+
+        public:
+
+            virtual RHI::RHITexture* CreateTexture( RHI::RHITextureCreateDesc const& createDesc ) override { m_numTextures++; return EE::New<MockTexture>(); }
+            virtual void DestroyTexture( RHI::RHITexture* pTexture ) override { m_numTextures--; EE::Delete( pTexture ); }
+
+            virtual RHI::RHIBuffer* CreateBuffer( RHI::RHIBufferCreateDesc const& createDesc ) override { m_numBuffers++; return EE::New<MockBuffer>(); }
+            virtual void DestroyBuffer( RHI::RHIBuffer* pBuffer ) override { m_numBuffers--; EE::Delete( pBuffer ); }
+
+            virtual RHI::RHIShader* CreateShader( RHI::RHIShaderCreateDesc const& createDesc ) override { return nullptr; }
+            virtual void DestroyShader( RHI::RHIShader* pShader ) override {}
+
+            virtual RHI::RHISemaphore* CreateSyncSemaphore( RHI::RHISemaphoreCreateDesc const& createDesc ) override { return nullptr; }
+            virtual void DestroySyncSemaphore( RHI::RHISemaphore* pSemaphore ) override {}
+
+            virtual RHI::RHIPipelineState* CreateRasterPipelineState( RHI::RHIRasterPipelineStateCreateDesc const& createDesc, CompiledShaderArray const& compiledShaders ) override { return nullptr; }
+            virtual void DestroyRasterPipelineState( RHI::RHIPipelineState* pPipelineState ) override {}
+
+        public:
+
+            int32_t                                 m_numTextures = 0;
+            int32_t                                 m_numBuffers = 0;
+        };
+
+        class RecordingContext final : public RenderGraphContext
+        {
+        public:
+
+            struct RecordedNode
+            {
+                String                              m_name;
+                TVector<RGExecutionBarrier>         m_barriers;
+                bool                                m_wasExecuted = false;
+            };
+
+            virtual void BeginNode( String const& nodeName ) override { m_nodes.emplace_back().m_name = nodeName; }
+            virtual void PipelineBarrier( RGExecutionBarrier const* pBarriers, uint32_t numBarriers ) override { m_nodes.back().m_barriers.insert( m_nodes.back().m_barriers.end(), pBarriers, pBarriers + numBarriers ); }
+            virtual void EndNode() override {}
+
+            inline void MarkExecuted() { m_nodes.back().m_wasExecuted = true; }
+
+        public:
+
+            TVector<RecordedNode>                   m_nodes;
+        };
+
+        static void ExecuteNode( RenderGraphContext& context ) { static_cast<RecordingContext&>( context ).MarkExecuted(); }
+
+    public:
+
+        static void Run()
+        {
+            using Render::RenderResourceBarrierState;
+
+            TSharedPtr<MockRHIDevice> pDevice = MakeShared<MockRHIDevice>();
+            TSharedPtr<RHI::RHIDevice> pRhiDevice = pDevice;
+
+            RenderGraph graph( "Test Graph" );
+
+            TextureDesc const textureDesc = TextureDesc::New2D( 256, 256, RHI::EPixelFormat::BGRA8Unorm );
+            auto gbuffer = graph.CreateResource( textureDesc );
+            auto lighting = graph.CreateResource( textureDesc );
+            auto postProcess = graph.CreateResource( textureDesc );
+            auto debugOverlay = graph.CreateResource( textureDesc );
+            auto output = graph.CreateResource( textureDesc );
+            auto histogram = graph.CreateResource( BufferDesc::NewSize( 1024 ) );
+
+            bool wasCulledNodeExecuted = false;
+
+            {
+                auto node = graph.AddNode( "GBuffer" );
+                node.RasterWrite( gbuffer, RenderResourceBarrierState::ColorAttachmentWrite );
+                node.SetExecuteFunction( ExecuteNode );
+            }
+
+            // Nothing uses the debug overlay so this node has to be culled
+            {
+                auto node = graph.AddNode( "Debug Overlay" );
+                node.CommonRead( gbuffer, RenderResourceBarrierState::FragmentShaderReadSampledImageOrUniformTexelBuffer );
+                node.RasterWrite( debugOverlay, RenderResourceBarrierState::ColorAttachmentWrite );
+                node.SetExecuteFunction( [&wasCulledNodeExecuted] ( RenderGraphContext& context ) { wasCulledNodeExecuted = true; } );
+            }
+
+            {
+                auto node = graph.AddNode( "Lighting" );
+                node.CommonRead( gbuffer, RenderResourceBarrierState::FragmentShaderReadSampledImageOrUniformTexelBuffer );
+                node.RasterWrite( lighting, RenderResourceBarrierState::ColorAttachmentWrite );
+                node.SetExecuteFunction( ExecuteNode );
+            }
+
+            // The gbuffer is no longer used so the post process target can alias it
+            {
+                auto node = graph.AddNode( "Post Process" );
+                node.CommonRead( lighting, RenderResourceBarrierState::FragmentShaderReadSampledImageOrUniformTexelBuffer );
+                node.RasterWrite( postProcess, RenderResourceBarrierState::ColorAttachmentWrite );
+                node.SetExecuteFunction( ExecuteNode );
+            }
+
+            // Lighting is read again in the same state, so it doesn't need a barrier
+            {
+                auto node = graph.AddNode( "Composite" );
+                node.CommonRead( postProcess, RenderResourceBarrierState::FragmentShaderReadSampledImageOrUniformTexelBuffer );
+                node.CommonRead( lighting, RenderResourceBarrierState::FragmentShaderReadSampledImageOrUniformTexelBuffer );
+                node.RasterWrite( output, RenderResourceBarrierState::ColorAttachmentWrite );
+                node.SetExecuteFunction( ExecuteNode );
+            }
+
+            // Host readback, none of its outputs are used inside the graph. The first write to a new buffer needs no barrier.
+            {
+                auto node = graph.AddNode( "Histogram" );
+                node.CommonWrite( histogram, RenderResourceBarrierState::ComputeShaderWrite );
+                node.SetNeverCull();
+                node.SetExecuteFunction( ExecuteNode );
+            }
+
+            graph.ExportResource( output );
+
+            // Compile twice, recompiling must release the previous compilation's resources
+            //-------------------------------------------------------------------------
+
+            graph.Compile( pRhiDevice );
+            graph.Compile( pRhiDevice );
+
+            // The exported output, the gbuffer (shared with the post process target) and lighting textures and the histogram buffer
+            bool const resourcesValid = graph.GetNumPhysicalResources() == 4 && pDevice->m_numTextures == 3 && pDevice->m_numBuffers == 1;
+
+            RecordingContext context;
+            graph.Execute( context );
+
+            // Validate execution
+            //-------------------------------------------------------------------------
+
+            TVector<String> const expectedNodes = { "GBuffer", "Lighting", "Post Process", "Composite", "Histogram" };
+            TVector<size_t> const expectedNumBarriers = { 1, 2, 2, 2, 0 };
+
+            bool executionValid = !wasCulledNodeExecuted && context.m_nodes.size() == expectedNodes.size();
+            for ( size_t i = 0; executionValid && i < context.m_nodes.size(); i++ )
+            {
+                executionValid = context.m_nodes[i].m_name == expectedNodes[i] && context.m_nodes[i].m_wasExecuted && context.m_nodes[i].m_barriers.size() == expectedNumBarriers[i];
+            }
+
+            // Validate barriers
+            //-------------------------------------------------------------------------
+
+            bool barriersValid = executionValid;
+            if ( barriersValid )
+            {
+                RGExecutionBarrier const& gbufferWrite = context.m_nodes[0].m_barriers[0];
+                RGExecutionBarrier const& gbufferRead = context.m_nodes[1].m_barriers[0];
+                RGExecutionBarrier const& lightingWrite = context.m_nodes[1].m_barriers[1];
+                RGExecutionBarrier const& lightingRead = context.m_nodes[2].m_barriers[0];
+                RGExecutionBarrier const& postProcessWrite = context.m_nodes[2].m_barriers[1];
+                RGExecutionBarrier const& postProcessRead = context.m_nodes[3].m_barriers[0];
+                RGExecutionBarrier const& outputWrite = context.m_nodes[3].m_barriers[1];
+
+                // New transient textures discard their contents
+                barriersValid &= gbufferWrite.m_previousAccess == RenderResourceBarrierState::Undefined && gbufferWrite.m_nextAccess == RenderResourceBarrierState::ColorAttachmentWrite && gbufferWrite.m_discardContents;
+                barriersValid &= lightingWrite.m_previousAccess == RenderResourceBarrierState::Undefined && lightingWrite.m_discardContents;
+                barriersValid &= outputWrite.m_previousAccess == RenderResourceBarrierState::Undefined && outputWrite.m_discardContents;
+
+                // Reads transition from the previous write
+                barriersValid &= gbufferRead.m_pRhiResource == gbufferWrite.m_pRhiResource && gbufferRead.m_previousAccess == RenderResourceBarrierState::ColorAttachmentWrite && !gbufferRead.m_discardContents;
+                barriersValid &= lightingRead.m_pRhiResource == lightingWrite.m_pRhiResource && lightingRead.m_nextAccess == RenderResourceBarrierState::FragmentShaderReadSampledImageOrUniformTexelBuffer;
+                barriersValid &= postProcessRead.m_pRhiResource == postProcessWrite.m_pRhiResource;
+
+                // The post process target aliases the gbuffer, so it transitions from the gbuffer's last access
+                barriersValid &= postProcessWrite.m_pRhiResource == gbufferWrite.m_pRhiResource && postProcessWrite.m_previousAccess == RenderResourceBarrierState::FragmentShaderReadSampledImageOrUniformTexelBuffer && postProcessWrite.m_discardContents;
+
+                // Resources that are alive at the same time never share RHI resources
+                barriersValid &= lightingWrite.m_pRhiResource != gbufferWrite.m_pRhiResource && outputWrite.m_pRhiResource != gbufferWrite.m_pRhiResource && outputWrite.m_pRhiResource != lightingWrite.m_pRhiResource;
+                barriersValid &= outputWrite.m_resourceType == RGResourceType::Texture && gbufferWrite.m_pRhiResource != nullptr;
+            }
+
+            //-------------------------------------------------------------------------
+
+            graph.ClearAllRHIResources( pRhiDevice );
+            bool const cleanupValid = pDevice->m_numTextures == 0 && pDevice->m_numBuffers == 0;
+
+            std::cout << "Render Graph (Resources): " << ( resourcesValid ? "PASSED" : "FAILED" ) << std::endl;
+            std::cout << "Render Graph (Execution): " << ( executionValid ? "PASSED" : "FAILED" ) << std::endl;
+            std::cout << "Render Graph (Barriers): " << ( barriersValid ? "PASSED" : "FAILED" ) << std::endl;
+            std::cout << "Render Graph (Cleanup): " << ( cleanupValid ? "PASSED" : "FAILED" ) << std::endl;
+        }
+    };
+}
+
+//-------------------------------------------------------------------------
+
+namespace EE::Tester
+{
+    void RunCullingBenchmark()
+    {
+        Render::CullingBenchmark::Run( 20000, 1000 );
+    }
+
+    void RunRenderGraphTest()
+    {
+        RG::RenderGraphTest::Run();
+    }
+}
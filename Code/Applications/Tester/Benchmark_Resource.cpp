@@ -0,0 +1,223 @@
+#include "Tester.h"
+#include "Base/Resource/ResourceIOScheduler.h"
+#include "Base/FileSystem/FileSystem.h"
+#include "Base/FileSystem/FileSystemUtils.h"
+#include "Base/Math/MathRandom.h"
+#include "Base/Time/Timers.h"
+#include <iostream>
+
+//-------------------------------------------------------------------------
+
+namespace EE::Resource
+{
+    // Loads a synthetic map dependency set, once through the I/O scheduler and once with the serial reads the resource requests used to do inline
+    // Every 'criticalInterval'th dependency is critical (needed to start the map) and the rest are streaming, they are interleaved in discovery order
+    // The files are read once before timing so both paths read from the OS file cache, this measures the scheduling rather than the disk
+    class ResourceLoadBenchmark
+    {
+        struct Dependency
+        {
+            FileSystem::Path                m_filePath;
+            uint32_t                        m_size = 0;
+            ResourceLoadPriority            m_priority = ResourceLoadPriority::Streaming;
+        };
+
+    public:
+
+        static void Run( int32_t numDependencies, int32_t criticalInterval, uint32_t minFileSize, uint32_t maxFileSize )
+        {
+            FileSystem::Path const directoryPath = FileSystem::GetCurrentProcessPath().Append( "ResourceLoadBenchmark", true );
+            if ( !directoryPath.EnsureDirectoryExists() )
+            {
+                std::cout << "Resource Load: FAILED (could not create " << directoryPath.c_str() << ")" << std::endl;
+                return;
+            }
+
+            // Create the dependency set
+            //-------------------------------------------------------------------------
+
+            TVector<Dependency> dependencies;
+            dependencies.resize( numDependencies );
+
+            Blob fileData;
+            fileData.resize( maxFileSize );
+            for ( uint32_t i = 0; i < maxFileSize; i++ )
+            {
+                fileData[i] = (uint8_t) i;
+            }
+
+            uint64_t totalSize = 0;
+            char filename[32];
+            for ( int32_t i = 0; i < numDependencies; i++ )
+            {
+                Printf( filename, 32, "Dependency%d.bin", i );
+
+                Dependency& dependency = dependencies[i];
+                dependency.m_filePath = directoryPath + filename;
+                dependency.m_size = Math::GetRandomUInt( minFileSize, maxFileSize );
+                dependency.m_priority = ( i % criticalInterval ) == 0 ? ResourceLoadPriority::Critical : ResourceLoadPriority::Streaming;
+                totalSize += dependency.m_size;
+
+                FILE* pFile = fopen( dependency.m_filePath.c_str(), "wb" );
+                if ( pFile == nullptr )
+                {
+                    std::cout << "Resource Load: FAILED (could not write " << dependency.m_filePath.c_str() << ")" << std::endl;
+                    DeleteFiles( dependencies, directoryPath );
+                    return;
+                }
+
+                fwrite( fileData.data(), dependency.m_size, 1, pFile );
+                fclose( pFile );
+            }
+
+            // Warm the OS file cache
+            for ( auto const& dependency : dependencies )
+            {
+                FileSystem::LoadFile( dependency.m_filePath, fileData );
+            }
+
+            //-------------------------------------------------------------------------
+
+            Milliseconds serialTime, serialCriticalTime;
+            bool const serialSucceeded = RunSerial( dependencies, serialTime, serialCriticalTime );
+
+            Milliseconds scheduledTime, scheduledCriticalTime;
+            bool const scheduledSucceeded = RunScheduled( dependencies, scheduledTime, scheduledCriticalTime );
+
+            DeleteFiles( dependencies, directoryPath );
+
+            //-------------------------------------------------------------------------
+
+            std::cout << "Resource Load (" << numDependencies << " files, " << GetNumCritical( dependencies ) << " critical, " << ( totalSize / ( 1024 * 1024 ) ) << "MB)" << std::endl;
+            std::cout << "  Serial: " << serialTime.ToFloat() << "ms (critical set loaded after " << serialCriticalTime.ToFloat() << "ms) " << ( serialSucceeded ? "PASSED" : "FAILED" ) << std::endl;
+            std::cout << "  I/O Scheduler (" << ResourceIOScheduler::s_defaultNumThreads << " threads): " << scheduledTime.ToFloat() << "ms (critical set loaded after " << scheduledCriticalTime.ToFloat() << "ms) " << ( scheduledSucceeded ? "PASSED" : "FAILED" ) << std::endl;
+        }
+
+    private:
+
+        // The old path: each request read its file inline in the order the dependencies were requested
+        static bool RunSerial( TVector<Dependency> const& dependencies, Milliseconds& outTotalTime, Milliseconds& outCriticalTime )
+        {
+            bool succeeded = true;
+            int32_t numCriticalRemaining = GetNumCritical( dependencies );
+            outCriticalTime = 0;
+
+            Blob data;
+            Timer<PlatformClock> timer;
+            for ( auto const& dependency : dependencies )
+            {
+                data.clear();
+                succeeded &= FileSystem::LoadFile( dependency.m_filePath, data ) && data.size() == dependency.m_size;
+
+                if ( dependency.m_priority == ResourceLoadPriority::Critical && --numCriticalRemaining == 0 )
+                {
+                    outCriticalTime = timer.GetElapsedTimeMilliseconds();
+                }
+            }
+
+            outTotalTime = timer.GetElapsedTimeMilliseconds();
+            return succeeded;
+        }
+
+        // Submits the reads the way the resource requests do: everything is submitted until the scheduler rejects a read, rejected reads are resubmitted on the next update
+        static bool RunScheduled( TVector<Dependency> const& dependencies, Milliseconds& outTotalTime, Milliseconds& outCriticalTime )
+        {
+            int32_t const numDependencies = (int32_t) dependencies.size();
+            int32_t numCriticalRemaining = GetNumCritical( dependencies );
+            outCriticalTime = 0;
+
+            TVector<ResourceIORead*> reads;
+            reads.reserve( numDependencies );
+            for ( auto const& dependency : dependencies )
+            {
+                ResourceIORead* pRead = EE::New<ResourceIORead>();
+                pRead->m_filePath = dependency.m_filePath;
+                pRead->m_priority = dependency.m_priority;
+                reads.emplace_back( pRead );
+            }
+
+            TVector<bool> isProcessed;
+            isProcessed.resize( numDependencies, false );
+
+            ResourceIOScheduler scheduler;
+            scheduler.Initialize();
+
+            //-------------------------------------------------------------------------
+
+            bool succeeded = true;
+            int32_t numSubmitted = 0;
+            int32_t numProcessed = 0;
+
+            Timer<PlatformClock> timer;
+            while ( numProcessed < numDependencies )
+            {
+                while ( numSubmitted < numDependencies && scheduler.SubmitRead( reads[numSubmitted] ) )
+                {
+                    numSubmitted++;
+                }
+
+                for ( int32_t i = 0; i < numSubmitted; i++ )
+                {
+                    if ( isProcessed[i] || !reads[i]->IsComplete() )
+                    {
+                        continue;
+                    }
+
+                    isProcessed[i] = true;
+                    numProcessed++;
+                    succeeded &= reads[i]->GetStatus() == ResourceIORead::Status::Succeeded && reads[i]->m_data.size() == dependencies[i].m_size;
+
+                    if ( dependencies[i].m_priority == ResourceLoadPriority::Critical && --numCriticalRemaining == 0 )
+                    {
+                        outCriticalTime = timer.GetElapsedTimeMilliseconds();
+                    }
+                }
+            }
+            outTotalTime = timer.GetElapsedTimeMilliseconds();
+
+            //-------------------------------------------------------------------------
+
+            scheduler.Shutdown();
+
+            for ( auto pRead : reads )
+            {
+                EE::Delete( pRead );
+            }
+
+            return succeeded;
+        }
+
+        static int32_t GetNumCritical( TVector<Dependency> const& dependencies )
+        {
+            int32_t numCritical = 0;
+            for ( auto const& dependency : dependencies )
+            {
+                numCritical += ( dependency.m_priority == ResourceLoadPriority::Critical ) ? 1 : 0;
+            }
+            return numCritical;
+        }
+
+        static void DeleteFiles( TVector<Dependency> const& dependencies, FileSystem::Path const& directoryPath )
+        {
+            for ( auto const& dependency : dependencies )
+            {
+                if ( dependency.m_filePath.IsValid() && dependency.m_filePath.Exists() )
+                {
+                    FileSystem::EraseFile( dependency.m_filePath.c_str() );
+                }
+            }
+
+            FileSystem::EraseDir( directoryPath.c_str() );
+        }
+    };
+}
+
+//-------------------------------------------------------------------------
+
+namespace EE::Tester
+{
+    void RunResourceLoadBenchmark()
+    {
+        Resource::ResourceLoadBenchmark::Run( 2000, 4, 16 * 1024, 1024 * 1024 );
+    }
+}
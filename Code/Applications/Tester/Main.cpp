@@ -1,3 +1,4 @@
+#include "Tester.h"
 #include "Base/TypeSystem/TypeRegistry.h"
 #include "Base/Application/ApplicationGlobalState.h"
 #include "Base/FileSystem/FileSystem.h"
@@ -110,6 +111,25 @@ int main( int argc, char *argv[] )
 
         //-------------------------------------------------------------------------
 
+        Tester::RunStringIDBenchmark();
+        Tester::RunRandomBenchmark();
+        Tester::RunDebugDrawingTest();
+        Tester::RunAnimationClipBenchmark();
+        Tester::RunAnimationEventQueryTest();
+        Tester::RunAnimationBlendBenchmark();
+        Tester::RunAnimationTaskSystemBenchmark();
+        Tester::RunCullingBenchmark();
+        Tester::RunRenderGraphTest();
+        Tester::RunMultiWorldStressTest();
+        Tester::RunDeferredTransformTest();
+        Tester::RunComponentStorageTest();
+        Tester::RunEntityLookupBenchmark();
+        Tester::RunWorldSystemGroupingTest();
+        Tester::RunPhysicsQueryBatchBenchmark();
+        Tester::RunResourceLoadBenchmark();
+
+        //-------------------------------------------------------------------------
+
         AutoGenerated::Tools::UnregisterTypes( typeRegistry );
     }
 
@@ -0,0 +1,26 @@
+#pragma once
+
+//-------------------------------------------------------------------------
+// Tester
+//-------------------------------------------------------------------------
+// Benchmarks print their timings to the console, run a release build when comparing numbers
+
+namespace EE::Tester
+{
+    void RunStringIDBenchmark();
+    void RunRandomBenchmark();
+    void RunDebugDrawingTest();
+    void RunAnimationClipBenchmark();
+    void RunAnimationEventQueryTest();
+    void RunAnimationBlendBenchmark();
+    void RunAnimationTaskSystemBenchmark();
+    void RunCullingBenchmark();
+    void RunRenderGraphTest();
+    void RunMultiWorldStressTest();
+    void RunDeferredTransformTest();
+    void RunComponentStorageTest();
+    void RunEntityLookupBenchmark();
+    void RunWorldSystemGroupingTest();
+    void RunPhysicsQueryBatchBenchmark();
+    void RunResourceLoadBenchmark();
+}
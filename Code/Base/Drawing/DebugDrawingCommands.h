@@ -217,6 +217,19 @@ namespace EE::Drawing
             m_textCommands.clear();
         }
 
+        inline void Swap( CommandBuffer& buffer )
+        {
+            m_pointCommands.swap( buffer.m_pointCommands );
+            m_lineCommands.swap( buffer.m_lineCommands );
+            m_triangleCommands.swap( buffer.m_triangleCommands );
+            m_textCommands.swap( buffer.m_textCommands );
+        }
+
+        inline bool IsEmpty() const
+        {
+            return m_pointCommands.empty() && m_lineCommands.empty() && m_triangleCommands.empty() && m_textCommands.empty();
+        }
+
         void Reset( Seconds deltaTime );
 
     public:
@@ -230,7 +243,9 @@ namespace EE::Drawing
     //-------------------------------------------------------------------------
     // Per-Thread command buffer
     //-------------------------------------------------------------------------
-    // These are fully cleared each frame
+    // Each thread records into its own buffer, at the end of the frame the recorded buffer is swapped with the thread's frame buffer
+    // The frame buffer contains all the commands we need to actually draw this frame
+    // Any command with a TTL, will be left in the frame buffer at the end of the frame to be drawn again
 
     class ThreadCommandBuffer
     {
@@ -275,6 +290,36 @@ namespace EE::Drawing
             m_transparentDepthOff.Clear();
         }
 
+        // Removes all commands with an expired TTL
+        inline void Reset( Seconds deltaTime )
+        {
+            m_opaqueDepthOn.Reset( deltaTime );
+            m_opaqueDepthOff.Reset( deltaTime );
+            m_transparentDepthOn.Reset( deltaTime );
+            m_transparentDepthOff.Reset( deltaTime );
+        }
+
+        inline void Append( ThreadCommandBuffer const& buffer )
+        {
+            m_opaqueDepthOn.Append( buffer.m_opaqueDepthOn );
+            m_opaqueDepthOff.Append( buffer.m_opaqueDepthOff );
+            m_transparentDepthOn.Append( buffer.m_transparentDepthOn );
+            m_transparentDepthOff.Append( buffer.m_transparentDepthOff );
+        }
+
+        inline void Swap( ThreadCommandBuffer& buffer )
+        {
+            m_opaqueDepthOn.Swap( buffer.m_opaqueDepthOn );
+            m_opaqueDepthOff.Swap( buffer.m_opaqueDepthOff );
+            m_transparentDepthOn.Swap( buffer.m_transparentDepthOn );
+            m_transparentDepthOff.Swap( buffer.m_transparentDepthOff );
+        }
+
+        inline bool IsEmpty() const
+        {
+            return m_opaqueDepthOn.IsEmpty() && m_opaqueDepthOff.IsEmpty() && m_transparentDepthOn.IsEmpty() && m_transparentDepthOff.IsEmpty();
+        }
+
         CommandBuffer const& GetOpaqueDepthTestEnabledBuffer() const { return m_opaqueDepthOn; }
         CommandBuffer const& GetOpaqueDepthTestDisabledBuffer() const { return m_opaqueDepthOff; }
         CommandBuffer const& GetTransparentDepthTestEnabledBuffer() const { return m_transparentDepthOn; }
@@ -306,43 +351,5 @@ namespace EE::Drawing
         CommandBuffer               m_transparentDepthOn;
         CommandBuffer               m_transparentDepthOff;
     };
-
-    //-------------------------------------------------------------------------
-    // Frame Buffer
-    //-------------------------------------------------------------------------
-    // This contains all the commands we need to actually draw this frame
-    // Any command with a TTL, will be left in this buffer at the end of the frame to be drawn again
-
-    class EE_BASE_API FrameCommandBuffer
-    {
-    public:
-
-        void AddThreadCommands( ThreadCommandBuffer const& threadCommands );
-
-        // Empties the command buffer ignoring any TTL state
-        inline void Clear()
-        {
-            m_opaqueDepthOn.Clear();
-            m_opaqueDepthOff.Clear();
-            m_transparentDepthOn.Clear();
-            m_transparentDepthOff.Clear();
-        }
-
-        // Resets the buffer, will remove all commands with an expired TTL
-        inline void Reset( Seconds deltaTime )
-        {
-            m_opaqueDepthOn.Reset( deltaTime );
-            m_opaqueDepthOff.Reset( deltaTime );
-            m_transparentDepthOn.Reset( deltaTime );
-            m_transparentDepthOff.Reset( deltaTime );
-        }
-
-    public:
-
-        CommandBuffer               m_opaqueDepthOn;
-        CommandBuffer               m_opaqueDepthOff;
-        CommandBuffer               m_transparentDepthOn;
-        CommandBuffer               m_transparentDepthOff;
-    };
 }
 #endif
\ No newline at end of file
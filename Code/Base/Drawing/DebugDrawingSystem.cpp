@@ -7,52 +7,78 @@ namespace EE::Drawing
 {
     ThreadCommandBuffer& DrawingSystem::GetThreadCommandBuffer()
     {
-        Threading::ScopeLock Lock( m_commandBufferMutex );
-
-        auto const threadID = Threading::GetCurrentThreadID();
+        uint32_t const threadIdx = Threading::GetCurrentThreadIndex();
 
         // Check for an already created buffer for this thread
-        for ( auto& pThreadBuffer : m_threadCommandBuffers )
+        ThreadBuffers* pThreadBuffers = m_threadBuffers[threadIdx].load( std::memory_order_acquire );
+        if ( pThreadBuffers != nullptr )
         {
-            if ( pThreadBuffer->GetThreadID() == threadID )
-            {
-                return *pThreadBuffer;
-            }
+            return pThreadBuffers->m_recordingBuffer;
         }
 
-        // Create a new buffer
-        auto& pThreadBuffer = m_threadCommandBuffers.emplace_back( EE::New<ThreadCommandBuffer>( threadID ) );
-        return *pThreadBuffer;
+        // Create new buffers, only the thread owning this index will ever try to create them
+        pThreadBuffers = EE::New<ThreadBuffers>( Threading::GetCurrentThreadID() );
+        m_threadBuffers[threadIdx].store( pThreadBuffers, std::memory_order_release );
+
+        uint32_t numSlotsUsed = m_numThreadSlotsUsed.load( std::memory_order_relaxed );
+        while ( numSlotsUsed <= threadIdx && !m_numThreadSlotsUsed.compare_exchange_weak( numSlotsUsed, threadIdx + 1, std::memory_order_release, std::memory_order_relaxed ) ) {}
+
+        return pThreadBuffers->m_recordingBuffer;
     }
 
     DrawingSystem::~DrawingSystem()
     {
-        for ( auto& pBuffer : m_threadCommandBuffers )
+        for ( auto& pThreadBuffers : m_threadBuffers )
         {
-            EE::Delete( pBuffer );
+            ThreadBuffers* pBuffersToDelete = pThreadBuffers.load();
+            EE::Delete( pBuffersToDelete );
         }
     }
 
-    void DrawingSystem::ReflectFrameCommandBuffer( Seconds const deltaTime, FrameCommandBuffer& reflectedFrameCommands )
+    void DrawingSystem::FlipFrameCommandBuffers( Seconds const deltaTime )
     {
-        // Reset the frame buffer for a new frame, flush old commands and only keep ones with a valid TTL
-        reflectedFrameCommands.Reset( deltaTime );
+        uint32_t const numSlotsUsed = m_numThreadSlotsUsed.load( std::memory_order_acquire );
+        for ( uint32_t i = 0; i < numSlotsUsed; i++ )
+        {
+            ThreadBuffers* pThreadBuffers = m_threadBuffers[i].load( std::memory_order_acquire );
+            if ( pThreadBuffers == nullptr )
+            {
+                continue;
+            }
 
-        // Reflect all the new commands into the frame buffer
-        Threading::ScopeLock Lock( m_commandBufferMutex );
-        for ( auto& pThreadBuffer : m_threadCommandBuffers )
+            // Flush old commands and only keep ones with a valid TTL, these are usually rare so we copy them into the newly recorded buffer and swap
+            pThreadBuffers->m_frameBuffer.Reset( deltaTime );
+            pThreadBuffers->m_recordingBuffer.Append( pThreadBuffers->m_frameBuffer );
+            pThreadBuffers->m_frameBuffer.Swap( pThreadBuffers->m_recordingBuffer );
+            pThreadBuffers->m_recordingBuffer.Clear();
+        }
+    }
+
+    void DrawingSystem::GetFrameCommandBuffers( TInlineVector<ThreadCommandBuffer const*, 32>& outBuffers ) const
+    {
+        outBuffers.clear();
+
+        uint32_t const numSlotsUsed = m_numThreadSlotsUsed.load( std::memory_order_acquire );
+        for ( uint32_t i = 0; i < numSlotsUsed; i++ )
         {
-            reflectedFrameCommands.AddThreadCommands( *pThreadBuffer );
-            pThreadBuffer->Clear();
+            ThreadBuffers const* pThreadBuffers = m_threadBuffers[i].load( std::memory_order_acquire );
+            if ( pThreadBuffers != nullptr && !pThreadBuffers->m_frameBuffer.IsEmpty() )
+            {
+                outBuffers.emplace_back( &pThreadBuffers->m_frameBuffer );
+            }
         }
     }
 
     void DrawingSystem::Reset()
     {
-        Threading::ScopeLock Lock( m_commandBufferMutex );
-        for ( auto& pThreadBuffer : m_threadCommandBuffers )
+        uint32_t const numSlotsUsed = m_numThreadSlotsUsed.load( std::memory_order_acquire );
+        for ( uint32_t i = 0; i < numSlotsUsed; i++ )
         {
-            pThreadBuffer->Clear();
+            ThreadBuffers* pThreadBuffers = m_threadBuffers[i].load( std::memory_order_acquire );
+            if ( pThreadBuffers != nullptr )
+            {
+                pThreadBuffers->m_recordingBuffer.Clear();
+            }
         }
     }
 }
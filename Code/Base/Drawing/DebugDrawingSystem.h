@@ -3,28 +3,44 @@
 #include "Base/_Module/API.h"
 #include "Base/Drawing/DebugDrawing.h"
 #include "Base/Threading/Threading.h"
+#include <atomic>
 
 //-------------------------------------------------------------------------
 
 #if EE_DEVELOPMENT_TOOLS
 namespace EE::Drawing
 {
+    // Each thread gets its own command buffers in a slot indexed by its thread index, so recording commands never requires any locking
     class EE_BASE_API DrawingSystem
     {
+        struct ThreadBuffers
+        {
+            ThreadBuffers( Threading::ThreadID threadID )
+                : m_recordingBuffer( threadID )
+                , m_frameBuffer( threadID )
+            {}
+
+            ThreadCommandBuffer                 m_recordingBuffer;  // Only ever written to by the owning thread
+            ThreadCommandBuffer                 m_frameBuffer;      // The commands to draw, only modified when flipping the frame
+        };
 
     public:
 
         DrawingSystem() = default;
         ~DrawingSystem();
 
-        // Empty all per thread buffers
+        // Empty all per thread recording buffers, the frame buffers are left untouched as they might still be being rendered
         void Reset();
 
         // Returns a per-thread drawing context, this removes the need for constantly calling get thread command buffer
         inline DrawContext GetDrawingContext() { return DrawContext( GetThreadCommandBuffer() ); }
 
-        // Reflects all the individual per-thread buffers into a single supplied frame command buffer. Clears all thread buffers.
-        void ReflectFrameCommandBuffer( Seconds const deltaTime, FrameCommandBuffer& reflectedFrameCommands );
+        // Swap each thread's recorded commands into its frame buffer, any commands in the frame buffer with a valid TTL are kept.
+        // This must not be called while any thread is recording commands or while the previous frame is still being rendered.
+        void FlipFrameCommandBuffers( Seconds const deltaTime );
+
+        // Get all the non-empty per-thread frame buffers, these are valid until the next flip
+        void GetFrameCommandBuffers( TInlineVector<ThreadCommandBuffer const*, 32>& outBuffers ) const;
 
     private:
 
@@ -32,8 +48,8 @@ namespace EE::Drawing
 
     private:
 
-        TVector<ThreadCommandBuffer*>       m_threadCommandBuffers;
-        Threading::Mutex                    m_commandBufferMutex;
+        std::atomic<ThreadBuffers*>             m_threadBuffers[Threading::g_maxThreadIndices] = {};
+        std::atomic<uint32_t>                   m_numThreadSlotsUsed = 0;
     };
 }
 #endif
\ No newline at end of file
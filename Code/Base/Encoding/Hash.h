@@ -3,6 +3,7 @@
 #include "Base/_Module/API.h"
 #include "Base/Types/String.h"
 #include "Base/Types/Arrays.h"
+#include "Base/Encoding/Hash_ConstExpr.h"
 
 //-----------------------------------------------------------------------------
 
@@ -230,6 +230,41 @@ namespace EE::Quantization
             }
         }
 
+        // Decode 4 quaternions stored in a structure-of-arrays layout i.e. [4 x data0][4 x data1][4 x data2]
+        // The output is also in SoA form, i.e. each output vector holds a single component for all 4 quaternions
+        inline static void DecodeSoA( uint16_t const* pData, Vector& outX, Vector& outY, Vector& outZ, Vector& outW )
+        {
+            static Vector const vValueRangeMin( s_valueRangeMin );
+            static Vector const vRangeMultiplier15Bit( s_valueRangeLength / float( 0x7FFF ) );
+
+            __m128i const zero = _mm_setzero_si128();
+            __m128i const valueMask = _mm_set1_epi32( 0x7FFF );
+
+            // Widen the encoded data to 32bits
+            __m128i const data0 = _mm_unpacklo_epi16( _mm_loadl_epi64( reinterpret_cast<__m128i const*>( pData ) ), zero );
+            __m128i const data1 = _mm_unpacklo_epi16( _mm_loadl_epi64( reinterpret_cast<__m128i const*>( pData + 4 ) ), zero );
+            __m128i const data2 = _mm_unpacklo_epi16( _mm_loadl_epi64( reinterpret_cast<__m128i const*>( pData + 8 ) ), zero );
+
+            // Decode the three stored components and reconstruct the largest one
+            Vector const a = Vector::MultiplyAdd( _mm_cvtepi32_ps( _mm_and_si128( data0, valueMask ) ), vRangeMultiplier15Bit, vValueRangeMin );
+            Vector const b = Vector::MultiplyAdd( _mm_cvtepi32_ps( _mm_and_si128( data1, valueMask ) ), vRangeMultiplier15Bit, vValueRangeMin );
+            Vector const c = Vector::MultiplyAdd( _mm_cvtepi32_ps( data2 ), vRangeMultiplier15Bit, vValueRangeMin );
+            Vector const sum = ( a * a ) + ( b * b ) + ( c * c );
+            Vector const s = Vector::Max( Vector::One - sum, Vector::Zero ).GetSqrt();
+
+            // Reorder the components based on the largest value index: 0 -> (s,a,b,c), 1 -> (a,s,b,c), 2 -> (a,b,s,c), 3 -> (a,b,c,s)
+            __m128i const largestValueIndex = _mm_or_si128( _mm_and_si128( _mm_srli_epi32( data0, 14 ), _mm_set1_epi32( 0x0002 ) ), _mm_srli_epi32( data1, 15 ) );
+            Vector const isIdx0 = _mm_castsi128_ps( _mm_cmpeq_epi32( largestValueIndex, _mm_set1_epi32( 0 ) ) );
+            Vector const isIdx1 = _mm_castsi128_ps( _mm_cmpeq_epi32( largestValueIndex, _mm_set1_epi32( 1 ) ) );
+            Vector const isIdx2 = _mm_castsi128_ps( _mm_cmpeq_epi32( largestValueIndex, _mm_set1_epi32( 2 ) ) );
+            Vector const isIdx3 = _mm_castsi128_ps( _mm_cmpeq_epi32( largestValueIndex, _mm_set1_epi32( 3 ) ) );
+
+            outX = Vector::Select( a, s, isIdx0 );
+            outY = Vector::Select( Vector::Select( b, s, isIdx1 ), a, isIdx0 );
+            outZ = Vector::Select( Vector::Select( c, s, isIdx2 ), b, _mm_or_ps( isIdx0, isIdx1 ) );
+            outW = Vector::Select( c, s, isIdx3 );
+        }
+
         inline uint16_t GetData0() const { return m_data0; }
         inline uint16_t GetData1() const { return m_data1; }
         inline uint16_t GetData2() const { return m_data2; }
@@ -69,5 +69,33 @@ namespace EE
 
             std::ofstream m_filestream;
         };
+
+        //-------------------------------------------------------------------------
+        // Read-only memory mapping of an entire file, the file contents are paged in on access by the OS
+
+        class EE_BASE_API MemoryMappedFile
+        {
+        public:
+
+            MemoryMappedFile() = default;
+            MemoryMappedFile( MemoryMappedFile const& ) = delete;
+            ~MemoryMappedFile() { Unmap(); }
+
+            MemoryMappedFile& operator=( MemoryMappedFile const& ) = delete;
+
+            bool Map( Path const& filePath );
+            void Unmap();
+
+            inline bool IsMapped() const { return m_pData != nullptr; }
+            inline uint8_t const* GetData() const { EE_ASSERT( IsMapped() ); return m_pData; }
+            inline size_t GetSize() const { EE_ASSERT( IsMapped() ); return m_size; }
+
+        private:
+
+            void*           m_pFileHandle = nullptr;
+            void*           m_pMappingHandle = nullptr;
+            uint8_t const*  m_pData = nullptr;
+            size_t          m_size = 0;
+        };
     }
 }
\ No newline at end of file
@@ -55,6 +55,9 @@ namespace EE::FileSystem
 
     EE_BASE_API uint64_t GetFileModifiedTime( char const* filePath );
     EE_FORCE_INLINE uint64_t GetFileModifiedTime( String const& filePath ) { return GetFileModifiedTime( filePath.c_str() ); }
+
+    // Get the size and last write time of a file or directory with a single query, returns false if the path doesnt exist
+    EE_BASE_API bool GetFileSizeAndModifiedTime( char const* pPath, uint64_t& outSize, uint64_t& outModifiedTime );
     
     EE_BASE_API bool EraseFile( char const* filePath );
     EE_FORCE_INLINE bool EraseFile( String const& filePath ) { return EraseFile( filePath.c_str() ); }
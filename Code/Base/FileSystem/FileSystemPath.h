@@ -21,6 +21,16 @@ namespace EE::FileSystem
 
     public:
 
+        // Create a path from a string that is already a full normalized path (e.g. the string of an existing path)
+        // This skips the file system query required to normalize the path so is significantly cheaper when creating lots of paths
+        static inline Path FromNormalizedPathString( String const& normalizedPath )
+        {
+            Path path;
+            path.m_fullpath = normalizedPath;
+            path.UpdatePathInternals();
+            return path;
+        }
+
         Path() = default;
         Path( Path&& path ) { *this = std::move( path ); }
         Path( Path const& path ) : m_fullpath( path.m_fullpath ), m_hashCode( path.m_hashCode ), m_isDirectoryPath( path.m_isDirectoryPath ) {}
@@ -224,6 +234,11 @@ namespace EE::FileSystem
         return GetFileModifiedTime( filePath.c_str() );
     }
 
+    EE_FORCE_INLINE bool GetFileSizeAndModifiedTime( Path const& path, uint64_t& outSize, uint64_t& outModifiedTime )
+    {
+        return GetFileSizeAndModifiedTime( path.c_str(), outSize, outModifiedTime );
+    }
+
     EE_FORCE_INLINE bool EraseFile( Path const& filePath )
     {
         EE_ASSERT( filePath.IsFilePath() );
@@ -1,5 +1,6 @@
 #ifdef _WIN32
 #include "../FileSystem.h"
+#include "../FileStreams.h"
 #include "Base/Platform/PlatformUtils_Win32.h"
 #include "Base/Encoding/Hash.h"
 #include "Base/Math/Math.h"
@@ -127,6 +128,28 @@ namespace EE::FileSystem
         return fileWriteTime.QuadPart;
     }
 
+    bool GetFileSizeAndModifiedTime( char const* pPath, uint64_t& outSize, uint64_t& outModifiedTime )
+    {
+        WIN32_FILE_ATTRIBUTE_DATA attributeData;
+        if ( !GetFileAttributesExA( pPath, GetFileExInfoStandard, &attributeData ) )
+        {
+            outSize = outModifiedTime = 0;
+            return false;
+        }
+
+        ULARGE_INTEGER fileSize;
+        fileSize.LowPart = attributeData.nFileSizeLow;
+        fileSize.HighPart = attributeData.nFileSizeHigh;
+        outSize = ( attributeData.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY ) ? 0 : fileSize.QuadPart;
+
+        ULARGE_INTEGER fileWriteTime;
+        fileWriteTime.LowPart = attributeData.ftLastWriteTime.dwLowDateTime;
+        fileWriteTime.HighPart = attributeData.ftLastWriteTime.dwHighDateTime;
+        outModifiedTime = fileWriteTime.QuadPart;
+
+        return true;
+    }
+
     //-------------------------------------------------------------------------
 
     bool CreateDir( char const* path )
@@ -192,6 +215,73 @@ namespace EE::FileSystem
         CloseHandle( hFile );
         return true;
     }
+
+    //-------------------------------------------------------------------------
+
+    bool MemoryMappedFile::Map( Path const& filePath )
+    {
+        EE_ASSERT( filePath.IsFilePath() );
+        EE_ASSERT( !IsMapped() );
+
+        // Open file handle
+        HANDLE hFile = CreateFile( filePath.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_FLAG_RANDOM_ACCESS, nullptr );
+        if ( hFile == INVALID_HANDLE_VALUE )
+        {
+            return false;
+        }
+
+        // Get file size
+        LARGE_INTEGER fileSizeLI;
+        if ( !GetFileSizeEx( hFile, &fileSizeLI ) || fileSizeLI.QuadPart == 0 )
+        {
+            CloseHandle( hFile );
+            return false;
+        }
+
+        // Map the entire file
+        HANDLE hMapping = CreateFileMapping( hFile, nullptr, PAGE_READONLY, 0, 0, nullptr );
+        if ( hMapping == nullptr )
+        {
+            CloseHandle( hFile );
+            return false;
+        }
+
+        void* pView = MapViewOfFile( hMapping, FILE_MAP_READ, 0, 0, 0 );
+        if ( pView == nullptr )
+        {
+            CloseHandle( hMapping );
+            CloseHandle( hFile );
+            return false;
+        }
+
+        m_pFileHandle = hFile;
+        m_pMappingHandle = hMapping;
+        m_pData = (uint8_t const*) pView;
+        m_size = (size_t) fileSizeLI.QuadPart;
+        return true;
+    }
+
+    void MemoryMappedFile::Unmap()
+    {
+        if ( m_pData != nullptr )
+        {
+            UnmapViewOfFile( m_pData );
+            m_pData = nullptr;
+            m_size = 0;
+        }
+
+        if ( m_pMappingHandle != nullptr )
+        {
+            CloseHandle( m_pMappingHandle );
+            m_pMappingHandle = nullptr;
+        }
+
+        if ( m_pFileHandle != nullptr )
+        {
+            CloseHandle( m_pFileHandle );
+            m_pFileHandle = nullptr;
+        }
+    }
 }
 
 #endif
\ No newline at end of file
@@ -1,4 +1,5 @@
 #include "AABBTree.h"
+#include "ViewVolume.h"
 #include "Base/Types/Color.h"
 #include "Base/Drawing/DebugDrawing.h"
 
@@ -271,6 +272,60 @@ namespace EE::Math
         return outResults.size() > 0;
     }
 
+    void AABBTree::FindAllVisibleLeafNodes( int32_t currentNodeIdx, ViewVolume const& viewVolume, uint32_t planeMask, TVector<uint64_t>& outResults ) const
+    {
+        Node const& currentNode = m_nodes[currentNodeIdx];
+
+        ViewVolume::IntersectionResult const result = viewVolume.Intersect( currentNode.m_bounds, planeMask );
+        if ( result == ViewVolume::IntersectionResult::FullyOutside )
+        {
+            return;
+        }
+
+        if ( currentNode.IsLeafNode() )
+        {
+            EE_ASSERT( currentNode.m_userData != 0 );
+            outResults.push_back( currentNode.m_userData );
+        }
+        else if ( result == ViewVolume::IntersectionResult::FullyInside )
+        {
+            GatherAllLeafNodes( currentNodeIdx, outResults );
+        }
+        else
+        {
+            FindAllVisibleLeafNodes( currentNode.m_leftNodeIdx, viewVolume, planeMask, outResults );
+            FindAllVisibleLeafNodes( currentNode.m_rightNodeIdx, viewVolume, planeMask, outResults );
+        }
+    }
+
+    void AABBTree::GatherAllLeafNodes( int32_t currentNodeIdx, TVector<uint64_t>& outResults ) const
+    {
+        Node const& currentNode = m_nodes[currentNodeIdx];
+        if ( currentNode.IsLeafNode() )
+        {
+            EE_ASSERT( currentNode.m_userData != 0 );
+            outResults.push_back( currentNode.m_userData );
+        }
+        else
+        {
+            GatherAllLeafNodes( currentNode.m_leftNodeIdx, outResults );
+            GatherAllLeafNodes( currentNode.m_rightNodeIdx, outResults );
+        }
+    }
+
+    bool AABBTree::FindVisible( ViewVolume const& viewVolume, TVector<uint64_t>& outResults ) const
+    {
+        outResults.clear();
+
+        if ( m_rootNodeIdx == InvalidIndex )
+        {
+            return false;
+        }
+
+        FindAllVisibleLeafNodes( m_rootNodeIdx, viewVolume, ViewVolume::s_allPlanesMask, outResults );
+        return outResults.size() > 0;
+    }
+
     //-------------------------------------------------------------------------
 
     #if EE_DEVELOPMENT_TOOLS
@@ -6,6 +6,7 @@
 //-------------------------------------------------------------------------
 
 namespace EE::Drawing { class DrawContext; }
+namespace EE::Math { class ViewVolume; }
 
 //-------------------------------------------------------------------------
 
@@ -56,6 +57,16 @@ namespace EE::Math
             return FindOverlaps( queryBox, reinterpret_cast<TVector<uint64_t>&>( outResults ) );
         }
 
+        // Find all boxes that are inside or intersect the view volume
+        // Branches only test the view planes that their parent intersects, and branches fully inside the volume are gathered without any further tests
+        bool FindVisible( ViewVolume const& viewVolume, TVector<uint64_t>& outResults ) const;
+
+        template<typename T>
+        bool FindVisible( ViewVolume const& viewVolume, TVector<T*>& outResults ) const
+        {
+            return FindVisible( viewVolume, reinterpret_cast<TVector<uint64_t>&>( outResults ) );
+        }
+
         #if EE_DEVELOPMENT_TOOLS
         void DrawDebug( Drawing::DrawContext& drawingContext ) const;
         #endif
@@ -72,6 +83,8 @@ namespace EE::Math
         int32_t FindBestLeafNodeToCreateSiblingFor( int32_t startNodeIdx, AABB const& newBox ) const;
         void FindAllOverlappingLeafNodes( int32_t currentNodeIdx, AABB const& queryBox, TVector<uint64_t>& outResults ) const;
         void FindAllOverlappingLeafNodes( int32_t currentNodeIdx, OBB const& queryBox, TVector<uint64_t>& outResults ) const;
+        void FindAllVisibleLeafNodes( int32_t currentNodeIdx, ViewVolume const& viewVolume, uint32_t planeMask, TVector<uint64_t>& outResults ) const;
+        void GatherAllLeafNodes( int32_t currentNodeIdx, TVector<uint64_t>& outResults ) const;
 
         #if EE_DEVELOPMENT_TOOLS
         void DrawBranch( Drawing::DrawContext& drawingContext, int32_t nodeIdx ) const;
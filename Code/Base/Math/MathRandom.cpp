@@ -1,6 +1,7 @@
 #include "MathRandom.h"
-#include "Base/Threading/Threading.h"
+#include "Base/Math/Vector.h"
 #include <random>
+#include <atomic>
 
 //-------------------------------------------------------------------------
 
@@ -17,25 +18,107 @@ namespace EE::Math
         EE_ASSERT( seed != 0 );
     }
 
+    RNG::RNG( uint32_t seed, uint64_t streamID )
+        : m_rng( seed, streamID )
+    {
+        EE_ASSERT( seed != 0 );
+    }
+
+    //-------------------------------------------------------------------------
+
+    // Convert 4 random values to floats between [0, 1) using the top 24 bits of each value (i.e. all values are exactly representable)
+    EE_FORCE_INLINE static __m128 ConvertToUnitFloats( uint32_t const values[4] )
+    {
+        static __m128 const s_scale = _mm_set1_ps( 1.0f / 16777216.0f );
+        __m128i const vInt = _mm_srli_epi32( _mm_loadu_si128( reinterpret_cast<__m128i const*>( values ) ), 8 );
+        return _mm_mul_ps( _mm_cvtepi32_ps( vInt ), s_scale );
+    }
+
+    void RNG::GetFloats( float* pValues, size_t numValues, float min, float max ) const
+    {
+        EE_ASSERT( pValues != nullptr && max > min );
+
+        __m128 const vMin = _mm_set1_ps( min );
+        __m128 const vRange = _mm_set1_ps( max - min );
+
+        // The generator is inherently serial so only the conversion is vectorized
+        uint32_t randomValues[4];
+        size_t i = 0;
+        for ( ; i + 4 <= numValues; i += 4 )
+        {
+            randomValues[0] = m_rng();
+            randomValues[1] = m_rng();
+            randomValues[2] = m_rng();
+            randomValues[3] = m_rng();
+
+            __m128 const vResult = _mm_add_ps( vMin, _mm_mul_ps( vRange, ConvertToUnitFloats( randomValues ) ) );
+            _mm_storeu_ps( pValues + i, vResult );
+        }
+
+        for ( ; i < numValues; i++ )
+        {
+            pValues[i] = min + ( ( max - min ) * ( (float) ( m_rng() >> 8 ) * ( 1.0f / 16777216.0f ) ) );
+        }
+    }
+
+    void RNG::GetVectors( Vector* pValues, size_t numValues, Vector const& min, Vector const& max ) const
+    {
+        EE_ASSERT( pValues != nullptr );
+
+        __m128 const vRange = _mm_sub_ps( max, min );
+
+        uint32_t randomValues[4];
+        for ( size_t i = 0; i < numValues; i++ )
+        {
+            randomValues[0] = m_rng();
+            randomValues[1] = m_rng();
+            randomValues[2] = m_rng();
+            randomValues[3] = m_rng();
+
+            pValues[i] = _mm_add_ps( min, _mm_mul_ps( vRange, ConvertToUnitFloats( randomValues ) ) );
+        }
+    }
+
     //-------------------------------------------------------------------------
 
     namespace
     {
-        RNG                 g_rng;
-        Threading::Mutex    g_globalRandomMutex;
+        // Shared non-deterministic seed for all the per-thread streams
+        uint32_t GetGlobalSeed()
+        {
+            static uint32_t const s_seed = []()
+            {
+                std::random_device randomDevice;
+                uint32_t seed = 0;
+                while ( seed == 0 )
+                {
+                    seed = randomDevice();
+                }
+                return seed;
+            }();
+
+            return s_seed;
+        }
+
+        std::atomic<uint64_t> g_nextThreadStreamID = 0;
+
+        // Each thread lazily creates its own stream, so the global functions do not require any synchronization
+        RNG& GetThreadRNG()
+        {
+            thread_local RNG threadRNG( GetGlobalSeed(), g_nextThreadStreamID.fetch_add( 1, std::memory_order_relaxed ) );
+            return threadRNG;
+        }
     }
 
     bool GetRandomBool()
     {
-        Threading::ScopeLock lock( g_globalRandomMutex );
-        return g_rng.GetUInt( 0, 1 ) == 1;
+        return GetThreadRNG().GetUInt( 0, 1 ) == 1;
     }
 
     uint32_t GetRandomUInt( uint32_t min, uint32_t max )
     {
         EE_ASSERT( min < max );
-        Threading::ScopeLock lock( g_globalRandomMutex );
-        return g_rng.GetUInt( min, max );
+        return GetThreadRNG().GetUInt( min, max );
     }
 
     int32_t GetRandomInt( int32_t min, int32_t max )
@@ -49,7 +132,16 @@ namespace EE::Math
 
     float GetRandomFloat( float min, float max )
     {
-        Threading::ScopeLock lock( g_globalRandomMutex );
-        return g_rng.GetFloat( min, max );
+        return GetThreadRNG().GetFloat( min, max );
+    }
+
+    void GetRandomFloats( float* pValues, size_t numValues, float min, float max )
+    {
+        GetThreadRNG().GetFloats( pValues, numValues, min, max );
+    }
+
+    void GetRandomVectors( Vector* pValues, size_t numValues, Vector const& min, Vector const& max )
+    {
+        GetThreadRNG().GetVectors( pValues, numValues, min, max );
     }
-}
\ No newline at end of file
+}
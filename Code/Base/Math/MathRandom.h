@@ -3,6 +3,11 @@
 #include "Base/_Module/API.h"
 #include "Base/Esoterica.h"
 #include "Base/ThirdParty/pcg/include/pcg_random.hpp"
+#include <cmath>
+
+//-------------------------------------------------------------------------
+
+namespace EE { class Vector; }
 
 //-------------------------------------------------------------------------
 
@@ -17,6 +22,10 @@ namespace EE::Math
         RNG(); // Non-deterministic RNG
         RNG( uint32_t seed ); // Deterministic RNG
 
+        // Deterministic RNG stream, generators with the same seed but different stream IDs produce independent sequences
+        // Use this for reproducible per-entity/per-system randomness i.e. seed with the world/level seed and use the entity ID as the stream ID
+        RNG( uint32_t seed, uint64_t streamID );
+
         inline uint32_t GetUInt( uint32_t min = 0, uint32_t max = 0xFFFFFFFF ) const
         {
             EE_ASSERT( max > min );
@@ -33,13 +42,28 @@ namespace EE::Math
             return min + ( ( max - min ) * (float) ldexp( m_rng(), -32 ) );
         }
 
+        inline bool GetBool() const
+        {
+            return ( m_rng() & 1 ) != 0;
+        }
+
+        // Batch generation
+        //-------------------------------------------------------------------------
+
+        // Fill an array with random float values between [min, max)
+        void GetFloats( float* pValues, size_t numValues, float min = 0.0f, float max = 1.0f ) const;
+
+        // Fill an array with random vectors, each component is between the corresponding components of [min, max)
+        void GetVectors( Vector* pValues, size_t numValues, Vector const& min, Vector const& max ) const;
+
     private:
 
         mutable pcg32 m_rng;
     };
 
-    // Threadsafe global versions - Use in non-performance critical code
+    // Threadsafe global versions
     //-------------------------------------------------------------------------
+    // Every thread uses its own non-deterministically seeded stream so these never contend, use an 'RNG' if you need reproducible results
 
     // Get a random unsigned integer value between [min, max]
     EE_BASE_API bool GetRandomBool();
@@ -52,4 +76,10 @@ namespace EE::Math
 
     // Get a random float value between [min, max]
     EE_BASE_API float GetRandomFloat( float min = 0, float max = 1.0f );
+
+    // Fill an array with random float values between [min, max)
+    EE_BASE_API void GetRandomFloats( float* pValues, size_t numValues, float min = 0.0f, float max = 1.0f );
+
+    // Fill an array with random vectors, each component is between the corresponding components of [min, max)
+    EE_BASE_API void GetRandomVectors( Vector* pValues, size_t numValues, Vector const& min, Vector const& max );
 }
\ No newline at end of file
@@ -357,6 +357,21 @@ namespace EE::Math
         m_viewProjectionMatrix = m_viewMatrix * m_projectionMatrix;
         m_inverseViewProjectionMatrix = m_viewProjectionMatrix.GetInverse();
         CalculateViewPlanes( m_viewProjectionMatrix, m_viewPlanes );
+
+        // Transpose the planes so we can test 4 at once, the second set duplicates the near and far planes
+        static uint32_t const planeIndices[2][4] = { { 0, 1, 2, 3 }, { 4, 5, 4, 5 } };
+        for ( auto i = 0u; i < 2; i++ )
+        {
+            Plane const& p0 = m_viewPlanes[planeIndices[i][0]];
+            Plane const& p1 = m_viewPlanes[planeIndices[i][1]];
+            Plane const& p2 = m_viewPlanes[planeIndices[i][2]];
+            Plane const& p3 = m_viewPlanes[planeIndices[i][3]];
+
+            m_planesX[i] = Vector( p0.a, p1.a, p2.a, p3.a );
+            m_planesY[i] = Vector( p0.b, p1.b, p2.b, p3.b );
+            m_planesZ[i] = Vector( p0.c, p1.c, p2.c, p3.c );
+            m_planesW[i] = Vector( p0.d, p1.d, p2.d, p3.d );
+        }
     }
 
     //-------------------------------------------------------------------------
@@ -528,6 +543,44 @@ namespace EE::Math
         return IntersectionResult::FullyInside;
     }
 
+    ViewVolume::IntersectionResult ViewVolume::Intersect( AABB const& aabb, uint32_t& inOutPlaneMask ) const
+    {
+        EE_ASSERT( ( inOutPlaneMask & ~s_allPlanesMask ) == 0 );
+
+        if ( inOutPlaneMask == 0 )
+        {
+            return IntersectionResult::FullyInside;
+        }
+
+        Vector const centerX = aabb.GetCenter().GetSplatX();
+        Vector const centerY = aabb.GetCenter().GetSplatY();
+        Vector const centerZ = aabb.GetCenter().GetSplatZ();
+        Vector const extentsX = aabb.GetExtents().GetSplatX();
+        Vector const extentsY = aabb.GetExtents().GetSplatY();
+        Vector const extentsZ = aabb.GetExtents().GetSplatZ();
+
+        uint32_t outsideMask = 0;
+        uint32_t intersectingMask = 0;
+
+        for ( auto i = 0u; i < 2; i++ )
+        {
+            Vector const distance = Vector::MultiplyAdd( m_planesX[i], centerX, Vector::MultiplyAdd( m_planesY[i], centerY, Vector::MultiplyAdd( m_planesZ[i], centerZ, m_planesW[i] ) ) );
+            Vector const radius = Vector::MultiplyAdd( m_planesX[i].GetAbs(), extentsX, Vector::MultiplyAdd( m_planesY[i].GetAbs(), extentsY, m_planesZ[i].GetAbs() * extentsZ ) );
+
+            uint32_t const groupMask = ( i == 0 ) ? 0xF : 0x3;
+            outsideMask |= ( _mm_movemask_ps( ( distance + radius ).LessThan( Vector::Zero ) ) & groupMask ) << ( i * 4 );
+            intersectingMask |= ( _mm_movemask_ps( ( distance - radius ).LessThan( Vector::Zero ) ) & groupMask ) << ( i * 4 );
+        }
+
+        if ( ( outsideMask & inOutPlaneMask ) != 0 )
+        {
+            return IntersectionResult::FullyOutside;
+        }
+
+        inOutPlaneMask &= intersectingMask;
+        return ( inOutPlaneMask == 0 ) ? IntersectionResult::FullyInside : IntersectionResult::Intersects;
+    }
+
     ViewVolume::IntersectionResult ViewVolume::Intersect( Vector const& point ) const
     {
         for ( auto i = 0u; i < 6; i++ )
@@ -35,6 +35,9 @@ namespace EE::Math
         enum class ProjectionType { Orthographic, Perspective };
         enum class IntersectionResult { FullyOutside = 0, FullyInside, Intersects };
 
+        // Bit per view plane (in PlaneID order), used to skip planes that a parent volume is already fully inside of
+        constexpr static uint32_t const s_allPlanesMask = 0x3F;
+
         inline static Radians ConvertVerticalToHorizontalFOV( float width, float height, Radians VerticalAngle )
         {
             EE_ASSERT( !Math::IsNearZero( height ) );
@@ -149,6 +152,10 @@ namespace EE::Math
         IntersectionResult Intersect( Vector const& point ) const;
 
         inline bool Contains( AABB const& aabb ) const { return Intersect( aabb ) != IntersectionResult::FullyOutside; }
+
+        // Tests the box against 4 planes at a time, only the planes set in the mask are tested
+        // On return, the mask only contains the planes that the box intersects, so it can be passed on when testing boxes contained by this one
+        IntersectionResult Intersect( AABB const& aabb, uint32_t& inOutPlaneMask ) const;
         inline bool Contains( Vector const& point ) const { return Intersect( point ) != IntersectionResult::FullyOutside; }
 
         //-------------------------------------------------------------------------
@@ -173,6 +180,10 @@ namespace EE::Math
         Matrix                  m_viewProjectionMatrix;                 // Cached view projection matrix
         Matrix                  m_inverseViewProjectionMatrix;          // Inverse of the cached view projection matrix
         Plane                   m_viewPlanes[6];                        // Cached view planes for this volume
+        Vector                  m_planesX[2];                           // Transposed view planes for SIMD tests ( Left, Right, Top, Bottom ), ( Near, Far, Near, Far )
+        Vector                  m_planesY[2];
+        Vector                  m_planesZ[2];
+        Vector                  m_planesW[2];
 
         Float2                  m_viewDimensions = Float2::Zero;        // The dimensions of the view volume
         Radians                 m_FOV = Radians( 0.0f );                // The horizontal field of view angle (only for perspective projection)
@@ -4,6 +4,7 @@
 #include "Base/RHI/RHIDevice.h"
 #include "Base/RHI/Resource/RHIBuffer.h"
 #include "Base/RHI/Resource/RHITexture.h"
+#include <EASTL/sort.h>
 
 namespace EE
 {
@@ -66,9 +67,130 @@ namespace EE
 			}
 		}
 
+		#endif
+
         // Compilation Stage
         //-------------------------------------------------------------------------
 
+        // Barrier States
+        //-------------------------------------------------------------------------
+        // Imported resources store their access as a render graph barrier state, while nodes record render barrier states.
+        // Both enums list the same states so they are converted by value, every state is validated here so the enums cannot silently diverge.
+        // Any state added to one of the enums needs to be added to the other one and to this list.
+
+        #define EE_RG_VALIDATE_BARRIER_STATE( State ) static_assert( (int32_t) RGResourceBarrierState::State == (int32_t) Render::RenderResourceBarrierState::State, "Render graph barrier state does not match the render barrier state: " #State )
+
+        EE_RG_VALIDATE_BARRIER_STATE( Undefined );
+        EE_RG_VALIDATE_BARRIER_STATE( IndirectBuffer );
+        EE_RG_VALIDATE_BARRIER_STATE( VertexBuffer );
+        EE_RG_VALIDATE_BARRIER_STATE( IndexBuffer );
+        EE_RG_VALIDATE_BARRIER_STATE( VertexShaderReadUniformBuffer );
+        EE_RG_VALIDATE_BARRIER_STATE( VertexShaderReadSampledImageOrUniformTexelBuffer );
+        EE_RG_VALIDATE_BARRIER_STATE( VertexShaderReadOther );
+        EE_RG_VALIDATE_BARRIER_STATE( TessellationControlShaderReadUniformBuffer );
+        EE_RG_VALIDATE_BARRIER_STATE( TessellationControlShaderReadSampledImageOrUniformTexelBuffer );
+        EE_RG_VALIDATE_BARRIER_STATE( TessellationControlShaderReadOther );
+        EE_RG_VALIDATE_BARRIER_STATE( TessellationEvaluationShaderReadUniformBuffer );
+        EE_RG_VALIDATE_BARRIER_STATE( TessellationEvaluationShaderReadSampledImageOrUniformTexelBuffer );
+        EE_RG_VALIDATE_BARRIER_STATE( TessellationEvaluationShaderReadOther );
+        EE_RG_VALIDATE_BARRIER_STATE( GeometryShaderReadUniformBuffer );
+        EE_RG_VALIDATE_BARRIER_STATE( GeometryShaderReadSampledImageOrUniformTexelBuffer );
+        EE_RG_VALIDATE_BARRIER_STATE( GeometryShaderReadOther );
+        EE_RG_VALIDATE_BARRIER_STATE( FragmentShaderReadUniformBuffer );
+        EE_RG_VALIDATE_BARRIER_STATE( FragmentShaderReadSampledImageOrUniformTexelBuffer );
+        EE_RG_VALIDATE_BARRIER_STATE( FragmentShaderReadColorInputAttachment );
+        EE_RG_VALIDATE_BARRIER_STATE( FragmentShaderReadDepthStencilInputAttachment );
+        EE_RG_VALIDATE_BARRIER_STATE( FragmentShaderReadOther );
+        EE_RG_VALIDATE_BARRIER_STATE( ColorAttachmentRead );
+        EE_RG_VALIDATE_BARRIER_STATE( DepthStencilAttachmentRead );
+        EE_RG_VALIDATE_BARRIER_STATE( ComputeShaderReadUniformBuffer );
+        EE_RG_VALIDATE_BARRIER_STATE( ComputeShaderReadSampledImageOrUniformTexelBuffer );
+        EE_RG_VALIDATE_BARRIER_STATE( ComputeShaderReadOther );
+        EE_RG_VALIDATE_BARRIER_STATE( AnyShaderReadUniformBuffer );
+        EE_RG_VALIDATE_BARRIER_STATE( AnyShaderReadUniformBufferOrVertexBuffer );
+        EE_RG_VALIDATE_BARRIER_STATE( AnyShaderReadSampledImageOrUniformTexelBuffer );
+        EE_RG_VALIDATE_BARRIER_STATE( AnyShaderReadOther );
+        EE_RG_VALIDATE_BARRIER_STATE( TransferRead );
+        EE_RG_VALIDATE_BARRIER_STATE( HostRead );
+        EE_RG_VALIDATE_BARRIER_STATE( Present );
+        EE_RG_VALIDATE_BARRIER_STATE( VertexShaderWrite );
+        EE_RG_VALIDATE_BARRIER_STATE( TessellationControlShaderWrite );
+        EE_RG_VALIDATE_BARRIER_STATE( TessellationEvaluationShaderWrite );
+        EE_RG_VALIDATE_BARRIER_STATE( GeometryShaderWrite );
+        EE_RG_VALIDATE_BARRIER_STATE( FragmentShaderWrite );
+        EE_RG_VALIDATE_BARRIER_STATE( ColorAttachmentWrite );
+        EE_RG_VALIDATE_BARRIER_STATE( DepthStencilAttachmentWrite );
+        EE_RG_VALIDATE_BARRIER_STATE( DepthAttachmentWriteStencilReadOnly );
+        EE_RG_VALIDATE_BARRIER_STATE( StencilAttachmentWriteDepthReadOnly );
+        EE_RG_VALIDATE_BARRIER_STATE( ComputeShaderWrite );
+        EE_RG_VALIDATE_BARRIER_STATE( AnyShaderWrite );
+        EE_RG_VALIDATE_BARRIER_STATE( TransferWrite );
+        EE_RG_VALIDATE_BARRIER_STATE( HostWrite );
+        EE_RG_VALIDATE_BARRIER_STATE( ColorAttachmentReadWrite );
+        EE_RG_VALIDATE_BARRIER_STATE( General );
+        EE_RG_VALIDATE_BARRIER_STATE( RayTracingShaderReadSampledImageOrUniformTexelBuffer );
+        EE_RG_VALIDATE_BARRIER_STATE( RayTracingShaderReadColorInputAttachment );
+        EE_RG_VALIDATE_BARRIER_STATE( RayTracingShaderReadDepthStencilInputAttachment );
+        EE_RG_VALIDATE_BARRIER_STATE( RayTracingShaderReadAccelerationStructure );
+        EE_RG_VALIDATE_BARRIER_STATE( RayTracingShaderReadOther );
+        EE_RG_VALIDATE_BARRIER_STATE( AccelerationStructureBuildWrite );
+        EE_RG_VALIDATE_BARRIER_STATE( AccelerationStructureBuildRead );
+        EE_RG_VALIDATE_BARRIER_STATE( AccelerationStructureBufferWrite );
+
+        #undef EE_RG_VALIDATE_BARRIER_STATE
+
+        static Render::RenderResourceBarrierState ToRenderBarrierState( RGResourceBarrierState state )
+        {
+            return static_cast<Render::RenderResourceBarrierState>( state );
+        }
+
+        static RGResourceBarrierState ToRGBarrierState( Render::RenderResourceBarrierState state )
+        {
+            return static_cast<RGResourceBarrierState>( state );
+        }
+
+        //-------------------------------------------------------------------------
+
+        // Can a resource use the physical resource that was created for another resource
+        static bool CanShareRHIResource( RGResource const& physicalDescResource, RGResource const& resource )
+        {
+            if ( physicalDescResource.GetResourceType() != resource.GetResourceType() )
+            {
+                return false;
+            }
+
+            switch ( resource.GetResourceType() )
+            {
+                // Buffers can be placed in any large enough buffer with the same usage
+                case RGResourceType::Buffer:
+                {
+                    RHI::RHIBufferCreateDesc const& physicalDesc = physicalDescResource.GetDesc<RGResourceTagBuffer>().m_desc;
+                    RHI::RHIBufferCreateDesc const& desc = resource.GetDesc<RGResourceTagBuffer>().m_desc;
+                    return physicalDesc.m_desireSize >= desc.m_desireSize && physicalDesc.m_usage == desc.m_usage && physicalDesc.m_memoryUsage == desc.m_memoryUsage && physicalDesc.m_memoryFlag == desc.m_memoryFlag;
+                }
+                break;
+
+                // Textures need to have been created identically
+                case RGResourceType::Texture:
+                {
+                    RHI::RHITextureCreateDesc const& physicalDesc = physicalDescResource.GetDesc<RGResourceTagTexture>().m_desc;
+                    RHI::RHITextureCreateDesc const& desc = resource.GetDesc<RGResourceTagTexture>().m_desc;
+                    return physicalDesc.m_width == desc.m_width && physicalDesc.m_height == desc.m_height && physicalDesc.m_depth == desc.m_depth &&
+                        physicalDesc.m_array == desc.m_array && physicalDesc.m_mipmap == desc.m_mipmap && physicalDesc.m_format == desc.m_format &&
+                        physicalDesc.m_usage == desc.m_usage && physicalDesc.m_tiling == desc.m_tiling && physicalDesc.m_sample == desc.m_sample &&
+                        physicalDesc.m_type == desc.m_type && physicalDesc.m_flag == desc.m_flag && physicalDesc.m_memoryUsage == desc.m_memoryUsage &&
+                        physicalDesc.m_memoryFlag == desc.m_memoryFlag;
+                }
+                break;
+
+                default:
+                return false;
+                break;
+            }
+        }
+
+        //-------------------------------------------------------------------------
+
         void RenderGraph::Compile( TSharedPtr<RHI::RHIDevice> const& pRhiDevice )
         {
             if ( pRhiDevice == nullptr )
@@ -77,50 +199,144 @@ namespace EE
                 return;
             }
 
+            // Release the resources created by any previous compilation
+            DestroyPhysicalResources( pRhiDevice );
+
+            // Compile and Analyze graph nodes to populate an execution sequence
+            //-------------------------------------------------------------------------
+
+            CullNodes();
+            ComputeResourceLifetimes();
+
             // Create actual RHI Resources
             //-------------------------------------------------------------------------
 
             CreateRHIResource( pRhiDevice );
 
-            // Compile and Analyze graph nodes to populate an execution sequence
+            // Synchronization
             //-------------------------------------------------------------------------
+
+            GenerateBarriers();
+        }
+
+        void RenderGraph::CullNodes()
+        {
+            // Nodes are only able to use resources written by previously added nodes, so we can walk the nodes in reverse order and in a single pass
+            // mark every node that writes to a resource that is used outside of the graph or that is read by a later node that was not culled.
+            TVector<bool> isResourceNeeded( m_graphResources.size(), false );
+            for ( size_t i = 0; i < m_graphResources.size(); i++ )
+            {
+                isResourceNeeded[i] = m_graphResources[i].IsExported() || !m_graphResources[i].IsLazyCreateResource();
+            }
+
+            for ( int32_t nodeIdx = (int32_t) m_graph.size() - 1; nodeIdx >= 0; nodeIdx-- )
+            {
+                RGNode& node = m_graph[nodeIdx];
+
+                node.m_isCulled = !node.m_neverCull;
+                for ( RGNodeResource const& output : node.m_pOutputs )
+                {
+                    if ( isResourceNeeded[output.m_slotID.m_id] )
+                    {
+                        node.m_isCulled = false;
+                        break;
+                    }
+                }
+
+                if ( node.m_isCulled )
+                {
+                    continue;
+                }
+
+                for ( RGNodeResource const& input : node.m_pInputs )
+                {
+                    isResourceNeeded[input.m_slotID.m_id] = true;
+                }
+            }
+
+            // Executable nodes are kept in submission order
+            //-------------------------------------------------------------------------
+
+            m_executableGraph.clear();
+            for ( RGNode const& node : m_graph )
+            {
+                if ( !node.m_isCulled )
+                {
+                    m_executableGraph.emplace_back( node.m_id, node.m_pipelineHandle );
+                }
+            }
+        }
+
+        void RenderGraph::ComputeResourceLifetimes()
+        {
+            for ( RGResource& rgResource : m_graphResources )
+            {
+                rgResource.m_firstUseNodeIdx = InvalidIndex;
+                rgResource.m_lastUseNodeIdx = InvalidIndex;
+            }
+
+            auto UpdateLifetime = [this] ( RGNodeResource const& nodeResource, int32_t executableNodeIdx )
+            {
+                RGResource& rgResource = GetRGResource( nodeResource );
+                if ( rgResource.m_firstUseNodeIdx == InvalidIndex )
+                {
+                    rgResource.m_firstUseNodeIdx = executableNodeIdx;
+                }
+                rgResource.m_lastUseNodeIdx = executableNodeIdx;
+            };
+
+            int32_t const numExecutableNodes = (int32_t) m_executableGraph.size();
+            for ( int32_t executableNodeIdx = 0; executableNodeIdx < numExecutableNodes; executableNodeIdx++ )
+            {
+                RGNode const& node = m_graph[m_executableGraph[executableNodeIdx].m_nodeID];
+
+                for ( RGNodeResource const& input : node.m_pInputs )
+                {
+                    UpdateLifetime( input, executableNodeIdx );
+                }
+
+                for ( RGNodeResource const& output : node.m_pOutputs )
+                {
+                    UpdateLifetime( output, executableNodeIdx );
+                }
+            }
+
+            // Exported resources are needed until the end of the graph
+            for ( RGResource& rgResource : m_graphResources )
+            {
+                if ( rgResource.IsExported() && rgResource.IsUsed() )
+                {
+                    rgResource.m_lastUseNodeIdx = numExecutableNodes - 1;
+                }
+            }
         }
 
         void RenderGraph::CreateRHIResource( TSharedPtr<RHI::RHIDevice> const& pRhiDevice )
         {
-            auto CreateRHILazyResource = [pRhiDevice] ( RGResource& rgResource )
+            EE_ASSERT( m_physicalResources.empty() );
+
+            auto CreatePhysicalResource = [this, &pRhiDevice] ( uint32_t resourceIdx ) -> int32_t
             {
+                RGResource const& rgResource = m_graphResources[resourceIdx];
+
+                RGPhysicalResource& physicalResource = m_physicalResources.emplace_back();
+                physicalResource.m_descResourceIdx = resourceIdx;
+
                 switch ( rgResource.GetResourceType() )
                 {
                     case RGResourceType::Buffer:
                     {
                         BufferDesc const& desc = rgResource.GetDesc<RGResourceTagBuffer>();
-
-                        EE_LOG_INFO( "RenderGraph", "RenderGraph::CreateNodeRHIResource()", "Buffer Desired Size = %d", desc.m_desc.m_desireSize );
-                        EE_LOG_INFO( "RenderGraph", "RenderGraph::CreateNodeRHIResource()", "Buffer Allocated Size = %d", desc.m_desc.m_desireSize );
-
-                        if ( rgResource.IsLazyCreateResource() )
-                        {
-                            RGLazyCreateResource& rhiResource = rgResource.GetLazyCreateResource();
-                            rhiResource.m_pRhiResource = pRhiDevice->CreateBuffer( desc.m_desc );
-                            EE_ASSERT( rhiResource.m_pRhiResource != nullptr );
-                        }
+                        physicalResource.m_pRhiResource = pRhiDevice->CreateBuffer( desc.m_desc );
+                        EE_ASSERT( physicalResource.m_pRhiResource != nullptr );
                     }
                     break;
 
                     case RGResourceType::Texture:
                     {
                         TextureDesc const& desc = rgResource.GetDesc<RGResourceTagTexture>();
-
-                        EE_LOG_INFO( "RenderGraph", "RenderGraph::CreateNodeRHIResource()", "Texture Width = %d", desc.m_desc.m_width );
-                        EE_LOG_INFO( "RenderGraph", "RenderGraph::CreateNodeRHIResource()", "Texture Height = %d", desc.m_desc.m_height );
-
-                        if ( rgResource.IsLazyCreateResource() )
-                        {
-                            RGLazyCreateResource& rhiResource = rgResource.GetLazyCreateResource();
-                            rhiResource.m_pRhiResource = pRhiDevice->CreateTexture( desc.m_desc );
-                            EE_ASSERT( rhiResource.m_pRhiResource != nullptr );
-                        }
+                        physicalResource.m_pRhiResource = pRhiDevice->CreateTexture( desc.m_desc );
+                        EE_ASSERT( physicalResource.m_pRhiResource != nullptr );
                     }
                     break;
 
@@ -130,58 +346,252 @@ namespace EE
                     EE_ASSERT( false );
                     break;
                 }
+
+                return (int32_t) m_physicalResources.size() - 1;
+            };
+
+            // Exported resources get their own RHI resources, gather all used transient resources
+            //-------------------------------------------------------------------------
+
+            TInlineVector<uint32_t, 32> transientResources;
+            for ( uint32_t resourceIdx = 0; resourceIdx < (uint32_t) m_graphResources.size(); resourceIdx++ )
+            {
+                RGResource& rgResource = m_graphResources[resourceIdx];
+                rgResource.m_physicalResourceIdx = InvalidIndex;
+
+                if ( !rgResource.IsLazyCreateResource() )
+                {
+                    continue;
+                }
+
+                rgResource.GetLazyCreateResource().m_pRhiResource = nullptr;
+
+                if ( !rgResource.IsUsed() )
+                {
+                    continue;
+                }
+
+                if ( rgResource.IsExported() )
+                {
+                    rgResource.m_physicalResourceIdx = CreatePhysicalResource( resourceIdx );
+                    m_physicalResources[rgResource.m_physicalResourceIdx].m_lastUseNodeIdx = std::numeric_limits<int32_t>::max();
+                }
+                else
+                {
+                    transientResources.emplace_back( resourceIdx );
+                }
+            }
+
+            // Alias transient resources
+            //-------------------------------------------------------------------------
+            // Process the resources in order of first use and greedily reuse the first compatible physical resource that is no longer in use
+
+            auto Comparator = [this] ( uint32_t const& resourceIdxA, uint32_t const& resourceIdxB )
+            {
+                int32_t const firstUseA = m_graphResources[resourceIdxA].m_firstUseNodeIdx;
+                int32_t const firstUseB = m_graphResources[resourceIdxB].m_firstUseNodeIdx;
+                return ( firstUseA != firstUseB ) ? firstUseA < firstUseB : resourceIdxA < resourceIdxB;
             };
 
-            for ( auto& rgResource : m_graphResources )
+            eastl::sort( transientResources.begin(), transientResources.end(), Comparator );
+
+            for ( uint32_t resourceIdx : transientResources )
             {
-                CreateRHILazyResource( rgResource );
+                RGResource& rgResource = m_graphResources[resourceIdx];
+
+                for ( int32_t physicalResourceIdx = 0; physicalResourceIdx < (int32_t) m_physicalResources.size(); physicalResourceIdx++ )
+                {
+                    RGPhysicalResource const& physicalResource = m_physicalResources[physicalResourceIdx];
+                    if ( physicalResource.m_lastUseNodeIdx < rgResource.m_firstUseNodeIdx && CanShareRHIResource( m_graphResources[physicalResource.m_descResourceIdx], rgResource ) )
+                    {
+                        rgResource.m_physicalResourceIdx = physicalResourceIdx;
+                        break;
+                    }
+                }
+
+                if ( rgResource.m_physicalResourceIdx == InvalidIndex )
+                {
+                    rgResource.m_physicalResourceIdx = CreatePhysicalResource( resourceIdx );
+                }
+
+                m_physicalResources[rgResource.m_physicalResourceIdx].m_lastUseNodeIdx = rgResource.m_lastUseNodeIdx;
             }
 
-            // Compile nodes into executable nodes
-            // TODO: graph dependency analyze
+            // Set the RHI resources
             //-------------------------------------------------------------------------
 
-            for ( RGNode const& node : m_graph )
+            for ( RGResource& rgResource : m_graphResources )
             {
-                
+                if ( rgResource.m_physicalResourceIdx != InvalidIndex )
+                {
+                    rgResource.GetLazyCreateResource().m_pRhiResource = m_physicalResources[rgResource.m_physicalResourceIdx].m_pRhiResource;
+                }
+            }
+        }
+
+        void RenderGraph::GenerateBarriers()
+        {
+            using Render::RenderResourceBarrierState;
+
+            // The current access of each physical resource, when a resource is aliased the previous access is that of the previous user of the physical resource
+            TVector<RenderResourceBarrierState> physicalResourceAccesses( m_physicalResources.size(), RenderResourceBarrierState::Undefined );
+
+            // Imported resources are not backed by physical resources so track their accesses separately
+            TVector<RenderResourceBarrierState> importedResourceAccesses( m_graphResources.size(), RenderResourceBarrierState::Undefined );
+            for ( size_t i = 0; i < m_graphResources.size(); i++ )
+            {
+                if ( !m_graphResources[i].IsLazyCreateResource() )
+                {
+                    importedResourceAccesses[i] = ToRenderBarrierState( m_graphResources[i].GetImportedResource().m_currentAccess );
+                }
+            }
+
+            //-------------------------------------------------------------------------
+
+            TInlineVector<RGNodeResource const*, 8> nodeAccesses;
+
+            int32_t const numExecutableNodes = (int32_t) m_executableGraph.size();
+            for ( int32_t executableNodeIdx = 0; executableNodeIdx < numExecutableNodes; executableNodeIdx++ )
+            {
+                RGExecutableNode& executableNode = m_executableGraph[executableNodeIdx];
+                executableNode.m_barriers.clear();
+
+                // Get a single access per resource for this node, a write takes precedence over a read of the same resource
+                //-------------------------------------------------------------------------
+
+                RGNode const& node = m_graph[executableNode.m_nodeID];
+
+                nodeAccesses.clear();
+                for ( RGNodeResource const& input : node.m_pInputs )
+                {
+                    nodeAccesses.emplace_back( &input );
+                }
+
+                for ( RGNodeResource const& output : node.m_pOutputs )
+                {
+                    auto SameResource = [&output] ( RGNodeResource const* pAccess ) { return pAccess->m_slotID.m_id == output.m_slotID.m_id; };
+                    auto iter = eastl::find_if( nodeAccesses.begin(), nodeAccesses.end(), SameResource );
+                    if ( iter != nodeAccesses.end() )
+                    {
+                        *iter = &output;
+                    }
+                    else
+                    {
+                        nodeAccesses.emplace_back( &output );
+                    }
+                }
+
+                // Only generate barriers for actual state changes
+                //-------------------------------------------------------------------------
+
+                for ( RGNodeResource const* pAccess : nodeAccesses )
+                {
+                    RGResource const& rgResource = GetRGResource( *pAccess );
+                    RenderResourceBarrierState& currentAccess = ( rgResource.m_physicalResourceIdx != InvalidIndex ) ? physicalResourceAccesses[rgResource.m_physicalResourceIdx] : importedResourceAccesses[pAccess->m_slotID.m_id];
+
+                    RenderResourceBarrierState const previousAccess = currentAccess;
+                    RenderResourceBarrierState const nextAccess = pAccess->m_passAccess.GetCurrentAccess();
+                    currentAccess = nextAccess;
+
+                    // Consecutive identical reads do not need to be synchronized
+                    if ( previousAccess == nextAccess && pAccess->m_passAccess.SkipSyncIfContinuous() )
+                    {
+                        continue;
+                    }
+
+                    // Buffers have no layout so there is nothing to synchronize on the first access of a newly created buffer
+                    if ( previousAccess == RenderResourceBarrierState::Undefined && rgResource.GetResourceType() == RGResourceType::Buffer )
+                    {
+                        continue;
+                    }
+
+                    RGResourceBarrier& barrier = executableNode.m_barriers.emplace_back();
+                    barrier.m_slotID = pAccess->m_slotID;
+                    barrier.m_previousAccess = previousAccess;
+                    barrier.m_nextAccess = nextAccess;
+                    barrier.m_discardContents = rgResource.IsLazyCreateResource() && rgResource.m_firstUseNodeIdx == executableNodeIdx;
+                }
             }
         }
 
         // Execution Stage
         //-------------------------------------------------------------------------
 
-        void RenderGraph::Execute()
+        void RenderGraph::Execute( RenderGraphContext& context )
         {
+            EE_ASSERT( Threading::IsMainThread() );
+
+            TInlineVector<RGExecutionBarrier, 8> executionBarriers;
+
+            for ( RGExecutableNode const& executableNode : m_executableGraph )
+            {
+                RGNode const& node = m_graph[executableNode.m_nodeID];
+                EE_ASSERT( !node.m_isCulled );
+
+                // Resolve the barriers to the RHI resources backing the graph resources
+                //-------------------------------------------------------------------------
+
+                executionBarriers.clear();
+                for ( RGResourceBarrier const& barrier : executableNode.m_barriers )
+                {
+                    RGResource& rgResource = m_graphResources[barrier.m_slotID.m_id];
+
+                    RGExecutionBarrier& executionBarrier = executionBarriers.emplace_back();
+                    executionBarrier.m_resourceType = rgResource.GetResourceType();
+                    executionBarrier.m_previousAccess = barrier.m_previousAccess;
+                    executionBarrier.m_nextAccess = barrier.m_nextAccess;
+                    executionBarrier.m_discardContents = barrier.m_discardContents;
+
+                    if ( rgResource.IsLazyCreateResource() )
+                    {
+                        executionBarrier.m_pRhiResource = rgResource.GetLazyCreateResource().m_pRhiResource;
+                        EE_ASSERT( executionBarrier.m_pRhiResource != nullptr );
+                    }
+                    else
+                    {
+                        rgResource.GetImportedResource().m_currentAccess = ToRGBarrierState( barrier.m_nextAccess );
+                    }
+                }
+
+                // Run the node
+                //-------------------------------------------------------------------------
+
+                context.BeginNode( node.m_passName );
+
+                if ( !executionBarriers.empty() )
+                {
+                    context.PipelineBarrier( executionBarriers.data(), (uint32_t) executionBarriers.size() );
+                }
 
+                if ( node.m_executeFunction )
+                {
+                    node.m_executeFunction( context );
+                }
+
+                context.EndNode();
+            }
         }
 
         // Cleanup Stage
         //-------------------------------------------------------------------------
 
-        void RenderGraph::ClearAllRHIResources( TSharedPtr<RHI::RHIDevice> const& pRhiDevice )
+        void RenderGraph::DestroyPhysicalResources( TSharedPtr<RHI::RHIDevice> const& pRhiDevice )
         {
-            for ( auto& resource : m_graphResources )
+            for ( RGPhysicalResource& physicalResource : m_physicalResources )
             {
-                switch ( resource.GetResourceType() )
+                switch ( m_graphResources[physicalResource.m_descResourceIdx].GetResourceType() )
                 {
                     case RGResourceType::Buffer:
                     {
-                        if ( resource.IsLazyCreateResource() )
-                        {
-                            auto& rhiResource = resource.GetLazyCreateResource();
-                            RHI::RHIBuffer* pRhiBuffer = static_cast<RHI::RHIBuffer*>( rhiResource.m_pRhiResource );
-                            pRhiDevice->DestroyBuffer( pRhiBuffer );
-                            rhiResource.m_pRhiResource = nullptr;
-                        }
+                        RHI::RHIBuffer* pRhiBuffer = static_cast<RHI::RHIBuffer*>( physicalResource.m_pRhiResource );
+                        pRhiDevice->DestroyBuffer( pRhiBuffer );
                     }
                     break;
 
                     case RGResourceType::Texture:
                     {
-                        auto& rhiResource = resource.GetLazyCreateResource();
-                        RHI::RHITexture* pRhiTexture = static_cast<RHI::RHITexture*>( rhiResource.m_pRhiResource );
+                        RHI::RHITexture* pRhiTexture = static_cast<RHI::RHITexture*>( physicalResource.m_pRhiResource );
                         pRhiDevice->DestroyTexture( pRhiTexture );
-                        rhiResource.m_pRhiResource = nullptr;
                     }
                     break;
 
@@ -193,10 +603,27 @@ namespace EE
                 }
             }
 
-            m_graphResources.clear();
+            m_physicalResources.clear();
+
+            //-------------------------------------------------------------------------
+
+            for ( RGResource& rgResource : m_graphResources )
+            {
+                if ( rgResource.IsLazyCreateResource() )
+                {
+                    rgResource.GetLazyCreateResource().m_pRhiResource = nullptr;
+                }
+
+                rgResource.m_physicalResourceIdx = InvalidIndex;
+            }
         }
 
-        #endif
+        void RenderGraph::ClearAllRHIResources( TSharedPtr<RHI::RHIDevice> const& pRhiDevice )
+        {
+            DestroyPhysicalResources( pRhiDevice );
+            m_executableGraph.clear();
+            m_graphResources.clear();
+        }
 
         //-------------------------------------------------------------------------
     }
@@ -3,6 +3,7 @@
 #include "Base/_Module/API.h"
 
 #include "RenderGraphNode.h"
+#include "RenderGraphContext.h"
 #include "Base/Threading/Threading.h"
 #include "Base/Types/Arrays.h"
 #include "Base/Types/String.h"
@@ -54,6 +55,16 @@ namespace EE
             _Impl::RGResourceID			    m_slotID;
 		};
 
+		// The actual RHI resource backing one or more graph resources
+		struct RGPhysicalResource
+		{
+			RHI::RHIResource*						m_pRhiResource = nullptr;
+			uint32_t								m_descResourceIdx = 0; // The graph resource whose desc was used to create this resource
+			int32_t									m_lastUseNodeIdx = InvalidIndex;
+		};
+
+		//-------------------------------------------------------------------------
+
 		class EE_BASE_API RenderGraph
 		{
 			friend class RGNodeBuilder;
@@ -75,6 +86,10 @@ namespace EE
 
 			[[nodiscard]] RGNodeBuilder AddNode( String const& nodeName );
 
+            // Mark a resource as used outside of this graph, this keeps all the nodes writing to it alive and prevents it from being aliased
+            template <typename Tag>
+            void ExportResource( RGHandle<Tag> const& handle );
+
 			#if EE_DEVELOPMENT_TOOLS
 			void LogGraphNodes() const;
 			#endif
@@ -82,15 +97,33 @@ namespace EE
             // Compilation Stage
             //-------------------------------------------------------------------------
 
+            // Cull all nodes that do not contribute to an exported resource, compute the resource lifetimes, create the RHI resources
+            // (aliasing transient resources with disjoint lifetimes) and generate the minimal set of barriers for each executable node.
+            // The compilation only creates and destroys RHI resources via the device so can be run against a device without a GPU.
             void Compile( TSharedPtr<RHI::RHIDevice> const& pRhiDevice );
-            // Use RGDescType to fetch internal RHIResourceDesc and create actual RHIResource.
-            // Created transient rhi resources will be cached in transient resource cache.
-            void CreateRHIResource( TSharedPtr<RHI::RHIDevice> const& pRhiDevice );
+
+            inline TVector<RGExecutableNode> const& GetExecutableNodes() const { return m_executableGraph; }
+
+            inline bool IsNodeCulled( NodeID nodeID ) const
+            {
+                EE_ASSERT( nodeID < m_graph.size() );
+                return m_graph[nodeID].m_isCulled;
+            }
+
+            inline RGResource const& GetResource( _Impl::RGResourceID const& slotID ) const
+            {
+                EE_ASSERT( slotID.IsValid() && slotID.m_id < m_graphResources.size() );
+                return m_graphResources[slotID.m_id];
+            }
+
+            inline int32_t GetNumPhysicalResources() const { return (int32_t) m_physicalResources.size(); }
 
             // Execution Stage
             //-------------------------------------------------------------------------
 
-            void Execute();
+            // Run all executable nodes in submission order, issuing each node's compiled barriers (on the aliased RHI resources) before running it.
+            // Culled nodes are skipped. The final access of each imported resource is stored so that the next compilation starts from it.
+            void Execute( RenderGraphContext& context );
 
             // Cleanup Stage
             //-------------------------------------------------------------------------
@@ -102,6 +135,19 @@ namespace EE
 			template <typename RGDescType, typename RGDescCVType = typename std::add_lvalue_reference_t<std::add_const_t<RGDescType>>>
             _Impl::RGResourceID CreateResourceImpl( RGDescCVType rgDesc );
 
+            // Compilation
+            //-------------------------------------------------------------------------
+
+            void CullNodes();
+            void ComputeResourceLifetimes();
+
+            // Assign physical resources to all used resources and create the actual RHI resources
+            void CreateRHIResource( TSharedPtr<RHI::RHIDevice> const& pRhiDevice );
+
+            void GenerateBarriers();
+
+            void DestroyPhysicalResources( TSharedPtr<RHI::RHIDevice> const& pRhiDevice );
+
             // Pipeline Registration (Defer creating actual RHI pipeline)
             //-------------------------------------------------------------------------
 
@@ -137,6 +183,7 @@ namespace EE
 			TVector<RGResource>						m_graphResources;
 
             TVector<RGExecutableNode>               m_executableGraph;
+            TVector<RGPhysicalResource>             m_physicalResources;
 		};
 
 		// Helper class to build a render graph node.
@@ -159,6 +206,12 @@ namespace EE
 			void RegisterRasterPipeline( RHI::RHIRasterPipelineStateCreateDesc pipelineDesc );
 			void RegisterComputePipeline( Render::ComputePipelineDesc pipelineDesc );
 
+			// Nodes with side effects outside of the graph (e.g. host readbacks) need to be kept even if none of their outputs are used
+			inline void SetNeverCull() { m_node.m_neverCull = true; }
+
+			// Set the function that records this node's work when the graph is executed
+			inline void SetExecuteFunction( RGNodeExecuteFunction&& executeFunction ) { m_node.m_executeFunction = std::move( executeFunction ); }
+
 			// Node resource read and write operations
 			//-------------------------------------------------------------------------
 			template <typename Tag>
@@ -209,6 +262,14 @@ namespace EE
 			return handle;
 		}
 
+		template <typename Tag>
+		void RenderGraph::ExportResource( RGHandle<Tag> const& handle )
+		{
+			EE_ASSERT( Threading::IsMainThread() );
+			EE_ASSERT( handle.m_slotID.IsValid() && handle.m_slotID.m_id < m_graphResources.size() );
+			m_graphResources[handle.m_slotID.m_id].m_isExported = true;
+		}
+
 		//-------------------------------------------------------------------------
 	
 		template <typename RGDescType, typename RGDescCVType>
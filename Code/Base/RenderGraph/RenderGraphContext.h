@@ -1,15 +1,54 @@
 #pragma once
+
+#include "Base/_Module/API.h"
+
+#include "RenderGraphResource.h"
+#include "Base/Render/RenderResourceBarrier.h"
+#include "Base/Types/String.h"
+
+namespace EE::RHI
+{
+    class RHIResource;
+}
+
+//-------------------------------------------------------------------------
+//	Render graph execution context.
+//
+//	The interface a compiled render graph is executed into. The renderer
+//	implements it to record the graph into a command buffer, the graph itself
+//	never talks to the GPU during execution so it can be executed (and
+//	validated) without one.
+//-------------------------------------------------------------------------
+
 namespace EE
 {
 	namespace RG
 	{
-		class RenderGraphContext
+		// A compiled barrier resolved to the actual resource it needs to be issued on
+		struct RGExecutionBarrier
+		{
+			// The (possibly aliased) RHI resource, null for imported resources
+			RHI::RHIResource*							m_pRhiResource = nullptr;
+			RGResourceType								m_resourceType = RGResourceType::Unknown;
+			Render::RenderResourceBarrierState			m_previousAccess = Render::RenderResourceBarrierState::Undefined;
+			Render::RenderResourceBarrierState			m_nextAccess = Render::RenderResourceBarrierState::Undefined;
+			bool										m_discardContents = false;
+		};
+
+		class EE_BASE_API RenderGraphContext
 		{
 		public:
 
-		private:
+			virtual ~RenderGraphContext() = default;
+
+			// Called for each executable node in submission order, before the node's execution function is run
+			virtual void BeginNode( String const& nodeName ) = 0;
 
+			// Issue all the barriers required before the current node can run, only called if the node needs any barriers
+			virtual void PipelineBarrier( RGExecutionBarrier const* pBarriers, uint32_t numBarriers ) = 0;
 
+			// Called once the node's execution function has been run
+			virtual void EndNode() = 0;
 		};
 	}
 }
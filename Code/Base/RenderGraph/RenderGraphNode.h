@@ -7,11 +7,14 @@
 #include "Base/Render/RenderPipelineRegistry.h"
 #include "Base/Types/Arrays.h"
 #include "Base/Types/String.h"
+#include "Base/Types/Function.h"
 
 #include <limits>
 
 namespace EE::RG
 {
+	class RenderGraphContext;
+
 	class EE_BASE_API RGNodeResource
 	{
         friend class RenderGraph;
@@ -52,6 +55,9 @@ namespace EE::RG
 
 	typedef uint32_t NodeID;
 
+	// Records the node's work into the context, run when the graph is executed (never run for culled nodes)
+	using RGNodeExecuteFunction = TFunction<void( RenderGraphContext& )>;
+
 	class EE_BASE_API RGNode
 	{
 	public:
@@ -71,15 +77,42 @@ namespace EE::RG
 		NodeID									m_id;
 
         Render::PipelineHandle                  m_pipelineHandle;
+        RGNodeExecuteFunction                   m_executeFunction;
+
+        bool                                    m_neverCull = false;
+        bool                                    m_isCulled = false;
 	};
 
+    // A resource transition that needs to be issued before an executable node runs
+    struct RGResourceBarrier
+    {
+        _Impl::RGResourceID                     m_slotID;
+        Render::RenderResourceBarrierState      m_previousAccess = Render::RenderResourceBarrierState::Undefined;
+        Render::RenderResourceBarrierState      m_nextAccess = Render::RenderResourceBarrierState::Undefined;
+
+        // Set on the first use of a transient resource, any previous contents (i.e. from an aliased resource) can be discarded
+        bool                                    m_discardContents = false;
+    };
+
     class RGExecutableNode
     {
+        friend class RenderGraph;
+
     public:
 
+        RGExecutableNode( NodeID nodeID, Render::PipelineHandle pipelineHandle )
+            : m_nodeID( nodeID ), m_pipelineHandle( pipelineHandle )
+        {}
+
+        inline NodeID GetNodeID() const { return m_nodeID; }
+        inline Render::PipelineHandle const& GetPipelineHandle() const { return m_pipelineHandle; }
+        inline TInlineVector<RGResourceBarrier, 4> const& GetBarriers() const { return m_barriers; }
+
     private:
 
-        
+        NodeID                                  m_nodeID;
+        Render::PipelineHandle                  m_pipelineHandle;
+        TInlineVector<RGResourceBarrier, 4>     m_barriers;
     };
 
 	//-------------------------------------------------------------------------
@@ -284,6 +284,22 @@ namespace EE::RG
 
         inline bool IsLazyCreateResource() const { return m_resource.index() == LazyCreateResourceVariantIndex; }
 
+        // Is this resource used outside of the graph, exported resources are never culled or aliased
+        inline bool IsExported() const { return m_isExported; }
+
+        // Compilation results
+        //-------------------------------------------------------------------------
+
+        // Is this resource used by any node that survived culling
+        inline bool IsUsed() const { return m_firstUseNodeIdx != InvalidIndex; }
+
+        // The range of executable nodes that use this resource
+        inline int32_t GetFirstUseNodeIndex() const { return m_firstUseNodeIdx; }
+        inline int32_t GetLastUseNodeIndex() const { return m_lastUseNodeIdx; }
+
+        // The physical resource backing this resource, transient resources with disjoint lifetimes share physical resources
+        inline int32_t GetPhysicalResourceIndex() const { return m_physicalResourceIdx; }
+
     private:
 
         static constexpr size_t BufferDescVariantIndex = 0;
@@ -300,6 +316,11 @@ namespace EE::RG
             _Impl::RGTextureDesc
 		>														m_desc;
 		TVariant<RGLazyCreateResource, RGImportedResource>		m_resource;
+
+        bool                                                    m_isExported = false;
+        int32_t                                                 m_firstUseNodeIdx = InvalidIndex;
+        int32_t                                                 m_lastUseNodeIdx = InvalidIndex;
+        int32_t                                                 m_physicalResourceIdx = InvalidIndex;
 	};
 
     template <typename RGDescType, typename DescType>
@@ -0,0 +1,195 @@
+#include "ResourceArchive.h"
+#include "Base/FileSystem/FileSystem.h"
+#include "Base/Math/Math.h"
+#include "Base/Profiling.h"
+
+//-------------------------------------------------------------------------
+
+namespace EE::Resource
+{
+    bool ResourceArchive::Write( FileSystem::Path const& archivePath, FileSystem::Path const& compiledResourceDirectoryPath, TVector<ResourceID> const& resourceIDs )
+    {
+        EE_PROFILE_FUNCTION_RESOURCE();
+        EE_ASSERT( archivePath.IsFilePath() && compiledResourceDirectoryPath.IsDirectoryPath() );
+
+        // Build table of contents and string table
+        //-------------------------------------------------------------------------
+
+        TVector<Entry> entries;
+        entries.reserve( resourceIDs.size() );
+
+        String stringTable;
+        for ( auto const& resourceID : resourceIDs )
+        {
+            EE_ASSERT( resourceID.IsValid() );
+
+            Entry& entry = entries.emplace_back();
+            entry.m_resourcePathID = resourceID.GetPathID();
+            entry.m_pathStringOffset = (uint32_t) stringTable.length();
+            stringTable.append( resourceID.c_str(), resourceID.ToString().length() + 1 );
+        }
+
+        Header header;
+        header.m_numEntries = (uint32_t) entries.size();
+        header.m_stringTableSize = (uint32_t) stringTable.length();
+
+        // Write header placeholder, the table of contents is only complete once all the data is written
+        //-------------------------------------------------------------------------
+
+        FileSystem::OutputFileStream archiveStream( archivePath );
+        if ( !archiveStream.IsValid() )
+        {
+            EE_LOG_ERROR( "Resource", "Resource Archive", "Failed to create archive file: %s", archivePath.c_str() );
+            return false;
+        }
+
+        std::ofstream& stream = archiveStream.GetStream();
+        stream.write( (char const*) &header, sizeof( Header ) );
+        stream.write( (char const*) entries.data(), sizeof( Entry ) * entries.size() );
+        stream.write( stringTable.data(), stringTable.length() );
+
+        // Write all resource data
+        //-------------------------------------------------------------------------
+
+        static uint8_t const paddingBytes[s_dataAlignment] = { 0 };
+
+        Blob resourceData;
+        for ( int32_t i = 0; i < (int32_t) resourceIDs.size(); i++ )
+        {
+            FileSystem::Path const compiledResourcePath = resourceIDs[i].ToFileSystemPath( compiledResourceDirectoryPath );
+            if ( !FileSystem::LoadFile( compiledResourcePath, resourceData ) )
+            {
+                EE_LOG_ERROR( "Resource", "Resource Archive", "Failed to read compiled resource: %s", compiledResourcePath.c_str() );
+                archiveStream.Close();
+                FileSystem::EraseFile( archivePath );
+                return false;
+            }
+
+            uint64_t const currentOffset = (uint64_t) stream.tellp();
+            uint64_t const alignedOffset = Math::RoundUpToNearestMultiple64( currentOffset, s_dataAlignment );
+            stream.write( (char const*) paddingBytes, alignedOffset - currentOffset );
+            stream.write( (char const*) resourceData.data(), resourceData.size() );
+
+            entries[i].m_dataOffset = alignedOffset;
+            entries[i].m_dataSize = resourceData.size();
+        }
+
+        // Write final table of contents
+        //-------------------------------------------------------------------------
+
+        stream.seekp( sizeof( Header ) );
+        stream.write( (char const*) entries.data(), sizeof( Entry ) * entries.size() );
+
+        bool const succeeded = stream.good();
+        archiveStream.Close();
+
+        if ( !succeeded )
+        {
+            EE_LOG_ERROR( "Resource", "Resource Archive", "Failed to write archive file: %s", archivePath.c_str() );
+            FileSystem::EraseFile( archivePath );
+        }
+
+        return succeeded;
+    }
+
+    //-------------------------------------------------------------------------
+
+    bool ResourceArchive::Mount( FileSystem::Path const& archivePath )
+    {
+        EE_PROFILE_FUNCTION_RESOURCE();
+        EE_ASSERT( !IsMounted() );
+
+        if ( !m_file.Map( archivePath ) )
+        {
+            return false;
+        }
+
+        // Validate header
+        //-------------------------------------------------------------------------
+        // The archive is read straight from disk so every offset needs to be validated before we use it, a truncated or corrupt archive must never be mounted
+
+        uint8_t const* pArchiveData = m_file.GetData();
+        uint64_t const archiveSize = (uint64_t) m_file.GetSize();
+
+        Header const* pHeader = reinterpret_cast<Header const*>( pArchiveData );
+        bool isValidArchive = archiveSize >= sizeof( Header ) && pHeader->m_archiveID == s_archiveID && pHeader->m_version == s_version;
+
+        uint64_t dataStartOffset = 0;
+        if ( isValidArchive )
+        {
+            dataStartOffset = sizeof( Header ) + ( (uint64_t) sizeof( Entry ) * pHeader->m_numEntries ) + pHeader->m_stringTableSize;
+            isValidArchive = dataStartOffset <= archiveSize;
+        }
+
+        // The string table needs to be null terminated, otherwise path comparisons could read past its end
+        if ( isValidArchive && pHeader->m_numEntries > 0 )
+        {
+            isValidArchive = pHeader->m_stringTableSize > 0 && pArchiveData[dataStartOffset - 1] == 0;
+        }
+
+        if ( !isValidArchive )
+        {
+            EE_LOG_ERROR( "Resource", "Resource Archive", "Invalid resource archive header: %s", archivePath.c_str() );
+            m_file.Unmap();
+            return false;
+        }
+
+        m_numEntries = pHeader->m_numEntries;
+        m_pEntries = reinterpret_cast<Entry const*>( pArchiveData + sizeof( Header ) );
+        m_pStringTable = reinterpret_cast<char const*>( m_pEntries + m_numEntries );
+
+        // Validate entries and build lookup table
+        //-------------------------------------------------------------------------
+
+        m_entryLookup.reserve( m_numEntries );
+        for ( uint32_t i = 0; i < m_numEntries; i++ )
+        {
+            Entry const& entry = m_pEntries[i];
+
+            bool const isValidEntry = entry.m_pathStringOffset < pHeader->m_stringTableSize && entry.m_dataOffset >= dataStartOffset && entry.m_dataOffset <= archiveSize && entry.m_dataSize <= ( archiveSize - entry.m_dataOffset );
+            if ( !isValidEntry )
+            {
+                EE_LOG_ERROR( "Resource", "Resource Archive", "Invalid resource archive entry (%u): %s", i, archivePath.c_str() );
+                Unmount();
+                return false;
+            }
+
+            if ( !m_entryLookup.insert( eastl::make_pair( entry.m_resourcePathID, i ) ).second )
+            {
+                EE_LOG_WARNING( "Resource", "Resource Archive", "Resource path ID collision in archive, resource will be loaded from a loose file: %s", m_pStringTable + entry.m_pathStringOffset );
+            }
+        }
+
+        return true;
+    }
+
+    void ResourceArchive::Unmount()
+    {
+        m_entryLookup.clear();
+        m_pEntries = nullptr;
+        m_pStringTable = nullptr;
+        m_numEntries = 0;
+        m_file.Unmap();
+    }
+
+    bool ResourceArchive::TryGetResourceData( ResourceID const& resourceID, uint8_t const*& pOutData, size_t& outDataSize ) const
+    {
+        EE_ASSERT( IsMounted() );
+
+        auto foundIter = m_entryLookup.find( resourceID.GetPathID() );
+        if ( foundIter == m_entryLookup.end() )
+        {
+            return false;
+        }
+
+        Entry const& entry = m_pEntries[foundIter->second];
+        if ( resourceID.ToString() != ( m_pStringTable + entry.m_pathStringOffset ) )
+        {
+            return false;
+        }
+
+        pOutData = m_file.GetData() + entry.m_dataOffset;
+        outDataSize = (size_t) entry.m_dataSize;
+        return true;
+    }
+}
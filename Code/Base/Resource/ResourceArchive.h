@@ -0,0 +1,78 @@
+#pragma once
+
+#include "ResourceID.h"
+#include "Base/FileSystem/FileStreams.h"
+#include "Base/Types/HashMap.h"
+
+//-------------------------------------------------------------------------
+// Packaged Resource Archive
+//-------------------------------------------------------------------------
+// A single file containing all the compiled resources for a packaged build
+// Layout: [Header][Table of contents][Path string table][Resource data]
+//
+// The table of contents is sorted by data offset, resources are written in the order they were packaged so that
+// resources that are loaded together are close together on disk. The archive is memory mapped at runtime and
+// loaders are provided with a view into the mapped data, so no per-resource file opens or copies are needed.
+//-------------------------------------------------------------------------
+
+namespace EE::Resource
+{
+    class EE_BASE_API ResourceArchive
+    {
+    public:
+
+        constexpr static uint32_t const s_archiveID = 'EEPK';
+        constexpr static uint32_t const s_version = 1;
+        constexpr static uint32_t const s_dataAlignment = 16;
+        constexpr static char const* const s_archiveFileName = "Resources.pak";
+
+        struct Header
+        {
+            uint32_t            m_archiveID = s_archiveID;
+            uint32_t            m_version = s_version;
+            uint32_t            m_numEntries = 0;
+            uint32_t            m_stringTableSize = 0;
+        };
+
+        struct Entry
+        {
+            uint32_t            m_resourcePathID = 0;
+            uint32_t            m_pathStringOffset = 0; // Offset into the string table for the resource path, used to resolve path ID collisions
+            uint64_t            m_dataOffset = 0; // Offset from the start of the archive
+            uint64_t            m_dataSize = 0;
+        };
+
+        static_assert( sizeof( Header ) == 16 && sizeof( Entry ) == 24, "Archive structures are written directly to disk, their layout must not change without bumping the version" );
+
+    public:
+
+        // Write an archive containing all the supplied compiled resources, the data is written in the order supplied
+        static bool Write( FileSystem::Path const& archivePath, FileSystem::Path const& compiledResourceDirectoryPath, TVector<ResourceID> const& resourceIDs );
+
+        //-------------------------------------------------------------------------
+
+        ResourceArchive() = default;
+        ResourceArchive( ResourceArchive const& ) = delete;
+        ~ResourceArchive() { EE_ASSERT( !IsMounted() ); }
+
+        ResourceArchive& operator=( ResourceArchive const& ) = delete;
+
+        // Map the archive and build the lookup table, fails if the archive is missing or invalid
+        bool Mount( FileSystem::Path const& archivePath );
+        void Unmount();
+
+        inline bool IsMounted() const { return m_file.IsMapped(); }
+
+        // Get a view of the compiled data for a resource, returns false if the resource is not in the archive
+        // The data remains valid for as long as the archive is mounted
+        bool TryGetResourceData( ResourceID const& resourceID, uint8_t const*& pOutData, size_t& outDataSize ) const;
+
+    private:
+
+        FileSystem::MemoryMappedFile                    m_file;
+        Entry const*                                    m_pEntries = nullptr;
+        char const*                                     m_pStringTable = nullptr;
+        uint32_t                                        m_numEntries = 0;
+        THashMap<uint32_t, uint32_t>                    m_entryLookup;
+    };
+}
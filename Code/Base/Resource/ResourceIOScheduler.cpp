@@ -0,0 +1,168 @@
+#include "ResourceIOScheduler.h"
+#include "Base/FileSystem/FileSystem.h"
+#include "Base/Memory/Memory.h"
+#include "Base/Time/Timers.h"
+#include "Base/Profiling.h"
+#include "EASTL/heap.h"
+
+//-------------------------------------------------------------------------
+
+namespace EE::Resource
+{
+    // Heap comparison - returns true if A should be serviced after B
+    static bool ServiceAfter( ResourceIORead const* pA, ResourceIORead const* pB )
+    {
+        if ( pA->m_priority != pB->m_priority )
+        {
+            return pA->m_priority > pB->m_priority;
+        }
+
+        return pA->m_sequenceNumber > pB->m_sequenceNumber;
+    }
+
+    //-------------------------------------------------------------------------
+
+    void ResourceIOScheduler::Initialize( int32_t numThreads )
+    {
+        EE_ASSERT( !IsInitialized() );
+        EE_ASSERT( numThreads > 0 );
+
+        m_isShuttingDown = false;
+        m_queuedReads.reserve( s_maxOutstandingReads );
+
+        for ( int32_t i = 0; i < numThreads; i++ )
+        {
+            m_threads.emplace_back( [this, i] () { ProcessReads( i ); } );
+        }
+    }
+
+    void ResourceIOScheduler::Shutdown()
+    {
+        EE_ASSERT( IsInitialized() );
+
+        {
+            Threading::ScopeLock lock( m_mutex );
+            EE_ASSERT( m_queuedReads.empty() && m_numActiveReads == 0 );
+            m_isShuttingDown = true;
+        }
+
+        m_readQueuedCondition.notify_all();
+
+        for ( auto& thread : m_threads )
+        {
+            thread.join();
+        }
+
+        m_threads.clear();
+    }
+
+    bool ResourceIOScheduler::IsBusy() const
+    {
+        Threading::ScopeLock lock( m_mutex );
+        return !m_queuedReads.empty() || m_numActiveReads > 0;
+    }
+
+    //-------------------------------------------------------------------------
+
+    bool ResourceIOScheduler::SubmitRead( ResourceIORead* pRead )
+    {
+        EE_ASSERT( IsInitialized() );
+        EE_ASSERT( pRead != nullptr && pRead->m_filePath.IsFilePath() );
+        EE_ASSERT( pRead->GetStatus() == ResourceIORead::Status::None );
+
+        {
+            Threading::ScopeLock lock( m_mutex );
+
+            if ( ( (int32_t) m_queuedReads.size() + m_numActiveReads ) >= s_maxOutstandingReads )
+            {
+                return false;
+            }
+
+            pRead->m_sequenceNumber = m_nextSequenceNumber++;
+            pRead->m_status.store( ResourceIORead::Status::Queued, std::memory_order_release );
+            m_queuedReads.emplace_back( pRead );
+            eastl::push_heap( m_queuedReads.begin(), m_queuedReads.end(), ServiceAfter );
+        }
+
+        m_readQueuedCondition.notify_one();
+        return true;
+    }
+
+    bool ResourceIOScheduler::TryCancelRead( ResourceIORead* pRead )
+    {
+        EE_ASSERT( pRead != nullptr );
+
+        Threading::ScopeLock lock( m_mutex );
+
+        auto foundIter = eastl::find( m_queuedReads.begin(), m_queuedReads.end(), pRead );
+        if ( foundIter == m_queuedReads.end() )
+        {
+            return false;
+        }
+
+        // Cancellation is rare so just rebuild the heap
+        m_queuedReads.erase_unsorted( foundIter );
+        eastl::make_heap( m_queuedReads.begin(), m_queuedReads.end(), ServiceAfter );
+        pRead->m_status.store( ResourceIORead::Status::Cancelled, std::memory_order_release );
+        return true;
+    }
+
+    //-------------------------------------------------------------------------
+
+    void ResourceIOScheduler::ProcessReads( int32_t threadIdx )
+    {
+        Memory::InitializeThreadHeap();
+
+        char nameBuffer[100];
+        Printf( nameBuffer, 100, "EE Resource IO %d", threadIdx );
+        EE_PROFILE_THREAD_START( nameBuffer );
+        Threading::SetCurrentThreadName( nameBuffer );
+
+        //-------------------------------------------------------------------------
+
+        while ( true )
+        {
+            ResourceIORead* pRead = nullptr;
+
+            // Get the highest priority read
+            {
+                Threading::Lock lock( m_mutex );
+                m_readQueuedCondition.wait( lock, [this] () { return m_isShuttingDown || !m_queuedReads.empty(); } );
+
+                if ( m_isShuttingDown )
+                {
+                    break;
+                }
+
+                eastl::pop_heap( m_queuedReads.begin(), m_queuedReads.end(), ServiceAfter );
+                pRead = m_queuedReads.back();
+                m_queuedReads.pop_back();
+                m_numActiveReads++;
+
+                pRead->m_status.store( ResourceIORead::Status::Reading, std::memory_order_release );
+            }
+
+            // Read file
+            {
+                EE_PROFILE_SCOPE_IO( "Read File" );
+                EE_PROFILE_TAG( "filename", pRead->m_filePath.GetFilename().c_str() );
+
+                bool wasRead = false;
+                {
+                    ScopedTimer<PlatformClock> timer( pRead->m_readTime );
+                    wasRead = FileSystem::LoadFile( pRead->m_filePath, pRead->m_data );
+                }
+
+                // The read may be released as soon as its status is set, so this must be the last access
+                Threading::ScopeLock lock( m_mutex );
+                m_numActiveReads--;
+                pRead->m_status.store( wasRead ? ResourceIORead::Status::Succeeded : ResourceIORead::Status::Failed, std::memory_order_release );
+            }
+        }
+
+        //-------------------------------------------------------------------------
+
+        EE_PROFILE_THREAD_END();
+        Memory::ShutdownThreadHeap();
+    }
+}
@@ -0,0 +1,101 @@
+#pragma once
+
+#include "Base/_Module/API.h"
+#include "ResourceRequesterID.h"
+#include "Base/FileSystem/FileSystemPath.h"
+#include "Base/Threading/Threading.h"
+#include "Base/Time/Time.h"
+#include "Base/Types/Arrays.h"
+
+//-------------------------------------------------------------------------
+
+namespace EE::Resource
+{
+    // A single raw resource file read, owned by the resource request that issued it
+    struct ResourceIORead
+    {
+        enum class Status : uint8_t
+        {
+            None,
+            Queued,
+            Reading,
+            Succeeded,
+            Failed,
+            Cancelled,
+        };
+
+    public:
+
+        inline Status GetStatus() const { return m_status.load( std::memory_order_acquire ); }
+        inline bool IsPending() const { Status const status = GetStatus(); return status == Status::Queued || status == Status::Reading; }
+        inline bool IsComplete() const { Status const status = GetStatus(); return status == Status::Succeeded || status == Status::Failed || status == Status::Cancelled; }
+
+        // Reset the read so that it can be reissued, cannot be called while the read is pending
+        inline void Reset()
+        {
+            EE_ASSERT( !IsPending() );
+            m_data.clear();
+            m_status.store( Status::None, std::memory_order_release );
+        }
+
+    public:
+
+        FileSystem::Path                    m_filePath;
+        Blob                                m_data;
+        ResourceLoadPriority                m_priority = ResourceLoadPriority::Normal;
+        Milliseconds                        m_readTime = 0;
+        uint64_t                            m_sequenceNumber = 0; // Set by the scheduler, ensures FIFO ordering within a priority
+        std::atomic<Status>                 m_status = Status::None;
+    };
+
+    //-------------------------------------------------------------------------
+    // Resource I/O Scheduler
+    //-------------------------------------------------------------------------
+    // Services raw resource file reads on a set of dedicated I/O threads so that the resource requests never block on disk access
+    // Reads are serviced in priority order (FIFO within a priority). The number of outstanding reads is bounded, once the queue is
+    // full, submissions are rejected and the requests will simply resubmit on their next update.
+
+    class EE_BASE_API ResourceIOScheduler
+    {
+    public:
+
+        constexpr static int32_t const s_defaultNumThreads = 2;
+        constexpr static int32_t const s_maxOutstandingReads = 128;
+
+    public:
+
+        ResourceIOScheduler() = default;
+        ResourceIOScheduler( ResourceIOScheduler const& ) = delete;
+        ~ResourceIOScheduler() { EE_ASSERT( m_threads.empty() ); }
+
+        ResourceIOScheduler& operator=( ResourceIOScheduler const& ) = delete;
+
+        void Initialize( int32_t numThreads = s_defaultNumThreads );
+        void Shutdown();
+
+        inline bool IsInitialized() const { return !m_threads.empty(); }
+
+        // Do we have any queued or in-progress reads
+        bool IsBusy() const;
+
+        // Queue a read, returns false if there are too many outstanding reads
+        bool SubmitRead( ResourceIORead* pRead );
+
+        // Try to cancel a read, this only succeeds if the read has not been started. If it fails, the caller needs to wait for the read to complete.
+        bool TryCancelRead( ResourceIORead* pRead );
+
+    private:
+
+        void ProcessReads( int32_t threadIdx );
+
+    private:
+
+        TVector<Threading::Thread>          m_threads;
+        TVector<ResourceIORead*>            m_queuedReads; // Heap ordered by priority and then submission order
+        mutable Threading::Mutex            m_mutex;
+        Threading::ConditionVariable        m_readQueuedCondition;
+        uint64_t                            m_nextSequenceNumber = 0;
+        int32_t                             m_numActiveReads = 0;
+        bool                                m_isShuttingDown = false;
+    };
+}
@@ -57,7 +57,8 @@ namespace EE
             virtual bool CanProceedWithFailedInstallDependency() const { return false; }
 
             // This function loads is responsible to deserialize the compiled resource data, read the resource header for install dependencies and to create the new runtime resource object
-            bool Load( ResourceID const& resourceID, Blob& rawData, ResourceRecord* pResourceRecord ) const;
+            // Note: the raw data is only guaranteed to be valid for the duration of this call
+            bool Load( ResourceID const& resourceID, uint8_t const* pRawData, size_t rawDataSize, ResourceRecord* pResourceRecord ) const;
 
             // This function will destroy the created resource object
             void Unload( ResourceID const& resourceID, ResourceRecord* pResourceRecord ) const;
@@ -1,7 +1,7 @@
 #include "PackagedResourceProvider.h"
 #include "Base/Resource/ResourceRequest.h"
 #include "Base/Resource/ResourceSettings.h"
-
+#include "Base/FileSystem/FileSystem.h"
 
 //-------------------------------------------------------------------------
 
@@ -14,11 +14,39 @@ namespace EE::Resource
 
     bool PackagedResourceProvider::Initialize()
     {
+        FileSystem::Path const archivePath = m_settings.m_compiledResourcePath + ResourceArchive::s_archiveFileName;
+        if ( FileSystem::Exists( archivePath ) )
+        {
+            if ( !m_archive.Mount( archivePath ) )
+            {
+                EE_LOG_WARNING( "Resource", "Packaged Resource Provider", "Failed to mount resource archive (%s), falling back to loose files", archivePath.c_str() );
+            }
+        }
+
         return true;
     }
 
+    void PackagedResourceProvider::Shutdown()
+    {
+        if ( m_archive.IsMounted() )
+        {
+            m_archive.Unmount();
+        }
+    }
+
     void PackagedResourceProvider::RequestRawResource( ResourceRequest* pRequest )
     {
+        if ( m_archive.IsMounted() )
+        {
+            uint8_t const* pRawData = nullptr;
+            size_t rawDataSize = 0;
+            if ( m_archive.TryGetResourceData( pRequest->GetResourceID(), pRawData, rawDataSize ) )
+            {
+                pRequest->OnRawResourceRequestComplete( pRawData, rawDataSize );
+                return;
+            }
+        }
+
         FileSystem::Path const resourceFilePath = pRequest->GetResourceID().GetResourcePath().ToFileSystemPath( m_settings.m_compiledResourcePath );
         pRequest->OnRawResourceRequestComplete( resourceFilePath.c_str() );
     }
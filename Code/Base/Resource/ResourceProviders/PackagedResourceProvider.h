@@ -1,6 +1,7 @@
 #pragma once
 
 #include "Base/Resource/ResourceProvider.h"
+#include "Base/Resource/ResourceArchive.h"
 
 //-------------------------------------------------------------------------
 
@@ -10,6 +11,8 @@ namespace EE::Resource
 
     //-------------------------------------------------------------------------
 
+    // Loads resources from the packaged resource archive if present, any resources not in the archive are loaded from loose compiled files
+
     class EE_BASE_API PackagedResourceProvider final : public ResourceProvider
     {
 
@@ -21,7 +24,12 @@ namespace EE::Resource
     private:
 
         virtual bool Initialize() override;
+        virtual void Shutdown() override;
         virtual void RequestRawResource( ResourceRequest* pRequest ) override;
         virtual void CancelRequest( ResourceRequest* pRequest ) override;
+
+    private:
+
+        ResourceArchive                 m_archive;
     };
 }
\ No newline at end of file
@@ -55,11 +55,22 @@ namespace EE::Resource
         }
         else // Continue the load operation
         {
-            m_rawResourcePath = filePath;
-            m_stage = ResourceRequest::Stage::LoadResource;
+            m_rawResourceRead.Reset();
+            m_rawResourceRead.m_filePath = filePath;
+            m_pRawResourceDataView = nullptr;
+            m_rawResourceDataViewSize = 0;
+            m_stage = ResourceRequest::Stage::ReadRawResource;
         }
     }
 
+    void ResourceRequest::OnRawResourceRequestComplete( uint8_t const* pRawData, size_t rawDataSize )
+    {
+        EE_ASSERT( pRawData != nullptr && rawDataSize > 0 );
+        m_pRawResourceDataView = pRawData;
+        m_rawResourceDataViewSize = rawDataSize;
+        m_stage = ResourceRequest::Stage::LoadResource;
+    }
+
     void ResourceRequest::SwitchToLoadTask()
     {
         EE_ASSERT( m_type == Type::Unload );
@@ -85,6 +96,12 @@ namespace EE::Resource
             }
             break;
 
+            case Stage::CancelRawResourceRead:
+            {
+                m_stage = Stage::WaitForRawResourceRead;
+            }
+            break;
+
             case Stage::CancelWaitForLoadDependencies:
             {
                 m_stage = Stage::WaitForLoadDependencies;
@@ -121,6 +138,13 @@ namespace EE::Resource
             }
             break;
 
+            case Stage::WaitForRawResourceRead:
+            {
+                m_stage = Stage::CancelRawResourceRead;
+            }
+            break;
+
+            case Stage::ReadRawResource:
             case Stage::LoadResource:
             {
                 m_stage = Stage::Complete;
@@ -175,6 +199,18 @@ namespace EE::Resource
             }
             break;
 
+            case ResourceRequest::Stage::ReadRawResource:
+            {
+                ReadRawResource( requestContext );
+            }
+            break;
+
+            case ResourceRequest::Stage::WaitForRawResourceRead:
+            {
+                WaitForRawResourceRead( requestContext );
+            }
+            break;
+
             case ResourceRequest::Stage::LoadResource:
             {
                 LoadResource( requestContext );
@@ -237,6 +273,12 @@ namespace EE::Resource
             }
             break;
 
+            case ResourceRequest::Stage::CancelRawResourceRead:
+            {
+                CancelRawResourceRead( requestContext );
+            }
+            break;
+
             default:
             {
                 EE_UNREACHABLE_CODE();
@@ -265,31 +307,50 @@ namespace EE::Resource
         requestContext.m_createRawRequestRequestFunction( this );
     }
 
-    void ResourceRequest::LoadResource( RequestContext& requestContext )
+    void ResourceRequest::ReadRawResource( RequestContext& requestContext )
     {
         EE_PROFILE_FUNCTION_RESOURCE();
-        EE_ASSERT( m_stage == ResourceRequest::Stage::LoadResource );
-        EE_ASSERT( m_rawResourcePath.IsValid() );
-
-        // Read file
-        //-------------------------------------------------------------------------
+        EE_ASSERT( m_stage == ResourceRequest::Stage::ReadRawResource );
+        EE_ASSERT( m_rawResourceRead.m_filePath.IsValid() );
 
+        // If the I/O queue is full, we will try again on the next update
+        m_rawResourceRead.m_priority = m_requesterID.GetLoadPriority();
+        if ( requestContext.m_submitReadFunction( &m_rawResourceRead ) )
         {
-            EE_PROFILE_SCOPE_IO( "Read File" );
-            EE_PROFILE_TAG( "filename", m_rawResourcePath.GetFilename().c_str() );
+            m_stage = ResourceRequest::Stage::WaitForRawResourceRead;
+        }
+    }
+
+    void ResourceRequest::WaitForRawResourceRead( RequestContext& requestContext )
+    {
+        EE_ASSERT( m_stage == ResourceRequest::Stage::WaitForRawResourceRead );
 
+        ResourceIORead::Status const readStatus = m_rawResourceRead.GetStatus();
+        if ( readStatus == ResourceIORead::Status::Failed )
+        {
+            EE_LOG_ERROR( "Resource", "Resource Request", "Failed to load resource file (%s)", m_pResourceRecord->GetResourceID().c_str() );
+            m_rawResourceRead.Reset();
+            m_stage = ResourceRequest::Stage::Complete;
+            m_pResourceRecord->SetLoadingStatus( LoadingStatus::Failed );
+        }
+        else if ( readStatus == ResourceIORead::Status::Succeeded )
+        {
             #if EE_DEVELOPMENT_TOOLS
-            ScopedTimer<PlatformClock> timer( m_pResourceRecord->m_fileReadTime );
+            m_pResourceRecord->m_fileReadTime = m_rawResourceRead.m_readTime;
             #endif
 
-            if ( !FileSystem::LoadFile( m_rawResourcePath, m_rawResourceData ) )
-            {
-                EE_LOG_ERROR( "Resource", "Resource Request", "Failed to load resource file (%s)", m_pResourceRecord->GetResourceID().c_str() );
-                m_stage = ResourceRequest::Stage::Complete;
-                m_pResourceRecord->SetLoadingStatus( LoadingStatus::Failed );
-                return;
-            }
+            // Load immediately, no need to wait for the next update
+            m_pRawResourceDataView = m_rawResourceRead.m_data.data();
+            m_rawResourceDataViewSize = m_rawResourceRead.m_data.size();
+            m_stage = ResourceRequest::Stage::LoadResource;
+            LoadResource( requestContext );
         }
+    }
+
+    void ResourceRequest::LoadResource( RequestContext& requestContext )
+    {
+        EE_PROFILE_FUNCTION_RESOURCE();
+        EE_ASSERT( m_stage == ResourceRequest::Stage::LoadResource );
 
         // Load resource
         //-------------------------------------------------------------------------
@@ -304,13 +365,20 @@ namespace EE::Resource
             #endif
 
             // Load the resource
-            EE_ASSERT( !m_rawResourceData.empty() );
+            EE_ASSERT( m_pRawResourceDataView != nullptr && m_rawResourceDataViewSize > 0 );
 
             #if EE_DEVELOPMENT_TOOLS
             ScopedTimer<PlatformClock> timer( m_pResourceRecord->m_loadTime );
             #endif
 
-            if ( !m_pResourceLoader->Load( GetResourceID(), m_rawResourceData, m_pResourceRecord ) )
+            bool const wasLoaded = m_pResourceLoader->Load( GetResourceID(), m_pRawResourceDataView, m_rawResourceDataViewSize, m_pResourceRecord );
+
+            // Release raw data
+            m_rawResourceRead.Reset();
+            m_pRawResourceDataView = nullptr;
+            m_rawResourceDataViewSize = 0;
+
+            if ( !wasLoaded )
             {
                 EE_LOG_ERROR( "Resource", "Resource Request", "Failed to load compiled resource data (%s)", m_pResourceRecord->GetResourceID().c_str() );
                 m_pResourceRecord->SetLoadingStatus( LoadingStatus::Failed );
@@ -318,9 +386,6 @@ namespace EE::Resource
                 m_stage = ResourceRequest::Stage::Complete;
                 return;
             }
-
-            // Release raw data
-            m_rawResourceData.clear();
         }
 
         // Load dependencies
@@ -328,7 +393,7 @@ namespace EE::Resource
 
         // Create the resource ptrs for the install dependencies and request their load
         // These resource ptrs are temporary and will be clear upon completion of the request
-        ResourceRequesterID const installDependencyRequesterID( m_pResourceRecord->GetResourceID() );
+        ResourceRequesterID const installDependencyRequesterID( m_pResourceRecord->GetResourceID(), m_requesterID.GetLoadPriority() );
         uint32_t const numInstallDependencies = (uint32_t) m_pResourceRecord->m_installDependencyResourceIDs.size();
         m_pendingInstallDependencies.resize( numInstallDependencies );
         for ( uint32_t i = 0; i < numInstallDependencies; i++ )
@@ -602,4 +667,19 @@ namespace EE::Resource
         m_pResourceRecord->SetLoadingStatus( LoadingStatus::Unloaded );
         m_stage = ResourceRequest::Stage::Complete;
     }
+
+    void ResourceRequest::CancelRawResourceRead( RequestContext& requestContext )
+    {
+        EE_ASSERT( m_stage == ResourceRequest::Stage::CancelRawResourceRead );
+
+        // If the read is already in progress, we need to wait for it to complete since it writes into this request
+        if ( !m_rawResourceRead.IsComplete() && !requestContext.m_cancelReadFunction( &m_rawResourceRead ) )
+        {
+            return;
+        }
+
+        m_rawResourceRead.Reset();
+        m_pResourceRecord->SetLoadingStatus( LoadingStatus::Unloaded );
+        m_stage = ResourceRequest::Stage::Complete;
+    }
 }
\ No newline at end of file
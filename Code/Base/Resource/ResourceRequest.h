@@ -2,6 +2,7 @@
 
 #include "ResourceRecord.h"
 #include "ResourceLoader.h"
+#include "ResourceIOScheduler.h"
 #include "Base/Types/Function.h"
 #include "Base/Time/Timers.h"
 
@@ -20,6 +21,8 @@ namespace EE::Resource
             // Load Stages
             RequestRawResource,
             WaitForRawResourceRequest,
+            ReadRawResource,
+            WaitForRawResourceRead,
             LoadResource,
             WaitForLoadDependencies,
             InstallResource,
@@ -33,6 +36,7 @@ namespace EE::Resource
             // Special Cases
             CancelWaitForLoadDependencies, // This stage is needed so we can resume correctly when going from load -> unload -> load
             CancelRawResourceRequest,
+            CancelRawResourceRead,
 
             Complete,
         };
@@ -56,6 +60,8 @@ namespace EE::Resource
         {
             TFunction<void( ResourceRequest* )> m_createRawRequestRequestFunction;
             TFunction<void( ResourceRequest* )> m_cancelRawRequestRequestFunction;
+            TFunction<bool( ResourceIORead* )> m_submitReadFunction;
+            TFunction<bool( ResourceIORead* )> m_cancelReadFunction;
             TFunction<void( ResourceRequesterID const&, ResourcePtr& )> m_loadResourceFunction;
             TFunction<void( ResourceRequesterID const&, ResourcePtr& )> m_unloadResourceFunction;
         };
@@ -89,6 +95,10 @@ namespace EE::Resource
         // Called by the resource provider once the request operation completes and provides the raw resource data
         void OnRawResourceRequestComplete( String const& filePath );
 
+        // Called by the resource provider once the request operation completes, with a view of the raw resource data
+        // The provider must ensure that the data stays valid until the resource is loaded
+        void OnRawResourceRequestComplete( uint8_t const* pRawData, size_t rawDataSize );
+
         // This will interrupt a load task and convert it into an unload task
         void SwitchToLoadTask();
 
@@ -98,6 +108,8 @@ namespace EE::Resource
         //-------------------------------------------------------------------------
 
         void RequestRawResource( RequestContext& requestContext );
+        void ReadRawResource( RequestContext& requestContext );
+        void WaitForRawResourceRead( RequestContext& requestContext );
         void LoadResource( RequestContext& requestContext );
         void WaitForLoadDependencies( RequestContext& requestContext );
         void InstallResource( RequestContext& requestContext );
@@ -106,14 +118,16 @@ namespace EE::Resource
         void UnloadResource( RequestContext& requestContext );
         void UnloadFailedResource( RequestContext& requestContext );
         void CancelRawRequestRequest( RequestContext& requestContext );
+        void CancelRawResourceRead( RequestContext& requestContext );
 
     private:
 
         ResourceRequesterID                     m_requesterID;
         ResourceRecord*                         m_pResourceRecord = nullptr;
         ResourceLoader*                         m_pResourceLoader = nullptr;
-        FileSystem::Path                        m_rawResourcePath;
-        Blob                                    m_rawResourceData;
+        ResourceIORead                          m_rawResourceRead;
+        uint8_t const*                          m_pRawResourceDataView = nullptr;
+        size_t                                  m_rawResourceDataViewSize = 0;
         InstallDependencyList                   m_pendingInstallDependencies;
         InstallDependencyList                   m_installDependencies;
         Type                                    m_type = Type::Invalid;
@@ -5,6 +5,18 @@
 
 namespace EE::Resource
 {
+    // The priority of the reads issued for a request, higher priority reads are always serviced first by the I/O scheduler
+    enum class ResourceLoadPriority : uint8_t
+    {
+        Critical = 0, // Needed to start or continue gameplay i.e. map loading
+        Normal,
+        Streaming, // Background loads that can be delayed
+
+        NumPriorities
+    };
+
+    //-------------------------------------------------------------------------
+
     class ResourceRequesterID
     {
     public:
@@ -17,17 +29,29 @@ namespace EE::Resource
         // No ID - manual request
         ResourceRequesterID() = default;
 
-        // Install dependency reference
-        ResourceRequesterID( ResourceID const& resourceID )
+        // No ID - manual request with an explicit priority
+        explicit ResourceRequesterID( ResourceLoadPriority priority )
+            : m_priority( priority )
+        {
+            EE_ASSERT( priority < ResourceLoadPriority::NumPriorities );
+        }
+
+        // Install dependency reference, install dependencies should be loaded with the priority of the depending resource
+        ResourceRequesterID( ResourceID const& resourceID, ResourceLoadPriority priority = ResourceLoadPriority::Normal )
             : m_ID( resourceID.GetResourcePath().GetID() )
             , m_isInstallDependency( true )
-        {}
+            , m_priority( priority )
+        {
+            EE_ASSERT( priority < ResourceLoadPriority::NumPriorities );
+        }
 
         // Explicit ID - generally refers to an entity or tools ID
-        explicit ResourceRequesterID( uint64_t ID )
+        explicit ResourceRequesterID( uint64_t ID, ResourceLoadPriority priority = ResourceLoadPriority::Normal )
             : m_ID( ID )
+            , m_priority( priority )
         {
             EE_ASSERT( ID > 0 );
+            EE_ASSERT( priority < ResourceLoadPriority::NumPriorities );
         }
 
         //-------------------------------------------------------------------------
@@ -61,6 +85,9 @@ namespace EE::Resource
         // Get the requester ID
         inline uint64_t GetID() const { return m_ID; }
 
+        // Get the priority for loads issued by this requester - this is not part of the requester's identity
+        inline ResourceLoadPriority GetLoadPriority() const { return m_priority; }
+
         // Get the ID for the data path for install dependencies, used for reverse look ups
         inline uint32_t GetInstallDependencyResourcePathID() const
         {
@@ -75,7 +102,8 @@ namespace EE::Resource
 
     private:
 
-        uint64_t    m_ID = 0;
-        bool        m_isInstallDependency = false;
+        uint64_t                m_ID = 0;
+        bool                    m_isInstallDependency = false;
+        ResourceLoadPriority    m_priority = ResourceLoadPriority::Normal;
     };
 }
\ No newline at end of file
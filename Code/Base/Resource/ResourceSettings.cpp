@@ -97,6 +97,23 @@ namespace EE::Resource
                 return false;
             }
 
+            // Compiled Resource Cache
+            //-------------------------------------------------------------------------
+
+            if ( ini.TryGetString( "Resource:CompiledResourceCachePath", tmp ) && !tmp.empty() )
+            {
+                // The cache can be shared between machines so we also allow absolute paths
+                bool const isAbsolutePath = tmp.length() > 1 && ( tmp[1] == ':' || ( tmp[0] == '\\' && tmp[1] == '\\' ) );
+                m_compiledResourceCachePath = isAbsolutePath ? FileSystem::Path( tmp ) : m_workingDirectoryPath + tmp;
+                if ( !m_compiledResourceCachePath.IsValid() )
+                {
+                    EE_LOG_ERROR( "Resource", "Resource Settings", "Invalid compiled resource cache path: %s", tmp.c_str() );
+                    return false;
+                }
+
+                m_compiledResourceCachePath.MakeIntoDirectoryPath();
+            }
+
             // Resource Compiler
             //-------------------------------------------------------------------------
 
@@ -29,6 +29,7 @@ namespace EE::Resource
         uint16_t                m_resourceServerPort;
         FileSystem::Path        m_rawResourcePath;
         FileSystem::Path        m_compiledResourceDatabasePath;
+        FileSystem::Path        m_compiledResourceCachePath; // Optional, no caching of compiled resources if not set
         FileSystem::Path        m_resourceServerExecutablePath;
         FileSystem::Path        m_resourceCompilerExecutablePath;
         #endif
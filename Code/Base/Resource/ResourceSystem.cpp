@@ -26,11 +26,13 @@ namespace EE::Resource
     {
         EE_ASSERT( pResourceProvider != nullptr && pResourceProvider->IsReady() );
         m_pResourceProvider = pResourceProvider;
+        m_ioScheduler.Initialize();
     }
 
     void ResourceSystem::Shutdown()
     {
         WaitForAllRequestsToComplete();
+        m_ioScheduler.Shutdown();
         m_pResourceProvider = nullptr;
     }
 
@@ -54,6 +56,21 @@ namespace EE::Resource
         return false;
     }
 
+    bool ResourceSystem::HasPendingUnloadRequests() const
+    {
+        Threading::RecursiveScopeLock lock( m_accessLock );
+
+        for ( auto const& pendingRequest : m_pendingRequests )
+        {
+            if ( pendingRequest.m_type == PendingRequest::Type::Unload )
+            {
+                return true;
+            }
+        }
+
+        return false;
+    }
+
     //-------------------------------------------------------------------------
 
     void ResourceSystem::GetUsersForResource( ResourceRecord const* pResourceRecord, TVector<ResourceRequesterID>& userIDs ) const
@@ -390,6 +407,8 @@ namespace EE::Resource
             ResourceRequest::RequestContext context;
             context.m_createRawRequestRequestFunction = [this] ( ResourceRequest* pRequest ) { m_pResourceProvider->RequestRawResource( pRequest ); };
             context.m_cancelRawRequestRequestFunction = [this] ( ResourceRequest* pRequest ) { m_pResourceProvider->CancelRequest( pRequest ); };
+            context.m_submitReadFunction = [this] ( ResourceIORead* pRead ) { return m_ioScheduler.SubmitRead( pRead ); };
+            context.m_cancelReadFunction = [this] ( ResourceIORead* pRead ) { return m_ioScheduler.TryCancelRead( pRead ); };
             context.m_loadResourceFunction = [this] ( ResourceRequesterID const& requesterID, ResourcePtr& resourcePtr ) { LoadResource( resourcePtr, requesterID ); };
             context.m_unloadResourceFunction = [this] ( ResourceRequesterID const& requesterID, ResourcePtr& resourcePtr ) { UnloadResource( resourcePtr, requesterID ); };
 
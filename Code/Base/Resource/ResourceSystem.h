@@ -2,6 +2,7 @@
 
 #include "Base/_Module/API.h"
 #include "ResourcePtr.h"
+#include "ResourceIOScheduler.h"
 #include "Base/Threading/Threading.h"
 #include "Base/Threading/TaskSystem.h"
 #include "Base/Systems.h"
@@ -77,6 +78,9 @@ namespace EE::Resource
         // Do we still have work we need to perform
         bool IsBusy() const;
 
+        // Are there any queued unload requests, these only start to be processed during the next update
+        bool HasPendingUnloadRequests() const;
+
         // Update all active requests (if you set the 'waitForAsyncTask' to true, this function will block and wait for the async task to complete)
         void Update( bool waitForAsyncTask = false );
 
@@ -153,6 +157,7 @@ namespace EE::Resource
         // ASync
         AsyncTask                                               m_asyncProcessingTask;
         std::atomic<bool>                                       m_isAsyncTaskRunning = false;
+        ResourceIOScheduler                                     m_ioScheduler;
 
         #if EE_DEVELOPMENT_TOOLS
         TVector<ResourceRequesterID>                            m_usersThatRequireReload;
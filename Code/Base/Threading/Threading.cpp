@@ -1,5 +1,6 @@
 #include "Threading.h"
 #include "Base/Profiling.h"
+#include <atomic>
 
 //-------------------------------------------------------------------------
 
@@ -26,5 +27,55 @@ namespace EE
         {
             g_mainThreadID = 0;
         }
+
+        //-------------------------------------------------------------------------
+
+        namespace
+        {
+            // Bitset of all the thread indices that are currently in use
+            std::atomic<uint64_t> g_usedThreadIndices[g_maxThreadIndices / 64];
+
+            // Claims the lowest free index on creation and releases it when the owning thread exits
+            struct ThreadIndex
+            {
+                ThreadIndex()
+                {
+                    for ( uint32_t wordIdx = 0; wordIdx < ( g_maxThreadIndices / 64 ); wordIdx++ )
+                    {
+                        uint64_t usedIndices = g_usedThreadIndices[wordIdx].load( std::memory_order_relaxed );
+                        while ( usedIndices != UINT64_MAX )
+                        {
+                            uint32_t bitIdx = 0;
+                            while ( ( usedIndices & ( 1ull << bitIdx ) ) != 0 )
+                            {
+                                bitIdx++;
+                            }
+
+                            if ( g_usedThreadIndices[wordIdx].compare_exchange_weak( usedIndices, usedIndices | ( 1ull << bitIdx ), std::memory_order_acquire, std::memory_order_relaxed ) )
+                            {
+                                m_index = ( wordIdx * 64 ) + bitIdx;
+                                return;
+                            }
+                        }
+                    }
+
+                    // Too many threads alive at once
+                    EE_HALT();
+                }
+
+                ~ThreadIndex()
+                {
+                    g_usedThreadIndices[m_index / 64].fetch_and( ~( 1ull << ( m_index % 64 ) ), std::memory_order_release );
+                }
+
+                uint32_t m_index = 0;
+            };
+        }
+
+        uint32_t GetCurrentThreadIndex()
+        {
+            thread_local ThreadIndex const threadIndex;
+            return threadIndex.m_index;
+        }
     }
 }
\ No newline at end of file
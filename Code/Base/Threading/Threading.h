@@ -48,15 +48,41 @@ namespace EE
 
             inline void LockForWrite() { m_mutex.lock(); }
             inline bool TryLockForWrite() { return m_mutex.try_lock(); }
+            inline void UnlockForWrite() { m_mutex.unlock(); }
 
             inline void LockForRead() { m_mutex.lock_shared(); }
             inline bool TryLockForRead() { return m_mutex.try_lock_shared(); }
+            inline void UnlockForRead() { m_mutex.unlock_shared(); }
 
         private:
 
             std::shared_mutex m_mutex;
         };
 
+        class ScopeReadLock
+        {
+        public:
+
+            ScopeReadLock( ReadWriteMutex& mutex ) : m_mutex( mutex ) { m_mutex.LockForRead(); }
+            ~ScopeReadLock() { m_mutex.UnlockForRead(); }
+
+        private:
+
+            ReadWriteMutex& m_mutex;
+        };
+
+        class ScopeWriteLock
+        {
+        public:
+
+            ScopeWriteLock( ReadWriteMutex& mutex ) : m_mutex( mutex ) { m_mutex.LockForWrite(); }
+            ~ScopeWriteLock() { m_mutex.UnlockForWrite(); }
+
+        private:
+
+            ReadWriteMutex& m_mutex;
+        };
+
         //-------------------------------------------------------------------------
         // Synchronization Event Semaphore
         //-------------------------------------------------------------------------
@@ -103,5 +129,12 @@ namespace EE
         EE_BASE_API void Shutdown();
         EE_BASE_API ThreadID GetCurrentThreadID();
         EE_BASE_API void SetCurrentThreadName( char const* pName );
+
+        // The maximum number of simultaneously alive threads that can request a thread index
+        constexpr static uint32_t const g_maxThreadIndices = 256;
+
+        // Get a small dense index for the calling thread between [0, g_maxThreadIndices), indices are reused once their thread exits
+        // This allows per-thread data to be stored in flat arrays and accessed without any locking
+        EE_BASE_API uint32_t GetCurrentThreadIndex();
     }
 }
\ No newline at end of file
@@ -1,101 +1,106 @@
 #include "StringID.h"
-#include "Base/Memory/Memory.h"
-#include "Base/Encoding/Hash.h"
-#include "Base/Threading/Threading.h"
 #include "String.h"
-#include "EASTL/hash_map.h"
+#include "Base/Encoding/Hash.h"
+#include <atomic>
 
 //-------------------------------------------------------------------------
+// Debug String Intern Table
+//-------------------------------------------------------------------------
+// A fixed size array of bucket lists, entries are only ever pushed onto the head of a bucket and are never modified or removed.
+// This means that lookups never need to lock and that inserting only requires a single CAS on the bucket head.
+// The table is zero-initialized static memory so it is safe to create IDs during static initialization.
+//
+// Entries are allocated directly from the CRT and not via the engine allocator since IDs can be created before the memory system is initialized.
 
 namespace EE
 {
-    class StringID_CustomAllocator
-    {
-    public:
-
-        EASTL_ALLOCATOR_EXPLICIT StringID_CustomAllocator( const char* pName = EASTL_NAME_VAL( EASTL_ALLOCATOR_DEFAULT_NAME ) ) {}
-        StringID_CustomAllocator( const StringID_CustomAllocator& x ) {}
-        StringID_CustomAllocator( const StringID_CustomAllocator& x, const char* pName ) {}
-        StringID_CustomAllocator& operator=( const StringID_CustomAllocator& x ) { return *this; }
-        const char* get_name() const { return "StringID"; }
-        void set_name( const char* pName ) {}
+    using DebugStringEntry = StringID::DebugStringEntry;
+    using DebugStringBucket = std::atomic<DebugStringEntry const*>;
 
-        void* allocate( size_t n, int flags = 0 )
-        {
-            return allocate( n, EASTL_SYSTEM_ALLOCATOR_MIN_ALIGNMENT, 0, flags );
-        }
+    static_assert( sizeof( DebugStringBucket ) == sizeof( DebugStringEntry const* ), "Debugger visualizers expect atomic ptrs to have the same layout as raw ptrs" );
 
-        void* allocate( size_t n, size_t alignment, size_t offset, int flags = 0 )
-        {
-            size_t adjustedAlignment = ( alignment > EA_PLATFORM_PTR_SIZE ) ? alignment : EA_PLATFORM_PTR_SIZE;
+    constexpr static size_t const g_numDebugStringBuckets = 16384;
+    constexpr static size_t const g_debugStringBucketMask = g_numDebugStringBuckets - 1;
 
-            void* p = new char[n + adjustedAlignment + EA_PLATFORM_PTR_SIZE];
-            void* pPlusPointerSize = (void*) ( (uintptr_t) p + EA_PLATFORM_PTR_SIZE );
-            void* pAligned = (void*) ( ( (uintptr_t) pPlusPointerSize + adjustedAlignment - 1 ) & ~( adjustedAlignment - 1 ) );
+    static DebugStringBucket g_debugStringBuckets[g_numDebugStringBuckets];
 
-            void** pStoredPtr = (void**) pAligned - 1;
-            EASTL_ASSERT( pStoredPtr >= p );
-            *( pStoredPtr ) = p;
+    // Natvis/Debugger info to print out human-readable strings
+    static StringID::DebuggerInfo const g_debuggerInfo = { g_debugStringBuckets, g_numDebugStringBuckets };
+    EE::StringID::DebuggerInfo const* StringID::s_pDebuggerInfo = &g_debuggerInfo;
 
-            EASTL_ASSERT( ( (size_t) pAligned & ~( alignment - 1 ) ) == (size_t) pAligned );
-            return pAligned;
-        }
+    //-------------------------------------------------------------------------
 
-        void deallocate( void* p, size_t n )
+    // Search a bucket list from the supplied entry until we reach the end entry
+    static DebugStringEntry const* FindDebugStringEntry( DebugStringEntry const* pEntry, DebugStringEntry const* pEndEntry, uint32_t ID )
+    {
+        for ( ; pEntry != pEndEntry; pEntry = pEntry->m_pNext )
         {
-            if ( p != nullptr )
+            if ( pEntry->m_ID == ID )
             {
-                void* pOriginalAllocation = *( (void**) p - 1 );
-                delete[]( char* )pOriginalAllocation;
+                return pEntry;
             }
         }
-    };
 
-    inline bool operator==( const StringID_CustomAllocator&, const StringID_CustomAllocator& ) { return true; }
-    inline bool operator!=( const StringID_CustomAllocator&, const StringID_CustomAllocator& ) { return false; }
+        return nullptr;
+    }
 
-    //-------------------------------------------------------------------------
+    static void RegisterDebugString( uint32_t ID, char const* pStr, size_t length )
+    {
+        DebugStringBucket& bucket = g_debugStringBuckets[ID & g_debugStringBucketMask];
 
-    using CachedString = eastl::basic_string<char, StringID_CustomAllocator>;
+        // Fast path - the vast majority of strings will already be registered
+        DebugStringEntry const* pHead = bucket.load( std::memory_order_acquire );
+        if ( FindDebugStringEntry( pHead, nullptr, ID ) != nullptr )
+        {
+            return;
+        }
 
-    class StringIDHashMap : public eastl::hash_map<uint32_t, CachedString, eastl::hash<uint32_t>, eastl::equal_to<uint32_t>, StringID_CustomAllocator>
-    {
-    public:
-      
-        eastl::hash_node<value_type, false> const* const* GetBuckets() const { return mpBucketArray; }
-    };
+        // Create a new entry, the string is stored in the same allocation directly after the entry
+        //-------------------------------------------------------------------------
 
-    //-------------------------------------------------------------------------
+        char* pMemory = new char[sizeof( DebugStringEntry ) + length + 1];
+        char* pString = pMemory + sizeof( DebugStringEntry );
+        memcpy( pString, pStr, length );
+        pString[length] = 0;
 
-    StringIDHashMap g_stringCache;
-    Threading::Mutex g_stringCacheMutex;
+        DebugStringEntry* pNewEntry = new ( pMemory ) DebugStringEntry();
+        pNewEntry->m_pString = pString;
+        pNewEntry->m_ID = ID;
 
-    // Natvis/Debugger info to print out human-readable strings
-    StringID::DebuggerInfo g_debuggerInfo;
-    EE::StringID::DebuggerInfo const* StringID::s_pDebuggerInfo = &g_debuggerInfo;
+        // Publish the entry, if another thread modified the bucket in the meantime we only need to check the newly added entries
+        //-------------------------------------------------------------------------
+
+        pNewEntry->m_pNext = pHead;
+        while ( !bucket.compare_exchange_weak( pNewEntry->m_pNext, pNewEntry, std::memory_order_release, std::memory_order_acquire ) )
+        {
+            if ( FindDebugStringEntry( pNewEntry->m_pNext, pHead, ID ) != nullptr )
+            {
+                pNewEntry->~DebugStringEntry();
+                delete[] pMemory;
+                return;
+            }
+
+            pHead = pNewEntry->m_pNext;
+        }
+    }
 
     //-------------------------------------------------------------------------
 
-    StringID::StringID( char const* pStr )
+    StringID::StringID( char const* pStr, size_t length )
     {
-        if ( pStr != nullptr && strlen( pStr ) > 0 )
+        if ( length > 0 )
         {
-            m_ID = Hash::GetHash32( pStr );
-
-            // Cache the string
-            Threading::ScopeLock lock( g_stringCacheMutex );
-            auto iter = g_stringCache.find( m_ID );
-            if ( iter == g_stringCache.end() )
-            {
-                g_stringCache[m_ID] = CachedString( pStr );
-                g_debuggerInfo.m_pBuckets = g_stringCache.GetBuckets();
-                g_debuggerInfo.m_numBuckets = g_stringCache.bucket_count();
-            }
+            m_ID = Hash::XXHash::GetHash32( pStr, length );
+            RegisterDebugString( m_ID, pStr, length );
         }
     }
 
+    StringID::StringID( char const* pStr )
+        : StringID( pStr, ( pStr != nullptr ) ? strlen( pStr ) : 0 )
+    {}
+
     StringID::StringID( String const& str )
-        : StringID( str.c_str() )
+        : StringID( str.c_str(), str.length() )
     {}
 
     char const* StringID::c_str() const
@@ -105,17 +110,13 @@ namespace EE
             return nullptr;
         }
 
+        DebugStringEntry const* pHead = g_debugStringBuckets[m_ID & g_debugStringBucketMask].load( std::memory_order_acquire );
+        if ( DebugStringEntry const* pEntry = FindDebugStringEntry( pHead, nullptr, m_ID ) )
         {
-            // Get cached string
-            Threading::ScopeLock lock( g_stringCacheMutex );
-            auto iter = g_stringCache.find( m_ID );
-            if ( iter != g_stringCache.end() )
-            {
-                return iter->second.c_str();
-            }
+            return pEntry->m_pString;
         }
 
         // ID likely directly created via uint32_t
         return nullptr;
     }
-}
\ No newline at end of file
+}
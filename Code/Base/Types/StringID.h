@@ -2,6 +2,7 @@
 
 #include "Base/_Module/API.h"
 #include "Base/Types/Containers_ForwardDecl.h"
+#include "Base/Encoding/Hash_ConstExpr.h"
 #include "Base/Esoterica.h"
 
 //-------------------------------------------------------------------------
@@ -10,56 +11,64 @@
 // Deterministic numeric ID generated from a string
 // StringIDs are CASE-SENSITIVE!
 // Uses the 32bit default hash
-
-namespace eastl
-{
-    template <typename Value, bool bCacheHashCode>
-    struct hash_node;
-
-    template <typename T1, typename T2>
-    struct pair;
-}
-
-//-------------------------------------------------------------------------
+//
+// Creating an ID from a string registers the string in a global lock-free intern table so that it can be retrieved for debugging.
+// IDs for string literals can be created at compile time via 'StringID::FromLiteral', these have the same value as runtime created IDs
+// but do not register their string so 'c_str()' will only return a string if the same string has also been created at runtime.
 
 namespace EE
 {
-    class StringID_CustomAllocator;
-
-    //-------------------------------------------------------------------------
-
     class EE_BASE_API StringID
     {
     public:
 
-        using StringIDHashNode = eastl::hash_node<eastl::pair<const uint32_t, eastl::basic_string<char, EE::StringID_CustomAllocator>>, false>;
+        // Entries are immutable once published to the intern table and are never released
+        struct DebugStringEntry
+        {
+            DebugStringEntry const*         m_pNext = nullptr;
+            char const*                     m_pString = nullptr;
+            uint32_t                        m_ID = 0;
+        };
 
         struct DebuggerInfo
         {
-            StringIDHashNode const* const*  m_pBuckets = nullptr;
+            void const*                     m_pBuckets = nullptr; // Array of 'DebugStringEntry const*' bucket heads
             size_t                          m_numBuckets = 0;
         };
 
         static DebuggerInfo const*          s_pDebuggerInfo;
 
+        // Create an ID from a literal, the string is not registered in the intern table
+        // This is only guaranteed to be evaluated at compile time when used in a constant expression, so always bind the result to a constexpr variable
+        // i.e. 'constexpr static StringID const s_ID = StringID::FromLiteral( "ID" );' - calling it inline hashes the literal at runtime in unoptimized builds
+        template<size_t N>
+        constexpr static StringID FromLiteral( char const ( &str )[N] )
+        {
+            return StringID( ( N > 1 ) ? Hash::XXHash::ConstExpr::GetHash32( str, N - 1 ) : 0 );
+        }
+
     public:
 
-        StringID() = default;
-        explicit StringID( nullptr_t ) : m_ID( 0 ) {}
+        constexpr StringID() = default;
+        constexpr explicit StringID( nullptr_t ) : m_ID( 0 ) {}
         explicit StringID( char const* pStr );
-        explicit StringID( uint32_t ID ) : m_ID( ID ) {}
+        constexpr explicit StringID( uint32_t ID ) : m_ID( ID ) {}
         explicit StringID( String const& str );
 
-        inline bool IsValid() const { return m_ID != 0; }
-        inline uint32_t ToUint() const { return m_ID; }
-        inline operator uint32_t() const { return m_ID; }
+        constexpr inline bool IsValid() const { return m_ID != 0; }
+        constexpr inline uint32_t ToUint() const { return m_ID; }
+        constexpr inline operator uint32_t() const { return m_ID; }
 
         inline void Clear() { m_ID = 0; }
 
         char const* c_str() const;
 
-        inline bool operator==( StringID const& rhs ) const { return m_ID == rhs.m_ID; }
-        inline bool operator!=( StringID const& rhs ) const { return m_ID != rhs.m_ID; }
+        constexpr inline bool operator==( StringID const& rhs ) const { return m_ID == rhs.m_ID; }
+        constexpr inline bool operator!=( StringID const& rhs ) const { return m_ID != rhs.m_ID; }
+
+    private:
+
+        StringID( char const* pStr, size_t length );
 
     private:
 
@@ -78,4 +87,4 @@ namespace eastl
     {
         size_t operator()( EE::StringID const& ID ) const { return (uint32_t) ID; }
     };
-}
\ No newline at end of file
+}
@@ -44,6 +44,14 @@ namespace EE::AI
 
     //-------------------------------------------------------------------------
 
+    WorldSystemAccess AIManager::GetUpdateAccess() const
+    {
+        // Spawning only reads the spawn points, the actual entity creation is requested from the (internally synchronized) persistent map
+        WorldSystemAccess access;
+        access.Reads<AISpawnComponent>();
+        return access;
+    }
+
     void AIManager::UpdateSystem( EntityWorldUpdateContext const& ctx )
     {
         if ( ctx.IsGameWorld() && !m_hasSpawnedAI )
@@ -67,7 +75,7 @@ namespace EE::AI
 
         for ( auto pSpawnPoint : m_spawnPoints )
         {
-            pPersistentMap->AddEntityCollection( pTaskSystem, *pTypeRegistry, *pSpawnPoint->GetEntityCollectionDesc(), pSpawnPoint->GetWorldTransform() );
+            pPersistentMap->AddEntityCollection( pTaskSystem, *pTypeRegistry, *pSpawnPoint->GetEntityCollectionDesc(), pSpawnPoint->GetWorldTransform(), nullptr, Resource::ResourceLoadPriority::Streaming );
         }
 
         return true;
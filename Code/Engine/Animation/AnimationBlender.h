@@ -43,6 +43,8 @@ namespace EE::Animation
 
         struct BlendFunction
         {
+            constexpr static bool const s_supportsBatchedBlend = false;
+
             EE_FORCE_INLINE static Quaternion BlendRotation( Quaternion const& quat0, Quaternion const& quat1, float t )
             {
                 return Quaternion::SLerp( quat0, quat1, t );
@@ -56,6 +58,8 @@ namespace EE::Animation
 
         struct BlendFunctionFastSLerp
         {
+            constexpr static bool const s_supportsBatchedBlend = true;
+
             EE_FORCE_INLINE static Quaternion BlendRotation( Quaternion const& quat0, Quaternion const& quat1, float t )
             {
                 return Quaternion::FastSLerp( quat0, quat1, t );
@@ -65,10 +69,72 @@ namespace EE::Animation
             {
                 return Vector::Lerp( translationScale0, translationScale1, t );
             }
+
+            // Blend 4 transforms at once with a separate weight per transform
+            // The rotations are transposed so that each register holds the same component for all 4 rotations, this removes all the horizontal work from the 'FastSLerp'
+            EE_FORCE_INLINE static void BlendTransforms( Transform const* pSource, Transform const* pTarget, Vector const& weights, Transform* pResult )
+            {
+                static Vector const vSignMask( -0.0f );
+
+                Vector x0 = pSource[0].GetRotation().ToVector(), y0 = pSource[1].GetRotation().ToVector(), z0 = pSource[2].GetRotation().ToVector(), w0 = pSource[3].GetRotation().ToVector();
+                Vector x1 = pTarget[0].GetRotation().ToVector(), y1 = pTarget[1].GetRotation().ToVector(), z1 = pTarget[2].GetRotation().ToVector(), w1 = pTarget[3].GetRotation().ToVector();
+                _MM_TRANSPOSE4_PS( x0.m_data, y0.m_data, z0.m_data, w0.m_data );
+                _MM_TRANSPOSE4_PS( x1.m_data, y1.m_data, z1.m_data, w1.m_data );
+
+                // Ensure we take the shortest path
+                Vector const dot = ( x0 * x1 ) + ( y0 * y1 ) + ( z0 * z1 ) + ( w0 * w1 );
+                Vector const sign = _mm_and_ps( vSignMask, dot );
+                Vector const xm1 = Vector( _mm_xor_ps( sign, dot ) ) - Vector::One;
+
+                Vector const cT = CalculateFastSLerpCoefficients( weights, xm1 ) * Vector( _mm_xor_ps( sign, Vector::One ) );
+                Vector const cD = CalculateFastSLerpCoefficients( Vector::One - weights, xm1 );
+
+                Vector x = Vector::MultiplyAdd( cD, x0, cT * x1 );
+                Vector y = Vector::MultiplyAdd( cD, y0, cT * y1 );
+                Vector z = Vector::MultiplyAdd( cD, z0, cT * z1 );
+                Vector w = Vector::MultiplyAdd( cD, w0, cT * w1 );
+                _MM_TRANSPOSE4_PS( x.m_data, y.m_data, z.m_data, w.m_data );
+
+                // Read all translations and scales before writing any results since the result may alias either input
+                Vector const ts0 = Vector::MultiplyAdd( pTarget[0].GetTranslationAndScale() - pSource[0].GetTranslationAndScale(), weights.GetSplatX(), pSource[0].GetTranslationAndScale() );
+                Vector const ts1 = Vector::MultiplyAdd( pTarget[1].GetTranslationAndScale() - pSource[1].GetTranslationAndScale(), weights.GetSplatY(), pSource[1].GetTranslationAndScale() );
+                Vector const ts2 = Vector::MultiplyAdd( pTarget[2].GetTranslationAndScale() - pSource[2].GetTranslationAndScale(), weights.GetSplatZ(), pSource[2].GetTranslationAndScale() );
+                Vector const ts3 = Vector::MultiplyAdd( pTarget[3].GetTranslationAndScale() - pSource[3].GetTranslationAndScale(), weights.GetSplatW(), pSource[3].GetTranslationAndScale() );
+
+                Transform::DirectlySetRotation( pResult[0], Quaternion( x ) );
+                Transform::DirectlySetRotation( pResult[1], Quaternion( y ) );
+                Transform::DirectlySetRotation( pResult[2], Quaternion( z ) );
+                Transform::DirectlySetRotation( pResult[3], Quaternion( w ) );
+                Transform::DirectlySetTranslationScale( pResult[0], ts0 );
+                Transform::DirectlySetTranslationScale( pResult[1], ts1 );
+                Transform::DirectlySetTranslationScale( pResult[2], ts2 );
+                Transform::DirectlySetTranslationScale( pResult[3], ts3 );
+            }
+
+            // Calculate the 'FastSLerp' coefficient for 4 rotations at once, 'xm1' is (cos(theta) - 1) for each rotation
+            // See 'Quaternion::FastSLerp' for the details
+            EE_FORCE_INLINE static Vector CalculateFastSLerpCoefficients( Vector const& t, Vector const& xm1 )
+            {
+                constexpr float const mu = 1.85298109240830f;
+                constexpr float const u[8] = { 1.f / ( 1 * 3 ), 1.f / ( 2 * 5 ), 1.f / ( 3 * 7 ), 1.f / ( 4 * 9 ), 1.f / ( 5 * 11 ), 1.f / ( 6 * 13 ), 1.f / ( 7 * 15 ), mu / ( 8 * 17 ) };
+                constexpr float const v[8] = { 1.f / 3, 2.f / 5, 3.f / 7, 4.f / 9, 5.f / 11, 6.f / 13, 7.f / 15, mu * 8 / 17 };
+
+                Vector const tSquared = t * t;
+                Vector c = ( Vector::MultiplySubtract( Vector( u[7] ), tSquared, Vector( v[7] ) ) * xm1 ) + Vector::One;
+                for ( int32_t i = 6; i >= 0; i-- )
+                {
+                    Vector const b = Vector::MultiplySubtract( Vector( u[i] ), tSquared, Vector( v[i] ) ) * xm1;
+                    c = Vector::MultiplyAdd( b, c, Vector::One );
+                }
+
+                return c * t;
+            }
         };
 
         struct AdditiveBlendFunction
         {
+            constexpr static bool const s_supportsBatchedBlend = true;
+
             EE_FORCE_INLINE static Quaternion BlendRotation( Quaternion const& quat0, Quaternion const& quat1, float t )
             {
                 Quaternion const targetQuat = quat1 * quat0;
@@ -79,6 +145,59 @@ namespace EE::Animation
             {
                 return Vector::MultiplyAdd( translationScale1, Vector( t ), translationScale0 );
             }
+
+            // Blend 4 transforms at once with a separate weight per transform
+            // The rotations are transposed so that each register holds the same component for all 4 rotations. Each lane performs the same operations, in the same order,
+            // as 'Quaternion::operator*' and 'Quaternion::SLerp' so the results are identical to blending each bone individually
+            EE_FORCE_INLINE static void BlendTransforms( Transform const* pSource, Transform const* pTarget, Vector const& weights, Transform* pResult )
+            {
+                static Vector const vOneMinusEpsilon( 1.0f - 0.00001f );
+
+                Vector x0 = pSource[0].GetRotation().ToVector(), y0 = pSource[1].GetRotation().ToVector(), z0 = pSource[2].GetRotation().ToVector(), w0 = pSource[3].GetRotation().ToVector();
+                Vector x1 = pTarget[0].GetRotation().ToVector(), y1 = pTarget[1].GetRotation().ToVector(), z1 = pTarget[2].GetRotation().ToVector(), w1 = pTarget[3].GetRotation().ToVector();
+                _MM_TRANSPOSE4_PS( x0.m_data, y0.m_data, z0.m_data, w0.m_data );
+                _MM_TRANSPOSE4_PS( x1.m_data, y1.m_data, z1.m_data, w1.m_data );
+
+                // Apply the additive rotation to the source rotation (target * source)
+                Vector const ax = ( ( x1 * w0 ) + ( x0 * w1 ) ) + ( ( y0 * z1 ) - ( z0 * y1 ) );
+                Vector const ay = ( ( y1 * w0 ) - ( x0 * z1 ) ) + ( ( y0 * w1 ) + ( z0 * x1 ) );
+                Vector const az = ( ( z1 * w0 ) + ( x0 * y1 ) ) + ( ( z0 * w1 ) - ( y0 * x1 ) );
+                Vector const aw = ( ( w1 * w0 ) - ( x0 * x1 ) ) - ( ( y0 * y1 ) + ( z0 * z1 ) );
+
+                // SLerp from the source rotation to the additive result, taking the shortest path
+                Vector cosOmega = ( ( x0 * ax ) + ( z0 * az ) ) + ( ( y0 * ay ) + ( w0 * aw ) );
+                Vector const sign = Vector::Select( Vector::One, Vector::NegativeOne, cosOmega.LessThan( Vector::Zero ) );
+                cosOmega = cosOmega * sign;
+
+                Vector const control = cosOmega.LessThan( vOneMinusEpsilon );
+                Vector const sinOmega = _mm_sqrt_ps( Vector::One - ( cosOmega * cosOmega ) );
+                Vector const omega = Vector::ATan2( sinOmega, cosOmega );
+
+                Vector const oneMinusWeights = Vector::One - weights;
+                Vector const c0 = Vector::Select( oneMinusWeights, Vector( _mm_div_ps( Vector::Sin( oneMinusWeights * omega ), sinOmega ) ), control );
+                Vector const c1 = Vector::Select( weights, Vector( _mm_div_ps( Vector::Sin( weights * omega ), sinOmega ) ), control ) * sign;
+
+                Vector x = ( x0 * c0 ) + ( c1 * ax );
+                Vector y = ( y0 * c0 ) + ( c1 * ay );
+                Vector z = ( z0 * c0 ) + ( c1 * az );
+                Vector w = ( w0 * c0 ) + ( c1 * aw );
+                _MM_TRANSPOSE4_PS( x.m_data, y.m_data, z.m_data, w.m_data );
+
+                // Read all translations and scales before writing any results since the result may alias either input
+                Vector const ts0 = Vector::MultiplyAdd( pTarget[0].GetTranslationAndScale(), weights.GetSplatX(), pSource[0].GetTranslationAndScale() );
+                Vector const ts1 = Vector::MultiplyAdd( pTarget[1].GetTranslationAndScale(), weights.GetSplatY(), pSource[1].GetTranslationAndScale() );
+                Vector const ts2 = Vector::MultiplyAdd( pTarget[2].GetTranslationAndScale(), weights.GetSplatZ(), pSource[2].GetTranslationAndScale() );
+                Vector const ts3 = Vector::MultiplyAdd( pTarget[3].GetTranslationAndScale(), weights.GetSplatW(), pSource[3].GetTranslationAndScale() );
+
+                Transform::DirectlySetRotation( pResult[0], Quaternion( x ) );
+                Transform::DirectlySetRotation( pResult[1], Quaternion( y ) );
+                Transform::DirectlySetRotation( pResult[2], Quaternion( z ) );
+                Transform::DirectlySetRotation( pResult[3], Quaternion( w ) );
+                Transform::DirectlySetTranslationScale( pResult[0], ts0 );
+                Transform::DirectlySetTranslationScale( pResult[1], ts1 );
+                Transform::DirectlySetTranslationScale( pResult[2], ts2 );
+                Transform::DirectlySetTranslationScale( pResult[3], ts3 );
+            }
         };
 
     private:
@@ -232,7 +351,20 @@ namespace EE::Animation
         else // Blend
         {
             int32_t const numBones = pResultPose->GetNumBones( skeletonLOD );
-            for ( int32_t boneIdx = 0; boneIdx < numBones; boneIdx++ )
+            int32_t boneIdx = 0;
+
+            // Blend groups of 4 bones at once if supported, the remaining bones are blended individually below
+            if constexpr ( BlendFunction::s_supportsBatchedBlend )
+            {
+                Vector const vBlendWeight( blendWeight );
+                int32_t const numBatchedBones = numBones & ~3;
+                for ( ; boneIdx < numBatchedBones; boneIdx += 4 )
+                {
+                    BlendFunction::BlendTransforms( &pSourcePose->m_localTransforms[boneIdx], &pTargetPose->m_localTransforms[boneIdx], vBlendWeight, &pResultPose->m_localTransforms[boneIdx] );
+                }
+            }
+
+            for ( ; boneIdx < numBones; boneIdx++ )
             {
                 Transform const& sourceTransform = pSourcePose->m_localTransforms[boneIdx];
                 Transform const& targetTransform = pTargetPose->m_localTransforms[boneIdx];
@@ -257,7 +389,53 @@ namespace EE::Animation
         EE_ASSERT( pBoneMask != nullptr );
 
         int32_t const numBones = pResultPose->GetNumBones( skeletonLOD );
-        for ( int32_t boneIdx = 0; boneIdx < numBones; boneIdx++ )
+        int32_t boneIdx = 0;
+
+        // Blend groups of 4 bones at once if supported, the remaining bones are blended individually below
+        if constexpr ( BlendFunction::s_supportsBatchedBlend )
+        {
+            Vector const vBlendWeight( blendWeight );
+            int32_t const numBatchedBones = numBones & ~3;
+            for ( ; boneIdx < numBatchedBones; boneIdx += 4 )
+            {
+                Vector const boneBlendWeights = Vector( _mm_loadu_ps( pBoneMask->GetWeights() + boneIdx ) ) * vBlendWeight;
+                int32_t const zeroWeightBones = _mm_movemask_ps( boneBlendWeights.Equal( Vector::Zero ) );
+                int32_t const fullWeightBones = canEarlyOutOfPerBoneBlend ? _mm_movemask_ps( boneBlendWeights.Equal( Vector::One ) ) : 0;
+
+                Transform const* pSourceTransforms = &pSourcePose->m_localTransforms[boneIdx];
+                Transform const* pTargetTransforms = &pTargetPose->m_localTransforms[boneIdx];
+                Transform* pResultTransforms = &pResultPose->m_localTransforms[boneIdx];
+
+                // No early outs, so blend directly into the result
+                if ( ( zeroWeightBones | fullWeightBones ) == 0 )
+                {
+                    BlendFunction::BlendTransforms( pSourceTransforms, pTargetTransforms, boneBlendWeights, pResultTransforms );
+                }
+                else // Blend into a temporary buffer and then select the result per bone to match the individual bone blend
+                {
+                    Transform blendedTransforms[4] = { Transform( NoInit ), Transform( NoInit ), Transform( NoInit ), Transform( NoInit ) };
+                    BlendFunction::BlendTransforms( pSourceTransforms, pTargetTransforms, boneBlendWeights, blendedTransforms );
+
+                    for ( int32_t i = 0; i < 4; i++ )
+                    {
+                        if ( zeroWeightBones & ( 1 << i ) )
+                        {
+                            pResultTransforms[i] = pSourceTransforms[i];
+                        }
+                        else if ( fullWeightBones & ( 1 << i ) )
+                        {
+                            pResultTransforms[i] = pTargetTransforms[i];
+                        }
+                        else
+                        {
+                            pResultTransforms[i] = blendedTransforms[i];
+                        }
+                    }
+                }
+            }
+        }
+
+        for ( ; boneIdx < numBones; boneIdx++ )
         {
             // If the bone has been masked out
             float const boneBlendWeight = blendWeight * pBoneMask->GetWeight( boneIdx );
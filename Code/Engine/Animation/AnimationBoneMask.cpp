@@ -436,13 +436,11 @@ namespace EE::Animation
         : m_pSkeleton( pSkeleton )
         , m_firstFreePoolIdx( InvalidIndex )
     {
-        EE_ASSERT( m_pool.empty() && m_pSkeleton != nullptr );
-
-        m_pool.reserve( s_initialPoolSize * 2 );
+        EE_ASSERT( m_poolSize == 0 && m_pSkeleton != nullptr );
 
         for ( auto i = 0; i < s_initialPoolSize; i++ )
         {
-            m_pool.emplace_back( pSkeleton );
+            m_pool[m_poolSize++] = EE::New<Slot>( pSkeleton );
         }
 
         m_firstFreePoolIdx = 0;
@@ -450,7 +448,12 @@ namespace EE::Animation
 
     BoneMaskPool::~BoneMaskPool()
     {
-        m_pool.clear();
+        for ( int32_t i = 0; i < m_poolSize; i++ )
+        {
+            EE::Delete( m_pool[i] );
+        }
+
+        m_poolSize = 0;
         m_firstFreePoolIdx = InvalidIndex;
     }
 
@@ -458,72 +461,88 @@ namespace EE::Animation
     void BoneMaskPool::PerformValidation() const
     {
         // Validate that all buffers have been released!
-        for ( auto const& slot : m_pool )
+        for ( int32_t i = 0; i < m_poolSize; i++ )
         {
-            EE_ASSERT( !slot.m_isUsed );
+            EE_ASSERT( !m_pool[i]->m_isUsed );
         }
 
         EE_ASSERT( m_firstFreePoolIdx == 0 );
     }
     #endif
 
-    int8_t BoneMaskPool::AcquireMask( bool resetMask )
+    void BoneMaskPool::EnableThreadSafeAccess( bool isEnabled )
     {
-        int32_t const currentPoolSize = (int32_t) m_pool.size();
-        EE_ASSERT( m_firstFreePoolIdx < currentPoolSize );
-        
-        // Set the mask as used
-        int8_t maskIdx = m_firstFreePoolIdx;
-        EE_ASSERT( !m_pool[maskIdx].m_isUsed );
-        m_pool[maskIdx].m_isUsed = true;
+        m_isThreadSafeAccessEnabled = isEnabled;
+    }
 
-        if ( resetMask )
+    int8_t BoneMaskPool::AcquireMask( bool resetMask )
+    {
+        Threading::Lock lock( m_mutex, std::defer_lock );
+        if ( m_isThreadSafeAccessEnabled )
         {
-            m_pool[maskIdx].m_mask.ResetWeights();
+            lock.lock();
         }
 
-        // Update free idx
-        int8_t const searchStartIdx = m_firstFreePoolIdx + 1;
-        m_firstFreePoolIdx = InvalidIndex;
-        for ( int8_t i = searchStartIdx; i < currentPoolSize; i++ )
+        // Grow the pool if needed, slots are individually allocated so existing masks never move
+        if ( m_firstFreePoolIdx == InvalidIndex )
         {
-            if ( !m_pool[i].m_isUsed )
+            if ( m_poolSize == s_maxPoolSize )
             {
-                m_firstFreePoolIdx = i;
-                break;
+                EE_LOG_FATAL_ERROR( "Animation", "Bone Mask Pool", "Ran out of bone masks, the pool has a max size of %d!", s_maxPoolSize );
+                return InvalidIndex;
             }
+
+            int32_t const newPoolSize = Math::Min( s_maxPoolSize, m_poolSize * 2 );
+            for ( int32_t i = m_poolSize; i < newPoolSize; i++ )
+            {
+                m_pool[i] = EE::New<Slot>( m_pSkeleton );
+            }
+
+            m_firstFreePoolIdx = (int8_t) m_poolSize;
+            m_poolSize = newPoolSize;
         }
 
-        // Grow the pool if needed
-        if ( m_firstFreePoolIdx == InvalidIndex )
+        // Set the mask as used
+        int8_t const maskIdx = m_firstFreePoolIdx;
+        EE_ASSERT( !m_pool[maskIdx]->m_isUsed );
+        m_pool[maskIdx]->m_isUsed = true;
+
+        if ( resetMask )
         {
-            size_t const newPoolSize = Math::Max( 127, currentPoolSize * 2 );
-            size_t const numMasksToAdd = newPoolSize - currentPoolSize;
+            m_pool[maskIdx]->m_mask.ResetWeights();
+        }
 
-            for ( auto i = 0; i < numMasksToAdd; i++ )
+        // Update free idx
+        m_firstFreePoolIdx = InvalidIndex;
+        for ( int32_t i = maskIdx + 1; i < m_poolSize; i++ )
+        {
+            if ( !m_pool[i]->m_isUsed )
             {
-                m_pool.emplace_back( m_pSkeleton );
+                m_firstFreePoolIdx = (int8_t) i;
+                break;
             }
-
-            m_firstFreePoolIdx = (int8_t) currentPoolSize + 1;
-            EE_ASSERT( m_firstFreePoolIdx < 127 );
         }
 
         // Return the allocate mask pool index
-        EE_ASSERT( maskIdx >= 0 && maskIdx < m_pool.size() );
         return maskIdx;
     }
 
     void BoneMaskPool::ReleaseMask( int8_t maskIdx )
     {
-        EE_ASSERT( maskIdx < m_pool.size() );
-        EE_ASSERT( m_pool[maskIdx].m_isUsed );
+        Threading::Lock lock( m_mutex, std::defer_lock );
+        if ( m_isThreadSafeAccessEnabled )
+        {
+            lock.lock();
+        }
+
+        EE_ASSERT( maskIdx >= 0 && maskIdx < m_poolSize );
+        EE_ASSERT( m_pool[maskIdx]->m_isUsed );
 
         // Clear the flag
-        m_pool[maskIdx].m_isUsed = false;
+        m_pool[maskIdx]->m_isUsed = false;
 
         // Update the free index
-        if ( maskIdx < m_firstFreePoolIdx )
+        if ( m_firstFreePoolIdx == InvalidIndex || maskIdx < m_firstFreePoolIdx )
         {
             m_firstFreePoolIdx = maskIdx;
         }
@@ -7,6 +7,7 @@
 #include "Base/TypeSystem/ReflectedType.h"
 #include "Base/Serialization/BitSerialization.h"
 #include "Base/Types/Color.h"
+#include "Base/Threading/Threading.h"
 
 //-------------------------------------------------------------------------
 
@@ -108,6 +109,7 @@ namespace EE::Animation
         inline Skeleton const* GetSkeleton() const { return m_pSkeleton; }
         inline int32_t GetNumWeights() const { return (int32_t) m_weights.size(); }
         inline float GetWeight( uint32_t i ) const { EE_ASSERT( i < (uint32_t) m_weights.size() ); return m_weights[i]; }
+        inline float const* GetWeights() const { return m_weights.data(); }
         inline float operator[]( uint32_t i ) const { return GetWeight( i ); }
         BoneMask& operator*=( BoneMask const& rhs );
 
@@ -181,6 +183,7 @@ namespace EE::Animation
     class BoneMaskPool
     {
         constexpr static int32_t const s_initialPoolSize = 5;
+        constexpr static int32_t const s_maxPoolSize = 127;
 
         struct Slot
         {
@@ -204,6 +207,10 @@ namespace EE::Animation
 
         inline Skeleton const* GetSkeleton() const { return m_pSkeleton; }
 
+        // Enable thread-safe acquiring/releasing of masks, needed when pose tasks are executed in parallel
+        // Masks are individually allocated so growing the pool never moves a mask that is in use
+        void EnableThreadSafeAccess( bool isEnabled );
+
         // Get a mask from the pool - pool has a max size of 127
         // By default mask are not reset so be careful what you do with the mask
         int8_t AcquireMask( bool resetMask = false );
@@ -214,15 +221,18 @@ namespace EE::Animation
         // Get a used bone mask
         inline BoneMask* operator[]( size_t maskIdx )
         {
-            EE_ASSERT( m_pool[maskIdx].m_isUsed );
-            return &m_pool[maskIdx].m_mask;
+            EE_ASSERT( maskIdx < s_maxPoolSize && m_pool[maskIdx] != nullptr && m_pool[maskIdx]->m_isUsed );
+            return &m_pool[maskIdx]->m_mask;
         }
 
     private:
 
         Skeleton const*             m_pSkeleton = nullptr;
-        TVector<Slot>               m_pool;
+        TArray<Slot*, s_maxPoolSize> m_pool = {};              // Fixed storage so that the slot ptrs can be read while another thread grows the pool
+        int32_t                     m_poolSize = 0;
         int8_t                      m_firstFreePoolIdx = InvalidIndex;
+        Threading::Mutex            m_mutex;
+        bool                        m_isThreadSafeAccessEnabled = false;
     };
 
     //-------------------------------------------------------------------------
@@ -7,6 +7,77 @@
 
 namespace EE::Animation
 {
+    namespace
+    {
+        // The 'FastSLerp' coefficient polynomial, we precompute the time dependent terms once per pose so that the per-track work is just a set of multiply-adds
+        // See 'Quaternion::FastSLerp' for the scalar version of this
+        struct FastSlerpCoefficients
+        {
+            FastSlerpCoefficients( float t )
+                : m_t( t )
+            {
+                constexpr float const mu = 1.85298109240830f;
+                constexpr float const u[8] = { 1.f / ( 1 * 3 ), 1.f / ( 2 * 5 ), 1.f / ( 3 * 7 ), 1.f / ( 4 * 9 ), 1.f / ( 5 * 11 ), 1.f / ( 6 * 13 ), 1.f / ( 7 * 15 ), mu / ( 8 * 17 ) };
+                constexpr float const v[8] = { 1.f / 3, 2.f / 5, 3.f / 7, 4.f / 9, 5.f / 11, 6.f / 13, 7.f / 15, mu * 8 / 17 };
+
+                float const tSquared = t * t;
+                for ( int32_t i = 0; i < 8; i++ )
+                {
+                    m_k[i] = Vector( ( u[i] * tSquared ) - v[i] );
+                }
+            }
+
+            // Calculate the coefficient for 4 tracks at once, 'xm1' is the (cos(theta) - 1) for each track
+            EE_FORCE_INLINE Vector Calculate( Vector const& xm1 ) const
+            {
+                Vector c = ( m_k[7] * xm1 ) + Vector::One;
+                for ( int32_t i = 6; i >= 0; i-- )
+                {
+                    c = Vector::MultiplyAdd( m_k[i] * xm1, c, Vector::One );
+                }
+                return c * m_t;
+            }
+
+            Vector      m_k[8];
+            Vector      m_t;
+        };
+
+        EE_FORCE_INLINE Vector DecodeNormalizedValues( uint16_t const* pData )
+        {
+            static Vector const vNormalizationMultiplier( 1.0f / float( 0xFFFF ) );
+            __m128i const data = _mm_unpacklo_epi16( _mm_loadl_epi64( reinterpret_cast<__m128i const*>( pData ) ), _mm_setzero_si128() );
+            return Vector( _mm_cvtepi32_ps( data ) ) * vNormalizationMultiplier;
+        }
+
+        // Get the number of tracks that affect the bones in the current LOD (bone indices are sorted)
+        EE_FORCE_INLINE int32_t GetNumTracksForLOD( TVector<uint16_t> const& boneIndices, int32_t numBones )
+        {
+            return int32_t( eastl::lower_bound( boneIndices.begin(), boneIndices.end(), (uint16_t) numBones ) - boneIndices.begin() );
+        }
+    }
+
+    //-------------------------------------------------------------------------
+
+    void AnimationClip::CreateEventTimeline()
+    {
+        m_eventTimeline.clear();
+        m_eventTimeline.reserve( m_events.size() );
+
+        float maxEndTime = 0.0f;
+        for ( auto pEvent : m_events )
+        {
+            EE_ASSERT( m_eventTimeline.empty() || pEvent->GetStartTime() >= m_eventTimeline.back().m_startTime );
+
+            EventInterval& interval = m_eventTimeline.emplace_back();
+            interval.m_startTime = pEvent->GetStartTime().ToFloat();
+            interval.m_endTime = interval.m_startTime + pEvent->GetDuration().ToFloat();
+            interval.m_typeID = pEvent->GetTypeID();
+            interval.m_isDurationEvent = pEvent->IsDurationEvent();
+            maxEndTime = Math::Max( maxEndTime, interval.m_endTime );
+            interval.m_maxEndTime = maxEndTime;
+        }
+    }
+
     void AnimationClip::GetPose( FrameTime const& frameTime, Pose* pOutPose, Skeleton::LOD lod ) const
     {
         EE_ASSERT( IsValid() );
@@ -14,81 +85,154 @@ namespace EE::Animation
         EE_ASSERT( frameTime.GetFrameIndex() < m_numFrames );
 
         pOutPose->ClearGlobalTransforms();
+        DecodePose( frameTime, m_skeleton->GetNumBones( lod ), pOutPose->m_localTransforms.data() );
 
-        //-------------------------------------------------------------------------
+        // Flag the pose as being set
+        pOutPose->m_state = m_isAdditive ? Pose::State::AdditivePose : Pose::State::Pose;
+    }
+
+    void AnimationClip::DecodePose( FrameTime const& frameTime, int32_t numBones, Transform* pOutTransforms ) const
+    {
+        EE_ASSERT( numBones <= (int32_t) m_staticPose.size() && pOutTransforms != nullptr );
 
-        int32_t const numBones = m_skeleton->GetNumBones( lod );
+        // Set all static track values, the dynamic values will be overwritten below
+        memcpy( pOutTransforms, m_staticPose.data(), sizeof( Transform ) * numBones );
 
-        auto ReadCompressedPose = [&] ( int32_t poseIdx, Transform outTransforms[] )
+        // If we're not exactly at a key frame we need to read the upper frame pose and blend
+        // Both frames are decoded and interpolated in the same pass, so we never need a temporary pose
+        uint16_t const* pLowerFrameData = m_compressedPoseData.data() + ( frameTime.GetLowerBoundFrameIndex() * m_compressedFrameSize );
+        uint16_t const* pUpperFrameData = m_compressedPoseData.data() + ( frameTime.GetUpperBoundFrameIndex() * m_compressedFrameSize );
+        float const percentageThrough = frameTime.GetPercentageThrough().ToFloat();
+        bool const needsInterpolation = !frameTime.IsExactlyAtKeyFrame();
+
+        // Rotations
+        //-------------------------------------------------------------------------
+
+        int32_t const numRotationTracks = GetNumTracksForLOD( m_dynamicRotationBoneIndices, numBones );
+        if ( numRotationTracks > 0 )
         {
-            uint16_t const* pReadPtr = m_compressedPoseData2.data() + m_compressedPoseOffsets[poseIdx];
+            static Vector const vSignMask( -0.0f );
+
+            FastSlerpCoefficients const coefficientsT( percentageThrough );
+            FastSlerpCoefficients const coefficientsD( 1.0f - percentageThrough );
 
-            // Read rotations
-            for ( auto i = 0; i < numBones; i++ )
+            int32_t const numGroups = GetNumTrackGroups( numRotationTracks );
+            for ( int32_t groupIdx = 0; groupIdx < numGroups; groupIdx++ )
             {
-                TrackCompressionSettings const& trackSettings = m_trackCompressionSettings[i];
-                if ( trackSettings.IsRotationTrackStatic() )
+                int32_t const dataOffset = groupIdx * s_rotationGroupDataSize;
+
+                Vector x, y, z, w;
+                Quantization::EncodedQuaternion::DecodeSoA( pLowerFrameData + dataOffset, x, y, z, w );
+
+                if ( needsInterpolation )
                 {
-                    Transform::DirectlySetRotation( outTransforms[i], trackSettings.GetStaticRotationValue() );
+                    Vector x1, y1, z1, w1;
+                    Quantization::EncodedQuaternion::DecodeSoA( pUpperFrameData + dataOffset, x1, y1, z1, w1 );
+
+                    // Ensure we take the shortest path
+                    Vector const dot = ( x * x1 ) + ( y * y1 ) + ( z * z1 ) + ( w * w1 );
+                    Vector const sign = _mm_and_ps( vSignMask, dot );
+                    x1 = _mm_xor_ps( sign, x1 );
+                    y1 = _mm_xor_ps( sign, y1 );
+                    z1 = _mm_xor_ps( sign, z1 );
+                    w1 = _mm_xor_ps( sign, w1 );
+
+                    Vector const xm1 = Vector( _mm_xor_ps( sign, dot ) ) - Vector::One;
+                    Vector const cT = coefficientsT.Calculate( xm1 );
+                    Vector const cD = coefficientsD.Calculate( xm1 );
+
+                    x = Vector::MultiplyAdd( cD, x, cT * x1 );
+                    y = Vector::MultiplyAdd( cD, y, cT * y1 );
+                    z = Vector::MultiplyAdd( cD, z, cT * z1 );
+                    w = Vector::MultiplyAdd( cD, w, cT * w1 );
                 }
-                else
+
+                // Transpose back into per-bone quaternions
+                _MM_TRANSPOSE4_PS( x.m_data, y.m_data, z.m_data, w.m_data );
+                Vector const rotations[s_trackGroupSize] = { x, y, z, w };
+
+                int32_t const trackIdxStart = groupIdx * s_trackGroupSize;
+                int32_t const numTracksInGroup = Math::Min( s_trackGroupSize, numRotationTracks - trackIdxStart );
+                for ( int32_t i = 0; i < numTracksInGroup; i++ )
                 {
-                    Transform::DirectlySetRotation( outTransforms[i], DecodeRotation( pReadPtr ) );
-                    pReadPtr += 3; // Rotations are 48bits (3 x uint16_t)
+                    Transform::DirectlySetRotation( pOutTransforms[m_dynamicRotationBoneIndices[trackIdxStart + i]], Quaternion( rotations[i] ) );
                 }
             }
+        }
+
+        // Translations
+        //-------------------------------------------------------------------------
 
-            // Read translation/scale
-            for ( auto i = 0; i < numBones; i++ )
+        int32_t const rotationDataSize = GetNumTrackGroups( (int32_t) m_dynamicRotationBoneIndices.size() ) * s_rotationGroupDataSize;
+        int32_t const numTranslationTracks = GetNumTracksForLOD( m_dynamicTranslationBoneIndices, numBones );
+        if ( numTranslationTracks > 0 )
+        {
+            int32_t const numGroups = GetNumTrackGroups( numTranslationTracks );
+            for ( int32_t groupIdx = 0; groupIdx < numGroups; groupIdx++ )
             {
-                TrackCompressionSettings const& trackSettings = m_trackCompressionSettings[i];
+                int32_t const dataOffset = rotationDataSize + ( groupIdx * s_translationGroupDataSize );
+                float const* pRanges = m_translationQuantizationRanges.data() + ( groupIdx * s_translationGroupRangeSize );
 
-                Float4 translationScale;
+                // Interpolate the normalized values and then decode once
+                Vector x = DecodeNormalizedValues( pLowerFrameData + dataOffset );
+                Vector y = DecodeNormalizedValues( pLowerFrameData + dataOffset + 4 );
+                Vector z = DecodeNormalizedValues( pLowerFrameData + dataOffset + 8 );
 
-                if ( trackSettings.IsTranslationTrackStatic() )
+                if ( needsInterpolation )
                 {
-                    translationScale = Float4( trackSettings.GetStaticTranslationValue() );
-                }
-                else
-                {
-                    translationScale = DecodeTranslation( pReadPtr, trackSettings );
-                    pReadPtr += 3; // Translations are 48bits (3 x uint16_t)
+                    x = Vector::Lerp( x, DecodeNormalizedValues( pUpperFrameData + dataOffset ), percentageThrough );
+                    y = Vector::Lerp( y, DecodeNormalizedValues( pUpperFrameData + dataOffset + 4 ), percentageThrough );
+                    z = Vector::Lerp( z, DecodeNormalizedValues( pUpperFrameData + dataOffset + 8 ), percentageThrough );
                 }
 
-                if ( trackSettings.IsScaleTrackStatic() )
-                {
-                    translationScale.m_w = trackSettings.GetStaticScaleValue();
-                }
-                else
+                x = Vector::MultiplyAdd( x, _mm_loadu_ps( pRanges + 12 ), _mm_loadu_ps( pRanges ) );
+                y = Vector::MultiplyAdd( y, _mm_loadu_ps( pRanges + 16 ), _mm_loadu_ps( pRanges + 4 ) );
+                z = Vector::MultiplyAdd( z, _mm_loadu_ps( pRanges + 20 ), _mm_loadu_ps( pRanges + 8 ) );
+
+                // Transpose back into per-bone translations
+                Vector unused = Vector::Zero;
+                _MM_TRANSPOSE4_PS( x.m_data, y.m_data, z.m_data, unused.m_data );
+                Vector const translations[s_trackGroupSize] = { x, y, z, unused };
+
+                int32_t const trackIdxStart = groupIdx * s_trackGroupSize;
+                int32_t const numTracksInGroup = Math::Min( s_trackGroupSize, numTranslationTracks - trackIdxStart );
+                for ( int32_t i = 0; i < numTracksInGroup; i++ )
                 {
-                    DecodeScale( pReadPtr, trackSettings );
-                    pReadPtr += 1; // Scales are 16bits (1 x uint16_t)
+                    pOutTransforms[m_dynamicTranslationBoneIndices[trackIdxStart + i]].SetTranslation( translations[i] );
                 }
-
-                Transform::DirectlySetTranslationScale( outTransforms[i], translationScale );
             }
-        };
+        }
 
+        // Scales
         //-------------------------------------------------------------------------
 
-        // Read the lower frame pose into the output pose
-        ReadCompressedPose( frameTime.GetLowerBoundFrameIndex(), pOutPose->m_localTransforms.data() );
-
-        // If we're not exactly at a key frame we need to read the upper frame pose and blend
-        if ( !frameTime.IsExactlyAtKeyFrame() )
+        int32_t const translationDataSize = GetNumTrackGroups( (int32_t) m_dynamicTranslationBoneIndices.size() ) * s_translationGroupDataSize;
+        int32_t const numScaleTracks = GetNumTracksForLOD( m_dynamicScaleBoneIndices, numBones );
+        if ( numScaleTracks > 0 )
         {
-            TInlineVector<Transform, 200> tmpPose;
-            tmpPose.resize( numBones );
-            ReadCompressedPose( frameTime.GetUpperBoundFrameIndex(), tmpPose.data() );
-
-            float const percentageThrough = frameTime.GetPercentageThrough().ToFloat();
-            for ( auto i = 0; i < numBones; i++ )
+            int32_t const numGroups = GetNumTrackGroups( numScaleTracks );
+            for ( int32_t groupIdx = 0; groupIdx < numGroups; groupIdx++ )
             {
-                pOutPose->m_localTransforms[i] = Transform::FastSlerp( pOutPose->m_localTransforms[i], tmpPose[i], percentageThrough );
+                int32_t const dataOffset = rotationDataSize + translationDataSize + ( groupIdx * s_scaleGroupDataSize );
+                float const* pRanges = m_scaleQuantizationRanges.data() + ( groupIdx * s_scaleGroupRangeSize );
+
+                Vector s = DecodeNormalizedValues( pLowerFrameData + dataOffset );
+                if ( needsInterpolation )
+                {
+                    s = Vector::Lerp( s, DecodeNormalizedValues( pUpperFrameData + dataOffset ), percentageThrough );
+                }
+                s = Vector::MultiplyAdd( s, _mm_loadu_ps( pRanges + 4 ), _mm_loadu_ps( pRanges ) );
+
+                alignas( 16 ) float scales[s_trackGroupSize];
+                _mm_store_ps( scales, s );
+
+                int32_t const trackIdxStart = groupIdx * s_trackGroupSize;
+                int32_t const numTracksInGroup = Math::Min( s_trackGroupSize, numScaleTracks - trackIdxStart );
+                for ( int32_t i = 0; i < numTracksInGroup; i++ )
+                {
+                    pOutTransforms[m_dynamicScaleBoneIndices[trackIdxStart + i]].SetScale( scales[i] );
+                }
             }
         }
-
-        // Flag the pose as being set
-        pOutPose->m_state = m_isAdditive ? Pose::State::AdditivePose : Pose::State::Pose;
     }
-}
\ No newline at end of file
+}
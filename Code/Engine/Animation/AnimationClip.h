@@ -18,98 +18,63 @@ namespace EE::Animation
     class Event;
 
     //-------------------------------------------------------------------------
-
-    struct QuantizationRange
-    {
-        EE_SERIALIZE( m_rangeStart, m_rangeLength );
-
-        QuantizationRange() = default;
-
-        QuantizationRange( float start, float length )
-            : m_rangeStart( start )
-            , m_rangeLength( length )
-        {}
-
-        inline bool IsValid() const { return m_rangeLength > 0; }
-
-    public:
-
-        float                                     m_rangeStart = 0;
-        float                                     m_rangeLength = -1;
-    };
-
+    // Animation Clip
     //-------------------------------------------------------------------------
+    // The compressed pose data is stored in a structure-of-arrays layout so that we can decode multiple tracks at once.
+    // Static track values are baked into a static pose, while dynamic tracks are grouped by type and padded to the track group size.
+    // Every frame has the same size, so the data for frame N starts at 'N * m_compressedFrameSize'.
+    //
+    // Frame layout:                [Rotation Groups][Translation Groups][Scale Groups]
+    // Rotation group:              4 x data0, 4 x data1, 4 x data2 (48bit encoded quaternions)
+    // Translation group:           4 x X, 4 x Y, 4 x Z
+    // Scale group:                 4 x S
+    //
+    // Quantization ranges are stored per group, in the same SoA form:
+    // Translation group ranges:    4 x startX, 4 x startY, 4 x startZ, 4 x lengthX, 4 x lengthY, 4 x lengthZ
+    // Scale group ranges:          4 x start, 4 x length
+    //
+    // Events are instantiated in a single allocation grouped by type, and are referenced in start time order by 'm_events'.
+    // A parallel event timeline stores each event's time interval along with the running max end time so that range queries
+    // are two binary searches and a scan of the overlapping candidates, without ever touching the event instances themselves.
 
-    struct TrackCompressionSettings
+    class EE_ENGINE_API AnimationClip : public Resource::IResource
     {
-        EE_SERIALIZE( m_translationRangeX, m_translationRangeY, m_translationRangeZ, m_scaleRange, m_constantRotation, m_isRotationStatic, m_isTranslationStatic, m_isScaleStatic );
+        EE_RESOURCE( 'anim', "Animation Clip" );
+        EE_SERIALIZE( m_skeleton, m_numFrames, m_duration, m_staticPose, m_dynamicRotationBoneIndices, m_dynamicTranslationBoneIndices, m_dynamicScaleBoneIndices, m_translationQuantizationRanges, m_scaleQuantizationRanges, m_compressedPoseData, m_compressedFrameSize, m_rootMotion, m_isAdditive );
 
         friend class AnimationClipCompiler;
+        friend class AnimationClipLoader;
+        friend class AnimationClipBenchmark;
+        friend class AnimationEventQueryTest;
 
     public:
 
-        TrackCompressionSettings() = default;
-
-        // Is the rotation for this track static i.e. a fixed value for the duration of the animation
-        inline bool IsRotationTrackStatic() const { return m_isRotationStatic; }
-
-        EE_FORCE_INLINE Quaternion GetStaticRotationValue() const { return m_constantRotation; }
-
-        // Is the translation for this track static i.e. a fixed value for the duration of the animation
-        inline bool IsTranslationTrackStatic() const { return m_isTranslationStatic; }
-
-        EE_FORCE_INLINE Float3 GetStaticTranslationValue() const { return Float3( m_translationRangeX.m_rangeStart, m_translationRangeY.m_rangeStart, m_translationRangeZ.m_rangeStart ); }
+        // An event's time interval along with the largest end time of it and all preceding events (which is monotonically increasing)
+        // The event's type and whether it is a duration event are cached so that sampled events can be processed without touching the event instances
+        struct EventInterval
+        {
+            inline FloatRange GetTimeRange() const { return FloatRange( m_startTime, m_endTime ); }
 
-        // Is the scale for this track static i.e. a fixed value for the duration of the animation
-        inline bool IsScaleTrackStatic() const { return m_isScaleStatic; }
+        public:
 
-        EE_FORCE_INLINE float GetStaticScaleValue() const { return m_scaleRange.m_rangeStart; }
+            float                               m_startTime = 0.0f;
+            float                               m_endTime = 0.0f;
+            float                               m_maxEndTime = 0.0f;
+            TypeSystem::TypeID                  m_typeID;
+            bool                                m_isDurationEvent = false;
+        };
 
     public:
 
-        QuantizationRange                       m_translationRangeX;
-        QuantizationRange                       m_translationRangeY;
-        QuantizationRange                       m_translationRangeZ;
-        QuantizationRange                       m_scaleRange;
+        constexpr static int32_t const s_trackGroupSize = 4;
+        constexpr static int32_t const s_rotationGroupDataSize = 3 * s_trackGroupSize;
+        constexpr static int32_t const s_translationGroupDataSize = 3 * s_trackGroupSize;
+        constexpr static int32_t const s_scaleGroupDataSize = s_trackGroupSize;
+        constexpr static int32_t const s_translationGroupRangeSize = 6 * s_trackGroupSize;
+        constexpr static int32_t const s_scaleGroupRangeSize = 2 * s_trackGroupSize;
 
-    private:
-
-        Quaternion                              m_constantRotation;
-        bool                                    m_isRotationStatic = false;
-        bool                                    m_isTranslationStatic = false;
-        bool                                    m_isScaleStatic = false;
-    };
-
-    //-------------------------------------------------------------------------
-
-    class EE_ENGINE_API AnimationClip : public Resource::IResource
-    {
-        EE_RESOURCE( 'anim', "Animation Clip" );
-        EE_SERIALIZE( m_skeleton, m_numFrames, m_duration, m_compressedPoseData2, m_compressedPoseOffsets, m_trackCompressionSettings, m_rootMotion, m_isAdditive );
-
-        friend class AnimationClipCompiler;
-        friend class AnimationClipLoader;
-
-    private:
-
-        EE_FORCE_INLINE static Quaternion DecodeRotation( uint16_t const* pData )
-        {
-            Quantization::EncodedQuaternion const encodedQuat( pData[0], pData[1], pData[2] );
-            return encodedQuat.ToQuaternion();
-        }
-
-        EE_FORCE_INLINE static Vector DecodeTranslation( uint16_t const* pData, TrackCompressionSettings const& settings )
-        {
-            float const m_x = Quantization::DecodeFloat( pData[0], settings.m_translationRangeX.m_rangeStart, settings.m_translationRangeX.m_rangeLength );
-            float const m_y = Quantization::DecodeFloat( pData[1], settings.m_translationRangeY.m_rangeStart, settings.m_translationRangeY.m_rangeLength );
-            float const m_z = Quantization::DecodeFloat( pData[2], settings.m_translationRangeZ.m_rangeStart, settings.m_translationRangeZ.m_rangeLength );
-            return Vector( m_x, m_y, m_z );
-        }
-
-        EE_FORCE_INLINE static float DecodeScale( uint16_t const* pData, TrackCompressionSettings const& settings )
-        {
-            return Quantization::DecodeFloat( pData[0], settings.m_scaleRange.m_rangeStart, settings.m_scaleRange.m_rangeLength );
-        }
+        // Get the number of track groups needed to store the specified number of tracks
+        EE_FORCE_INLINE static int32_t GetNumTrackGroups( int32_t numTracks ) { return ( numTracks + s_trackGroupSize - 1 ) / s_trackGroupSize; }
 
     public:
 
@@ -143,9 +108,27 @@ namespace EE::Animation
         // Events
         //-------------------------------------------------------------------------
 
-        // Get all the events for this animation
+        // Get all the events for this animation, sorted by start time
         inline TVector<Event*> const& GetEvents() const { return m_events; }
 
+        // Get the event and the event interval at the specified index in the start time sorted event list
+        inline Event const* GetEvent( int32_t eventIdx ) const { EE_ASSERT( eventIdx >= 0 && eventIdx < (int32_t) m_events.size() ); return m_events[eventIdx]; }
+        inline EventInterval const& GetEventInterval( int32_t eventIdx ) const { EE_ASSERT( eventIdx >= 0 && eventIdx < (int32_t) m_eventTimeline.size() ); return m_eventTimeline[eventIdx]; }
+
+        // Get the indices of all the events for the specified range. This function will append the results to the output array. Handle's looping but assumes only a single loop occurred!
+        inline void GetEventIndicesForRange( Seconds fromTime, Seconds toTime, TInlineVector<int32_t, 10>& outEventIndices ) const;
+
+        // Get the indices of all the events for the specified range. This function will append the results to the output array. DOES NOT SUPPORT LOOPING!
+        inline void GetEventIndicesForRangeNoLooping( Seconds fromTime, Seconds toTime, TInlineVector<int32_t, 10>& outEventIndices ) const;
+
+        // Helper function that converts percentage times to actual anim times
+        EE_FORCE_INLINE void GetEventIndicesForRange( Percentage fromTime, Percentage toTime, TInlineVector<int32_t, 10>& outEventIndices ) const
+        {
+            EE_ASSERT( fromTime >= 0.0f && fromTime <= 1.0f );
+            EE_ASSERT( toTime >= 0.0f && toTime <= 1.0f );
+            GetEventIndicesForRange( m_duration * fromTime, m_duration * toTime, outEventIndices );
+        }
+
         // Get all the events for the specified range. This function will append the results to the output array. Handle's looping but assumes only a single loop occurred!
         inline void GetEventsForRange( Seconds fromTime, Seconds toTime, TInlineVector<Event const*, 10>& outEvents ) const;
 
@@ -193,15 +176,33 @@ namespace EE::Animation
         // Get the rotation delta for this animation
         EE_FORCE_INLINE Quaternion const& GetRotationDelta() const { return m_rootMotion.m_totalDelta.GetRotation(); }
 
+    private:
+
+        // Build the event timeline from the time sorted events
+        void CreateEventTimeline();
+
+        // Get the range of timeline entries [begin, end) that could overlap the specified range, the caller still needs to reject the ones that end before the range
+        inline void GetEventTimelineCandidates( Seconds fromTime, Seconds toTime, int32_t& outBeginIdx, int32_t& outEndIdx ) const;
+
+        // Decode the local transforms of the first 'numBones' bones for the specified time
+        void DecodePose( FrameTime const& frameTime, int32_t numBones, Transform* pOutTransforms ) const;
+
     private:
 
         TResourcePtr<Skeleton>                  m_skeleton;
         uint32_t                                m_numFrames = 0;
         Seconds                                 m_duration = 0.0f;
-        TVector<uint16_t>                       m_compressedPoseData2;
-        TVector<TrackCompressionSettings>       m_trackCompressionSettings;
-        TVector<uint32_t>                       m_compressedPoseOffsets;
-        TVector<Event*>                         m_events;
+        TVector<Transform>                      m_staticPose;                       // Per-bone local transforms with all the static track values set
+        TVector<uint16_t>                       m_dynamicRotationBoneIndices;       // Sorted bone indices of all the dynamic rotation tracks
+        TVector<uint16_t>                       m_dynamicTranslationBoneIndices;    // Sorted bone indices of all the dynamic translation tracks
+        TVector<uint16_t>                       m_dynamicScaleBoneIndices;          // Sorted bone indices of all the dynamic scale tracks
+        TVector<float>                          m_translationQuantizationRanges;    // SoA quantization ranges for each translation track group
+        TVector<float>                          m_scaleQuantizationRanges;          // SoA quantization ranges for each scale track group
+        TVector<uint16_t>                       m_compressedPoseData;
+        uint32_t                                m_compressedFrameSize = 0;          // The number of uint16_t values per frame
+        TVector<Event*>                         m_events;                           // Sorted by start time
+        TVector<EventInterval>                  m_eventTimeline;                    // The time interval for each event in 'm_events'
+        void*                                   m_pEventMemory = nullptr;           // The single allocation containing all the event instances
         SyncTrack                               m_syncTrack;
         RootMotionData                          m_rootMotion;
         bool                                    m_isAdditive = false;
@@ -215,21 +216,47 @@ namespace EE::Animation
 
 namespace EE::Animation
 {
-    inline void AnimationClip::GetEventsForRangeNoLooping( Seconds fromTime, Seconds toTime, TInlineVector<Event const*, 10>& outEvents ) const
+    inline void AnimationClip::GetEventTimelineCandidates( Seconds fromTime, Seconds toTime, int32_t& outBeginIdx, int32_t& outEndIdx ) const
     {
         EE_ASSERT( toTime >= fromTime );
+        EE_ASSERT( m_eventTimeline.size() == m_events.size() );
+
+        // Skip all events that end before the range, since the max end time is monotonic we can binary search for the first candidate
+        auto const beginIter = eastl::lower_bound( m_eventTimeline.begin(), m_eventTimeline.end(), fromTime.ToFloat(), [] ( EventInterval const& interval, float time ) { return interval.m_maxEndTime < time; } );
+
+        // Events are sorted by start time, so we can binary search for the first event that starts after the range
+        auto const endIter = eastl::upper_bound( beginIter, m_eventTimeline.end(), toTime.ToFloat(), [] ( float time, EventInterval const& interval ) { return time < interval.m_startTime; } );
 
-        for ( auto const& pEvent : m_events )
+        outBeginIdx = (int32_t) ( beginIter - m_eventTimeline.begin() );
+        outEndIdx = (int32_t) ( endIter - m_eventTimeline.begin() );
+    }
+
+    inline void AnimationClip::GetEventsForRangeNoLooping( Seconds fromTime, Seconds toTime, TInlineVector<Event const*, 10>& outEvents ) const
+    {
+        int32_t beginIdx, endIdx;
+        GetEventTimelineCandidates( fromTime, toTime, beginIdx, endIdx );
+
+        // Only the candidates that end before the range (i.e. are contained within a longer preceding event) need to be rejected
+        for ( int32_t i = beginIdx; i < endIdx; i++ )
         {
-            // Events are stored sorted by time so as soon as we reach an event after the end of the time range, we're done
-            if ( pEvent->GetStartTime() > toTime )
+            if ( m_eventTimeline[i].m_endTime >= fromTime )
             {
-                break;
+                outEvents.emplace_back( m_events[i] );
             }
+        }
+    }
 
-            if ( FloatRange( fromTime, toTime ).Overlaps( pEvent->GetTimeRange() ) )
+    inline void AnimationClip::GetEventIndicesForRangeNoLooping( Seconds fromTime, Seconds toTime, TInlineVector<int32_t, 10>& outEventIndices ) const
+    {
+        int32_t beginIdx, endIdx;
+        GetEventTimelineCandidates( fromTime, toTime, beginIdx, endIdx );
+
+        // Only the candidates that end before the range (i.e. are contained within a longer preceding event) need to be rejected
+        for ( int32_t i = beginIdx; i < endIdx; i++ )
+        {
+            if ( m_eventTimeline[i].m_endTime >= fromTime )
             {
-                outEvents.emplace_back( pEvent );
+                outEventIndices.emplace_back( i );
             }
         }
     }
@@ -246,4 +273,17 @@ namespace EE::Animation
             GetEventsForRangeNoLooping( 0, toTime, outEvents );
         }
     }
+
+    EE_FORCE_INLINE void AnimationClip::GetEventIndicesForRange( Seconds fromTime, Seconds toTime, TInlineVector<int32_t, 10>& outEventIndices ) const
+    {
+        if ( fromTime <= toTime )
+        {
+            GetEventIndicesForRangeNoLooping( fromTime, toTime, outEventIndices );
+        }
+        else
+        {
+            GetEventIndicesForRangeNoLooping( fromTime, m_duration, outEventIndices );
+            GetEventIndicesForRangeNoLooping( 0, toTime, outEventIndices );
+        }
+    }
 }
\ No newline at end of file
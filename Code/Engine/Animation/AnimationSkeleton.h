@@ -31,6 +31,7 @@ namespace EE::Animation
 
         friend class SkeletonCompiler;
         friend class SkeletonLoader;
+        friend class BenchmarkSkeletonBuilder;
 
     public:
 
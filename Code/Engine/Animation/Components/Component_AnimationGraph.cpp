@@ -27,6 +27,14 @@ namespace EE::Animation
     void GraphComponent::Shutdown()
     {
         EE::Delete( m_pGraphInstance );
+
+        m_lastEvaluatedRootMotionDelta = Transform::Identity;
+        m_extrapolatedRootMotionDelta = Transform::Identity;
+        m_lastEvaluationDeltaTime = 0.0f;
+        m_timeSinceLastEvaluation = 0.0f;
+        m_framesUntilNextEvaluation = 0;
+        m_wasEvaluationSkipped = false;
+
         EntityComponent::Shutdown();
     }
 
@@ -41,6 +49,20 @@ namespace EE::Animation
 
     //-------------------------------------------------------------------------
 
+    bool GraphComponent::IsParallelTaskExecutionEnabled() const
+    {
+        EE_ASSERT( HasGraphInstance() );
+        return m_pGraphInstance->IsParallelTaskExecutionEnabled();
+    }
+
+    void GraphComponent::EnableParallelTaskExecution( EE::TaskSystem* pTaskSystem )
+    {
+        EE_ASSERT( HasGraphInstance() );
+        m_pGraphInstance->EnableParallelTaskExecution( pTaskSystem );
+    }
+
+    //-------------------------------------------------------------------------
+
     Skeleton const* GraphComponent::GetSkeleton() const
     {
         return ( m_pGraphVariation != nullptr ) ? m_pGraphVariation->GetSkeleton() : nullptr;
@@ -55,10 +77,39 @@ namespace EE::Animation
     {
         EE_ASSERT( HasGraph() );
 
+        // Reduced update rate - hold the last pose and extrapolate the root motion from the last evaluation
+        //-------------------------------------------------------------------------
+
+        m_timeSinceLastEvaluation += deltaTime;
+
+        m_wasEvaluationSkipped = ( m_framesUntilNextEvaluation > 0 ) && !m_graphStateResetRequested;
+        if ( m_wasEvaluationSkipped )
+        {
+            m_framesUntilNextEvaluation--;
+
+            float const percentageOfLastEvaluation = ( m_lastEvaluationDeltaTime > 0.0f ) ? Math::Min( deltaTime / m_lastEvaluationDeltaTime, 1.0f ) : 0.0f;
+            m_rootMotionDelta = Transform::Slerp( Transform::Identity, m_lastEvaluatedRootMotionDelta, percentageOfLastEvaluation );
+            m_extrapolatedRootMotionDelta = m_rootMotionDelta * m_extrapolatedRootMotionDelta;
+
+            // The events from the last evaluation have already been reported
+            m_pGraphInstance->ClearSampledEvents();
+            return;
+        }
+
+        // Evaluate the graph for all the time elapsed since the last evaluation
+        //-------------------------------------------------------------------------
+
         m_pGraphInstance->SetSkeletonLOD( m_skeletonLOD );
-        GraphPoseNodeResult const result = m_pGraphInstance->EvaluateGraph( deltaTime, characterWorldTransform, pPhysicsWorld, nullptr, m_graphStateResetRequested );
+        GraphPoseNodeResult const result = m_pGraphInstance->EvaluateGraph( m_timeSinceLastEvaluation, characterWorldTransform, pPhysicsWorld, nullptr, m_graphStateResetRequested );
         m_graphStateResetRequested = false;
-        m_rootMotionDelta = result.m_rootMotionDelta;
+
+        // Remove the root motion that we already applied via extrapolation
+        m_rootMotionDelta = result.m_rootMotionDelta * m_extrapolatedRootMotionDelta.GetInverse();
+        m_lastEvaluatedRootMotionDelta = result.m_rootMotionDelta;
+        m_lastEvaluationDeltaTime = m_timeSinceLastEvaluation;
+        m_extrapolatedRootMotionDelta = Transform::Identity;
+        m_timeSinceLastEvaluation = 0.0f;
+        m_framesUntilNextEvaluation = m_updateInterval - 1;
 
         #if EE_DEVELOPMENT_TOOLS
         m_pGraphInstance->OutputLog();
@@ -68,15 +119,32 @@ namespace EE::Animation
     void GraphComponent::ExecutePrePhysicsTasks( Seconds deltaTime, Transform const& characterWorldTransform )
     {
         EE_ASSERT( HasGraph() );
+        if ( m_wasEvaluationSkipped )
+        {
+            return;
+        }
+
         m_pGraphInstance->ExecutePrePhysicsPoseTasks( characterWorldTransform );
     }
 
     void GraphComponent::ExecutePostPhysicsTasks()
     {
         EE_ASSERT( HasGraph() );
+        if ( m_wasEvaluationSkipped )
+        {
+            return;
+        }
+
         m_pGraphInstance->ExecutePostPhysicsPoseTasks();
     }
 
+    void GraphComponent::SetUpdateInterval( uint8_t updateInterval )
+    {
+        EE_ASSERT( updateInterval > 0 );
+        m_updateInterval = updateInterval;
+        m_framesUntilNextEvaluation = Math::Min( m_framesUntilNextEvaluation, uint8_t( m_updateInterval - 1 ) );
+    }
+
     //-------------------------------------------------------------------------
 
     #if EE_DEVELOPMENT_TOOLS
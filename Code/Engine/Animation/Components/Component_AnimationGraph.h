@@ -34,6 +34,12 @@ namespace EE::Animation
         // Does this component require a manual update via a custom entity system?
         inline bool RequiresManualUpdate() const { return m_requiresManualUpdate; }
 
+        // Is this graph updated by the animation world system as part of the batched update of all characters, rather than by the entity's animation system
+        inline bool UsesBatchedUpdate() const { return m_useBatchedUpdate && !m_requiresManualUpdate; }
+
+        // Is the skeleton LOD and update rate for this graph assigned by the animation world system based on the character's significance
+        inline bool UsesSignificanceBasedUpdate() const { return m_useSignificanceBasedUpdate && !m_requiresManualUpdate; }
+
         // Should we apply the root motion delta automatically to the character once we evaluate the graph 
         // (Note: only works if we dont require a manual update)
         inline bool ShouldApplyRootMotionToEntity() const { return m_applyRootMotionToEntity; }
@@ -44,6 +50,15 @@ namespace EE::Animation
         // Gets the root motion delta for the last update (Note: this delta is in character space!)
         inline Transform const& GetRootMotionDelta() const { return m_rootMotionDelta; }
 
+        // Should the pose tasks for this graph be executed in parallel on the engine task system
+        inline bool ShouldExecuteTasksInParallel() const { return m_executeTasksInParallel; }
+
+        // Is parallel pose task execution currently enabled
+        bool IsParallelTaskExecutionEnabled() const;
+
+        // Enable parallel execution of the pose tasks on the supplied task system
+        void EnableParallelTaskExecution( EE::TaskSystem* pTaskSystem );
+
         // Get the graph variation ID
         inline ResourceID const& GetGraphVariationID() const { return m_pGraphVariation.GetResourceID(); }
 
@@ -65,6 +80,17 @@ namespace EE::Animation
         // This function will reset the current graph state
         void ResetGraphState() { m_graphStateResetRequested = true; }
 
+        // Set how often the graph is evaluated (every N frames), on the frames in between the last pose is held and the root motion is extrapolated
+        // Note: Sampled events are only updated when the graph is evaluated, the evaluation will sample all events for the time elapsed since the last evaluation
+        // Note: No events are reported for frames where the evaluation is skipped
+        void SetUpdateInterval( uint8_t updateInterval );
+
+        // Get the number of frames between graph evaluations
+        inline uint8_t GetUpdateInterval() const { return m_updateInterval; }
+
+        // Was the graph evaluation skipped this frame due to the update interval
+        inline bool WasEvaluationSkipped() const { return m_wasEvaluationSkipped; }
+
         // This function will evaluate the graph and produce the desired root motion delta for the character
         void EvaluateGraph( Seconds deltaTime, Transform const& characterWorldTransform, Physics::PhysicsWorld* pPhysicsWorld );
 
@@ -148,6 +174,18 @@ namespace EE::Animation
         Skeleton::LOD                                           m_skeletonLOD = Skeleton::LOD::High;
         EE_REFLECT() bool                                       m_requiresManualUpdate = false; // Does this component require a manual update via a custom entity system?
         EE_REFLECT() bool                                       m_applyRootMotionToEntity = false; // Should we apply the root motion delta automatically to the character once we evaluate the graph. (Note: only works if we dont require a manual update)
+        EE_REFLECT() bool                                       m_useBatchedUpdate = false; // Should this graph be updated together with all other characters by the animation world system. (Note: ignored for manually updated graphs, the final pose is only available once the world systems have updated)
+        EE_REFLECT() bool                                       m_executeTasksInParallel = false; // Should independent pose tasks be executed in parallel. Only worth it for large graphs with many independent branches
+        EE_REFLECT() bool                                       m_useSignificanceBasedUpdate = false; // Should the animation world system set the skeleton LOD and update rate based on the character's screen size. (Note: ignored for manually updated graphs)
         bool                                                    m_graphStateResetRequested = false;
+
+        // Update rate
+        Transform                                               m_lastEvaluatedRootMotionDelta = Transform::Identity; // The root motion delta produced by the last graph evaluation
+        Transform                                               m_extrapolatedRootMotionDelta = Transform::Identity; // The root motion we've extrapolated since the last graph evaluation
+        Seconds                                                 m_lastEvaluationDeltaTime = 0.0f;
+        Seconds                                                 m_timeSinceLastEvaluation = 0.0f;
+        uint8_t                                                 m_updateInterval = 1;
+        uint8_t                                                 m_framesUntilNextEvaluation = 0;
+        bool                                                    m_wasEvaluationSkipped = false;
     };
 }
\ No newline at end of file
@@ -508,6 +508,30 @@ namespace EE::Animation
 
     void AnimationDebugView::DrawMenu( EntityWorldUpdateContext const& context )
     {
+        if ( ImGui::BeginMenu( "Significance" ) )
+        {
+            bool isSchedulingEnabled = m_pAnimationWorldSystem->IsSignificanceSchedulingEnabled();
+            if ( ImGui::Checkbox( "Enable Significance Scheduling", &isSchedulingEnabled ) )
+            {
+                m_pAnimationWorldSystem->SetSignificanceSchedulingEnabled( isSchedulingEnabled );
+            }
+
+            ImGuiX::TextSeparator( "Buckets" );
+
+            constexpr static char const* const bucketNames[] = { "High", "Medium", "Low", "Minimal" };
+            static_assert( sizeof( bucketNames ) / sizeof( bucketNames[0] ) == (uint8_t) AnimationWorldSystem::SignificanceBucket::NumBuckets );
+
+            for ( uint8_t i = 0; i < (uint8_t) AnimationWorldSystem::SignificanceBucket::NumBuckets; i++ )
+            {
+                auto const& stats = m_pAnimationWorldSystem->GetSignificanceBucketStats( (AnimationWorldSystem::SignificanceBucket) i );
+                ImGui::Text( "%s: %d characters, %d evaluated, %d skipped", bucketNames[i], stats.m_numCharacters, stats.m_numEvaluatedGraphs, stats.m_numSkippedGraphs );
+            }
+
+            ImGui::EndMenu();
+        }
+
+        //-------------------------------------------------------------------------
+
         InlineString componentName;
         for ( GraphComponent* pGraphComponent : m_pAnimationWorldSystem->m_graphComponents )
         {
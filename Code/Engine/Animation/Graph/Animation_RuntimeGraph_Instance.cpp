@@ -6,6 +6,7 @@
 #include "Base/Profiling.h"
 #include "Engine/Animation/TaskSystem/Animation_TaskSystem.h"
 #include "Engine/Animation/TaskSystem/Animation_TaskSerializer.h"
+#include "Engine/Physics/PhysicsWorld.h"
 
 //-------------------------------------------------------------------------
 
@@ -211,6 +212,21 @@ namespace EE::Animation
         m_pTaskSystem->DisableSerialization();
     }
 
+    void GraphInstance::EnableParallelTaskExecution( EE::TaskSystem* pTaskSystem )
+    {
+        m_pTaskSystem->EnableParallelExecution( pTaskSystem );
+    }
+
+    void GraphInstance::DisableParallelTaskExecution()
+    {
+        m_pTaskSystem->DisableParallelExecution();
+    }
+
+    bool GraphInstance::IsParallelTaskExecutionEnabled() const
+    {
+        return m_pTaskSystem->IsParallelExecutionEnabled();
+    }
+
     void GraphInstance::SerializeTaskList( Blob& outBlob ) const
     {
         EE_ASSERT( !DoesTaskSystemNeedUpdate() );
@@ -432,6 +448,13 @@ namespace EE::Animation
     void GraphInstance::ExecutePostPhysicsPoseTasks()
     {
         EE_PROFILE_SCOPE_ANIMATION( "Graph Instance: Post-Physics Tasks" );
+
+        // Physics dependent tasks need the results of the current step, so make sure the simulation has completed before we run them
+        if ( m_pTaskSystem->HasPhysicsDependency() && m_graphContext.m_pPhysicsWorld != nullptr )
+        {
+            m_graphContext.m_pPhysicsWorld->WaitForSimulationToComplete();
+        }
+
         m_pTaskSystem->UpdatePostPhysics();
 
         #if EE_DEVELOPMENT_TOOLS
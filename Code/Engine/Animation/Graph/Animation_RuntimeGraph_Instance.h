@@ -6,6 +6,11 @@
 
 //-------------------------------------------------------------------------
 
+namespace EE
+{
+    class TaskSystem;
+}
+
 namespace EE::Physics
 {
     class PhysicsWorld;
@@ -100,6 +105,15 @@ namespace EE::Animation
         // Disable task serialization
         void DisableTaskSystemSerialization();
 
+        // Enable parallel execution of the pose tasks on the supplied task system
+        void EnableParallelTaskExecution( EE::TaskSystem* pTaskSystem );
+
+        // Disable parallel execution of the pose tasks
+        void DisableParallelTaskExecution();
+
+        // Are the pose tasks executed in parallel
+        bool IsParallelTaskExecutionEnabled() const;
+
         // Does the task system have any pending pose tasks
         bool DoesTaskSystemNeedUpdate() const;
 
@@ -140,6 +154,9 @@ namespace EE::Animation
         // Get the sampled events for the last update
         SampledEventsBuffer const& GetSampledEvents() const { return m_graphContext.m_sampledEventsBuffer; }
 
+        // Clear the sampled events, used when skipping an update so that the events from the last update are not reported again
+        inline void ClearSampledEvents() { m_graphContext.m_sampledEventsBuffer.Clear(); }
+
         // General Node Info
         //-------------------------------------------------------------------------
 
@@ -188,31 +188,36 @@ namespace EE::Animation::GraphNodes
         Percentage actualAnimationSampleEndTime = m_currentTime;
 
         // Invert times and swap the start and end times to create the correct sampling range for events
-        TInlineVector<Event const*, 10> sampledAnimationEvents;
+        TInlineVector<int32_t, 10> sampledEventIndices;
         if ( m_shouldPlayInReverse )
         {
             actualAnimationSampleEndTime = 1.0f - m_currentTime;
             actualAnimationSampleStartTime = 1.0f - m_previousTime;
-            m_pAnimation->GetEventsForRange( actualAnimationSampleEndTime, actualAnimationSampleStartTime, sampledAnimationEvents );
+            m_pAnimation->GetEventIndicesForRange( actualAnimationSampleEndTime, actualAnimationSampleStartTime, sampledEventIndices );
         }
         else
         {
-            m_pAnimation->GetEventsForRange( actualAnimationSampleStartTime, actualAnimationSampleEndTime, sampledAnimationEvents );
+            m_pAnimation->GetEventIndicesForRange( actualAnimationSampleStartTime, actualAnimationSampleEndTime, sampledEventIndices );
         }
 
         // Snap to frame settings
         bool shouldSnapToFrame = false;
         SnapToFrameEvent::SelectionMode frameSelectionMode = SnapToFrameEvent::SelectionMode::Floor;
 
-        // Post-process sampled events
-        for ( auto pEvent : sampledAnimationEvents )
+        // Post-process sampled events, the event intervals contain everything we need so the event instances are only touched for snap to frame events
+        TypeSystem::TypeID const snapToFrameEventTypeID = SnapToFrameEvent::GetStaticTypeID();
+        Seconds const currentAnimTimeSeconds( m_pAnimation->GetDuration() * actualAnimationSampleEndTime.ToFloat() );
+
+        for ( int32_t const eventIdx : sampledEventIndices )
         {
+            AnimationClip::EventInterval const& eventInterval = m_pAnimation->GetEventInterval( eventIdx );
+            Event const* pEvent = m_pAnimation->GetEvent( eventIdx );
+
             Percentage percentageThroughEvent = 1.0f;
 
-            if ( pEvent->IsDurationEvent() )
+            if ( eventInterval.m_isDurationEvent )
             {
-                Seconds const currentAnimTimeSeconds( m_pAnimation->GetDuration() * actualAnimationSampleEndTime.ToFloat() );
-                percentageThroughEvent = pEvent->GetTimeRange().GetPercentageThroughClamped( currentAnimTimeSeconds );
+                percentageThroughEvent = eventInterval.GetTimeRange().GetPercentageThroughClamped( currentAnimTimeSeconds );
                 EE_ASSERT( percentageThroughEvent <= 1.0f );
 
                 if ( m_shouldPlayInReverse )
@@ -221,10 +226,10 @@ namespace EE::Animation::GraphNodes
                 }
             }
 
-            if ( auto pSnapFrameEvent = TryCast<SnapToFrameEvent>( pEvent ) )
+            if ( eventInterval.m_typeID == snapToFrameEventTypeID )
             {
                 shouldSnapToFrame = true;
-                frameSelectionMode = pSnapFrameEvent->GetFrameSelectionMode();
+                frameSelectionMode = static_cast<SnapToFrameEvent const*>( pEvent )->GetFrameSelectionMode();
             }
 
             context.m_sampledEventsBuffer.EmplaceAnimationEvent( GetNodeIndex(), pEvent, percentageThroughEvent, isFromActiveBranch );
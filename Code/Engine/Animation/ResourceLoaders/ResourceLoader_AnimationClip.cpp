@@ -2,6 +2,7 @@
 #include "Engine/Animation/AnimationClip.h"
 #include "Base/TypeSystem/TypeDescriptors.h"
 #include "Base/Serialization/BinarySerialization.h"
+#include <eastl/sort.h>
 
 //-------------------------------------------------------------------------
 
@@ -39,8 +40,45 @@ namespace EE::Animation
         TypeSystem::TypeDescriptorCollection collectionDesc;
         archive << collectionDesc;
 
-        collectionDesc.CalculateCollectionRequirements( *m_pTypeRegistry );
-        TypeSystem::TypeDescriptorCollection::InstantiateStaticCollection( *m_pTypeRegistry, collectionDesc, pAnimation->m_events );
+        int32_t const numEvents = (int32_t) collectionDesc.m_descriptors.size();
+        if ( numEvents > 0 )
+        {
+            // The events are compiled sorted by start time, reorder the descriptors so that the instances are grouped by type in memory
+            TVector<int32_t> eventTimeOrder( numEvents );
+            for ( int32_t i = 0; i < numEvents; i++ )
+            {
+                eventTimeOrder[i] = i;
+            }
+
+            auto sortPredicate = [&collectionDesc] ( int32_t const& idxA, int32_t const& idxB )
+            {
+                return (uint32_t) collectionDesc.m_descriptors[idxA].m_typeID < (uint32_t) collectionDesc.m_descriptors[idxB].m_typeID;
+            };
+
+            eastl::stable_sort( eventTimeOrder.begin(), eventTimeOrder.end(), sortPredicate );
+
+            TVector<TypeSystem::TypeDescriptor> descriptorsGroupedByType;
+            descriptorsGroupedByType.reserve( numEvents );
+            for ( int32_t i = 0; i < numEvents; i++ )
+            {
+                descriptorsGroupedByType.emplace_back( eastl::move( collectionDesc.m_descriptors[eventTimeOrder[i]] ) );
+            }
+            collectionDesc.m_descriptors.swap( descriptorsGroupedByType );
+
+            // Instantiate all events in a single allocation
+            TVector<Event*> eventsGroupedByType;
+            collectionDesc.CalculateCollectionRequirements( *m_pTypeRegistry );
+            pAnimation->m_pEventMemory = TypeSystem::TypeDescriptorCollection::InstantiateStaticCollection( *m_pTypeRegistry, collectionDesc, eventsGroupedByType );
+
+            // Restore the time order
+            pAnimation->m_events.resize( numEvents );
+            for ( int32_t i = 0; i < numEvents; i++ )
+            {
+                pAnimation->m_events[eventTimeOrder[i]] = eventsGroupedByType[i];
+            }
+        }
+
+        pAnimation->CreateEventTimeline();
 
         return true;
     }
@@ -50,10 +88,17 @@ namespace EE::Animation
         auto pAnimation = pResourceRecord->GetResourceData<AnimationClip>();
         if ( pAnimation != nullptr )
         {
-            // Release allocated events collection
-            if ( !pAnimation->m_events.empty() )
+            // Release allocated events collection, the events are not in memory order so we cant use 'DestroyStaticCollection'
+            if ( pAnimation->m_pEventMemory != nullptr )
             {
-                TypeSystem::TypeDescriptorCollection::DestroyStaticCollection( pAnimation->m_events );
+                for ( auto pEvent : pAnimation->m_events )
+                {
+                    pEvent->~Event();
+                }
+
+                EE::Free( pAnimation->m_pEventMemory );
+                pAnimation->m_events.clear();
+                pAnimation->m_eventTimeline.clear();
             }
         }
 
@@ -5,6 +5,7 @@
 #include "Engine/Physics/Systems/WorldSystem_Physics.h"
 #include "Engine/Entity/EntityWorldUpdateContext.h"
 #include "Engine/Animation/AnimationPose.h"
+#include "Base/Threading/TaskSystem.h"
 #include "Base/Profiling.h"
 
 
@@ -109,11 +110,30 @@ namespace EE::Animation
                     continue;
                 }
 
+                // Meshes posed by a batched graph are finalized by the animation world system once their pose has been set
+                if ( IsDrivenByBatchedGraph( pMeshComponent ) )
+                {
+                    continue;
+                }
+
                 pMeshComponent->FinalizePose();
             }
         }
     }
 
+    bool AnimationSystem::IsDrivenByBatchedGraph( Render::SkeletalMeshComponent const* pMeshComponent ) const
+    {
+        for ( auto pAnimComponent : m_animGraphs )
+        {
+            if ( pAnimComponent->HasGraph() && pAnimComponent->UsesBatchedUpdate() && pAnimComponent->GetSkeleton() == pMeshComponent->GetSkeleton() )
+            {
+                return true;
+            }
+        }
+
+        return false;
+    }
+
     void AnimationSystem::UpdateAnimPlayers( EntityWorldUpdateContext const& ctx, Transform const& characterWorldTransform )
     {
         UpdateStage const updateStage = ctx.GetUpdateStage();
@@ -176,11 +196,17 @@ namespace EE::Animation
 
             for ( auto pAnimComponent : m_animGraphs )
             {
-                if ( !pAnimComponent->HasGraph() )
+                if ( !pAnimComponent->HasGraph() || pAnimComponent->UsesBatchedUpdate() )
                 {
                     continue;
                 }
 
+                // Parallel task execution requires the engine task system, so we enable it here on the first update
+                if ( pAnimComponent->ShouldExecuteTasksInParallel() && !pAnimComponent->IsParallelTaskExecutionEnabled() )
+                {
+                    pAnimComponent->EnableParallelTaskExecution( ctx.GetSystem<EE::TaskSystem>() );
+                }
+
                 if ( !pAnimComponent->RequiresManualUpdate() )
                 {
                     // Evaluate the graph nodes and calculate the root motion delta
@@ -208,7 +234,7 @@ namespace EE::Animation
         {
             for ( auto pAnimComponent : m_animGraphs )
             {
-                if ( !pAnimComponent->HasGraph() )
+                if ( !pAnimComponent->HasGraph() || pAnimComponent->UsesBatchedUpdate() )
                 {
                     continue;
                 }
@@ -42,6 +42,9 @@ namespace EE::Animation
         void UpdateAnimPlayers( EntityWorldUpdateContext const& ctx, Transform const& characterWorldTransform );
         void UpdateAnimGraphs( EntityWorldUpdateContext const& ctx, Transform const& characterWorldTransform );
 
+        // Is this mesh posed by a graph that is updated by the batched update in the animation world system
+        bool IsDrivenByBatchedGraph( Render::SkeletalMeshComponent const* pMeshComponent ) const;
+
     private:
 
         TVector<AnimationClipPlayerComponent*>          m_animPlayers;
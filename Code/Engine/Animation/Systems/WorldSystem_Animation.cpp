@@ -1,15 +1,69 @@
 #include "WorldSystem_Animation.h"
 #include "Engine/Animation/Components/Component_AnimationGraph.h"
+#include "Engine/Animation/AnimationPose.h"
+#include "Engine/Render/Components/Component_SkeletalMesh.h"
+#include "Engine/Physics/Systems/WorldSystem_Physics.h"
 #include "Engine/Entity/EntityWorldUpdateContext.h"
+#include "Engine/Entity/Entity.h"
+#include "Base/Render/RenderViewport.h"
+#include "Base/Threading/TaskSystem.h"
 #include "Base/Drawing/DebugDrawing.h"
+#include "Base/Profiling.h"
+#include "EASTL/sort.h"
 
 //-------------------------------------------------------------------------
 
 namespace EE::Animation
 {
+    namespace
+    {
+        // Used when the character has no valid bounds
+        constexpr static float const g_defaultCharacterHeight = 2.0f;
+
+        // Get the projected height of a character as a percentage of the viewport height
+        static float CalculateProjectedScreenHeight( Render::Viewport const* pViewport, Entity const* pEntity )
+        {
+            OBB const& bounds = pEntity->GetRootSpatialComponentWorldBounds();
+            AABB const aabb = bounds.GetAABB();
+            float const boundingDiameter = ( aabb.GetExtents().GetLength3() > 0.0f ) ? 2.0f * aabb.GetExtents().GetLength3() : g_defaultCharacterHeight;
+
+            Math::ViewVolume const& viewVolume = pViewport->GetViewVolume();
+            if ( !viewVolume.Contains( aabb ) )
+            {
+                return 0.0f;
+            }
+
+            if ( viewVolume.IsOrthographic() )
+            {
+                return boundingDiameter / viewVolume.GetViewDimensions().m_y;
+            }
+
+            // Characters that intersect the near plane are treated as filling the screen
+            float const depth = pViewport->GetViewForwardDirection().GetDot3( aabb.GetCenter() - pViewport->GetViewPosition() );
+            if ( depth <= viewVolume.GetDepthRange().m_begin )
+            {
+                return 1.0f;
+            }
+
+            float const visibleHeightAtDepth = 2.0f * depth * Math::Tan( viewVolume.GetVerticalFOV().ToFloat() / 2.0f );
+            return boundingDiameter / visibleHeightAtDepth;
+        }
+    }
+
+    //-------------------------------------------------------------------------
+
+    bool AnimationWorldSystem::BatchedCharacter::IsInSpatialHierarchy() const
+    {
+        return m_pEntity->HasSpatialParent() || m_pEntity->HasAttachedEntities();
+    }
+
+    //-------------------------------------------------------------------------
+
     void AnimationWorldSystem::ShutdownSystem()
     {
         EE_ASSERT( m_graphComponents.empty() );
+        EE_ASSERT( m_batchedCharacters.empty() );
+        EE_ASSERT( m_significanceScheduledGraphs.empty() );
     }
 
     void AnimationWorldSystem::RegisterComponent( Entity const* pEntity, EntityComponent* pComponent )
@@ -17,6 +71,56 @@ namespace EE::Animation
         if ( auto pGraphComponent = TryCast<GraphComponent>( pComponent ) )
         {
             m_graphComponents.Add( pGraphComponent );
+
+            if ( pGraphComponent->HasGraph() && pGraphComponent->UsesSignificanceBasedUpdate() )
+            {
+                m_significanceScheduledGraphs.Emplace( pGraphComponent->GetID(), pGraphComponent->GetID(), pEntity, pGraphComponent );
+            }
+
+            // Create the batched character, we need to find all the relevant components that have already been registered
+            if ( pGraphComponent->HasGraph() && pGraphComponent->UsesBatchedUpdate() )
+            {
+                EE_ASSERT( !m_batchedCharacters.HasItemForID( pEntity->GetID() ) ); // Only a single batched graph per entity is supported
+                auto pCharacter = m_batchedCharacters.Emplace( pEntity->GetID(), pEntity->GetID(), pEntity, pGraphComponent );
+
+                for ( auto pEntityComponent : pEntity->GetComponents() )
+                {
+                    if ( !pEntityComponent->IsInitialized() )
+                    {
+                        continue;
+                    }
+
+                    if ( auto pMeshComponent = TryCast<Render::SkeletalMeshComponent>( pEntityComponent ) )
+                    {
+                        pCharacter->m_meshComponents.emplace_back( pMeshComponent );
+                    }
+                    else if ( auto pSpatialComponent = TryCast<SpatialEntityComponent>( pEntityComponent ) )
+                    {
+                        if ( pSpatialComponent->IsRootComponent() )
+                        {
+                            pCharacter->m_pRootComponent = pSpatialComponent;
+                        }
+                    }
+                }
+            }
+        }
+        else if ( auto pMeshComponent = TryCast<Render::SkeletalMeshComponent>( pComponent ) )
+        {
+            if ( auto pCharacter = m_batchedCharacters.FindItem( pEntity->GetID() ) )
+            {
+                VectorEmplaceBackUnique( pCharacter->m_meshComponents, pMeshComponent );
+            }
+        }
+
+        //-------------------------------------------------------------------------
+
+        auto pSpatialComponent = TryCast<SpatialEntityComponent>( pComponent );
+        if ( pSpatialComponent != nullptr && pSpatialComponent->IsRootComponent() )
+        {
+            if ( auto pCharacter = m_batchedCharacters.FindItem( pEntity->GetID() ) )
+            {
+                pCharacter->m_pRootComponent = pSpatialComponent;
+            }
         }
     }
 
@@ -25,17 +129,364 @@ namespace EE::Animation
         if ( auto pGraphComponent = TryCast<GraphComponent>( pComponent ) )
         {
             m_graphComponents.Remove( pGraphComponent->GetID() );
+
+            if ( m_significanceScheduledGraphs.HasItemForID( pGraphComponent->GetID() ) )
+            {
+                m_significanceScheduledGraphs.Remove( pGraphComponent->GetID() );
+            }
+
+            auto pCharacter = m_batchedCharacters.FindItem( pEntity->GetID() );
+            if ( pCharacter != nullptr && pCharacter->m_pGraphComponent == pGraphComponent )
+            {
+                m_batchedCharacters.Remove( pEntity->GetID() );
+            }
+        }
+        else if ( auto pMeshComponent = TryCast<Render::SkeletalMeshComponent>( pComponent ) )
+        {
+            if ( auto pCharacter = m_batchedCharacters.FindItem( pEntity->GetID() ) )
+            {
+                pCharacter->m_meshComponents.erase_first( pMeshComponent );
+            }
+        }
+
+        //-------------------------------------------------------------------------
+
+        if ( auto pCharacter = m_batchedCharacters.FindItem( pEntity->GetID() ) )
+        {
+            if ( pCharacter->m_pRootComponent == pComponent )
+            {
+                pCharacter->m_pRootComponent = nullptr;
+            }
         }
     }
 
+    //-------------------------------------------------------------------------
+
+    WorldSystemAccess AnimationWorldSystem::GetUpdateAccess() const
+    {
+        // Graphs query the physics world, apply root motion to the character root components and set the skeletal mesh poses
+        WorldSystemAccess access;
+        access.Reads<Physics::PhysicsWorldSystem>().Writes<GraphComponent>().Writes<SpatialEntityComponent>();
+        return access;
+    }
+
     void AnimationWorldSystem::UpdateSystem( EntityWorldUpdateContext const& ctx )
     {
-        #if EE_DEVELOPMENT_TOOLS
-        Drawing::DrawContext drawingCtx = ctx.GetDrawingContext();
-        for ( auto pComponent : m_graphComponents )
+        switch ( ctx.GetUpdateStage() )
+        {
+            case UpdateStage::FrameStart:
+            {
+                UpdateSignificance( ctx );
+            }
+            break;
+
+            case UpdateStage::PrePhysics:
+            {
+                UpdateBatchedCharactersPrePhysics( ctx );
+            }
+            break;
+
+            case UpdateStage::PostPhysics:
+            {
+                UpdateBatchedCharactersPostPhysics( ctx );
+            }
+            break;
+
+            default:
+            {
+                #if EE_DEVELOPMENT_TOOLS
+                if ( ctx.GetUpdateStage() == UpdateStage::FrameEnd )
+                {
+                    UpdateSignificanceStats();
+                }
+
+                Drawing::DrawContext drawingCtx = ctx.GetDrawingContext();
+                for ( auto pComponent : m_graphComponents )
+                {
+                    pComponent->DrawDebug( drawingCtx );
+                }
+                #endif
+            }
+            break;
+        }
+    }
+
+    //-------------------------------------------------------------------------
+
+    void AnimationWorldSystem::UpdateBatchedCharactersPrePhysics( EntityWorldUpdateContext const& ctx )
+    {
+        EE_PROFILE_SCOPE_ANIMATION( "Batched Animation Update: Pre-Physics" );
+
+        if ( m_batchedCharacters.empty() )
+        {
+            return;
+        }
+
+        //-------------------------------------------------------------------------
+
+        struct PrePhysicsUpdateTask final : public ITaskSet
+        {
+            PrePhysicsUpdateTask( TIDVector<EntityID, BatchedCharacter>& characters, Seconds deltaTime, Physics::PhysicsWorld* pPhysicsWorld, EE::TaskSystem* pTaskSystem )
+                : m_characters( characters )
+                , m_deltaTime( deltaTime )
+                , m_pPhysicsWorld( pPhysicsWorld )
+                , m_pTaskSystem( pTaskSystem )
+            {
+                m_SetSize = (uint32_t) characters.size();
+            }
+
+            // Evaluate the graph, apply the root motion and run all pre-physics tasks - this mirrors the per-entity animation system update
+            void UpdateCharacter( BatchedCharacter& character ) const
+            {
+                GraphComponent* pGraphComponent = character.m_pGraphComponent;
+                if ( pGraphComponent->ShouldExecuteTasksInParallel() && !pGraphComponent->IsParallelTaskExecutionEnabled() )
+                {
+                    pGraphComponent->EnableParallelTaskExecution( m_pTaskSystem );
+                }
+
+                Transform const characterWorldTransform = character.m_meshComponents.empty() ? Transform::Identity : character.m_meshComponents[0]->GetWorldTransform();
+                pGraphComponent->EvaluateGraph( m_deltaTime, characterWorldTransform, m_pPhysicsWorld );
+
+                Transform adjustedCharacterTransform = characterWorldTransform;
+                if ( character.m_pRootComponent != nullptr && pGraphComponent->ShouldApplyRootMotionToEntity() )
+                {
+                    Transform const& rootMotionDelta = pGraphComponent->GetRootMotionDelta();
+                    character.m_pRootComponent->SetWorldTransform( rootMotionDelta * character.m_pRootComponent->GetWorldTransform() );
+                    adjustedCharacterTransform = rootMotionDelta * characterWorldTransform;
+                }
+
+                pGraphComponent->ExecutePrePhysicsTasks( m_deltaTime, adjustedCharacterTransform );
+            }
+
+            virtual void ExecuteRange( TaskSetPartition range, uint32_t threadnum ) override final
+            {
+                for ( uint64_t i = range.start; i < range.end; ++i )
+                {
+                    // Characters in spatial hierarchies are updated serially afterwards since moving them affects other entities
+                    BatchedCharacter& character = m_characters[(int32_t) i];
+                    if ( !character.IsInSpatialHierarchy() )
+                    {
+                        UpdateCharacter( character );
+                    }
+                }
+            }
+
+        public:
+
+            TIDVector<EntityID, BatchedCharacter>&              m_characters;
+            Seconds                                             m_deltaTime;
+            Physics::PhysicsWorld*                              m_pPhysicsWorld = nullptr;
+            EE::TaskSystem*                                     m_pTaskSystem = nullptr;
+        };
+
+        //-------------------------------------------------------------------------
+
+        auto pTaskSystem = ctx.GetSystem<EE::TaskSystem>();
+        auto pPhysicsWorldSystem = ctx.GetWorldSystem<Physics::PhysicsWorldSystem>();
+
+        PrePhysicsUpdateTask updateTask( m_batchedCharacters, ctx.GetDeltaTime(), pPhysicsWorldSystem->GetWorld(), pTaskSystem );
+        pTaskSystem->ScheduleTask( &updateTask );
+        pTaskSystem->WaitForTask( &updateTask );
+
+        // Serial update for characters in spatial hierarchies
+        //-------------------------------------------------------------------------
+
+        for ( auto& character : m_batchedCharacters )
+        {
+            if ( character.IsInSpatialHierarchy() )
+            {
+                updateTask.UpdateCharacter( character );
+            }
+        }
+    }
+
+    void AnimationWorldSystem::UpdateBatchedCharactersPostPhysics( EntityWorldUpdateContext const& ctx )
+    {
+        EE_PROFILE_SCOPE_ANIMATION( "Batched Animation Update: Post-Physics" );
+
+        if ( m_batchedCharacters.empty() )
         {
-            pComponent->DrawDebug( drawingCtx );
+            return;
+        }
+
+        //-------------------------------------------------------------------------
+
+        struct PostPhysicsUpdateTask final : public ITaskSet
+        {
+            PostPhysicsUpdateTask( TIDVector<EntityID, BatchedCharacter>& characters )
+                : m_characters( characters )
+            {
+                m_SetSize = (uint32_t) characters.size();
+            }
+
+            // Run all post-physics tasks (this also calculates the global transforms) and then generate the skinning transforms for the meshes
+            static void UpdateCharacter( BatchedCharacter& character )
+            {
+                character.m_pGraphComponent->ExecutePostPhysicsTasks();
+
+                auto const* pPose = character.m_pGraphComponent->GetPose();
+                EE_ASSERT( pPose->HasGlobalTransforms() );
+
+                for ( auto pMeshComponent : character.m_meshComponents )
+                {
+                    if ( !pMeshComponent->HasMeshResourceSet() )
+                    {
+                        continue;
+                    }
+
+                    // Any other meshes on the entity are posed and finalized by the entity's animation system
+                    if ( pPose->GetSkeleton() != pMeshComponent->GetSkeleton() )
+                    {
+                        continue;
+                    }
+
+                    pMeshComponent->SetPose( pPose );
+                    pMeshComponent->FinalizePose();
+                }
+            }
+
+            virtual void ExecuteRange( TaskSetPartition range, uint32_t threadnum ) override final
+            {
+                for ( uint64_t i = range.start; i < range.end; ++i )
+                {
+                    // Finalizing the mesh pose updates any attached entities, so characters in spatial hierarchies are updated serially afterwards
+                    BatchedCharacter& character = m_characters[(int32_t) i];
+                    if ( !character.IsInSpatialHierarchy() )
+                    {
+                        UpdateCharacter( character );
+                    }
+                }
+            }
+
+        public:
+
+            TIDVector<EntityID, BatchedCharacter>&              m_characters;
+        };
+
+        //-------------------------------------------------------------------------
+
+        auto pTaskSystem = ctx.GetSystem<EE::TaskSystem>();
+        PostPhysicsUpdateTask updateTask( m_batchedCharacters );
+        pTaskSystem->ScheduleTask( &updateTask );
+        pTaskSystem->WaitForTask( &updateTask );
+
+        for ( auto& character : m_batchedCharacters )
+        {
+            if ( character.IsInSpatialHierarchy() )
+            {
+                PostPhysicsUpdateTask::UpdateCharacter( character );
+            }
+        }
+    }
+
+    //-------------------------------------------------------------------------
+
+    void AnimationWorldSystem::SetSignificanceSchedulingEnabled( bool isEnabled )
+    {
+        m_isSignificanceSchedulingEnabled = isEnabled;
+
+        if ( !m_isSignificanceSchedulingEnabled )
+        {
+            for ( auto& scheduledGraph : m_significanceScheduledGraphs )
+            {
+                scheduledGraph.m_pGraphComponent->SetSkeletonLOD( Skeleton::LOD::High );
+                scheduledGraph.m_pGraphComponent->SetUpdateInterval( 1 );
+            }
+        }
+    }
+
+    void AnimationWorldSystem::SetSignificanceBucketSettings( SignificanceBucket bucket, SignificanceBucketSettings const& settings )
+    {
+        EE_ASSERT( bucket < SignificanceBucket::NumBuckets );
+        EE_ASSERT( settings.m_updateInterval > 0 );
+        m_bucketSettings[(uint8_t) bucket] = settings;
+    }
+
+    void AnimationWorldSystem::UpdateSignificance( EntityWorldUpdateContext const& ctx )
+    {
+        EE_PROFILE_SCOPE_ANIMATION( "Animation Significance Update" );
+
+        Render::Viewport const* pViewport = ctx.GetViewport();
+        if ( !m_isSignificanceSchedulingEnabled || pViewport == nullptr || m_significanceScheduledGraphs.empty() )
+        {
+            return;
+        }
+
+        // Calculate significance for all characters and sort them (most significant first)
+        //-------------------------------------------------------------------------
+
+        m_significanceSortedGraphs.clear();
+        for ( auto& scheduledGraph : m_significanceScheduledGraphs )
+        {
+            scheduledGraph.m_significance = scheduledGraph.m_pEntity->IsSpatialEntity() ? CalculateProjectedScreenHeight( pViewport, scheduledGraph.m_pEntity ) : 0.0f;
+            m_significanceSortedGraphs.emplace_back( &scheduledGraph );
+        }
+
+        auto SortPredicate = [] ( SignificanceScheduledGraph const* pA, SignificanceScheduledGraph const* pB )
+        {
+            return pA->m_significance > pB->m_significance;
+        };
+
+        eastl::sort( m_significanceSortedGraphs.begin(), m_significanceSortedGraphs.end(), SortPredicate );
+
+        // Assign buckets - once a bucket is full, the remaining characters are demoted to the next bucket
+        //-------------------------------------------------------------------------
+
+        int32_t numCharactersInBucket[(uint8_t) SignificanceBucket::NumBuckets] = { 0 };
+        uint8_t const lastBucketIdx = (uint8_t) SignificanceBucket::NumBuckets - 1;
+
+        for ( auto pScheduledGraph : m_significanceSortedGraphs )
+        {
+            uint8_t bucketIdx = 0;
+            while ( bucketIdx < lastBucketIdx )
+            {
+                SignificanceBucketSettings const& settings = m_bucketSettings[bucketIdx];
+                bool const isSignificantEnough = pScheduledGraph->m_significance >= settings.m_minScreenHeight;
+                bool const hasBudget = settings.m_maxCharacters < 0 || numCharactersInBucket[bucketIdx] < settings.m_maxCharacters;
+                if ( isSignificantEnough && hasBudget )
+                {
+                    break;
+                }
+
+                bucketIdx++;
+            }
+
+            numCharactersInBucket[bucketIdx]++;
+            pScheduledGraph->m_bucket = (SignificanceBucket) bucketIdx;
+
+            SignificanceBucketSettings const& settings = m_bucketSettings[bucketIdx];
+            pScheduledGraph->m_pGraphComponent->SetSkeletonLOD( settings.m_skeletonLOD );
+            pScheduledGraph->m_pGraphComponent->SetUpdateInterval( settings.m_updateInterval );
+        }
+    }
+
+    #if EE_DEVELOPMENT_TOOLS
+    void AnimationWorldSystem::UpdateSignificanceStats()
+    {
+        for ( auto& stats : m_bucketStats )
+        {
+            stats = SignificanceBucketStats();
+        }
+
+        if ( !m_isSignificanceSchedulingEnabled )
+        {
+            return;
+        }
+
+        for ( auto const& scheduledGraph : m_significanceScheduledGraphs )
+        {
+            SignificanceBucketStats& stats = m_bucketStats[(uint8_t) scheduledGraph.m_bucket];
+            stats.m_numCharacters++;
+
+            if ( scheduledGraph.m_pGraphComponent->WasEvaluationSkipped() )
+            {
+                stats.m_numSkippedGraphs++;
+            }
+            else
+            {
+                stats.m_numEvaluatedGraphs++;
+            }
         }
-        #endif
     }
-}
\ No newline at end of file
+    #endif
+}
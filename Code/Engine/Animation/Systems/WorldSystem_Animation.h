@@ -2,15 +2,38 @@
 
 #include "Engine/_Module/API.h"
 #include "Engine/Entity/EntityWorldSystem.h"
+#include "Engine/Entity/EntityIDs.h"
+#include "Engine/Animation/AnimationSkeleton.h"
 #include "Base/Types/IDVector.h"
 
 //-------------------------------------------------------------------------
 
+namespace EE
+{
+    class Entity;
+    class SpatialEntityComponent;
+}
+
+namespace EE::Render
+{
+    class SkeletalMeshComponent;
+}
+
+//-------------------------------------------------------------------------
+
 namespace EE::Animation
 {
     class GraphComponent;
 
     //-------------------------------------------------------------------------
+    // Animation World System
+    //-------------------------------------------------------------------------
+    // Also responsible for the batched animation update: all graph components that opt into it are not updated by their entity's animation system
+    // but are instead updated here as a set of wide stages (graph evaluation + pre-physics tasks, then post-physics tasks + mesh poses) over all characters
+    //
+    // Also acts as the significance manager for all graphs that opt into it: at the start of each frame, characters are ranked by their projected screen height
+    // and assigned to a significance bucket which defines the skeleton LOD and update interval to use. Each bucket has a budget, once full the least significant
+    // characters are demoted to the next bucket.
 
     class AnimationWorldSystem : public EntityWorldSystem
     {
@@ -18,10 +41,87 @@ namespace EE::Animation
 
     public:
 
-        EE_ENTITY_WORLD_SYSTEM( AnimationWorldSystem, RequiresUpdate( UpdateStage::FrameEnd ), RequiresUpdate( UpdateStage::Paused ) );
+        enum class SignificanceBucket : uint8_t
+        {
+            High = 0,
+            Medium,
+            Low,
+            Minimal,
+
+            NumBuckets
+        };
+
+        struct SignificanceBucketSettings
+        {
+            float                                               m_minScreenHeight = 0.0f; // The minimum projected height for a character to be in this bucket (as a percentage of the viewport height)
+            int32_t                                             m_maxCharacters = -1; // The max number of characters in this bucket, -1 means unlimited (the last bucket is always unlimited)
+            uint8_t                                             m_updateInterval = 1; // The graph is evaluated every N frames
+            Skeleton::LOD                                       m_skeletonLOD = Skeleton::LOD::High;
+        };
+
+        #if EE_DEVELOPMENT_TOOLS
+        struct SignificanceBucketStats
+        {
+            int32_t                                             m_numCharacters = 0;
+            int32_t                                             m_numEvaluatedGraphs = 0; // The number of graph evaluations for the last frame
+            int32_t                                             m_numSkippedGraphs = 0; // The number of graph evaluations that were skipped for the last frame
+        };
+        #endif
+
+    private:
+
+        struct SignificanceScheduledGraph
+        {
+            SignificanceScheduledGraph( ComponentID componentID, Entity const* pEntity, GraphComponent* pGraphComponent ) : m_componentID( componentID ), m_pEntity( pEntity ), m_pGraphComponent( pGraphComponent ) {}
+
+            inline ComponentID const& GetID() const { return m_componentID; }
+
+        public:
+
+            ComponentID                                         m_componentID;
+            Entity const*                                       m_pEntity = nullptr;
+            GraphComponent*                                     m_pGraphComponent = nullptr;
+            float                                               m_significance = 0.0f;
+            SignificanceBucket                                  m_bucket = SignificanceBucket::High;
+        };
+
+        struct BatchedCharacter
+        {
+            BatchedCharacter( EntityID entityID, Entity const* pEntity, GraphComponent* pGraphComponent ) : m_entityID( entityID ), m_pEntity( pEntity ), m_pGraphComponent( pGraphComponent ) {}
+
+            inline EntityID const& GetID() const { return m_entityID; }
+
+            // Characters that are part of a spatial hierarchy cannot be updated in parallel with other characters
+            bool IsInSpatialHierarchy() const;
+
+        public:
+
+            EntityID                                            m_entityID;
+            Entity const*                                       m_pEntity = nullptr;
+            GraphComponent*                                     m_pGraphComponent = nullptr;
+            SpatialEntityComponent*                             m_pRootComponent = nullptr;
+            TInlineVector<Render::SkeletalMeshComponent*, 2>    m_meshComponents;
+        };
+
+    public:
+
+        EE_ENTITY_WORLD_SYSTEM( AnimationWorldSystem, RequiresUpdate( UpdateStage::FrameStart, UpdatePriority::Low ), RequiresUpdate( UpdateStage::PrePhysics, UpdatePriority::Low ), RequiresUpdate( UpdateStage::PostPhysics, UpdatePriority::Low ), RequiresUpdate( UpdateStage::FrameEnd ), RequiresUpdate( UpdateStage::Paused ) );
+
+        // Significance
+        //-------------------------------------------------------------------------
+
+        inline bool IsSignificanceSchedulingEnabled() const { return m_isSignificanceSchedulingEnabled; }
+
+        // Disabling the scheduling will reset all scheduled graphs to full rate at the high LOD
+        void SetSignificanceSchedulingEnabled( bool isEnabled );
+
+        inline SignificanceBucketSettings const& GetSignificanceBucketSettings( SignificanceBucket bucket ) const { EE_ASSERT( bucket < SignificanceBucket::NumBuckets ); return m_bucketSettings[(uint8_t) bucket]; }
+        void SetSignificanceBucketSettings( SignificanceBucket bucket, SignificanceBucketSettings const& settings );
 
         #if EE_DEVELOPMENT_TOOLS
         inline TVector<GraphComponent*> const& GetRegisteredGraphComponents() const { return m_graphComponents.GetVector(); }
+        inline int32_t GetNumBatchedCharacters() const { return m_batchedCharacters.size(); }
+        inline SignificanceBucketStats const& GetSignificanceBucketStats( SignificanceBucket bucket ) const { EE_ASSERT( bucket < SignificanceBucket::NumBuckets ); return m_bucketStats[(uint8_t) bucket]; }
         #endif
 
     private:
@@ -30,9 +130,34 @@ namespace EE::Animation
         virtual void RegisterComponent( Entity const* pEntity, EntityComponent* pComponent ) override final;
         virtual void UnregisterComponent( Entity const* pEntity, EntityComponent* pComponent ) override final;
         virtual void UpdateSystem( EntityWorldUpdateContext const& ctx ) override;
+        virtual WorldSystemAccess GetUpdateAccess() const override final;
+
+        void UpdateBatchedCharactersPrePhysics( EntityWorldUpdateContext const& ctx );
+        void UpdateBatchedCharactersPostPhysics( EntityWorldUpdateContext const& ctx );
+
+        void UpdateSignificance( EntityWorldUpdateContext const& ctx );
+
+        #if EE_DEVELOPMENT_TOOLS
+        void UpdateSignificanceStats();
+        #endif
 
     private:
 
         TIDVector<ComponentID, GraphComponent*>          m_graphComponents;
+        TIDVector<EntityID, BatchedCharacter>           m_batchedCharacters;
+        TIDVector<ComponentID, SignificanceScheduledGraph> m_significanceScheduledGraphs;
+        TVector<SignificanceScheduledGraph*>            m_significanceSortedGraphs;
+        SignificanceBucketSettings                      m_bucketSettings[(uint8_t) SignificanceBucket::NumBuckets] =
+        {
+            { 0.25f, 8, 1, Skeleton::LOD::High },
+            { 0.10f, 24, 1, Skeleton::LOD::Low },
+            { 0.03f, 64, 2, Skeleton::LOD::Low },
+            { 0.0f, -1, 4, Skeleton::LOD::Low },
+        };
+        bool                                            m_isSignificanceSchedulingEnabled = true;
+
+        #if EE_DEVELOPMENT_TOOLS
+        SignificanceBucketStats                         m_bucketStats[(uint8_t) SignificanceBucket::NumBuckets];
+        #endif
     };
-} 
\ No newline at end of file
+}
\ No newline at end of file
@@ -76,6 +76,10 @@ namespace EE::Animation
         // Do we have a dependency on the physics simulation?
         inline bool	HasPhysicsDependency() const { return m_updateStage != TaskUpdateStage::Any; }
 
+        // Does this task access state that is shared with other tasks outside of its dependencies (i.e. cached poses, physics)?
+        // When executing tasks in parallel, all such tasks are executed in registration order
+        virtual bool AccessesSharedState() const { return HasPhysicsDependency(); }
+
         // Serialization
         //-------------------------------------------------------------------------
 
@@ -29,7 +29,7 @@ namespace EE::Animation
 
         for ( auto i = 0; i < s_numInitialBuffers; i++ )
         {
-            m_poseBuffers.emplace_back( PoseBuffer( m_pSkeleton ) );
+            m_poseBuffers[m_numPoseBuffers++] = EE::New<PoseBuffer>( m_pSkeleton );
             m_cachedBuffers.emplace_back( CachedPoseBuffer( m_pSkeleton ) );
 
             #if EE_DEVELOPMENT_TOOLS
@@ -42,14 +42,20 @@ namespace EE::Animation
     PoseBufferPool::~PoseBufferPool()
     {
         Reset();
+
+        for ( int8_t i = 0; i < m_numPoseBuffers; i++ )
+        {
+            EE::Delete( m_poseBuffers[i] );
+        }
+        m_numPoseBuffers = 0;
     }
 
     void PoseBufferPool::Reset()
     {
         // Reset all buffers
-        for ( auto& poseBuffer : m_poseBuffers )
+        for ( int8_t i = 0; i < m_numPoseBuffers; i++ )
         {
-            poseBuffer.Reset();
+            m_poseBuffers[i]->Reset();
         }
 
         m_firstFreeBuffer = 0;
@@ -74,26 +80,43 @@ namespace EE::Animation
         #endif
     }
 
+    void PoseBufferPool::EnableThreadSafeAccess( bool isEnabled )
+    {
+        m_isThreadSafeAccessEnabled = isEnabled;
+    }
+
     int8_t PoseBufferPool::RequestPoseBuffer()
     {
-        if ( m_firstFreeBuffer == m_poseBuffers.size() )
+        Threading::Lock lock( m_mutex, std::defer_lock );
+        if ( m_isThreadSafeAccessEnabled )
         {
-            for ( auto i = 0; i < s_bufferGrowAmount; i++ )
+            lock.lock();
+        }
+
+        // Grow the pool, existing buffers never move so this is safe even while other tasks are using their buffers
+        if ( m_firstFreeBuffer == m_numPoseBuffers )
+        {
+            if ( m_numPoseBuffers == s_maxBuffers )
             {
-                m_poseBuffers.emplace_back( PoseBuffer( m_pSkeleton ) );
+                EE_LOG_FATAL_ERROR( "Animation", "Pose Buffer Pool", "Ran out of pose buffers, the task graph requires more than %d simultaneous poses!", s_maxBuffers );
+                return InvalidIndex;
+            }
+
+            int8_t const numBuffersToAdd = Math::Min<int8_t>( s_bufferGrowAmount, s_maxBuffers - m_numPoseBuffers );
+            for ( auto i = 0; i < numBuffersToAdd; i++ )
+            {
+                m_poseBuffers[m_numPoseBuffers++] = EE::New<PoseBuffer>( m_pSkeleton );
             }
-            EE_ASSERT( m_poseBuffers.size() < 255 );
         }
 
         int8_t const freeBufferIdx = m_firstFreeBuffer;
-        EE_ASSERT( !m_poseBuffers[freeBufferIdx].m_isUsed );
-        m_poseBuffers[freeBufferIdx].m_isUsed = true;
+        EE_ASSERT( !m_poseBuffers[freeBufferIdx]->m_isUsed );
+        m_poseBuffers[freeBufferIdx]->m_isUsed = true;
 
         // Update free index
-        int8_t const numPoseBuffers = (int8_t) m_poseBuffers.size();
-        for ( ; m_firstFreeBuffer < numPoseBuffers; m_firstFreeBuffer++ )
+        for ( ; m_firstFreeBuffer < m_numPoseBuffers; m_firstFreeBuffer++ )
         {
-            if ( !m_poseBuffers[m_firstFreeBuffer].m_isUsed )
+            if ( !m_poseBuffers[m_firstFreeBuffer]->m_isUsed )
             {
                 break;
             }
@@ -104,11 +127,31 @@ namespace EE::Animation
 
     void PoseBufferPool::ReleasePoseBuffer( int8_t bufferIdx )
     {
-        EE_ASSERT( m_poseBuffers[bufferIdx].m_isUsed );
-        m_poseBuffers[bufferIdx].m_isUsed = false;
+        Threading::Lock lock( m_mutex, std::defer_lock );
+        if ( m_isThreadSafeAccessEnabled )
+        {
+            lock.lock();
+        }
+
+        EE_ASSERT( bufferIdx >= 0 && bufferIdx < m_numPoseBuffers && m_poseBuffers[bufferIdx]->m_isUsed );
+        m_poseBuffers[bufferIdx]->m_isUsed = false;
         m_firstFreeBuffer = Math::Min( bufferIdx, m_firstFreeBuffer );
     }
 
+    int32_t PoseBufferPool::GetNumAvailableBuffers() const
+    {
+        int32_t numAvailableBuffers = s_maxBuffers - m_numPoseBuffers;
+        for ( int8_t i = m_firstFreeBuffer; i < m_numPoseBuffers; i++ )
+        {
+            if ( !m_poseBuffers[i]->m_isUsed )
+            {
+                numAvailableBuffers++;
+            }
+        }
+
+        return numAvailableBuffers;
+    }
+
     UUID PoseBufferPool::CreateCachedPoseBuffer()
     {
         CachedPoseBuffer* pCachedPoseBuffer = nullptr;
@@ -207,6 +250,12 @@ namespace EE::Animation
             return;
         }
 
+        Threading::Lock lock( m_mutex, std::defer_lock );
+        if ( m_isThreadSafeAccessEnabled )
+        {
+            lock.lock();
+        }
+
         // If we are out of buffers, add additional debug buffers
         if ( m_firstFreeDebugBuffer == m_debugBuffers.size() )
         {
@@ -219,8 +268,8 @@ namespace EE::Animation
             EE_ASSERT( m_debugBuffers.size() < 255 );
         }
 
-        EE_ASSERT( m_poseBuffers[poseBufferIdx].m_isUsed );
-        m_debugBuffers[m_firstFreeDebugBuffer].CopyFrom( m_poseBuffers[poseBufferIdx].m_pose );
+        EE_ASSERT( m_poseBuffers[poseBufferIdx]->m_isUsed );
+        m_debugBuffers[m_firstFreeDebugBuffer].CopyFrom( m_poseBuffers[poseBufferIdx]->m_pose );
         m_debugBufferTaskIdxMapping[m_firstFreeDebugBuffer] = taskIdx;
         m_firstFreeDebugBuffer++;
     }
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "Engine/Animation/AnimationPose.h"
+#include "Base/Threading/Threading.h"
 
 //-------------------------------------------------------------------------
 
@@ -57,6 +58,7 @@ namespace EE::Animation
     {
         constexpr static int8_t const s_numInitialBuffers = 6;
         constexpr static int8_t const s_bufferGrowAmount = 3;
+        constexpr static int8_t const s_maxBuffers = 127;
 
     public:
 
@@ -68,16 +70,23 @@ namespace EE::Animation
 
         void Reset();
 
+        // Enable thread-safe requesting/releasing of pose buffers, needed when tasks are executed in parallel
+        // Pose buffers are individually allocated so growing the pool never moves a buffer that is in use
+        void EnableThreadSafeAccess( bool isEnabled );
+
         // Poses
         //-------------------------------------------------------------------------
 
         int8_t RequestPoseBuffer();
         void ReleasePoseBuffer( int8_t bufferIdx );
 
+        // Get the number of buffers that can still be requested, including the ones the pool can still grow into - this is not thread-safe
+        int32_t GetNumAvailableBuffers() const;
+
         inline PoseBuffer* GetBuffer( int8_t bufferIdx )
         {
-            EE_ASSERT( m_poseBuffers[bufferIdx].m_isUsed );
-            return &m_poseBuffers[bufferIdx];
+            EE_ASSERT( bufferIdx >= 0 && m_poseBuffers[bufferIdx] != nullptr && m_poseBuffers[bufferIdx]->m_isUsed );
+            return m_poseBuffers[bufferIdx];
         }
 
         // Cached Poses
@@ -102,11 +111,14 @@ namespace EE::Animation
     private:
 
         Skeleton const*                             m_pSkeleton = nullptr;
-        TInlineVector<PoseBuffer, 10>               m_poseBuffers;
+        TArray<PoseBuffer*, s_maxBuffers>           m_poseBuffers = {}; // Fixed storage so that the buffer ptrs can be read while another thread grows the pool
+        int8_t                                      m_numPoseBuffers = 0;
         TInlineVector<CachedPoseBuffer, 10>         m_cachedBuffers;
         TInlineVector<UUID, 5>                      m_cachedPoseBuffersToDestroy;
         int8_t                                      m_firstFreeCachedBuffer = 0;
         int8_t                                      m_firstFreeBuffer = 0;
+        Threading::Mutex                            m_mutex;
+        bool                                        m_isThreadSafeAccessEnabled = false;
 
         #if EE_DEVELOPMENT_TOOLS
         TVector<Pose>                               m_debugBuffers;
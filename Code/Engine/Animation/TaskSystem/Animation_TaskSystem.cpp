@@ -4,6 +4,7 @@
 
 #include "Base/Drawing/DebugDrawing.h"
 #include "Base/Profiling.h"
+#include "Base/Threading/TaskSystem.h"
 #include "Base/TypeSystem/TypeRegistry.h"
 
 //-------------------------------------------------------------------------
@@ -233,17 +234,7 @@ namespace EE::Animation
             {
                 for ( TaskIndex prePhysicsTaskIdx : m_prePhysicsTaskIndices )
                 {
-                    m_taskContext.m_currentTaskIdx = prePhysicsTaskIdx;
-
-                    // Set dependencies
-                    m_taskContext.m_dependencies.clear();
-                    for ( auto depTaskIdx : m_tasks[prePhysicsTaskIdx]->GetDependencyIndices() )
-                    {
-                        EE_ASSERT( m_tasks[depTaskIdx]->IsComplete() );
-                        m_taskContext.m_dependencies.emplace_back( m_tasks[depTaskIdx] );
-                    }
-
-                    m_tasks[prePhysicsTaskIdx]->Execute( m_taskContext );
+                    ExecuteTask( prePhysicsTaskIdx, m_taskContext );
                 }
             }
         }
@@ -305,29 +296,190 @@ namespace EE::Animation
         }
     }
 
+    void TaskSystem::ExecuteTask( TaskIndex taskIdx, TaskContext& context )
+    {
+        context.m_currentTaskIdx = taskIdx;
+
+        // Set dependencies
+        context.m_dependencies.clear();
+        for ( auto depTaskIdx : m_tasks[taskIdx]->GetDependencyIndices() )
+        {
+            EE_ASSERT( m_tasks[depTaskIdx]->IsComplete() );
+            context.m_dependencies.emplace_back( m_tasks[depTaskIdx] );
+        }
+
+        // Execute task
+        m_tasks[taskIdx]->Execute( context );
+    }
+
     void TaskSystem::ExecuteTasks()
     {
-        int16_t const numTasks = (int8_t) m_tasks.size();
+        if ( m_pParallelTaskSystem != nullptr )
+        {
+            ExecuteTasksInParallel();
+        }
+        else
+        {
+            ExecuteTasksSerially();
+        }
+
+        m_needsUpdate = false;
+    }
+
+    void TaskSystem::ExecuteTasksSerially()
+    {
+        // Dependencies always have a lower index than the task that depends on them, so this is valid for any set of already completed tasks
+        int16_t const numTasks = (int16_t) m_tasks.size();
         for ( TaskIndex i = 0; i < numTasks; i++ )
         {
             if ( !m_tasks[i]->IsComplete() )
             {
-                m_taskContext.m_currentTaskIdx = i;
+                ExecuteTask( i, m_taskContext );
+            }
+        }
+    }
+
+    void TaskSystem::ExecuteTasksInParallel()
+    {
+        EE_ASSERT( m_pParallelTaskSystem != nullptr );
+
+        // Calculate the dependency level for each pending task
+        //-------------------------------------------------------------------------
+        // Dependencies always have a lower index than the task that depends on them so a single forward pass is enough
+        // Tasks that access state shared between tasks (i.e. cached poses, physics) are also chained in registration order
 
-                // Set dependencies
-                m_taskContext.m_dependencies.clear();
-                for ( auto DepTaskIdx : m_tasks[i]->GetDependencyIndices() )
+        int16_t const numTasks = (int16_t) m_tasks.size();
+        m_parallelTaskLevels.resize( numTasks );
+        m_parallelTaskOrder.clear();
+
+        TaskIndex maxLevel = InvalidIndex;
+        TaskIndex previousSharedStateTaskLevel = InvalidIndex;
+        for ( TaskIndex i = 0; i < numTasks; i++ )
+        {
+            // Completed tasks (i.e. pre-physics tasks) are treated as being below the first level
+            if ( m_tasks[i]->IsComplete() )
+            {
+                m_parallelTaskLevels[i] = InvalidIndex;
+                continue;
+            }
+
+            TaskIndex level = 0;
+            for ( auto depTaskIdx : m_tasks[i]->GetDependencyIndices() )
+            {
+                level = Math::Max( level, TaskIndex( m_parallelTaskLevels[depTaskIdx] + 1 ) );
+            }
+
+            if ( m_tasks[i]->AccessesSharedState() )
+            {
+                level = Math::Max( level, TaskIndex( previousSharedStateTaskLevel + 1 ) );
+                previousSharedStateTaskLevel = level;
+            }
+
+            m_parallelTaskLevels[i] = level;
+            maxLevel = Math::Max( maxLevel, level );
+        }
+
+        // Order the pending tasks by level, keeping the registration order within a level
+        for ( TaskIndex level = 0; level <= maxLevel; level++ )
+        {
+            for ( TaskIndex i = 0; i < numTasks; i++ )
+            {
+                if ( m_parallelTaskLevels[i] == level )
                 {
-                    EE_ASSERT( m_tasks[DepTaskIdx]->IsComplete() );
-                    m_taskContext.m_dependencies.emplace_back( m_tasks[DepTaskIdx] );
+                    m_parallelTaskOrder.emplace_back( i );
                 }
+            }
+        }
+
+        // Execute each level
+        //-------------------------------------------------------------------------
+
+        struct TaskLevelExecutionTask final : public ITaskSet
+        {
+            TaskLevelExecutionTask( TaskSystem* pTaskSystem, TaskContext const& context, TaskIndex const* pTaskIndices, uint32_t numTasks )
+                : m_pTaskSystem( pTaskSystem )
+                , m_context( context )
+                , m_pTaskIndices( pTaskIndices )
+            {
+                m_SetSize = numTasks;
+            }
+
+            virtual void ExecuteRange( TaskSetPartition range, uint32_t threadnum ) override final
+            {
+                EE_PROFILE_SCOPE_ANIMATION( "Anim Task Level" );
+
+                // Each worker needs its own context since the current task and dependencies are set per task
+                TaskContext context( m_context );
+                for ( uint64_t i = range.start; i < range.end; ++i )
+                {
+                    m_pTaskSystem->ExecuteTask( m_pTaskIndices[i], context );
+                }
+            }
+
+        private:
+
+            TaskSystem*                         m_pTaskSystem = nullptr;
+            TaskContext const&                  m_context;
+            TaskIndex const*                    m_pTaskIndices = nullptr;
+        };
+
+        //-------------------------------------------------------------------------
 
-                // Execute task
-                m_tasks[i]->Execute( m_taskContext );
+        int32_t const numPendingTasks = (int32_t) m_parallelTaskOrder.size();
+        int32_t levelStartIdx = 0;
+        while ( levelStartIdx < numPendingTasks )
+        {
+            TaskIndex const level = m_parallelTaskLevels[m_parallelTaskOrder[levelStartIdx]];
+
+            int32_t levelEndIdx = levelStartIdx + 1;
+            while ( levelEndIdx < numPendingTasks && m_parallelTaskLevels[m_parallelTaskOrder[levelEndIdx]] == level )
+            {
+                levelEndIdx++;
+            }
+
+            // Each task in the level holds on to its result buffer and might also need a temporary buffer while executing
+            // Executing by level needs a lot more simultaneous buffers than executing in order, so if the pool cant provide them we execute the remaining tasks serially
+            int32_t const numTasksInLevel = levelEndIdx - levelStartIdx;
+            if ( m_posePool.GetNumAvailableBuffers() < numTasksInLevel * 2 )
+            {
+                ExecuteTasksSerially();
+                return;
+            }
+
+            // Dont bother going wide for a single task
+            if ( numTasksInLevel == 1 )
+            {
+                ExecuteTask( m_parallelTaskOrder[levelStartIdx], m_taskContext );
+            }
+            else
+            {
+                TaskLevelExecutionTask levelTask( this, m_taskContext, &m_parallelTaskOrder[levelStartIdx], (uint32_t) numTasksInLevel );
+                m_pParallelTaskSystem->ScheduleTask( &levelTask );
+                m_pParallelTaskSystem->WaitForTask( &levelTask );
             }
+
+            levelStartIdx = levelEndIdx;
         }
+    }
 
-        m_needsUpdate = false;
+    //-------------------------------------------------------------------------
+
+    void TaskSystem::EnableParallelExecution( EE::TaskSystem* pTaskSystem )
+    {
+        EE_ASSERT( pTaskSystem != nullptr );
+
+        m_posePool.EnableThreadSafeAccess( true );
+        m_boneMaskPool.EnableThreadSafeAccess( true );
+        m_pParallelTaskSystem = pTaskSystem;
+    }
+
+    void TaskSystem::DisableParallelExecution()
+    {
+        m_posePool.EnableThreadSafeAccess( false );
+        m_boneMaskPool.EnableThreadSafeAccess( false );
+        m_pParallelTaskSystem = nullptr;
+        m_parallelTaskLevels.clear();
+        m_parallelTaskOrder.clear();
     }
 
     //-------------------------------------------------------------------------
@@ -6,6 +6,7 @@
 
 //-------------------------------------------------------------------------
 
+namespace EE { class TaskSystem; }
 namespace EE::TypeSystem { class TypeRegistry; }
 
 //-------------------------------------------------------------------------
@@ -98,6 +99,20 @@ namespace EE::Animation
         TaskIndex GetCurrentTaskIndexMarker() const { return (TaskIndex) m_tasks.size(); }
         void RollbackToTaskIndexMarker( TaskIndex const marker );
 
+        // Parallel Execution
+        //-------------------------------------------------------------------------
+
+        // Have we enabled parallel task execution
+        bool IsParallelExecutionEnabled() const { return m_pParallelTaskSystem != nullptr; }
+
+        // Enable parallel task execution - independent tasks will be executed concurrently on the supplied task system's workers
+        // Tasks are grouped into levels based on their dependencies and each level is executed as a single parallel task set
+        // If the pose pool cant provide the buffers needed to execute a level in parallel, the remaining tasks are executed serially
+        void EnableParallelExecution( EE::TaskSystem* pTaskSystem );
+
+        // Disable parallel task execution
+        void DisableParallelExecution();
+
         // Task Serialization
         //-------------------------------------------------------------------------
 
@@ -130,7 +145,10 @@ namespace EE::Animation
     private:
 
         bool AddTaskChainToPrePhysicsList( TaskIndex taskIdx );
+        void ExecuteTask( TaskIndex taskIdx, TaskContext& context );
         void ExecuteTasks();
+        void ExecuteTasksSerially();
+        void ExecuteTasksInParallel();
 
     private:
 
@@ -152,6 +170,12 @@ namespace EE::Animation
 
         //-------------------------------------------------------------------------
 
+        EE::TaskSystem*                         m_pParallelTaskSystem = nullptr;
+        TInlineVector<TaskIndex, 16>            m_parallelTaskLevels; // The dependency level of each task, all tasks on the same level can be executed concurrently
+        TInlineVector<TaskIndex, 16>            m_parallelTaskOrder; // The task indices sorted by level
+
+        //-------------------------------------------------------------------------
+
         #if EE_DEVELOPMENT_TOOLS
         TaskSystemDebugMode                     m_debugMode = TaskSystemDebugMode::Off;
         #endif
@@ -10,7 +10,7 @@ namespace EE::Drawing { class DrawContext; }
 
 namespace EE::Animation::Tasks
 {
-    class BlendTask final : public Task
+    class EE_ENGINE_API BlendTask final : public Task
     {
         EE_REFLECT_TYPE( BlendTask );
 
@@ -6,7 +6,7 @@
 
 namespace EE::Animation::Tasks
 {
-    class DefaultPoseTask : public Task
+    class EE_ENGINE_API DefaultPoseTask : public Task
     {
         EE_REFLECT_TYPE( DefaultPoseTask );
 
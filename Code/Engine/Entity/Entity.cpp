@@ -2,6 +2,7 @@
 #include "EntityWorldUpdateContext.h"
 #include "EntityContexts.h"
 #include "EntityDescriptors.h"
+#include "EntityComponentStorage.h"
 #include "EntityLog.h"
 #include "Base/Resource/ResourceRequesterID.h"
 #include "Base/TypeSystem/TypeRegistry.h"
@@ -62,7 +63,7 @@ namespace EE
         // Destroy components
         for ( auto& pComponent : m_components )
         {
-            EE::Delete( pComponent );
+            DeleteComponent( pComponent );
         }
 
         m_components.clear();
@@ -86,7 +87,7 @@ namespace EE
         for ( auto pComponent : m_components )
         {
             EE_ASSERT( pComponent->IsUnloaded() );
-            pComponent->Load( loadingContext, Resource::ResourceRequesterID( m_ID.m_value ) );
+            pComponent->Load( loadingContext, GetResourceRequesterID() );
         }
 
         m_status = Status::Loaded;
@@ -112,7 +113,7 @@ namespace EE
                 EE_ASSERT( !pComponent->IsInitialized() ); // Did you forget to call the parent class shutdown?
             }
 
-            pComponent->Unload( loadingContext, Resource::ResourceRequesterID( m_ID.m_value ) );
+            pComponent->Unload( loadingContext, GetResourceRequesterID() );
         }
 
         m_status = Status::Unloaded;
@@ -147,6 +148,14 @@ namespace EE
             m_pRootSpatialComponent->CalculateWorldTransform( false );
         }
 
+        for ( auto pComponent : m_components )
+        {
+            if ( auto pSpatialComponent = TryCast<SpatialEntityComponent>( pComponent ) )
+            {
+                pSpatialComponent->m_pTransformResolver = initializationContext.m_pTransformResolver;
+            }
+        }
+
         // Systems and Components
         //-------------------------------------------------------------------------
 
@@ -369,7 +378,7 @@ namespace EE
 
                     auto pComponent = (EntityComponent*) action.m_ptr;
                     AddComponentImmediate( pComponent, pParentComponent );
-                    pComponent->Load( loadingContext, Resource::ResourceRequesterID( m_ID.m_value ) );
+                    pComponent->Load( loadingContext, GetResourceRequesterID() );
                     m_deferredActions.erase( m_deferredActions.begin() + i );
                     i--;
                 }
@@ -414,7 +423,7 @@ namespace EE
                             pComponent->Shutdown();
                         }
 
-                        pComponent->Unload( loadingContext, Resource::ResourceRequesterID( m_ID.m_value ) );
+                        pComponent->Unload( loadingContext, GetResourceRequesterID() );
                         DestroyComponentImmediate( pComponent );
                         m_deferredActions.erase( m_deferredActions.begin() + i );
                         i--;
@@ -453,6 +462,7 @@ namespace EE
 
                 if ( auto pSpatialComponent = TryCast<SpatialEntityComponent>( pComponent ) )
                 {
+                    pSpatialComponent->m_pTransformResolver = initializationContext.m_pTransformResolver;
                     pSpatialComponent->CalculateWorldTransform( false );
                 }
 
@@ -1081,6 +1091,19 @@ namespace EE
         //-------------------------------------------------------------------------
 
         m_components.erase_unsorted( m_components.begin() + componentIdx );
+        DeleteComponent( pComponent );
+    }
+
+    void Entity::DeleteComponent( EntityComponent* pComponent )
+    {
+        EE_ASSERT( pComponent != nullptr );
+
+        // Components added at runtime are always heap allocated, even for entities created from pooled storage
+        if ( m_pComponentStorage != nullptr && m_pComponentStorage->TryDestroyComponent( pComponent ) )
+        {
+            return;
+        }
+
         EE::Delete( pComponent );
     }
 
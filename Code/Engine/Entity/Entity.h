@@ -3,6 +3,7 @@
 #include "EntitySpatialComponent.h"
 #include "EntitySystem.h"
 #include "Engine/UpdateStage.h"
+#include "Base/Resource/ResourceRequesterID.h"
 #include "Base/Threading/Threading.h"
 #include "Base/Types/Event.h"
 
@@ -339,6 +340,9 @@ namespace EE
         // Request initial load of all components
         void LoadComponents( EntityModel::LoadingContext const& loadingContext );
 
+        // The requester ID for all our component resource requests, this carries the load priority that the entity was added to its map with
+        inline Resource::ResourceRequesterID GetResourceRequesterID() const { return Resource::ResourceRequesterID( m_ID.m_value, m_loadPriority ); }
+
         // Request final unload of all components
         void UnloadComponents( EntityModel::LoadingContext const& loadingContext );
 
@@ -354,6 +358,9 @@ namespace EE
         void AddComponentImmediate( EntityComponent* pComponent, SpatialEntityComponent* pParentSpatialComponent );
         void DestroyComponentImmediate( EntityComponent* pComponent );
 
+        // Release the memory for a component, this handles both pooled and heap allocated components
+        void DeleteComponent( EntityComponent* pComponent );
+
     protected:
 
         EntityID                                            m_ID = EntityID::Generate();                                            // The unique ID of this entity ( globally unique and generated at runtime )
@@ -361,6 +368,7 @@ namespace EE
         EE_REFLECT( "IsToolsReadOnly" : true ) StringID     m_name;                                                                 // The name of the entity, only unique within the context of a map
         Status                                              m_status = Status::Unloaded;
         UpdateRegistrationStatus                            m_updateRegistrationStatus = UpdateRegistrationStatus::Unregistered;    // Is this entity registered for frame updates
+        Resource::ResourceLoadPriority                      m_loadPriority = Resource::ResourceLoadPriority::Normal;                // The I/O priority for our component resources, set when added to a map
 
         TVector<EntitySystem*>                              m_systems;
         TVector<EntityComponent*>                           m_components;
@@ -372,6 +380,8 @@ namespace EE
         EE_REFLECT() StringID                               m_parentAttachmentSocketID;                                             // The socket that we are attached to on the parent
         bool                                                m_isSpatialAttachmentCreated = false;                                   // Has the actual component-to-component attachment been created
 
+        EntityModel::ComponentStorage*                      m_pComponentStorage = nullptr;                                          // The pooled storage our serialized components were allocated from (if any)
+
         TVector<EntityInternalStateAction>                  m_deferredActions;                                                      // The set of internal entity state changes that need to be executed
         Threading::RecursiveMutex                           m_internalStateMutex;                                                   // A mutex that needs to be lock due to internal state changes
     };
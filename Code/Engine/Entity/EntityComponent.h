@@ -14,6 +14,7 @@ namespace EE
         class EntityMapEditor;
         class EntityCollection;
         class EntityMap;
+        class ComponentPool;
         struct Serializer;
     }
 
@@ -28,6 +29,7 @@ namespace EE
         friend EntityModel::Serializer;
         friend EntityModel::EntityCollection;
         friend EntityModel::EntityMap;
+        friend EntityModel::ComponentPool;
 
     public:
 
@@ -96,6 +98,7 @@ namespace EE
         Status                                              m_status = Status::Unloaded;                    // Component status
         bool                                                m_isRegisteredWithEntity = false;               // Registered with its parent entity's local systems
         bool                                                m_isRegisteredWithWorld = false;                // Registered with the global systems in it's parent world
+        int32_t                                             m_poolSlotIdx = InvalidIndex;                   // The slot in the component pool this component was allocated from (if pooled)
     };
 }
 
@@ -0,0 +1,228 @@
+#include "EntityComponentStorage.h"
+#include "EntityDescriptors.h"
+#include "Base/TypeSystem/TypeRegistry.h"
+#include "Base/Profiling.h"
+
+//-------------------------------------------------------------------------
+
+namespace EE::EntityModel
+{
+    ComponentPool::ComponentPool( TypeSystem::TypeInfo const* pTypeInfo )
+        : m_pTypeInfo( pTypeInfo )
+    {
+        EE_ASSERT( m_pTypeInfo != nullptr && m_pTypeInfo->IsDerivedFrom<EntityComponent>() );
+        EE_ASSERT( m_pTypeInfo->m_size > 0 && m_pTypeInfo->m_alignment > 0 );
+
+        size_t const alignment = (size_t) m_pTypeInfo->m_alignment;
+        m_stride = ( ( (size_t) m_pTypeInfo->m_size + alignment - 1 ) / alignment ) * alignment;
+        m_slotsPerChunk = Math::Max( 1, (int32_t) ( s_chunkSizeInBytes / m_stride ) );
+    }
+
+    ComponentPool::~ComponentPool()
+    {
+        EE_ASSERT( m_numComponents == 0 );
+
+        for ( auto& pChunkMemory : m_chunks )
+        {
+            EE::Free( pChunkMemory );
+        }
+    }
+
+    void ComponentPool::AllocateChunks( int32_t numChunks )
+    {
+        EE_ASSERT( numChunks > 0 );
+
+        int32_t const firstNewSlotIdx = (int32_t) m_slotGenerations.size();
+        int32_t const numNewSlots = numChunks * m_slotsPerChunk;
+
+        for ( int32_t i = 0; i < numChunks; i++ )
+        {
+            m_chunks.emplace_back( (uint8_t*) EE::Alloc( m_stride * m_slotsPerChunk, (size_t) m_pTypeInfo->m_alignment ) );
+        }
+
+        m_slotGenerations.resize( m_slotGenerations.size() + numNewSlots, 0 );
+
+        // Free slots are popped from the back, so add them in reverse order to hand out ascending addresses
+        m_freeSlots.reserve( m_freeSlots.size() + numNewSlots );
+        for ( int32_t slotIdx = firstNewSlotIdx + numNewSlots - 1; slotIdx >= firstNewSlotIdx; slotIdx-- )
+        {
+            m_freeSlots.emplace_back( slotIdx );
+        }
+    }
+
+    void ComponentPool::Reserve( int32_t numAdditionalComponents )
+    {
+        Threading::ScopeLock lock( m_mutex );
+
+        int32_t const numSlotsRequired = numAdditionalComponents - (int32_t) m_freeSlots.size();
+        if ( numSlotsRequired > 0 )
+        {
+            AllocateChunks( ( numSlotsRequired + m_slotsPerChunk - 1 ) / m_slotsPerChunk );
+        }
+    }
+
+    EntityComponent* ComponentPool::CreateComponent( TypeSystem::TypeRegistry const& typeRegistry, SerializedComponentDescriptor const& componentDesc )
+    {
+        EE_ASSERT( componentDesc.m_typeID == m_pTypeInfo->m_ID );
+
+        int32_t slotIdx = InvalidIndex;
+        IReflectedType* pMemory = nullptr;
+        {
+            Threading::ScopeLock lock( m_mutex );
+
+            if ( m_freeSlots.empty() )
+            {
+                AllocateChunks( 1 );
+            }
+
+            slotIdx = m_freeSlots.back();
+            m_freeSlots.pop_back();
+
+            EE_ASSERT( !IsSlotAlive( slotIdx ) );
+            m_slotGenerations[slotIdx]++;
+            m_numComponents++;
+
+            pMemory = reinterpret_cast<IReflectedType*>( GetSlotMemory( slotIdx ) );
+        }
+
+        // The slot is now exclusively ours so we can construct the component outside of the lock
+        EntityComponent* pComponent = componentDesc.CreateTypeInstanceInPlace<EntityComponent>( typeRegistry, m_pTypeInfo, pMemory );
+        pComponent->m_poolSlotIdx = slotIdx;
+        return pComponent;
+    }
+
+    bool ComponentPool::OwnsComponent( EntityComponent const* pComponent ) const
+    {
+        Threading::ScopeLock lock( m_mutex );
+        return GetSlotIndex( pComponent ) != InvalidIndex;
+    }
+
+    void ComponentPool::DestroyComponent( EntityComponent* pComponent )
+    {
+        Threading::ScopeLock lock( m_mutex );
+
+        int32_t const slotIdx = GetSlotIndex( pComponent );
+        EE_ASSERT( slotIdx != InvalidIndex && IsSlotAlive( slotIdx ) );
+
+        pComponent->~EntityComponent();
+        m_slotGenerations[slotIdx]++;
+        m_freeSlots.emplace_back( slotIdx );
+        m_numComponents--;
+    }
+
+    int32_t ComponentPool::GetSlotIndex( EntityComponent const* pComponent ) const
+    {
+        // Another world's pool (or a heap allocated component) can have the same slot index, so we need to validate that the slot memory is actually this component
+        int32_t const slotIdx = pComponent->m_poolSlotIdx;
+        if ( slotIdx == InvalidIndex || slotIdx >= (int32_t) m_slotGenerations.size() )
+        {
+            return InvalidIndex;
+        }
+
+        if ( GetSlotMemory( slotIdx ) != reinterpret_cast<uint8_t const*>( pComponent ) )
+        {
+            return InvalidIndex;
+        }
+
+        return slotIdx;
+    }
+
+    ComponentHandle ComponentPool::GetHandle( EntityComponent const* pComponent ) const
+    {
+        Threading::ScopeLock lock( m_mutex );
+
+        ComponentHandle handle;
+
+        int32_t const slotIdx = GetSlotIndex( pComponent );
+        if ( slotIdx != InvalidIndex && IsSlotAlive( slotIdx ) )
+        {
+            handle.m_slotIdx = slotIdx;
+            handle.m_generation = m_slotGenerations[slotIdx];
+        }
+
+        return handle;
+    }
+
+    EntityComponent* ComponentPool::GetComponent( ComponentHandle const& handle ) const
+    {
+        if ( !handle.IsValid() || handle.m_slotIdx >= (int32_t) m_slotGenerations.size() )
+        {
+            return nullptr;
+        }
+
+        if ( m_slotGenerations[handle.m_slotIdx] != handle.m_generation )
+        {
+            return nullptr;
+        }
+
+        return reinterpret_cast<EntityComponent*>( GetSlotMemory( handle.m_slotIdx ) );
+    }
+
+    //-------------------------------------------------------------------------
+
+    ComponentStorage::~ComponentStorage()
+    {
+        EE_ASSERT( m_pools.empty() );
+    }
+
+    void ComponentStorage::Shutdown()
+    {
+        for ( auto& poolPair : m_pools )
+        {
+            EE::Delete( poolPair.second );
+        }
+
+        m_pools.clear();
+    }
+
+    void ComponentStorage::Reserve( TypeSystem::TypeRegistry const& typeRegistry, SerializedEntityCollection const& entityCollection )
+    {
+        EE_PROFILE_FUNCTION_ENTITY();
+
+        THashMap<TypeSystem::TypeID, int32_t> numComponentsPerType;
+        for ( auto const& entityDesc : entityCollection.GetEntityDescriptors() )
+        {
+            for ( auto const& componentDesc : entityDesc.m_components )
+            {
+                numComponentsPerType[componentDesc.m_typeID]++;
+            }
+        }
+
+        //-------------------------------------------------------------------------
+
+        for ( auto const& countPair : numComponentsPerType )
+        {
+            ComponentPool* pPool = GetPool( countPair.first );
+            if ( pPool == nullptr )
+            {
+                TypeSystem::TypeInfo const* pTypeInfo = typeRegistry.GetTypeInfo( countPair.first );
+                EE_ASSERT( pTypeInfo != nullptr );
+                pPool = EE::New<ComponentPool>( pTypeInfo );
+                m_pools.insert( eastl::make_pair( countPair.first, pPool ) );
+            }
+
+            pPool->Reserve( countPair.second );
+        }
+    }
+
+    EntityComponent* ComponentStorage::CreateComponent( TypeSystem::TypeRegistry const& typeRegistry, SerializedComponentDescriptor const& componentDesc )
+    {
+        ComponentPool* pPool = GetPool( componentDesc.m_typeID );
+        EE_ASSERT( pPool != nullptr ); // You need to reserve space for all the components before creating them
+        return pPool->CreateComponent( typeRegistry, componentDesc );
+    }
+
+    bool ComponentStorage::TryDestroyComponent( EntityComponent* pComponent )
+    {
+        EE_ASSERT( pComponent != nullptr );
+
+        ComponentPool* pPool = GetPool( pComponent->GetTypeID() );
+        if ( pPool == nullptr || !pPool->OwnsComponent( pComponent ) )
+        {
+            return false;
+        }
+
+        pPool->DestroyComponent( pComponent );
+        return true;
+    }
+}
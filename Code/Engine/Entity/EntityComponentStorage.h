@@ -0,0 +1,164 @@
+#pragma once
+
+#include "EntityComponent.h"
+#include "Base/Threading/Threading.h"
+#include "Base/Types/Arrays.h"
+#include "Base/Types/HashMap.h"
+
+//-------------------------------------------------------------------------
+// Pooled Entity Component Storage
+//-------------------------------------------------------------------------
+// Optional per-world storage that allocates all components of the same type contiguously in fixed size chunks.
+// Chunks are never moved or released while the pool is alive so component ptrs remain stable, pooled components can also be
+// referred to via generational handles which detect slot reuse. World systems can walk all components of a type linearly.
+// Each pooled component stores its slot index, so finding the slot for a component (i.e. on destruction) doesnt require a search.
+//
+// Pools are only modified while entities are being created or destroyed (i.e. world loading), so iteration and handle lookups during
+// the world update do not require any locking. Components that are added to an entity at runtime are still heap allocated.
+
+namespace EE::EntityModel
+{
+    struct SerializedComponentDescriptor;
+    class SerializedEntityCollection;
+
+    //-------------------------------------------------------------------------
+
+    // Handle to a pooled component, this becomes invalid once the component is destroyed
+    struct ComponentHandle
+    {
+        inline bool IsValid() const { return m_slotIdx != InvalidIndex; }
+
+    public:
+
+        int32_t                                             m_slotIdx = InvalidIndex;
+        uint32_t                                            m_generation = 0;
+    };
+
+    //-------------------------------------------------------------------------
+
+    class EE_ENGINE_API ComponentPool final
+    {
+        constexpr static size_t const s_chunkSizeInBytes = 16 * 1024;
+
+    public:
+
+        ComponentPool( TypeSystem::TypeInfo const* pTypeInfo );
+        ~ComponentPool();
+
+        inline TypeSystem::TypeInfo const* GetTypeInfo() const { return m_pTypeInfo; }
+        inline int32_t GetNumComponents() const { return m_numComponents; }
+
+        // Ensure that there are enough free slots for the specified number of additional components, all required chunks are allocated at once
+        void Reserve( int32_t numAdditionalComponents );
+
+        // Create a new component instance from the supplied descriptor
+        EntityComponent* CreateComponent( TypeSystem::TypeRegistry const& typeRegistry, SerializedComponentDescriptor const& componentDesc );
+
+        // Was this component allocated from this pool? Thread-safe.
+        bool OwnsComponent( EntityComponent const* pComponent ) const;
+
+        // Destroy a component that was allocated from this pool. Thread-safe.
+        void DestroyComponent( EntityComponent* pComponent );
+
+        // Get a handle to a pooled component. Thread-safe.
+        ComponentHandle GetHandle( EntityComponent const* pComponent ) const;
+
+        // Get the component for a handle, returns null if the component has been destroyed - this must not be called concurrently with component creation/destruction
+        EntityComponent* GetComponent( ComponentHandle const& handle ) const;
+
+        // Iterate over all initialized components in this pool, in memory order
+        template<typename F>
+        inline void ForEach( F&& func ) const
+        {
+            int32_t const numSlots = (int32_t) m_slotGenerations.size();
+            for ( int32_t chunkIdx = 0; chunkIdx < (int32_t) m_chunks.size(); chunkIdx++ )
+            {
+                uint8_t* pChunkMemory = m_chunks[chunkIdx];
+                int32_t const firstSlotIdx = chunkIdx * m_slotsPerChunk;
+                int32_t const lastSlotIdx = Math::Min( firstSlotIdx + m_slotsPerChunk, numSlots );
+                for ( int32_t slotIdx = firstSlotIdx; slotIdx < lastSlotIdx; slotIdx++ )
+                {
+                    if ( !IsSlotAlive( slotIdx ) )
+                    {
+                        continue;
+                    }
+
+                    auto pComponent = reinterpret_cast<EntityComponent*>( pChunkMemory + ( ( slotIdx - firstSlotIdx ) * m_stride ) );
+                    if ( pComponent->IsInitialized() )
+                    {
+                        func( pComponent );
+                    }
+                }
+            }
+        }
+
+    private:
+
+        ComponentPool( ComponentPool const& ) = delete;
+        ComponentPool& operator=( ComponentPool const& ) = delete;
+
+        // Slot generations are odd while the slot is in use
+        inline bool IsSlotAlive( int32_t slotIdx ) const { return ( m_slotGenerations[slotIdx] & 1 ) != 0; }
+
+        inline uint8_t* GetSlotMemory( int32_t slotIdx ) const { return m_chunks[slotIdx / m_slotsPerChunk] + ( ( slotIdx % m_slotsPerChunk ) * m_stride ); }
+
+        // Get the slot that this component occupies in this pool, returns InvalidIndex if it isnt ours - the pool lock needs to be held
+        int32_t GetSlotIndex( EntityComponent const* pComponent ) const;
+
+        void AllocateChunks( int32_t numChunks );
+
+    private:
+
+        TypeSystem::TypeInfo const*                         m_pTypeInfo = nullptr;
+        size_t                                              m_stride = 0;
+        int32_t                                             m_slotsPerChunk = 0;
+        int32_t                                             m_numComponents = 0;
+        TVector<uint8_t*>                                   m_chunks;
+        TVector<uint32_t>                                   m_slotGenerations;
+        TVector<int32_t>                                    m_freeSlots;
+        mutable Threading::Mutex                            m_mutex;
+    };
+
+    //-------------------------------------------------------------------------
+
+    class EE_ENGINE_API ComponentStorage final
+    {
+    public:
+
+        ComponentStorage() = default;
+        ~ComponentStorage();
+
+        // Destroy all pools - all pooled components need to have been destroyed
+        void Shutdown();
+
+        // Create any missing pools and reserve space for all the components in the collection, this must not be called concurrently with any other storage operation
+        void Reserve( TypeSystem::TypeRegistry const& typeRegistry, SerializedEntityCollection const& entityCollection );
+
+        // Create a new component instance, the pool for this type needs to have been reserved. Thread-safe.
+        EntityComponent* CreateComponent( TypeSystem::TypeRegistry const& typeRegistry, SerializedComponentDescriptor const& componentDesc );
+
+        // Destroy a component if it was allocated from this storage, returns false if the component is not pooled. Thread-safe.
+        bool TryDestroyComponent( EntityComponent* pComponent );
+
+        // Get the pool for a given component type, returns null if no components of this type have been pooled
+        inline ComponentPool* GetPool( TypeSystem::TypeID typeID ) const
+        {
+            auto iter = m_pools.find( typeID );
+            return ( iter != m_pools.end() ) ? iter->second : nullptr;
+        }
+
+        // Iterate over all initialized pooled components of the specified type (derived types are stored in their own pools)
+        template<typename T, typename F>
+        inline void ForEach( F&& func ) const
+        {
+            if ( auto pPool = GetPool( T::GetStaticTypeID() ) )
+            {
+                pPool->ForEach( [&func] ( EntityComponent* pComponent ) { func( static_cast<T*>( pComponent ) ); } );
+            }
+        }
+
+    private:
+
+        THashMap<TypeSystem::TypeID, ComponentPool*>        m_pools;
+    };
+}
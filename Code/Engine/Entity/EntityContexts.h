@@ -13,6 +13,7 @@ namespace EE
     class EntityWorldSystem;
     namespace Resource { class ResourceSystem; }
     namespace TypeSystem { class TypeRegistry; }
+    namespace EntityModel { class TransformResolver; class ComponentStorage; class EntityIndex; }
 }
 
 //-------------------------------------------------------------------------
@@ -41,6 +42,7 @@ namespace EE::EntityModel
         TaskSystem*                                                     m_pTaskSystem = nullptr;
         TypeSystem::TypeRegistry const*                                 m_pTypeRegistry = nullptr;
         Resource::ResourceSystem*                                       m_pResourceSystem = nullptr;
+        ComponentStorage*                                               m_pComponentStorage = nullptr;          // Optional pooled storage to allocate created entities' components from
     };
 
     //-------------------------------------------------------------------------
@@ -79,13 +81,15 @@ namespace EE::EntityModel
             if ( m_pComponentTypeMap == nullptr ) return false;
             #endif
 
-            return m_pTaskSystem != nullptr && m_pTypeRegistry != nullptr;
+            return m_pTaskSystem != nullptr && m_pTypeRegistry != nullptr && m_pTransformResolver != nullptr && m_pEntityIndex != nullptr;
         }
 
     public:
 
         TaskSystem* const                                           m_pTaskSystem = nullptr;
         TypeSystem::TypeRegistry const*                             m_pTypeRegistry = nullptr;
+        TransformResolver* const                                    m_pTransformResolver = nullptr;
+        EntityIndex* const                                          m_pEntityIndex = nullptr;
 
         // World system registration
         Threading::LockFreeQueue<EntityComponentPair>               m_componentsToRegister;
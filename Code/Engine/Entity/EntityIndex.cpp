@@ -0,0 +1,171 @@
+#include "EntityIndex.h"
+#include "Entity.h"
+
+//-------------------------------------------------------------------------
+
+namespace EE::EntityModel
+{
+    constexpr static size_t const g_minNumBuckets = 64;
+
+    //-------------------------------------------------------------------------
+
+    EntityIndex::EntityIndex()
+    {
+        m_buckets.resize( g_minNumBuckets );
+    }
+
+    void EntityIndex::Reserve( int32_t numEntities )
+    {
+        Threading::ScopeWriteLock lock( m_mutex );
+
+        size_t numBucketsRequired = m_buckets.size();
+        while ( (size_t) numEntities * 2 > numBucketsRequired )
+        {
+            numBucketsRequired *= 2;
+        }
+
+        if ( numBucketsRequired != m_buckets.size() )
+        {
+            Rehash( numBucketsRequired );
+        }
+
+        m_slots.reserve( numEntities );
+    }
+
+    void EntityIndex::AddEntity( Entity* pEntity, EntityMap* pMap )
+    {
+        EE_ASSERT( pEntity != nullptr && pEntity->GetID().IsValid() && pMap != nullptr );
+
+        Threading::ScopeWriteLock lock( m_mutex );
+        EE_ASSERT( FindBucketIndex( pEntity->GetID().m_value ) == InvalidIndex );
+
+        // Keep the load factor at or below 0.5
+        if ( (size_t) ( m_numEntities + 1 ) * 2 > m_buckets.size() )
+        {
+            Rehash( m_buckets.size() * 2 );
+        }
+
+        // Get a slot
+        //-------------------------------------------------------------------------
+
+        int32_t slotIdx = InvalidIndex;
+        if ( !m_freeSlots.empty() )
+        {
+            slotIdx = m_freeSlots.back();
+            m_freeSlots.pop_back();
+        }
+        else
+        {
+            slotIdx = (int32_t) m_slots.size();
+            m_slots.emplace_back();
+        }
+
+        Slot& slot = m_slots[slotIdx];
+        slot.m_pEntity = pEntity;
+        slot.m_pMap = pMap;
+
+        //-------------------------------------------------------------------------
+
+        InsertIntoBuckets( pEntity->GetID().m_value, slotIdx );
+        m_numEntities++;
+    }
+
+    void EntityIndex::RemoveEntity( EntityID const& entityID )
+    {
+        Threading::ScopeWriteLock lock( m_mutex );
+
+        int32_t const bucketIdx = FindBucketIndex( entityID.m_value );
+        EE_ASSERT( bucketIdx != InvalidIndex );
+
+        // Release the slot, bumping the generation invalidates all handles to it
+        //-------------------------------------------------------------------------
+
+        int32_t const slotIdx = m_buckets[bucketIdx].m_slotIdx;
+        Slot& slot = m_slots[slotIdx];
+        slot.m_pEntity = nullptr;
+        slot.m_pMap = nullptr;
+        slot.m_generation++;
+        m_freeSlots.emplace_back( slotIdx );
+
+        // Backward shift deletion - move any following entries in the probe sequence into the hole, so we never need tombstones
+        //-------------------------------------------------------------------------
+
+        size_t const mask = m_buckets.size() - 1;
+        size_t holeIdx = (size_t) bucketIdx;
+        for ( size_t nextBucketIdx = ( holeIdx + 1 ) & mask; m_buckets[nextBucketIdx].m_entityID != 0; nextBucketIdx = ( nextBucketIdx + 1 ) & mask )
+        {
+            // Only move the entry if the hole lies in between its ideal bucket and its current bucket
+            size_t const idealBucketIdx = HashEntityID( m_buckets[nextBucketIdx].m_entityID ) & mask;
+            size_t const distanceFromIdeal = ( nextBucketIdx - idealBucketIdx ) & mask;
+            size_t const distanceFromHole = ( nextBucketIdx - holeIdx ) & mask;
+            if ( distanceFromIdeal >= distanceFromHole )
+            {
+                m_buckets[holeIdx] = m_buckets[nextBucketIdx];
+                holeIdx = nextBucketIdx;
+            }
+        }
+
+        m_buckets[holeIdx] = Bucket();
+        m_numEntities--;
+    }
+
+    void EntityIndex::Clear()
+    {
+        Threading::ScopeWriteLock lock( m_mutex );
+
+        m_buckets.clear();
+        m_buckets.resize( g_minNumBuckets );
+        m_slots.clear();
+        m_freeSlots.clear();
+        m_numEntities = 0;
+    }
+
+    EntityHandle EntityIndex::GetHandle( EntityID const& entityID ) const
+    {
+        EntityHandle handle;
+
+        Threading::ScopeReadLock lock( m_mutex );
+        int32_t const bucketIdx = FindBucketIndex( entityID.m_value );
+        if ( bucketIdx != InvalidIndex )
+        {
+            handle.m_slotIdx = m_buckets[bucketIdx].m_slotIdx;
+            handle.m_generation = m_slots[handle.m_slotIdx].m_generation;
+        }
+
+        return handle;
+    }
+
+    //-------------------------------------------------------------------------
+
+    void EntityIndex::InsertIntoBuckets( uint64_t entityID, int32_t slotIdx )
+    {
+        EE_ASSERT( entityID != 0 );
+
+        size_t const mask = m_buckets.size() - 1;
+        size_t bucketIdx = HashEntityID( entityID ) & mask;
+        while ( m_buckets[bucketIdx].m_entityID != 0 )
+        {
+            bucketIdx = ( bucketIdx + 1 ) & mask;
+        }
+
+        m_buckets[bucketIdx].m_entityID = entityID;
+        m_buckets[bucketIdx].m_slotIdx = slotIdx;
+    }
+
+    void EntityIndex::Rehash( size_t newNumBuckets )
+    {
+        EE_ASSERT( Math::IsPowerOf2( (uint32_t) newNumBuckets ) );
+
+        TVector<Bucket> oldBuckets;
+        oldBuckets.swap( m_buckets );
+        m_buckets.resize( newNumBuckets );
+
+        for ( auto const& bucket : oldBuckets )
+        {
+            if ( bucket.m_entityID != 0 )
+            {
+                InsertIntoBuckets( bucket.m_entityID, bucket.m_slotIdx );
+            }
+        }
+    }
+}
@@ -0,0 +1,158 @@
+#pragma once
+
+#include "Engine/_Module/API.h"
+#include "EntityIDs.h"
+#include "Base/Threading/Threading.h"
+#include "Base/Types/Arrays.h"
+
+//-------------------------------------------------------------------------
+// World Entity Index
+//-------------------------------------------------------------------------
+// A single lookup table for all entities across all the maps in a world, maintained by the maps as entities are added and removed.
+//
+// Entities are stored in a slot array and an open-addressing (linear probing) hash table maps entity IDs to slots. Slots carry a
+// generation that is incremented on removal, so an 'EntityHandle' can be resolved with a single array access and detects stale handles.
+//
+// The index is modified whenever a map adds or removes entities, which happens during loading but also from world systems spawning
+// entities in the middle of an update (while other systems may be running and looking up entities). Adding entities can grow (rehash)
+// the bucket table and the slot array, so all lookups take a shared read lock and all modifications take the exclusive write lock.
+
+namespace EE
+{
+    class Entity;
+    namespace EntityModel { class EntityMap; }
+
+    //-------------------------------------------------------------------------
+
+    // A generational handle to an entity in a world, resolves without any hashing
+    struct EntityHandle
+    {
+        inline bool IsValid() const { return m_slotIdx != InvalidIndex; }
+        inline void Clear() { m_slotIdx = InvalidIndex; m_generation = 0; }
+
+        inline bool operator==( EntityHandle const& rhs ) const { return m_slotIdx == rhs.m_slotIdx && m_generation == rhs.m_generation; }
+        inline bool operator!=( EntityHandle const& rhs ) const { return !operator==( rhs ); }
+
+    public:
+
+        int32_t                                             m_slotIdx = InvalidIndex;
+        uint32_t                                            m_generation = 0;
+    };
+}
+
+//-------------------------------------------------------------------------
+
+namespace EE::EntityModel
+{
+    class EE_ENGINE_API EntityIndex final
+    {
+        struct Slot
+        {
+            Entity*                                         m_pEntity = nullptr;
+            EntityMap*                                      m_pMap = nullptr;
+            uint32_t                                        m_generation = 0;
+        };
+
+        struct Bucket
+        {
+            uint64_t                                        m_entityID = 0; // 0 is the invalid ID and marks an empty bucket
+            int32_t                                         m_slotIdx = InvalidIndex;
+        };
+
+    public:
+
+        EntityIndex();
+
+        inline int32_t GetNumEntities() const { return m_numEntities; }
+
+        // Reserve space for the specified total number of entities
+        void Reserve( int32_t numEntities );
+
+        void AddEntity( Entity* pEntity, EntityMap* pMap );
+        void RemoveEntity( EntityID const& entityID );
+        void Clear();
+
+        // Lookups
+        //-------------------------------------------------------------------------
+
+        inline Entity* FindEntity( EntityID const& entityID ) const
+        {
+            Threading::ScopeReadLock lock( m_mutex );
+            int32_t const bucketIdx = FindBucketIndex( entityID.m_value );
+            return ( bucketIdx != InvalidIndex ) ? m_slots[m_buckets[bucketIdx].m_slotIdx].m_pEntity : nullptr;
+        }
+
+        inline EntityMap* FindMapForEntity( EntityID const& entityID ) const
+        {
+            Threading::ScopeReadLock lock( m_mutex );
+            int32_t const bucketIdx = FindBucketIndex( entityID.m_value );
+            return ( bucketIdx != InvalidIndex ) ? m_slots[m_buckets[bucketIdx].m_slotIdx].m_pMap : nullptr;
+        }
+
+        // Get a handle for an entity in the index, returns an invalid handle if the entity is not in the index
+        EntityHandle GetHandle( EntityID const& entityID ) const;
+
+        // Resolve a handle, returns null if the entity has since been removed
+        inline Entity* ResolveHandle( EntityHandle const& handle ) const
+        {
+            if ( !handle.IsValid() )
+            {
+                return nullptr;
+            }
+
+            Threading::ScopeReadLock lock( m_mutex );
+            if ( handle.m_slotIdx >= (int32_t) m_slots.size() )
+            {
+                return nullptr;
+            }
+
+            Slot const& slot = m_slots[handle.m_slotIdx];
+            return ( slot.m_generation == handle.m_generation ) ? slot.m_pEntity : nullptr;
+        }
+
+    private:
+
+        // Mix the ID bits since entity IDs are sequential
+        EE_FORCE_INLINE static uint64_t HashEntityID( uint64_t ID )
+        {
+            ID ^= ID >> 33;
+            ID *= 0xff51afd7ed558ccdULL;
+            ID ^= ID >> 33;
+            return ID;
+        }
+
+        inline int32_t FindBucketIndex( uint64_t entityID ) const
+        {
+            if ( entityID == 0 )
+            {
+                return InvalidIndex;
+            }
+
+            uint64_t const mask = m_buckets.size() - 1;
+            for ( uint64_t bucketIdx = HashEntityID( entityID ) & mask; ; bucketIdx = ( bucketIdx + 1 ) & mask )
+            {
+                Bucket const& bucket = m_buckets[bucketIdx];
+                if ( bucket.m_entityID == entityID )
+                {
+                    return (int32_t) bucketIdx;
+                }
+
+                if ( bucket.m_entityID == 0 )
+                {
+                    return InvalidIndex;
+                }
+            }
+        }
+
+        void InsertIntoBuckets( uint64_t entityID, int32_t slotIdx );
+        void Rehash( size_t newNumBuckets );
+
+    private:
+
+        TVector<Bucket>                                     m_buckets;          // Always a power of two in size and at most half full
+        TVector<Slot>                                       m_slots;
+        TVector<int32_t>                                    m_freeSlots;
+        int32_t                                             m_numEntities = 0;
+        mutable Threading::ReadWriteMutex                   m_mutex;
+    };
+}
@@ -1,4 +1,5 @@
 #include "EntityMap.h"
+#include "EntityIndex.h"
 #include "EntityLog.h"
 #include "EntityContexts.h"
 #include "EntitySerialization.h"
@@ -73,6 +74,7 @@ namespace EE::EntityModel
         m_ID = map.m_ID;
         m_entities.swap( map.m_entities );
         m_entityIDLookupMap.swap( map.m_entityIDLookupMap );
+        m_pWorldEntityIndex = map.m_pWorldEntityIndex;
         m_pMapDesc = eastl::move( map.m_pMapDesc );
         m_entitiesCurrentlyLoading = eastl::move( map.m_entitiesCurrentlyLoading );
         m_status = map.m_status;
@@ -88,7 +90,7 @@ namespace EE::EntityModel
     // Entity Management
     //-------------------------------------------------------------------------
 
-    void EntityMap::AddEntities( TVector<Entity*> const& entities, Transform const& offsetTransform )
+    void EntityMap::AddEntities( TVector<Entity*> const& entities, Transform const& offsetTransform, Resource::ResourceLoadPriority loadPriority )
     {
         Threading::RecursiveScopeLock lock( m_mutex );
 
@@ -109,11 +111,11 @@ namespace EE::EntityModel
                 pEntity->SetWorldTransform( pEntity->GetWorldTransform() * offsetTransform );
             }
 
-            AddEntity( pEntity );
+            AddEntity( pEntity, loadPriority );
         }
     }
 
-    void EntityMap::AddEntity( Entity* pEntity )
+    void EntityMap::AddEntity( Entity* pEntity, Resource::ResourceLoadPriority loadPriority )
     {
         // Ensure that the entity to add, is not already part of a collection and that it is not initialized
         EE_ASSERT( pEntity != nullptr && !pEntity->IsAddedToMap() && !pEntity->HasRequestedComponentLoad() );
@@ -138,6 +140,7 @@ namespace EE::EntityModel
         Threading::RecursiveScopeLock lock( m_mutex );
 
         pEntity->m_mapID = m_ID;
+        pEntity->m_loadPriority = loadPriority;
         m_entities.emplace_back( pEntity );
         m_entitiesToLoad.emplace_back( pEntity );
 
@@ -145,12 +148,18 @@ namespace EE::EntityModel
         //-------------------------------------------------------------------------
 
         m_entityIDLookupMap.insert( TPair<EntityID, Entity*>( pEntity->m_ID, pEntity ) );
+
+        if ( m_pWorldEntityIndex != nullptr )
+        {
+            m_pWorldEntityIndex->AddEntity( pEntity, this );
+        }
+
         #if EE_DEVELOPMENT_TOOLS
         m_entityNameLookupMap.insert( TPair<StringID, Entity*>( pEntity->m_name, pEntity ) );
         #endif
     }
 
-    void EntityMap::AddEntityCollection( TaskSystem* pTaskSystem, TypeSystem::TypeRegistry const& typeRegistry, SerializedEntityCollection const& entityCollectionDesc, Transform const& offsetTransform, TVector<Entity*>* pOutCreatedEntities )
+    void EntityMap::AddEntityCollection( TaskSystem* pTaskSystem, TypeSystem::TypeRegistry const& typeRegistry, SerializedEntityCollection const& entityCollectionDesc, Transform const& offsetTransform, TVector<Entity*>* pOutCreatedEntities, Resource::ResourceLoadPriority loadPriority )
     {
         TVector<Entity*> scratchVector;
         TVector<Entity*>& createdEntities = ( pOutCreatedEntities != nullptr ) ? *pOutCreatedEntities : scratchVector;
@@ -159,7 +168,7 @@ namespace EE::EntityModel
 
         createdEntities.clear();
         createdEntities = Serializer::CreateEntities( pTaskSystem, typeRegistry, entityCollectionDesc );
-        AddEntities( createdEntities, offsetTransform );
+        AddEntities( createdEntities, offsetTransform, loadPriority );
     }
 
     Entity* EntityMap::RemoveEntityInternal( EntityID entityID, bool destroyEntityOnceRemoved )
@@ -203,6 +212,11 @@ namespace EE::EntityModel
         EE_ASSERT( IDLookupIter != m_entityIDLookupMap.end() );
         m_entityIDLookupMap.erase( IDLookupIter );
 
+        if ( m_pWorldEntityIndex != nullptr )
+        {
+            m_pWorldEntityIndex->RemoveEntity( pEntityToRemove->m_ID );
+        }
+
         #if EE_DEVELOPMENT_TOOLS
         auto nameLookupIter = m_entityNameLookupMap.find( pEntityToRemove->m_name );
         EE_ASSERT( nameLookupIter != m_entityNameLookupMap.end() );
@@ -276,13 +290,23 @@ namespace EE::EntityModel
 
         Threading::RecursiveScopeLock lock( m_mutex );
 
+        // Register with the world entity index, this includes any entities that were added before the map was loaded
+        m_pWorldEntityIndex = initializationContext.m_pEntityIndex;
+        if ( m_pWorldEntityIndex != nullptr )
+        {
+            for ( auto pEntity : m_entities )
+            {
+                m_pWorldEntityIndex->AddEntity( pEntity, this );
+            }
+        }
+
         if ( m_isTransientMap )
         {
             m_status = Status::Loaded;
         }
         else // Request loading of map resource
         {
-            loadingContext.m_pResourceSystem->LoadResource( m_pMapDesc );
+            loadingContext.m_pResourceSystem->LoadResource( m_pMapDesc, Resource::ResourceRequesterID( Resource::ResourceLoadPriority::Critical ) );
             m_status = Status::Loading;
         }
     }
@@ -317,22 +341,28 @@ namespace EE::EntityModel
         if ( m_pMapDesc->IsValid() )
         {
             // Create all required entities
-            TVector<Entity*> const createdEntities = Serializer::CreateEntities( loadingContext.m_pTaskSystem, *loadingContext.m_pTypeRegistry, *m_pMapDesc.GetPtr() );
+            TVector<Entity*> const createdEntities = Serializer::CreateEntities( loadingContext.m_pTaskSystem, *loadingContext.m_pTypeRegistry, *m_pMapDesc.GetPtr(), loadingContext.m_pComponentStorage );
 
             // Reserve memory for new entities in internal structures
             m_entities.reserve( m_entities.size() + createdEntities.size() );
             m_entitiesToLoad.reserve( m_entitiesToLoad.size() + createdEntities.size() );
             m_entityIDLookupMap.reserve( m_entityIDLookupMap.size() + createdEntities.size() );
+
+            if ( m_pWorldEntityIndex != nullptr )
+            {
+                m_pWorldEntityIndex->Reserve( m_pWorldEntityIndex->GetNumEntities() + (int32_t) createdEntities.size() );
+            }
+
             m_entitiesCurrentlyLoading.reserve( m_entitiesCurrentlyLoading.size() + createdEntities.size() );
 
             #if EE_DEVELOPMENT_TOOLS
             m_entityNameLookupMap.reserve( m_entityNameLookupMap.size() + createdEntities.size() );
             #endif
 
-            // Add entities
+            // Add entities, the map's own content is needed before gameplay can start
             for ( auto pEntity : createdEntities )
             {
-                AddEntity( pEntity );
+                AddEntity( pEntity, Resource::ResourceLoadPriority::Critical );
             }
 
             m_status = Status::Loaded;
@@ -425,6 +455,12 @@ namespace EE::EntityModel
         for ( auto& pEntity : m_entities )
         {
             EE_ASSERT( !pEntity->IsInitialized() );
+
+            if ( m_pWorldEntityIndex != nullptr )
+            {
+                m_pWorldEntityIndex->RemoveEntity( pEntity->m_ID );
+            }
+
             if ( pEntity->IsLoaded() )
             {
                 pEntity->UnloadComponents( loadingContext );
@@ -28,6 +28,7 @@ namespace EE
         struct LoadingContext;
         struct InitializationContext;
         class SerializedEntityCollection;
+        class EntityIndex;
 
         //-------------------------------------------------------------------------
 
@@ -114,15 +115,16 @@ namespace EE
             // Adds a set of entities to this map - Transfers ownership of the entities to the map
             // Additionally allows you to offset all the entities via the supplied offset transform
             // Takes 1 frame to be fully added
-            void AddEntities( TVector<Entity*> const& entities, Transform const& offsetTransform = Transform::Identity );
+            void AddEntities( TVector<Entity*> const& entities, Transform const& offsetTransform = Transform::Identity, Resource::ResourceLoadPriority loadPriority = Resource::ResourceLoadPriority::Normal );
 
             // Instantiates and adds an entity collection to the map
             // Additionally allows you to offset all the entities via the supplied offset transform
             // Takes 1 frame to be fully added
-            void AddEntityCollection( TaskSystem* pTaskSystem, TypeSystem::TypeRegistry const& typeRegistry, SerializedEntityCollection const& entityCollectionDesc, Transform const& offsetTransform = Transform::Identity, TVector<Entity*>* pOutCreatedEntities = nullptr );
+            void AddEntityCollection( TaskSystem* pTaskSystem, TypeSystem::TypeRegistry const& typeRegistry, SerializedEntityCollection const& entityCollectionDesc, Transform const& offsetTransform = Transform::Identity, TVector<Entity*>* pOutCreatedEntities = nullptr, Resource::ResourceLoadPriority loadPriority = Resource::ResourceLoadPriority::Normal );
 
             // Add a newly created entity to the map - Transfers ownership of the entity to the map
-            void AddEntity( Entity* pEntity );
+            // The load priority is used for all the entity's resource requests, use streaming for content that can be delayed
+            void AddEntity( Entity* pEntity, Resource::ResourceLoadPriority loadPriority = Resource::ResourceLoadPriority::Normal );
 
             // Unload and remove an entity from the map - Transfer ownership of the entity to the calling code
             // May take multiple frames to be fully destroyed, as the shutdown/unload occurs during the loading update
@@ -189,6 +191,7 @@ namespace EE
             TResourcePtr<SerializedEntityMap>           m_pMapDesc;
             TVector<Entity*>                            m_entities;
             THashMap<EntityID, Entity*>                 m_entityIDLookupMap;
+            EntityIndex*                                m_pWorldEntityIndex = nullptr; // The index of all entities in the world we are loaded into (set on load)
             TVector<Entity*>                            m_entitiesCurrentlyLoading;
             TInlineVector<Entity*, 5>                   m_entitiesToLoad;
             TInlineVector<RemovalRequest, 5>            m_entitiesToRemove;
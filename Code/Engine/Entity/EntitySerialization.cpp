@@ -7,13 +7,14 @@
 #include "EntityLog.h"
 #include "EntitySystem.h"
 #include "EntityMap.h"
+#include "EntityComponentStorage.h"
 #include "EASTL/sort.h"
 
 //-------------------------------------------------------------------------
 
 namespace EE::EntityModel
 {
-    Entity* Serializer::CreateEntity( TypeSystem::TypeRegistry const& typeRegistry, SerializedEntityDescriptor const& entityDesc )
+    Entity* Serializer::CreateEntity( TypeSystem::TypeRegistry const& typeRegistry, SerializedEntityDescriptor const& entityDesc, ComponentStorage* pComponentStorage )
     {
         EE_ASSERT( entityDesc.IsValid() );
 
@@ -25,6 +26,7 @@ namespace EE::EntityModel
 
         auto pEntity = reinterpret_cast<Entity*>( pEntityTypeInfo->CreateType() );
         pEntity->m_name = entityDesc.m_name;
+        pEntity->m_pComponentStorage = pComponentStorage;
 
         #if EE_DEVELOPMENT_TOOLS
         // Restore entity ID if valid
@@ -40,7 +42,7 @@ namespace EE::EntityModel
 
         for ( EntityModel::SerializedComponentDescriptor const& componentDesc : entityDesc.m_components )
         {
-            auto pEntityComponent = componentDesc.CreateTypeInstance<EntityComponent>( typeRegistry );
+            auto pEntityComponent = ( pComponentStorage != nullptr ) ? pComponentStorage->CreateComponent( typeRegistry, componentDesc ) : componentDesc.CreateTypeInstance<EntityComponent>( typeRegistry );
             EE_ASSERT( pEntityComponent != nullptr );
 
             TypeSystem::TypeInfo const* pTypeInfo = pEntityComponent->GetTypeInfo();
@@ -131,7 +133,7 @@ namespace EE::EntityModel
         return pEntity;
     }
 
-    TVector<Entity*> Serializer::CreateEntities( TaskSystem* pTaskSystem, TypeSystem::TypeRegistry const& typeRegistry, SerializedEntityCollection const& entityCollection )
+    TVector<Entity*> Serializer::CreateEntities( TaskSystem* pTaskSystem, TypeSystem::TypeRegistry const& typeRegistry, SerializedEntityCollection const& entityCollection, ComponentStorage* pComponentStorage )
     {
         EE_PROFILE_SCOPE_ENTITY( "Instantiate Entity Collection" );
 
@@ -139,6 +141,12 @@ namespace EE::EntityModel
         TVector<Entity*> createdEntities;
         createdEntities.resize( numEntitiesToCreate );
 
+        // Allocate all the storage needed for the collection's components up front
+        if ( pComponentStorage != nullptr )
+        {
+            pComponentStorage->Reserve( typeRegistry, entityCollection );
+        }
+
         //-------------------------------------------------------------------------
 
         // For small number of entities, just create them inline!
@@ -146,17 +154,18 @@ namespace EE::EntityModel
         {
             for ( auto i = 0; i < numEntitiesToCreate; i++ )
             {
-                createdEntities[i] = CreateEntity( typeRegistry, entityCollection.m_entityDescriptors[i] );
+                createdEntities[i] = CreateEntity( typeRegistry, entityCollection.m_entityDescriptors[i], pComponentStorage );
             }
         }
         else // Go wide and create all entities in parallel
         {
             struct EntityCreationTask : public ITaskSet
             {
-                EntityCreationTask( TypeSystem::TypeRegistry const& typeRegistry, TVector<SerializedEntityDescriptor> const& descriptors, TVector<Entity*>& createdEntities )
+                EntityCreationTask( TypeSystem::TypeRegistry const& typeRegistry, TVector<SerializedEntityDescriptor> const& descriptors, TVector<Entity*>& createdEntities, ComponentStorage* pComponentStorage )
                     : m_typeRegistry( typeRegistry )
                     , m_descriptors( descriptors )
                     , m_createdEntities( createdEntities )
+                    , m_pComponentStorage( pComponentStorage )
                 {
                     m_SetSize = (uint32_t) descriptors.size();
                     m_MinRange = 10;
@@ -167,7 +176,7 @@ namespace EE::EntityModel
                     EE_PROFILE_SCOPE_ENTITY( "Entity Creation Task" );
                     for ( uint64_t i = range.start; i < range.end; ++i )
                     {
-                        m_createdEntities[i] = CreateEntity( m_typeRegistry, m_descriptors[i] );
+                        m_createdEntities[i] = CreateEntity( m_typeRegistry, m_descriptors[i], m_pComponentStorage );
                     }
                 }
 
@@ -176,12 +185,13 @@ namespace EE::EntityModel
                 TypeSystem::TypeRegistry const&                     m_typeRegistry;
                 TVector<SerializedEntityDescriptor> const&          m_descriptors;
                 TVector<Entity*>&                                   m_createdEntities;
+                ComponentStorage*                                   m_pComponentStorage = nullptr;
             };
 
             //-------------------------------------------------------------------------
 
             // Create all entities in parallel
-            EntityCreationTask updateTask( typeRegistry, entityCollection.m_entityDescriptors, createdEntities );
+            EntityCreationTask updateTask( typeRegistry, entityCollection.m_entityDescriptors, createdEntities, pComponentStorage );
             pTaskSystem->ScheduleTask( &updateTask );
             pTaskSystem->WaitForTask( &updateTask );
         }
@@ -9,7 +9,7 @@ namespace EE
     class Entity;
     class TaskSystem;
     namespace TypeSystem { class TypeRegistry; }
-    namespace EntityModel { class EntityMap; struct SerializedEntityDescriptor; class SerializedEntityCollection; struct SerializedComponentDescriptor; }
+    namespace EntityModel { class EntityMap; class ComponentStorage; struct SerializedEntityDescriptor; class SerializedEntityCollection; struct SerializedComponentDescriptor; }
 }
 
 //-------------------------------------------------------------------------
@@ -18,8 +18,11 @@ namespace EE::EntityModel
 {
     struct EE_ENGINE_API Serializer
     {
-        static Entity* CreateEntity( TypeSystem::TypeRegistry const& typeRegistry, SerializedEntityDescriptor const& entityDesc );
-        static TVector<Entity*> CreateEntities( TaskSystem* pTaskSystem, TypeSystem::TypeRegistry const& typeRegistry, SerializedEntityCollection const& entityCollection );
+        // If a component storage is provided, the components will be allocated from the storage's pools (which need to have been reserved for these components)
+        static Entity* CreateEntity( TypeSystem::TypeRegistry const& typeRegistry, SerializedEntityDescriptor const& entityDesc, ComponentStorage* pComponentStorage = nullptr );
+
+        // If a component storage is provided, space for all the components in the collection is reserved up front and the components are allocated from the storage's pools
+        static TVector<Entity*> CreateEntities( TaskSystem* pTaskSystem, TypeSystem::TypeRegistry const& typeRegistry, SerializedEntityCollection const& entityCollection, ComponentStorage* pComponentStorage = nullptr );
 
         //-------------------------------------------------------------------------
 
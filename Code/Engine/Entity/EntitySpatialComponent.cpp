@@ -135,7 +135,72 @@ namespace EE
     {
         for ( auto& pChildComponent : m_spatialChildren )
         {
-            pChildComponent->CalculateWorldTransform();
+            if ( pChildComponent->IsTransformUpdateDeferred() )
+            {
+                pChildComponent->m_shouldFireTransformCallback = true;
+                pChildComponent->MarkTransformDirty();
+            }
+            else
+            {
+                pChildComponent->CalculateWorldTransform();
+            }
+        }
+    }
+
+    void SpatialEntityComponent::ResolveDeferredWorldTransform( bool wasParentUpdated )
+    {
+        // Our parent has already been resolved at this point, so we can safely derive our transforms from it
+        if ( m_pSpatialParent != nullptr )
+        {
+            auto parentWorldTransform = m_pSpatialParent->GetAttachmentSocketTransform( m_parentAttachmentSocketID );
+            if ( m_hasPendingWorldTransform )
+            {
+                m_transform = Transform::Delta( parentWorldTransform, m_worldTransform );
+            }
+            else
+            {
+                m_worldTransform = m_transform * parentWorldTransform;
+            }
+        }
+        else
+        {
+            if ( m_hasPendingWorldTransform )
+            {
+                m_transform = m_worldTransform;
+            }
+            else
+            {
+                m_worldTransform = m_transform;
+            }
+        }
+
+        // Calculate world bounds
+        m_worldBounds = m_bounds.GetTransformed( m_worldTransform );
+
+        // Children will always have their callbacks fired (same as for immediate updates)
+        m_hasPendingTransformCallback = wasParentUpdated || m_shouldFireTransformCallback;
+        m_isTransformDirty = false;
+        m_hasPendingWorldTransform = false;
+        m_shouldFireTransformCallback = false;
+
+        for ( auto pChild : m_spatialChildren )
+        {
+            pChild->ResolveDeferredWorldTransform( true );
+        }
+    }
+
+    void SpatialEntityComponent::DispatchDeferredTransformCallbacks()
+    {
+        // Same order as for immediate updates, children are notified before their parent
+        for ( auto pChild : m_spatialChildren )
+        {
+            pChild->DispatchDeferredTransformCallbacks();
+        }
+
+        if ( m_hasPendingTransformCallback )
+        {
+            m_hasPendingTransformCallback = false;
+            OnWorldTransformUpdated();
         }
     }
 
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "EntityComponent.h"
+#include "EntityTransformResolver.h"
 #include "Base/Math/BoundingVolumes.h"
 #include "Base/Math/Transform.h"
 
@@ -26,6 +27,7 @@ namespace EE
         friend EntityModel::Serializer;
         friend EntityModel::EntityMapEditor;
         friend EntityModel::EntityCollection;
+        friend EntityModel::TransformResolver;
 
         #if EE_DEVELOPMENT_TOOLS
         friend EntityModel::EntityEditorWorkspace;
@@ -69,10 +71,21 @@ namespace EE
         inline Vector GetRightVector() const { return m_worldTransform.GetRightVector(); }
 
         // Call to update the local transform - this will also update the world transform for this component and all children
+        // Note: if transform updates are deferred, the world transform will only be updated on the next world transform resolve
         inline void SetLocalTransform( Transform const& newTransform )
         {
             m_transform = newTransform;
-            CalculateWorldTransform();
+
+            if ( IsTransformUpdateDeferred() )
+            {
+                m_hasPendingWorldTransform = false;
+                m_shouldFireTransformCallback = true;
+                MarkTransformDirty();
+            }
+            else
+            {
+                CalculateWorldTransform();
+            }
         }
 
         // Call to update the world transform - this will also updated the local transform for this component and all children's world transforms
@@ -81,6 +94,9 @@ namespace EE
             SetWorldTransformDirectly( newTransform );
         }
 
+        // Is the world transform (and bounds) for this component or any of its children waiting to be resolved?
+        inline bool IsTransformDirty() const { return m_isTransformDirty; }
+
         // Move the component by the specified delta transform
         inline void MoveByDelta( Transform const& deltaTransform )
         {
@@ -188,6 +204,33 @@ namespace EE
         // This must be used with care and so not be exposed externally.
         inline void SetWorldTransformDirectly( Transform newWorldTransform, bool triggerCallback = true )
         {
+            // The world transform is available immediately but the bounds and children are only updated on the next resolve
+            if ( IsTransformUpdateDeferred() )
+            {
+                m_worldTransform = newWorldTransform;
+                m_shouldFireTransformCallback |= triggerCallback;
+
+                // If our parent's world transform is up to date, derive the local transform immediately so that any later parent moves in this stage will move us (same as for immediate updates)
+                // Otherwise, the local transform can only be derived from the resolved parent transform, so we will keep this world transform even if the parent moves again before the resolve
+                if ( m_pSpatialParent == nullptr )
+                {
+                    m_transform = newWorldTransform;
+                    m_hasPendingWorldTransform = false;
+                }
+                else if ( !HasDirtyAncestor() )
+                {
+                    m_transform = Transform::Delta( m_pSpatialParent->GetAttachmentSocketTransform( m_parentAttachmentSocketID ), m_worldTransform );
+                    m_hasPendingWorldTransform = false;
+                }
+                else
+                {
+                    m_hasPendingWorldTransform = true;
+                }
+
+                MarkTransformDirty();
+                return;
+            }
+
             // Only update the transform if we have a parent, if we dont have a parent it means we are the root transform
             if ( m_pSpatialParent != nullptr )
             {
@@ -223,6 +266,39 @@ namespace EE
 
     private:
 
+        inline bool IsTransformUpdateDeferred() const { return m_pTransformResolver != nullptr && m_pTransformResolver->IsDeferringUpdates(); }
+
+        // Flag this component as dirty and queue it for the next resolve
+        inline void MarkTransformDirty()
+        {
+            if ( !m_isTransformDirty )
+            {
+                m_isTransformDirty = true;
+                m_pTransformResolver->EnqueueDirtyComponent( this );
+            }
+        }
+
+        // Is any component above us in the spatial hierarchy waiting to be resolved
+        inline bool HasDirtyAncestor() const
+        {
+            for ( auto pAncestor = m_pSpatialParent; pAncestor != nullptr; pAncestor = pAncestor->m_pSpatialParent )
+            {
+                if ( pAncestor->m_isTransformDirty )
+                {
+                    return true;
+                }
+            }
+
+            return false;
+        }
+
+        // Update the world transform and bounds for this component and all children from the deferred state
+        // This doesnt fire the transform callbacks, it only flags the components that need them, as it can be run from any thread
+        void ResolveDeferredWorldTransform( bool wasParentUpdated );
+
+        // Fire the transform callbacks flagged by the last resolve for this component and all children
+        void DispatchDeferredTransformCallbacks();
+
         // Called whenever the local transform is modified
         inline void CalculateWorldTransform( bool triggerCallback = true )
         {
@@ -267,6 +343,14 @@ namespace EE
 
         //-------------------------------------------------------------------------
 
+        EntityModel::TransformResolver*                                     m_pTransformResolver = nullptr;         // The world's transform resolver (set by the entity on initialization)
+        bool                                                                m_isTransformDirty = false;             // Are we queued for the next transform resolve
+        bool                                                                m_hasPendingWorldTransform = false;     // Was the world transform set directly, i.e. the local transform needs to be derived on resolve
+        bool                                                                m_shouldFireTransformCallback = false;  // Should we fire the world transform callback on resolve
+        bool                                                                m_hasPendingTransformCallback = false;  // Was this component resolved and is waiting for its callback to be dispatched
+
+        //-------------------------------------------------------------------------
+
         #if EE_DEVELOPMENT_TOOLS
         bool                                                                m_boundsValidationGuard = false;
         #endif
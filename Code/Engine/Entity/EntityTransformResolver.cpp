@@ -0,0 +1,138 @@
+#include "EntityTransformResolver.h"
+#include "EntitySpatialComponent.h"
+#include "Base/Threading/TaskSystem.h"
+#include "Base/Profiling.h"
+#include <eastl/sort.h>
+
+//-------------------------------------------------------------------------
+
+namespace EE::EntityModel
+{
+    void TransformResolver::Initialize( TaskSystem* pTaskSystem )
+    {
+        EE_ASSERT( pTaskSystem != nullptr );
+        m_pTaskSystem = pTaskSystem;
+    }
+
+    void TransformResolver::Shutdown()
+    {
+        ResolveTransforms();
+        m_dirtyRoots.clear();
+        m_pTaskSystem = nullptr;
+    }
+
+    void TransformResolver::SetEnabled( bool isEnabled )
+    {
+        if ( !isEnabled )
+        {
+            ResolveTransforms();
+        }
+
+        m_isEnabled = isEnabled;
+    }
+
+    void TransformResolver::Suspend()
+    {
+        EE_ASSERT( !m_isSuspended );
+        ResolveTransforms();
+        m_isSuspended = true;
+    }
+
+    void TransformResolver::Resume()
+    {
+        EE_ASSERT( m_isSuspended );
+        m_isSuspended = false;
+    }
+
+    //-------------------------------------------------------------------------
+
+    void TransformResolver::ResolveTransforms()
+    {
+        struct ResolveTask final : public ITaskSet
+        {
+            constexpr static uint32_t const s_minHierarchiesPerChunk = 16;
+
+            ResolveTask( TVector<SpatialEntityComponent*> const& dirtyRoots )
+                : m_dirtyRoots( dirtyRoots )
+            {
+                m_SetSize = (uint32_t) dirtyRoots.size();
+                m_MinRange = s_minHierarchiesPerChunk;
+            }
+
+            virtual void ExecuteRange( TaskSetPartition range, uint32_t threadnum ) override final
+            {
+                for ( uint32_t i = range.start; i < range.end; ++i )
+                {
+                    m_dirtyRoots[i]->ResolveDeferredWorldTransform( false );
+                }
+            }
+
+        private:
+
+            TVector<SpatialEntityComponent*> const&     m_dirtyRoots;
+        };
+
+        //-------------------------------------------------------------------------
+
+        if ( !HasPendingTransforms() )
+        {
+            return;
+        }
+
+        EE_PROFILE_FUNCTION_ENTITY();
+
+        // Find the top-most dirty component for each dirty hierarchy
+        //-------------------------------------------------------------------------
+        // Any component with a dirty ancestor will be resolved as part of that ancestor's hierarchy, this ensures that the resulting hierarchies are disjoint
+
+        m_dirtyRoots.clear();
+
+        SpatialEntityComponent* pDirtyComponent = nullptr;
+        while ( m_dirtyComponents.try_dequeue( pDirtyComponent ) )
+        {
+            EE_ASSERT( pDirtyComponent != nullptr );
+
+            // Already resolved as part of another hierarchy
+            if ( !pDirtyComponent->m_isTransformDirty )
+            {
+                continue;
+            }
+
+            if ( !pDirtyComponent->HasDirtyAncestor() )
+            {
+                m_dirtyRoots.emplace_back( pDirtyComponent );
+            }
+        }
+
+        // A component can be queued more than once if it was dirtied concurrently from multiple threads
+        eastl::sort( m_dirtyRoots.begin(), m_dirtyRoots.end() );
+        m_dirtyRoots.erase( eastl::unique( m_dirtyRoots.begin(), m_dirtyRoots.end() ), m_dirtyRoots.end() );
+
+        // Resolve hierarchies
+        //-------------------------------------------------------------------------
+
+        ResolveTask resolveTask( m_dirtyRoots );
+        if ( m_pTaskSystem != nullptr && m_dirtyRoots.size() > ResolveTask::s_minHierarchiesPerChunk )
+        {
+            m_pTaskSystem->ScheduleTask( &resolveTask );
+            m_pTaskSystem->WaitForTask( &resolveTask );
+        }
+        else
+        {
+            resolveTask.ExecuteRange( { 0u, (uint32_t) m_dirtyRoots.size() }, 0 );
+        }
+
+        // Dispatch callbacks
+        //-------------------------------------------------------------------------
+        // The callbacks update world system state (i.e. renderer/physics tracking) so are never run from the resolve tasks
+        // Any transforms dirtied by the transform callbacks will be resolved on the next resolve
+
+        {
+            EE_PROFILE_SCOPE_ENTITY( "Dispatch Transform Callbacks" );
+            for ( auto pDirtyRoot : m_dirtyRoots )
+            {
+                pDirtyRoot->DispatchDeferredTransformCallbacks();
+            }
+        }
+    }
+}
@@ -0,0 +1,74 @@
+#pragma once
+
+#include "Engine/_Module/API.h"
+#include "Base/Threading/Threading.h"
+#include "Base/Types/Arrays.h"
+
+//-------------------------------------------------------------------------
+// Deferred Spatial Transform Resolver
+//-------------------------------------------------------------------------
+// When deferred transform updates are enabled, setting a spatial component's transform only flags it as dirty and queues it here.
+// The world then resolves all queued components at the end of the entity and system updates for each stage. Each dirty hierarchy
+// is walked once from its top-most dirty component downwards and independent hierarchies are resolved in parallel. The
+// 'OnWorldTransformUpdated' callbacks are then dispatched serially on the thread calling the resolve, since world systems
+// track transform changes in unsynchronized state.
+//
+// This means that world transforms, world bounds and the callbacks are only updated once per component per resolve no matter how many
+// times a transform in the hierarchy was set. The cost is that world transforms read in between are stale until the next resolve
+// (except for the component whose world transform was set directly).
+//
+// Setting a world transform directly matches the immediate behavior as long as the parent's transform is up to date at that point.
+// If the parent (or any ancestor) is itself waiting to be resolved, the component keeps the world transform that was set, even if
+// that ancestor is moved again later in the same stage (an immediate update would have moved the component along with it).
+
+namespace EE
+{
+    class TaskSystem;
+    class SpatialEntityComponent;
+}
+
+//-------------------------------------------------------------------------
+
+namespace EE::EntityModel
+{
+    class EE_ENGINE_API TransformResolver final
+    {
+    public:
+
+        void Initialize( TaskSystem* pTaskSystem );
+
+        // Resolves any pending transforms, all queued components need to still be alive at this point
+        void Shutdown();
+
+        // Should spatial transform updates be deferred until the next resolve?
+        inline bool IsEnabled() const { return m_isEnabled; }
+
+        // Enable/disable deferred transform updates, disabling will immediately resolve any pending transforms
+        void SetEnabled( bool isEnabled );
+
+        // Are transform updates currently being deferred?
+        inline bool IsDeferringUpdates() const { return m_isEnabled && !m_isSuspended; }
+
+        // Temporarily switch back to immediate transform updates (i.e. while entities are being loaded/destroyed), resolves all pending transforms
+        void Suspend();
+        void Resume();
+
+        // Queue a component whose transform was modified - this is thread-safe
+        inline void EnqueueDirtyComponent( SpatialEntityComponent* pComponent ) { m_dirtyComponents.enqueue( pComponent ); }
+
+        // Do we have any queued components that need to be resolved
+        inline bool HasPendingTransforms() const { return m_dirtyComponents.size_approx() > 0; }
+
+        // Resolve the world transforms for all queued components and their children and dispatch their transform callbacks on the calling thread
+        // This must not be called concurrently with any transform updates
+        void ResolveTransforms();
+
+    private:
+
+        TaskSystem*                                                 m_pTaskSystem = nullptr;
+        Threading::LockFreeQueue<SpatialEntityComponent*>           m_dirtyComponents;
+        TVector<SpatialEntityComponent*>                            m_dirtyRoots;
+        bool                                                        m_isEnabled = false;
+        bool                                                        m_isSuspended = false;
+    };
+}
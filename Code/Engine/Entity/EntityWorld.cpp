@@ -48,8 +48,12 @@ namespace EE
 
         //-------------------------------------------------------------------------
 
+        m_transformResolver.Initialize( m_pTaskSystem );
+
         const_cast<TaskSystem*&>( m_initializationContext.m_pTaskSystem ) = m_pTaskSystem;
         const_cast<TypeSystem::TypeRegistry const*&>( m_initializationContext.m_pTypeRegistry ) = m_loadingContext.m_pTypeRegistry;
+        const_cast<EntityModel::TransformResolver*&>( m_initializationContext.m_pTransformResolver ) = &m_transformResolver;
+        const_cast<EntityModel::EntityIndex*&>( m_initializationContext.m_pEntityIndex ) = &m_entityIndex;
         
         #if EE_DEVELOPMENT_TOOLS
         m_initializationContext.SetComponentTypeMapPtr( &m_componentTypeLookup );
@@ -88,6 +92,8 @@ namespace EE
             }
         }
 
+        BuildSystemUpdateGroups();
+
         // Create and initialize the persistent map
         //-------------------------------------------------------------------------
 
@@ -138,10 +144,19 @@ namespace EE
             EE::Delete( pWorldSystem );
         }
 
+        for ( int8_t i = 0; i < (int8_t) UpdateStage::NumStages; i++ )
+        {
+            m_systemUpdateGroupEnds[i].clear();
+        }
+
         m_worldSystems.clear();
 
         //-------------------------------------------------------------------------
 
+        m_transformResolver.Shutdown();
+        m_componentStorage.Shutdown();
+        EE_ASSERT( m_entityIndex.GetNumEntities() == 0 );
+        m_entityIndex.Clear();
         m_pTaskSystem = nullptr;
         m_initialized = false;
     }
@@ -171,6 +186,11 @@ namespace EE
     void EntityWorld::UpdateLoading()
     {
         EE_PROFILE_SCOPE_ENTITY( "World Loading" );
+        EE_ASSERT( Threading::IsMainThread() );
+        EE_DEVELOPMENT_TOOLS_ONLY( EE_ASSERT( !m_isUpdating ) );
+
+        // Components can be destroyed as part of the state changes so we cannot have any deferred transforms queued while loading
+        m_transformResolver.Suspend();
 
         // Update all maps internal loading state
         //-------------------------------------------------------------------------
@@ -188,11 +208,67 @@ namespace EE
                 }
             }
         }
+
+        m_transformResolver.Resume();
     }
 
+    void EntityWorld::BuildSystemUpdateGroups()
+    {
+        for ( int8_t stageIdx = 0; stageIdx < (int8_t) UpdateStage::NumStages; stageIdx++ )
+        {
+            TVector<EntityWorldSystem*>& systemUpdateList = m_systemUpdateLists[stageIdx];
+            m_systemUpdateGroupEnds[stageIdx].clear();
+
+            int32_t const numSystems = (int32_t) systemUpdateList.size();
+            if ( numSystems == 0 )
+            {
+                continue;
+            }
+
+            // Get the access for each system, all systems implicitly write to their own state
+            //-------------------------------------------------------------------------
+
+            TInlineVector<WorldSystemAccess, 10> systemAccess;
+            for ( auto pSystem : systemUpdateList )
+            {
+                auto& access = systemAccess.emplace_back( pSystem->GetUpdateAccess() );
+                access.m_writes.emplace_back( pSystem->GetTypeInfo() );
+            }
+
+            // Each system needs to be in a later group than all the higher priority systems it conflicts with
+            //-------------------------------------------------------------------------
+
+            TInlineVector<int32_t, 10> systemGroupIndices;
+            int32_t const numGroups = WorldSystemAccess::CalculateUpdateGroups( systemAccess, systemGroupIndices );
+
+            // Reorder the update list so that each group is contiguous, this preserves the priority order within each group
+            //-------------------------------------------------------------------------
+
+            TVector<EntityWorldSystem*> groupedSystemUpdateList;
+            groupedSystemUpdateList.reserve( numSystems );
+
+            for ( int32_t groupIdx = 0; groupIdx < numGroups; groupIdx++ )
+            {
+                for ( int32_t i = 0; i < numSystems; i++ )
+                {
+                    if ( systemGroupIndices[i] == groupIdx )
+                    {
+                        groupedSystemUpdateList.emplace_back( systemUpdateList[i] );
+                    }
+                }
+
+                m_systemUpdateGroupEnds[stageIdx].emplace_back( (int32_t) groupedSystemUpdateList.size() );
+            }
+
+            systemUpdateList.swap( groupedSystemUpdateList );
+        }
+    }
+
+    //-------------------------------------------------------------------------
+
+    // Note: this can be run from a worker thread when the world manager is updating worlds in parallel
     void EntityWorld::Update( UpdateContext const& context )
     {
-        EE_ASSERT( Threading::IsMainThread() );
         EE_ASSERT( !m_isSuspended );
 
         struct EntityUpdateTask final : public ITaskSet
@@ -248,6 +324,33 @@ namespace EE
             TVector<Entity*>&                            m_updateList;
         };
 
+        struct SystemUpdateTask final : public ITaskSet
+        {
+            SystemUpdateTask( EntityWorldUpdateContext const& context, TVector<EntityWorldSystem*> const& updateList, int32_t startIdx, int32_t endIdx )
+                : m_context( context )
+                , m_updateList( updateList )
+                , m_startIdx( startIdx )
+            {
+                m_SetSize = (uint32_t) ( endIdx - startIdx );
+            }
+
+            virtual void ExecuteRange( TaskSetPartition range, uint32_t threadnum ) override final
+            {
+                for ( uint64_t i = range.start; i < range.end; ++i )
+                {
+                    auto pSystem = m_updateList[m_startIdx + i];
+                    EE_ASSERT( pSystem->GetRequiredUpdatePriorities().IsStageEnabled( m_context.GetUpdateStage() ) );
+                    pSystem->UpdateSystem( m_context );
+                }
+            }
+
+        private:
+
+            EntityWorldUpdateContext const&              m_context;
+            TVector<EntityWorldSystem*> const&           m_updateList;
+            int32_t                                      m_startIdx = 0;
+        };
+
         //-------------------------------------------------------------------------
 
         UpdateStage const updateStage = context.GetUpdateStage();
@@ -268,6 +371,7 @@ namespace EE
         //-------------------------------------------------------------------------
 
         EntityWorldUpdateContext entityWorldUpdateContext( context, this );
+        EE_DEVELOPMENT_TOOLS_ONLY( m_isUpdating = true );
 
         // Update entities
         //-------------------------------------------------------------------------
@@ -279,22 +383,46 @@ namespace EE
         // Force execution on main thread for debugging purposes
         //entityUpdateTask.ExecuteRange( { 0u, (uint32_t) m_entityUpdateList.size() }, 0 );
 
+        // Resolve any deferred transform updates so that world systems see the final transforms for this stage
+        m_transformResolver.ResolveTransforms();
+
         // Update systems
         //-------------------------------------------------------------------------
+        // Systems within a group dont conflict with one another, so groups with more than one system are updated concurrently
 
-        for ( auto pSystem : m_systemUpdateLists[(int8_t) updateStage] )
+        TVector<EntityWorldSystem*> const& systemUpdateList = m_systemUpdateLists[(int8_t) updateStage];
+
+        int32_t groupStartIdx = 0;
+        for ( int32_t const groupEndIdx : m_systemUpdateGroupEnds[(int8_t) updateStage] )
         {
             EE_PROFILE_SCOPE_ENTITY( "Update World Systems" );
-            EE_ASSERT( pSystem->GetRequiredUpdatePriorities().IsStageEnabled( updateStage ) );
-            pSystem->UpdateSystem( entityWorldUpdateContext );
+
+            if ( ( groupEndIdx - groupStartIdx ) == 1 )
+            {
+                auto pSystem = systemUpdateList[groupStartIdx];
+                EE_ASSERT( pSystem->GetRequiredUpdatePriorities().IsStageEnabled( updateStage ) );
+                pSystem->UpdateSystem( entityWorldUpdateContext );
+            }
+            else
+            {
+                SystemUpdateTask systemUpdateTask( entityWorldUpdateContext, systemUpdateList, groupStartIdx, groupEndIdx );
+                m_pTaskSystem->ScheduleTask( &systemUpdateTask );
+                m_pTaskSystem->WaitForTask( &systemUpdateTask );
+            }
+
+            groupStartIdx = groupEndIdx;
         }
 
+        m_transformResolver.ResolveTransforms();
+
         //-------------------------------------------------------------------------
 
         if ( updateStage == UpdateStage::FrameEnd )
         {
             m_timeStepRequested = false;
         }
+
+        EE_DEVELOPMENT_TOOLS_ONLY( m_isUpdating = false );
     }
 
     //-------------------------------------------------------------------------
@@ -374,6 +502,7 @@ namespace EE
 
     EntityModel::EntityMap* EntityWorld::CreateTransientMap()
     {
+        EE_ASSERT( Threading::IsMainThread() );
         EntityModel::EntityMap* pNewMap = m_maps.emplace_back( EE::New<EntityModel::EntityMap>() );
         pNewMap->Load( m_loadingContext, m_initializationContext );
         return pNewMap;
@@ -398,14 +527,14 @@ namespace EE
     EntityModel::EntityMap const* EntityWorld::GetMapForEntity( Entity const* pEntity ) const
     {
         EE_ASSERT( pEntity != nullptr && pEntity->IsAddedToMap() );
-        auto const& mapID = pEntity->GetMapID();
-        auto pMap = GetMap( mapID );
-        EE_ASSERT( pMap != nullptr );
+        auto pMap = m_entityIndex.FindMapForEntity( pEntity->GetID() );
+        EE_ASSERT( pMap != nullptr && pMap->GetID() == pEntity->GetMapID() );
         return pMap;
     }
 
     EntityMapID EntityWorld::LoadMap( ResourceID const& mapResourceID )
     {
+        EE_ASSERT( Threading::IsMainThread() );
         EE_ASSERT( mapResourceID.IsValid() && mapResourceID.GetResourceTypeID() == EntityModel::SerializedEntityMap::GetStaticResourceTypeID() );
 
         EE_ASSERT( !HasMap( mapResourceID ) );
@@ -416,6 +545,7 @@ namespace EE
 
     void EntityWorld::UnloadMap( ResourceID const& mapResourceID )
     {
+        EE_ASSERT( Threading::IsMainThread() );
         EE_ASSERT( mapResourceID.IsValid() && mapResourceID.GetResourceTypeID() == EntityModel::SerializedEntityMap::GetStaticResourceTypeID() );
 
         auto const foundMapIter = VectorFind( m_maps, mapResourceID, [] ( EntityModel::EntityMap const* pMap, ResourceID const& mapResourceID ) { return pMap->GetMapResourceID() == mapResourceID; } );
@@ -435,7 +565,9 @@ namespace EE
 
         auto pMap = GetMap( pEntity->GetMapID() );
         EE_ASSERT( pMap != nullptr );
+        m_transformResolver.Suspend();
         pMap->BeginComponentEdit( m_loadingContext, m_initializationContext, pEntity->GetID() );
+        m_transformResolver.Resume();
     }
 
     void EntityWorld::EndComponentEdit( Entity* pEntity )
@@ -456,7 +588,9 @@ namespace EE
 
         auto pMap = GetMap( pEntity->GetMapID() );
         EE_ASSERT( pMap != nullptr );
+        m_transformResolver.Suspend();
         pMap->BeginComponentEdit( m_loadingContext, m_initializationContext, pEntity->GetID() );
+        m_transformResolver.Resume();
     }
 
     void EntityWorld::EndComponentEdit( EntityComponent* pComponent )
@@ -476,10 +610,13 @@ namespace EE
     void EntityWorld::HotReload_UnloadEntities( TVector<Resource::ResourceRequesterID> const& usersToReload )
     {
         EE_ASSERT( !usersToReload.empty() );
+
+        m_transformResolver.Suspend();
         for ( auto& pMap : m_maps )
         {
             pMap->HotReload_UnloadEntities( m_loadingContext, m_initializationContext, usersToReload );
         }
+        m_transformResolver.Resume();
     }
 
     void EntityWorld::HotReload_ReloadEntities()
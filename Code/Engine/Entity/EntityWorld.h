@@ -4,10 +4,14 @@
 #include "EntityContexts.h"
 #include "Entity.h"
 #include "EntityMap.h"
+#include "EntityTransformResolver.h"
+#include "EntityComponentStorage.h"
+#include "EntityIndex.h"
 #include "Base/Render/RenderViewport.h"
 #include "Base/Types/Arrays.h"
 #include "Base/Drawing/DebugDrawingSystem.h"
 #include "Base/Input/InputSystem.h"
+#include <atomic>
 
 //-------------------------------------------------------------------------
 
@@ -51,10 +55,19 @@ namespace EE
         void ResumeUpdates() { m_isSuspended = false; }
 
         // Run entity and system updates
+        // Note: the world manager may run this from a worker thread (concurrently with the updates of other worlds), while all loading
+        // and map management functions are main thread only. The manager waits for all world updates before returning to the main thread,
+        // so the loading update of a world never overlaps its own update.
         void Update( UpdateContext const& context );
 
+        // Should spatial transform updates be deferred and resolved in bulk at the end of the entity and system updates of each stage?
+        // Note: with this enabled, world transforms read during an update may be stale until the next resolve
+        inline bool IsDeferredTransformUpdateEnabled() const { return m_transformResolver.IsEnabled(); }
+        inline void SetDeferredTransformUpdateEnabled( bool isEnabled ) { m_transformResolver.SetEnabled( isEnabled ); }
+
         // This function will handle all actual loading/unloading operations for the world/maps.
         // Any queued requests will be handled here as will any requests to the resource system.
+        // Note: main thread only, this must never be called while this world is updating
         void UpdateLoading();
 
         //-------------------------------------------------------------------------
@@ -66,6 +79,23 @@ namespace EE
         template<typename T>
         inline T* GetWorldSystem() const { return reinterpret_cast<T*>( GetWorldSystem( T::s_entitySystemID ) ); }
 
+        //-------------------------------------------------------------------------
+        // Component Storage
+        //-------------------------------------------------------------------------
+        // Components for entities created from map loads can optionally be allocated from per-type pools owned by the world
+        // This allows world systems to iterate over all components of a given type linearly in memory
+
+        // Should the components of newly loaded maps be allocated from the world's component pools?
+        inline bool IsPooledComponentStorageEnabled() const { return m_loadingContext.m_pComponentStorage != nullptr; }
+        inline void SetPooledComponentStorageEnabled( bool isEnabled ) { EE_ASSERT( m_initialized ); m_loadingContext.m_pComponentStorage = isEnabled ? &m_componentStorage : nullptr; }
+
+        // Get the pool for a specific component type, returns null if no components of that type have been pooled
+        inline EntityModel::ComponentPool const* GetComponentPool( TypeSystem::TypeID typeID ) const { return m_componentStorage.GetPool( typeID ); }
+
+        // Iterate over all initialized pooled components of the specified type - this will not visit any heap allocated components
+        template<typename T, typename F>
+        inline void ForEachPooledComponent( F&& func ) const { m_componentStorage.ForEach<T>( eastl::forward<F>( func ) ); }
+
         //-------------------------------------------------------------------------
         // Input
         //-------------------------------------------------------------------------
@@ -167,21 +197,14 @@ namespace EE
         EntityMapID LoadMap( ResourceID const& mapResourceID );
         void UnloadMap( ResourceID const& mapResourceID );
 
-        // Find an entity in the map
-        inline Entity* FindEntity( EntityID entityID ) const
-        {
-            Entity* pEntity = nullptr;
-            for ( auto const& pMap : m_maps )
-            {
-                pEntity = pMap->FindEntity( entityID );
-                if ( pEntity != nullptr )
-                {
-                    break;
-                }
-            }
+        // Find an entity in any of the world's maps, this is safe to call while entities are being added or removed on other threads
+        inline Entity* FindEntity( EntityID entityID ) const { return m_entityIndex.FindEntity( entityID ); }
 
-            return pEntity;
-        }
+        // Get a handle for an entity in this world, handles can be resolved without any lookups but only remain valid while the entity is part of a map in this world
+        inline EntityHandle GetEntityHandle( EntityID entityID ) const { return m_entityIndex.GetHandle( entityID ); }
+
+        // Resolve an entity handle, returns null if the entity has been removed from the world
+        inline Entity* ResolveEntityHandle( EntityHandle const& handle ) const { return m_entityIndex.ResolveHandle( handle ); }
 
         //-------------------------------------------------------------------------
         // Editor
@@ -270,6 +293,11 @@ namespace EE
         void HotReload_ReloadEntities();
         #endif
 
+    private:
+
+        // Group the world systems for each stage so that systems with non-conflicting access can be updated concurrently
+        void BuildSystemUpdateGroups();
+
     private:
 
         EntityWorldID                                                           m_worldID = UUID::GenerateID();
@@ -277,6 +305,9 @@ namespace EE
         Input::InputState                                                       m_inputState;
         EntityModel::LoadingContext                                             m_loadingContext;
         EntityModel::InitializationContext                                      m_initializationContext;
+        EntityModel::TransformResolver                                          m_transformResolver;
+        EntityModel::ComponentStorage                                           m_componentStorage;
+        EntityModel::EntityIndex                                                m_entityIndex;
         TVector<EntityWorldSystem*>                                             m_worldSystems;
         EntityWorldType                                                         m_worldType = EntityWorldType::Game;
         bool                                                                    m_initialized = false;
@@ -289,6 +320,7 @@ namespace EE
         // Entities
         TVector<Entity*>                                                        m_entityUpdateList;
         TVector<EntityWorldSystem*>                                             m_systemUpdateLists[(int8_t) UpdateStage::NumStages];
+        TInlineVector<int32_t, 10>                                              m_systemUpdateGroupEnds[(int8_t) UpdateStage::NumStages]; // The end index (exclusive) of each group of concurrently updatable systems
 
         // Time Scaling + Pause
         float                                                                   m_timeScale = 1.0f; // <= 0 means that the world is paused
@@ -299,6 +331,7 @@ namespace EE
         EntityModel::EntityComponentTypeMap                                     m_componentTypeLookup;
         Drawing::DrawingSystem                                                  m_debugDrawingSystem;
         String                                                                  m_debugName;
+        std::atomic<bool>                                                       m_isUpdating = false; // Assertion helper
         #endif
     };
 }
\ No newline at end of file
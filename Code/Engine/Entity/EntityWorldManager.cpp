@@ -6,6 +6,8 @@
 #include "Engine/Camera/Components/Component_Camera.h"
 #include "Base/TypeSystem/TypeRegistry.h"
 #include "Engine/UpdateContext.h"
+#include "Base/Threading/TaskSystem.h"
+#include "Base/Profiling.h"
 #include "Base/Systems.h"
 
 //-------------------------------------------------------------------------
@@ -20,6 +22,8 @@ namespace EE
     void EntityWorldManager::Initialize( SystemRegistry const& systemsRegistry )
     {
         m_pSystemsRegistry = &systemsRegistry;
+        m_pTaskSystem = systemsRegistry.GetSystem<TaskSystem>();
+        EE_ASSERT( m_pTaskSystem != nullptr );
 
         //-------------------------------------------------------------------------
 
@@ -82,6 +86,7 @@ namespace EE
 
     EntityWorld* EntityWorldManager::CreateWorld( EntityWorldType worldType )
     {
+        EE_ASSERT( Threading::IsMainThread() );
         EE_ASSERT( m_pSystemsRegistry != nullptr );
 
         //-------------------------------------------------------------------------
@@ -100,6 +105,8 @@ namespace EE
 
         auto pNewWorld = EE::New<EntityWorld>( worldType );
         pNewWorld->Initialize( *m_pSystemsRegistry, m_worldSystemTypeInfos );
+        pNewWorld->SetDeferredTransformUpdateEnabled( m_isDeferredTransformUpdateEnabled );
+        pNewWorld->SetPooledComponentStorageEnabled( m_isPooledComponentStorageEnabled );
         m_worlds.emplace_back( pNewWorld );
 
         //-------------------------------------------------------------------------
@@ -118,6 +125,28 @@ namespace EE
         return pNewWorld;
     }
 
+    void EntityWorldManager::SetDeferredTransformUpdateEnabled( bool isEnabled )
+    {
+        EE_ASSERT( Threading::IsMainThread() );
+
+        m_isDeferredTransformUpdateEnabled = isEnabled;
+        for ( auto pWorld : m_worlds )
+        {
+            pWorld->SetDeferredTransformUpdateEnabled( isEnabled );
+        }
+    }
+
+    void EntityWorldManager::SetPooledComponentStorageEnabled( bool isEnabled )
+    {
+        EE_ASSERT( Threading::IsMainThread() );
+
+        m_isPooledComponentStorageEnabled = isEnabled;
+        for ( auto pWorld : m_worlds )
+        {
+            pWorld->SetPooledComponentStorageEnabled( isEnabled );
+        }
+    }
+
     void EntityWorldManager::DestroyWorld( EntityWorld* pWorld )
     {
         EE_ASSERT( Threading::IsMainThread() );
@@ -128,6 +157,7 @@ namespace EE
         m_worlds.erase( foundWorldIter );
 
         // Shutdown and destroy world
+        m_worldDestroyedEvent.Execute( pWorld );
         pWorld->Shutdown();
         EE::Delete( pWorld );
     }
@@ -149,18 +179,70 @@ namespace EE
 
     void EntityWorldManager::UpdateLoading()
     {
+        EE_ASSERT( Threading::IsMainThread() );
+
         for ( auto const& pWorld : m_worlds )
         {
             pWorld->UpdateLoading();
         }
     }
 
+    void EntityWorldManager::RunWorldUpdates( TaskSystem* pTaskSystem, UpdateContext const& context, TInlineVector<EntityWorld*, 5>& worlds, bool updateInParallel )
+    {
+        struct WorldUpdateTask final : public ITaskSet
+        {
+            WorldUpdateTask( UpdateContext const& context, TInlineVector<EntityWorld*, 5>& worlds )
+                : m_context( context )
+                , m_worlds( worlds )
+            {
+                m_SetSize = (uint32_t) worlds.size();
+            }
+
+            virtual void ExecuteRange( TaskSetPartition range, uint32_t threadnum ) override final
+            {
+                for ( uint64_t i = range.start; i < range.end; ++i )
+                {
+                    EE_PROFILE_SCOPE_ENTITY( "Update World" );
+                    m_worlds[i]->Update( m_context );
+                }
+            }
+
+        private:
+
+            UpdateContext const&                        m_context;
+            TInlineVector<EntityWorld*, 5>&             m_worlds;
+        };
+
+        //-------------------------------------------------------------------------
+
+        EE_ASSERT( Threading::IsMainThread() );
+
+        // Worlds are independent so they can be updated concurrently, each world's entity update tasks will then interleave with the other worlds' work
+        if ( updateInParallel && worlds.size() > 1 )
+        {
+            WorldUpdateTask worldUpdateTask( context, worlds );
+            pTaskSystem->ScheduleTask( &worldUpdateTask );
+            pTaskSystem->WaitForTask( &worldUpdateTask );
+        }
+        else
+        {
+            for ( auto const& pWorld : worlds )
+            {
+                pWorld->Update( context );
+            }
+        }
+    }
+
     void EntityWorldManager::UpdateWorlds( UpdateContext const& context )
     {
+        EE_ASSERT( Threading::IsMainThread() );
+
         //-------------------------------------------------------------------------
-        // World Update
+        // Reflect input state
         //-------------------------------------------------------------------------
 
+        m_worldsToUpdate.clear();
+
         for ( auto const& pWorld : m_worlds )
         {
             if ( pWorld->IsSuspended() )
@@ -168,8 +250,7 @@ namespace EE
                 continue;
             }
 
-            // Reflect input state
-            //-------------------------------------------------------------------------
+            m_worldsToUpdate.emplace_back( pWorld );
 
             if ( context.GetUpdateStage() == UpdateStage::FrameStart )
             {
@@ -186,15 +267,20 @@ namespace EE
                     pWorldInputState->Clear();
                 }
             }
+        }
 
-            // Run world updates
-            //-------------------------------------------------------------------------
+        //-------------------------------------------------------------------------
+        // World Update
+        //-------------------------------------------------------------------------
 
-            pWorld->Update( context );
+        RunWorldUpdates( m_pTaskSystem, context, m_worldsToUpdate, m_isParallelWorldUpdateEnabled );
 
-            // Update world view
-            //-------------------------------------------------------------------------
+        //-------------------------------------------------------------------------
+        // Update world views
+        //-------------------------------------------------------------------------
 
+        for ( auto const& pWorld : m_worldsToUpdate )
+        {
             if ( pWorld->GetViewport() != nullptr )
             {
                 auto pViewport = pWorld->GetViewport();
@@ -3,6 +3,7 @@
 #include "Engine/_Module/API.h"
 #include "EntityWorldType.h"
 #include "Base/Resource/ResourceRequesterID.h"
+#include "Base/Types/Event.h"
 #include "Base/Systems.h"
 
 //-------------------------------------------------------------------------
@@ -12,6 +13,7 @@ namespace EE
     class UpdateContext;
     class EntityWorld;
     class SystemRegistry;
+    class TaskSystem;
     namespace TypeSystem { class TypeInfo; }
     namespace Render { class Viewport; }
 
@@ -42,6 +44,7 @@ namespace EE
 
         // Loading
         //-------------------------------------------------------------------------
+        // Loading is main thread only and is always run outside of the world updates
 
         bool IsBusyLoading() const;
         void UpdateLoading();
@@ -61,12 +64,33 @@ namespace EE
         // Destroy an existing world
         void DestroyWorld( EntityWorld* pWorld );
 
+        // Fired just before a world is shutdown and destroyed
+        inline TEventHandle<EntityWorld*> OnWorldDestroyed() { return m_worldDestroyedEvent; }
+
         // Get all created worlds
         TInlineVector<EntityWorld*, 5> const& GetWorlds() const { return m_worlds; }
 
         // Run the world update - updates all entities, systems and camera
+        // This needs to be called from the main thread and will only return once all world updates for the stage have completed
         void UpdateWorlds( UpdateContext const& context );
 
+        // Run the entity and system updates for the specified worlds, blocks until all the updates have completed
+        static void RunWorldUpdates( TaskSystem* pTaskSystem, UpdateContext const& context, TInlineVector<EntityWorld*, 5>& worlds, bool updateInParallel );
+
+        // Should independent worlds be updated concurrently (per update stage)?
+        // Each world's update then runs on a worker thread, the loading update and any world creation/destruction remain on the main thread.
+        // Note: this requires that world systems dont share any mutable state across worlds
+        inline bool IsParallelWorldUpdateEnabled() const { return m_isParallelWorldUpdateEnabled; }
+        inline void SetParallelWorldUpdateEnabled( bool isEnabled ) { m_isParallelWorldUpdateEnabled = isEnabled; }
+
+        // Should spatial transform updates be deferred and resolved in bulk by each world? Applies to all current and future worlds
+        inline bool IsDeferredTransformUpdateEnabled() const { return m_isDeferredTransformUpdateEnabled; }
+        void SetDeferredTransformUpdateEnabled( bool isEnabled );
+
+        // Should the components of loaded maps be allocated from per-world contiguous pools? Applies to all maps loaded after this call
+        inline bool IsPooledComponentStorageEnabled() const { return m_isPooledComponentStorageEnabled; }
+        void SetPooledComponentStorageEnabled( bool isEnabled );
+
         // Hot Reload
         //-------------------------------------------------------------------------
 
@@ -78,7 +102,13 @@ namespace EE
     private:
 
         SystemRegistry const*                               m_pSystemsRegistry = nullptr;
+        TaskSystem*                                         m_pTaskSystem = nullptr;
         TInlineVector<EntityWorld*, 5>                      m_worlds;
+        TInlineVector<EntityWorld*, 5>                      m_worldsToUpdate;
         TVector<TypeSystem::TypeInfo const*>                m_worldSystemTypeInfos;
+        TEvent<EntityWorld*>                                m_worldDestroyedEvent;
+        bool                                                m_isParallelWorldUpdateEnabled = false;
+        bool                                                m_isDeferredTransformUpdateEnabled = false;
+        bool                                                m_isPooledComponentStorageEnabled = false;
     };
 }
\ No newline at end of file
@@ -6,6 +6,7 @@
 #include "Engine/Entity/EntityIDs.h"
 #include "Base/TypeSystem/ReflectedType.h"
 #include "Base/Types/Arrays.h"
+#include "Base/Math/Math.h"
 #include "Base/Encoding/Hash.h"
 
 
@@ -22,6 +23,104 @@ namespace EE
     class EntityComponent;
     namespace EntityModel { class EntityMap; }
 
+    //-------------------------------------------------------------------------
+    // World System Access
+    //-------------------------------------------------------------------------
+    // Describes the shared data (component types and/or other world systems) that a world system touches during its update.
+    // Systems whose access doesnt conflict can be updated concurrently, conflicting systems are still updated in priority order.
+    // Access to a type covers all types derived from it i.e. writing to spatial components conflicts with reading mesh components.
+    // Note: a system always implicitly writes to its own state, other systems need to declare a read if they access it.
+    // Note: entity map add/remove requests are internally synchronized and dont need to be declared.
+
+    struct WorldSystemAccess
+    {
+        // Systems that dont declare their access are assumed to touch everything
+        static WorldSystemAccess Exclusive() { WorldSystemAccess access; access.m_isExclusive = true; return access; }
+
+        // Assign each access (sorted by update priority) to an update group, each access is placed in a later group than all higher priority accesses it conflicts with
+        // Returns the number of groups
+        template<typename AccessList, typename GroupIndexList>
+        static int32_t CalculateUpdateGroups( AccessList const& accesses, GroupIndexList& outGroupIndices )
+        {
+            outGroupIndices.clear();
+            int32_t numGroups = 0;
+
+            int32_t const numAccesses = (int32_t) accesses.size();
+            for ( int32_t i = 0; i < numAccesses; i++ )
+            {
+                int32_t groupIdx = 0;
+                for ( int32_t j = 0; j < i; j++ )
+                {
+                    if ( accesses[i].ConflictsWith( accesses[j] ) )
+                    {
+                        groupIdx = Math::Max( groupIdx, outGroupIndices[j] + 1 );
+                    }
+                }
+
+                outGroupIndices.emplace_back( groupIdx );
+                numGroups = Math::Max( numGroups, groupIdx + 1 );
+            }
+
+            return numGroups;
+        }
+
+    public:
+
+        template<typename T>
+        inline WorldSystemAccess& Reads() { EE_ASSERT( T::s_pTypeInfo != nullptr ); m_reads.emplace_back( T::s_pTypeInfo ); return *this; }
+
+        template<typename T>
+        inline WorldSystemAccess& Writes() { EE_ASSERT( T::s_pTypeInfo != nullptr ); m_writes.emplace_back( T::s_pTypeInfo ); return *this; }
+
+        inline bool ConflictsWith( WorldSystemAccess const& other ) const
+        {
+            if ( m_isExclusive || other.m_isExclusive )
+            {
+                return true;
+            }
+
+            for ( auto pWriteType : m_writes )
+            {
+                if ( Overlaps( pWriteType, other.m_writes ) || Overlaps( pWriteType, other.m_reads ) )
+                {
+                    return true;
+                }
+            }
+
+            for ( auto pReadType : m_reads )
+            {
+                if ( Overlaps( pReadType, other.m_writes ) )
+                {
+                    return true;
+                }
+            }
+
+            return false;
+        }
+
+    private:
+
+        // Two types overlap if either one is derived from the other
+        static bool Overlaps( TypeSystem::TypeInfo const* pTypeInfo, TInlineVector<TypeSystem::TypeInfo const*, 4> const& typeInfos )
+        {
+            for ( auto pOtherTypeInfo : typeInfos )
+            {
+                if ( pTypeInfo->IsDerivedFrom( pOtherTypeInfo->m_ID ) || pOtherTypeInfo->IsDerivedFrom( pTypeInfo->m_ID ) )
+                {
+                    return true;
+                }
+            }
+
+            return false;
+        }
+
+    public:
+
+        TInlineVector<TypeSystem::TypeInfo const*, 4>   m_reads;
+        TInlineVector<TypeSystem::TypeInfo const*, 4>   m_writes;
+        bool                                            m_isExclusive = false;
+    };
+
     //-------------------------------------------------------------------------
 
     class EE_ENGINE_API EntityWorldSystem : public IReflectedType
@@ -41,6 +140,10 @@ namespace EE
         // Is this world system in a tools-only world
         bool IsInAToolsWorld() const;
 
+        // Get the data accessed by this system's update, this is used to determine which systems can be updated concurrently
+        // Note: this does not include the system's own state, see WorldSystemAccess
+        virtual WorldSystemAccess GetUpdateAccess() const { return WorldSystemAccess::Exclusive(); }
+
     protected:
 
         // Get the required update stages and priorities for this component
@@ -38,6 +38,14 @@ namespace EE::EntityModel
 
     //-------------------------------------------------------------------------
 
+    WorldSystemAccess EntityCollectionSpawner::GetUpdateAccess() const
+    {
+        // Spawning only reads the collection components, the actual entity creation/destruction is requested from the (internally synchronized) persistent map
+        WorldSystemAccess access;
+        access.Reads<EntityCollectionComponent>();
+        return access;
+    }
+
     void EntityCollectionSpawner::UpdateSystem( EntityWorldUpdateContext const& ctx )
     {
         auto pPersistentMap = ctx.GetPersistentMap();
@@ -57,7 +65,8 @@ namespace EE::EntityModel
                     EE_ASSERT( pRecord != nullptr );
 
                     TVector<Entity*> createdEntities;
-                    pPersistentMap->AddEntityCollection( pTaskSystem, *pTypeRegistry, *pCollectionToSpawn->GetEntityCollectionDesc(), pCollectionToSpawn->GetWorldTransform(), &createdEntities );
+                    // Spawned collections are streamed in behind any map and player loads
+                    pPersistentMap->AddEntityCollection( pTaskSystem, *pTypeRegistry, *pCollectionToSpawn->GetEntityCollectionDesc(), pCollectionToSpawn->GetWorldTransform(), &createdEntities, Resource::ResourceLoadPriority::Streaming );
 
                     for ( auto pCreatedEntity : createdEntities )
                     {
@@ -66,6 +66,9 @@ namespace EE::Navmesh
 
         void UpdateSystem( EntityWorldUpdateContext const& ctx ) override;
 
+        // The navmesh simulation only touches the system's own state
+        virtual WorldSystemAccess GetUpdateAccess() const override { return WorldSystemAccess(); }
+
         #if EE_DEVELOPMENT_TOOLS
         bool IsDebugRendererDepthTestEnabled() const;
         void SetDebugRendererDepthTestState( bool isDepthTestingEnabled );
@@ -136,6 +136,18 @@ namespace EE::Physics
             pWorld->SetDebugDrawDistance( drawDistance );
         }
 
+        //-------------------------------------------------------------------------
+        // Simulation
+        //-------------------------------------------------------------------------
+
+        ImGui::Separator();
+
+        bool isAsyncSimulationEnabled = pWorld->IsAsyncSimulationEnabled();
+        if ( ImGui::Checkbox( "Async Simulation", &isAsyncSimulationEnabled ) )
+        {
+            pWorld->SetAsyncSimulationEnabled( isAsyncSimulationEnabled );
+        }
+
         //-------------------------------------------------------------------------
         // Materials
         //-------------------------------------------------------------------------
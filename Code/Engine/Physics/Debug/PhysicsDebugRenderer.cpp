@@ -14,6 +14,24 @@ namespace EE::Physics
 
     //-------------------------------------------------------------------------
 
+    struct PhysicsRenderer::DebugRenderBuffer
+    {
+        void Clear()
+        {
+            m_points.clear();
+            m_lines.clear();
+            m_triangles.clear();
+        }
+
+    public:
+
+        TVector<physx::PxDebugPoint>                m_points;
+        TVector<physx::PxDebugLine>                 m_lines;
+        TVector<physx::PxDebugTriangle>             m_triangles;
+    };
+
+    //-------------------------------------------------------------------------
+
     bool PhysicsRenderer::Initialize( Render::RenderDevice* pRenderDevice )
     {
         EE_ASSERT( m_pRenderDevice == nullptr && pRenderDevice != nullptr );
@@ -47,6 +65,14 @@ namespace EE::Physics
 
     void PhysicsRenderer::Shutdown()
     {
+        for ( auto& worldRenderBufferPair : m_worldRenderBuffers )
+        {
+            EE::Delete( worldRenderBufferPair.second );
+        }
+        m_worldRenderBuffers.clear();
+
+        //-------------------------------------------------------------------------
+
         if ( m_pRenderDevice != nullptr )
         {
             m_textRS.Shutdown( m_pRenderDevice );
@@ -220,11 +246,31 @@ namespace EE::Physics
 
     //-------------------------------------------------------------------------
 
-    void PhysicsRenderer::RenderWorld( Seconds const deltaTime, Render::Viewport const& viewport, Render::RenderTarget const& renderTarget, EntityWorld* pWorld )
+    void PhysicsRenderer::OnWorldDestroyed( EntityWorld const* pWorld )
+    {
+        EE_ASSERT( Threading::IsMainThread() );
+
+        auto iter = m_worldRenderBuffers.find( pWorld );
+        if ( iter != m_worldRenderBuffers.end() )
+        {
+            EE::Delete( iter->second );
+            m_worldRenderBuffers.erase( iter );
+        }
+    }
+
+    void PhysicsRenderer::PrepareWorld( Seconds const deltaTime, Render::Viewport const& viewport, EntityWorld* pWorld )
     {
         EE_ASSERT( IsInitialized() && Threading::IsMainThread() );
         EE_PROFILE_FUNCTION_RENDER();
 
+        DebugRenderBuffer*& pRenderBuffer = m_worldRenderBuffers[pWorld];
+        if ( pRenderBuffer == nullptr )
+        {
+            pRenderBuffer = EE::New<DebugRenderBuffer>();
+        }
+
+        pRenderBuffer->Clear();
+
         //-------------------------------------------------------------------------
 
         auto pPhysicsWorldSystem = pWorld->GetWorldSystem<PhysicsWorldSystem>();
@@ -241,12 +287,6 @@ namespace EE::Physics
             return;
         }
 
-        auto const& renderContext = m_pRenderDevice->GetImmediateContext();
-        renderContext.SetRenderTarget( renderTarget );
-        renderContext.SetViewport( Float2( viewport.GetDimensions() ), Float2( viewport.GetTopLeftPosition() ) );
-
-        //-------------------------------------------------------------------------
-
         // Offset the culling bounds in front of the camera, no point in visualizing lines off-screen
         float const debugHalfDistance = ( pPhysicsWorld->GetDebugDrawDistance() );
 
@@ -259,16 +299,46 @@ namespace EE::Physics
 
         //-------------------------------------------------------------------------
 
+        // The physx render buffer is only valid until the next simulation step, so we need to copy it
         physx::PxRenderBuffer const& renderBuffer = pPhysicsWorld->GetRenderBuffer();
+        pRenderBuffer->m_points.insert( pRenderBuffer->m_points.end(), renderBuffer.getPoints(), renderBuffer.getPoints() + renderBuffer.getNbPoints() );
+        pRenderBuffer->m_lines.insert( pRenderBuffer->m_lines.end(), renderBuffer.getLines(), renderBuffer.getLines() + renderBuffer.getNbLines() );
+        pRenderBuffer->m_triangles.insert( pRenderBuffer->m_triangles.end(), renderBuffer.getTriangles(), renderBuffer.getTriangles() + renderBuffer.getNbTriangles() );
+    }
+
+    void PhysicsRenderer::RenderWorld( Seconds const deltaTime, Render::Viewport const& viewport, Render::RenderTarget const& renderTarget, EntityWorld* pWorld )
+    {
+        EE_ASSERT( IsInitialized() );
+        EE_PROFILE_FUNCTION_RENDER();
 
-        uint32_t const numPoints = renderBuffer.getNbPoints();
-        DrawPoints( renderContext, viewport, renderBuffer.getPoints(), numPoints );
+        auto iter = m_worldRenderBuffers.find( pWorld );
+        if ( iter == m_worldRenderBuffers.end() )
+        {
+            return;
+        }
 
-        uint32_t const numLines = renderBuffer.getNbLines();
-        DrawLines( renderContext, viewport, renderBuffer.getLines(), numLines );
+        DebugRenderBuffer const* pRenderBuffer = iter->second;
+        if ( pRenderBuffer->m_points.empty() && pRenderBuffer->m_lines.empty() && pRenderBuffer->m_triangles.empty() )
+        {
+            return;
+        }
+
+        //-------------------------------------------------------------------------
+
+        if ( !viewport.IsValid() )
+        {
+            return;
+        }
+
+        auto const& renderContext = m_pRenderDevice->GetImmediateContext();
+        renderContext.SetRenderTarget( renderTarget );
+        renderContext.SetViewport( Float2( viewport.GetDimensions() ), Float2( viewport.GetTopLeftPosition() ) );
+
+        //-------------------------------------------------------------------------
 
-        uint32_t const numTriangles = renderBuffer.getNbTriangles();
-        DrawTriangles( renderContext, viewport, renderBuffer.getTriangles(), numTriangles );
+        DrawPoints( renderContext, viewport, pRenderBuffer->m_points.data(), (uint32_t) pRenderBuffer->m_points.size() );
+        DrawLines( renderContext, viewport, pRenderBuffer->m_lines.data(), (uint32_t) pRenderBuffer->m_lines.size() );
+        DrawTriangles( renderContext, viewport, pRenderBuffer->m_triangles.data(), (uint32_t) pRenderBuffer->m_triangles.size() );
     }
 }
 #endif
\ No newline at end of file
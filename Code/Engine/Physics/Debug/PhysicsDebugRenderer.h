@@ -4,6 +4,7 @@
 #include "Engine/Render/Renderers/DebugRenderStates.h"
 #include "Engine/Render/IRenderer.h"
 #include "Base/Render/RenderDevice.h"
+#include "Base/Types/HashMap.h"
 
 //-------------------------------------------------------------------------
 
@@ -28,12 +29,18 @@ namespace EE::Physics
     {
         EE_RENDERER_ID( PhysicsRenderer, Render::RendererPriorityLevel::Debug );
 
+        // A copy of a physics world's debug render buffer
+        struct DebugRenderBuffer;
+
     public:
 
         bool IsInitialized() const { return m_initialized; }
         bool Initialize( Render::RenderDevice* pRenderDevice );
         void Shutdown();
+        void PrepareWorld( Seconds const deltaTime, Render::Viewport const& viewport, EntityWorld* pWorld ) override final;
         void RenderWorld( Seconds const deltaTime, Render::Viewport const& viewport, Render::RenderTarget const& renderTarget, EntityWorld* pWorld ) override final;
+        bool SupportsPipelinedRendering() const override final { return true; }
+        void OnWorldDestroyed( EntityWorld const* pWorld ) override final;
 
     private:
 
@@ -51,6 +58,8 @@ namespace EE::Physics
         Render::DebugPrimitiveRenderState           m_primitiveRS;
         Render::DebugTextRenderState                m_textRS;
 
+        THashMap<EntityWorld const*, DebugRenderBuffer*>    m_worldRenderBuffers;
+
         bool                                        m_initialized = false;
     };
 }
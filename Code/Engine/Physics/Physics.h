@@ -95,10 +95,10 @@ namespace EE::Physics
 
     namespace Core
     {
-        void Initialize();
-        void Shutdown();
+        EE_ENGINE_API void Initialize();
+        EE_ENGINE_API void Shutdown();
 
-        physx::PxPhysics* GetPxPhysics();
+        EE_ENGINE_API physx::PxPhysics* GetPxPhysics();
     };
 
     //-------------------------------------------------------------------------
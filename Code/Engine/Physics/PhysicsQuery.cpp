@@ -42,4 +42,89 @@ namespace EE::Physics
             break;
         }
     }
+
+    //-------------------------------------------------------------------------
+
+    void QueryBatch::Reserve( int32_t numRayCasts, int32_t numSweeps )
+    {
+        Threading::ScopeLock const lock( m_mutex );
+        m_queries.reserve( numRayCasts + numSweeps );
+        m_rayCastResults.reserve( numRayCasts );
+        m_sweepResults.reserve( numSweeps );
+    }
+
+    void QueryBatch::Reset()
+    {
+        Threading::ScopeLock const lock( m_mutex );
+        m_queries.clear();
+        m_rayCastResults.clear();
+        m_sweepResults.clear();
+        m_numRayCasts = 0;
+        m_numSweeps = 0;
+        m_wasExecuted = false;
+    }
+
+    int32_t QueryBatch::AddRayCast( Vector const& start, Vector const& end, QueryRules const& rules )
+    {
+        Vector direction;
+        float distance;
+        ( end - start ).ToDirectionAndLength3( direction, distance );
+
+        //-------------------------------------------------------------------------
+
+        Threading::ScopeLock const lock( m_mutex );
+        EE_ASSERT( !m_wasExecuted );
+
+        auto& query = m_queries.emplace_back();
+        query.m_type = Query::Type::RayCast;
+        query.m_rules = rules;
+        query.m_start = start;
+        query.m_direction = direction;
+        query.m_distance = distance;
+        query.m_resultIdx = m_numRayCasts++;
+        return query.m_resultIdx;
+    }
+
+    int32_t QueryBatch::AddSphereSweep( float radius, Vector const& start, Vector const& end, QueryRules const& rules )
+    {
+        return AddSweep( Query::Type::SphereSweep, Vector( radius ), Quaternion::Identity, start, end, rules );
+    }
+
+    int32_t QueryBatch::AddCapsuleSweep( float radius, float cylinderPortionHalfHeight, Quaternion const& orientation, Vector const& start, Vector const& end, QueryRules const& rules )
+    {
+        return AddSweep( Query::Type::CapsuleSweep, Vector( radius, cylinderPortionHalfHeight, 0.0f ), orientation, start, end, rules );
+    }
+
+    int32_t QueryBatch::AddCylinderSweep( float radius, float cylinderPortionHalfHeight, Quaternion const& orientation, Vector const& start, Vector const& end, QueryRules const& rules )
+    {
+        return AddSweep( Query::Type::CylinderSweep, Vector( radius, cylinderPortionHalfHeight, 0.0f ), orientation, start, end, rules );
+    }
+
+    int32_t QueryBatch::AddBoxSweep( Vector halfExtents, Quaternion const& orientation, Vector const& start, Vector const& end, QueryRules const& rules )
+    {
+        return AddSweep( Query::Type::BoxSweep, halfExtents, orientation, start, end, rules );
+    }
+
+    int32_t QueryBatch::AddSweep( Query::Type type, Vector const& shapeDimensions, Quaternion const& orientation, Vector const& start, Vector const& end, QueryRules const& rules )
+    {
+        Vector direction;
+        float distance;
+        ( end - start ).ToDirectionAndLength3( direction, distance );
+
+        //-------------------------------------------------------------------------
+
+        Threading::ScopeLock const lock( m_mutex );
+        EE_ASSERT( !m_wasExecuted );
+
+        auto& query = m_queries.emplace_back();
+        query.m_type = type;
+        query.m_rules = rules;
+        query.m_orientation = orientation;
+        query.m_start = start;
+        query.m_direction = direction;
+        query.m_shapeDimensions = shapeDimensions;
+        query.m_distance = distance;
+        query.m_resultIdx = m_numSweeps++;
+        return query.m_resultIdx;
+    }
 }
\ No newline at end of file
@@ -3,6 +3,8 @@
 #include "Engine/Physics/PhysicsSettings.h"
 #include "Engine/Entity/EntityIDs.h"
 #include "Base/Math/Vector.h"
+#include "Base/Math/Quaternion.h"
+#include "Base/Threading/Threading.h"
 
 //-------------------------------------------------------------------------
 
@@ -298,4 +300,89 @@ namespace EE::Physics
         Vector                                          m_overlapPosition = Vector::Zero;
         TInlineVector<Overlap, s_initialBufferSize>     m_overlaps;
     };
+
+    //-------------------------------------------------------------------------
+    // Query Batch
+    //-------------------------------------------------------------------------
+    // Gathers ray casts and sweeps (from any thread) so that they can be executed together in parallel via 'PhysicsWorld::ExecuteQueryBatch'
+    // Each add function returns the index of the result slot for that query, results are only valid once the batch has been executed.
+    // No queries can be added to an executed batch, it needs to be reset first.
+
+    class EE_ENGINE_API QueryBatch
+    {
+        friend class PhysicsWorld;
+
+        struct Query
+        {
+            enum class Type : uint8_t
+            {
+                RayCast,
+                SphereSweep,
+                CapsuleSweep,
+                CylinderSweep,
+                BoxSweep
+            };
+
+        public:
+
+            QueryRules                      m_rules;
+            Quaternion                      m_orientation = Quaternion::Identity;
+            Vector                          m_start;
+            Vector                          m_direction;
+            Vector                          m_shapeDimensions; // Radius + half-height for capsules/cylinders, half-extents for boxes
+            float                           m_distance = 0.0f;
+            int32_t                         m_resultIdx = InvalidIndex;
+            Type                            m_type = Type::RayCast;
+        };
+
+    public:
+
+        // Preallocate storage for the expected number of queries
+        void Reserve( int32_t numRayCasts, int32_t numSweeps );
+
+        // Clear all queries and results
+        void Reset();
+
+        inline bool IsEmpty() const { return m_queries.empty(); }
+        inline bool WasExecuted() const { return m_wasExecuted; }
+        inline int32_t GetNumQueries() const { return (int32_t) m_queries.size(); }
+
+        // Queries
+        //-------------------------------------------------------------------------
+
+        int32_t AddRayCast( Vector const& start, Vector const& end, QueryRules const& rules );
+        int32_t AddSphereSweep( float radius, Vector const& start, Vector const& end, QueryRules const& rules );
+        int32_t AddCapsuleSweep( float radius, float cylinderPortionHalfHeight, Quaternion const& orientation, Vector const& start, Vector const& end, QueryRules const& rules );
+        int32_t AddCylinderSweep( float radius, float cylinderPortionHalfHeight, Quaternion const& orientation, Vector const& start, Vector const& end, QueryRules const& rules );
+        int32_t AddBoxSweep( Vector halfExtents, Quaternion const& orientation, Vector const& start, Vector const& end, QueryRules const& rules );
+
+        // Results
+        //-------------------------------------------------------------------------
+
+        inline RayCastResults const& GetRayCastResults( int32_t resultIdx ) const
+        {
+            EE_ASSERT( m_wasExecuted && resultIdx >= 0 && resultIdx < (int32_t) m_rayCastResults.size() );
+            return m_rayCastResults[resultIdx];
+        }
+
+        inline SweepResults const& GetSweepResults( int32_t resultIdx ) const
+        {
+            EE_ASSERT( m_wasExecuted && resultIdx >= 0 && resultIdx < (int32_t) m_sweepResults.size() );
+            return m_sweepResults[resultIdx];
+        }
+
+    private:
+
+        int32_t AddSweep( Query::Type type, Vector const& shapeDimensions, Quaternion const& orientation, Vector const& start, Vector const& end, QueryRules const& rules );
+
+    private:
+
+        Threading::Mutex                    m_mutex;
+        TVector<Query>                      m_queries;
+        TVector<RayCastResults>             m_rayCastResults;
+        TVector<SweepResults>               m_sweepResults;
+        int32_t                             m_numRayCasts = 0;
+        int32_t                             m_numSweeps = 0;
+        bool                                m_wasExecuted = false;
+    };
 }
\ No newline at end of file
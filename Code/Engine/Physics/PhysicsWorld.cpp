@@ -22,11 +22,56 @@ using namespace physx;
 
 namespace EE::Physics::PX
 {
+    // Surprisingly it is faster to run all physics tasks on a single thread since there is a fair amount of gaps when spreading the tasks across multiple cores.
+    // By default, tasks are run immediately on the submitting thread. When deferring, tasks are queued so that the whole step can be run later on a single worker.
     class TaskDispatcher final : public PxCpuDispatcher
     {
-        virtual void submitTask( PxBaseTask & task ) override
+    public:
+
+        // Queue all submitted tasks until the next call to 'RunDeferredTasks'
+        void BeginDeferringTasks()
+        {
+            Threading::ScopeLock const lock( m_mutex );
+            EE_ASSERT( !m_isDeferringTasks && m_deferredTasks.empty() );
+            m_isDeferringTasks = true;
+        }
+
+        // Run all queued tasks (and any tasks they submit) on this thread, once the queue is drained all further tasks are run immediately
+        void RunDeferredTasks()
         {
-            // Surprisingly it is faster to run all physics tasks on a single thread since there is a fair amount of gaps when spreading the tasks across multiple cores.
+            while ( true )
+            {
+                PxBaseTask* pTask = nullptr;
+                {
+                    Threading::ScopeLock const lock( m_mutex );
+                    if ( m_deferredTasks.empty() )
+                    {
+                        m_isDeferringTasks = false;
+                        break;
+                    }
+
+                    pTask = m_deferredTasks.back();
+                    m_deferredTasks.pop_back();
+                }
+
+                pTask->run();
+                pTask->release();
+            }
+        }
+
+    private:
+
+        virtual void submitTask( PxBaseTask& task ) override
+        {
+            {
+                Threading::ScopeLock const lock( m_mutex );
+                if ( m_isDeferringTasks )
+                {
+                    m_deferredTasks.emplace_back( &task );
+                    return;
+                }
+            }
+
             // TODO: re-evaluate this when we have additional work. Perhaps we can interleave other tasks while physics tasks are waiting
             auto pTask = &task;
             pTask->run();
@@ -37,9 +82,13 @@ namespace EE::Physics::PX
         {
             return 1;
         }
-    };
 
-    TaskDispatcher g_taskDispatcher;
+    private:
+
+        Threading::Mutex                    m_mutex;
+        TVector<PxBaseTask*>                m_deferredTasks;
+        bool                                m_isDeferringTasks = false;
+    };
 
     //-------------------------------------------------------------------------
 
@@ -189,19 +238,24 @@ namespace EE::Physics::PX
 
 namespace EE::Physics
 {
-    PhysicsWorld::PhysicsWorld( MaterialRegistry const* pRegistry, bool isGameWorld )
+    PhysicsWorld::PhysicsWorld( MaterialRegistry const* pRegistry, TaskSystem* pTaskSystem, bool isGameWorld )
         : m_pMaterialRegistry( pRegistry )
+        , m_pTaskSystem( pTaskSystem )
         , m_isGameWorld( isGameWorld )
+        , m_simulationTask( [this] ( TaskSetPartition range, uint32_t threadnum ) { m_pTaskDispatcher->RunDeferredTasks(); } )
     {
         EE_ASSERT( m_pMaterialRegistry != nullptr );
 
+        m_pTaskDispatcher = EE::New<PX::TaskDispatcher>();
+        m_isAsyncSimulationEnabled = ( m_pTaskSystem != nullptr );
+
         PxTolerancesScale tolerancesScale;
         tolerancesScale.length = Constants::s_lengthScale;
         tolerancesScale.speed = Constants::s_speedScale;
 
         PxSceneDesc sceneDesc( tolerancesScale );
         sceneDesc.gravity = ToPx( Constants::s_gravity );
-        sceneDesc.cpuDispatcher = &PX::g_taskDispatcher;
+        sceneDesc.cpuDispatcher = m_pTaskDispatcher;
         sceneDesc.filterShader = PX::SimulationFilter::Shader;
         sceneDesc.filterCallback = &PX::g_simulationFilter;
         sceneDesc.flags = PxSceneFlag::eENABLE_CCD | PxSceneFlag::eREQUIRE_RW_LOCK;
@@ -214,21 +268,61 @@ namespace EE::Physics
 
     PhysicsWorld::~PhysicsWorld()
     {
+        WaitForSimulationToComplete();
+
         m_pControllerManager->purgeControllers();
         m_pControllerManager->release();
         m_pControllerManager = nullptr;
 
         m_pScene->release();
         m_pScene = nullptr;
+
+        EE::Delete( m_pTaskDispatcher );
     }
 
     //-------------------------------------------------------------------------
     // Update
     //-------------------------------------------------------------------------
 
-    void PhysicsWorld::Simulate( Seconds deltaTime )
+    void PhysicsWorld::SetAsyncSimulationEnabled( bool isEnabled )
+    {
+        EE_ASSERT( m_pTaskSystem != nullptr || !isEnabled );
+        WaitForSimulationToComplete();
+        m_isAsyncSimulationEnabled = isEnabled;
+    }
+
+    void PhysicsWorld::StartSimulation( Seconds deltaTime )
     {
         EE_PROFILE_FUNCTION_PHYSICS();
+        EE_ASSERT( !m_isSimulationInFlight );
+
+        // Synchronous step
+        //-------------------------------------------------------------------------
+
+        if ( !m_isAsyncSimulationEnabled )
+        {
+            AcquireWriteLock();
+            {
+                // TODO: run at fixed time step
+                EE_PROFILE_SCOPE_PHYSICS( "Simulate" );
+                m_pScene->simulate( deltaTime );
+            }
+
+            //-------------------------------------------------------------------------
+
+            {
+                EE_PROFILE_SCOPE_PHYSICS( "Fetch Results" );
+                m_pScene->fetchResults( true );
+            }
+            ReleaseWriteLock();
+            return;
+        }
+
+        // Async step
+        //-------------------------------------------------------------------------
+        // The simulate call only queues the step's tasks, these are then run on a worker and the write lock is released so that queries can be issued in the meantime
+
+        m_pTaskDispatcher->BeginDeferringTasks();
 
         AcquireWriteLock();
         {
@@ -236,14 +330,51 @@ namespace EE::Physics
             EE_PROFILE_SCOPE_PHYSICS( "Simulate" );
             m_pScene->simulate( deltaTime );
         }
+        ReleaseWriteLock();
+
+        m_isSimulationInFlight = true;
+        m_pTaskSystem->ScheduleTask( &m_simulationTask );
+    }
+
+    void PhysicsWorld::WaitForSimulationToComplete()
+    {
+        if ( !m_isSimulationInFlight )
+        {
+            return;
+        }
 
         //-------------------------------------------------------------------------
 
+        EE_PROFILE_FUNCTION_PHYSICS();
+
+        // No locks can be held while waiting, the task system runs other tasks on this thread while it waits and those might also need the results
+        m_pTaskSystem->WaitForTask( &m_simulationTask );
+
+        // Only the first thread to get here fetches the results, any other threads need to wait for that fetch to complete
+        if ( !m_isFetchingResults.exchange( true ) )
         {
-            EE_PROFILE_SCOPE_PHYSICS( "Fetch Results" );
-            m_pScene->fetchResults( true );
+            // Another thread might have already fetched the results before we claimed the fetch
+            if ( m_isSimulationInFlight )
+            {
+                AcquireWriteLock();
+                {
+                    EE_PROFILE_SCOPE_PHYSICS( "Fetch Results" );
+                    m_pScene->fetchResults( true );
+                }
+                ReleaseWriteLock();
+
+                m_isSimulationInFlight = false;
+            }
+
+            m_isFetchingResults = false;
+        }
+        else
+        {
+            while ( m_isSimulationInFlight )
+            {
+                std::this_thread::yield();
+            }
         }
-        ReleaseWriteLock();
     }
 
     //-------------------------------------------------------------------------
@@ -548,6 +679,120 @@ namespace EE::Physics
         return OverlapInternal( boxGeo, Transform( orientation, position ), rules, outResults );
     }
 
+    //-------------------------------------------------------------------------
+    // Batched Queries
+    //-------------------------------------------------------------------------
+
+    void PhysicsWorld::ExecuteQueryBatch( QueryBatch& batch )
+    {
+        EE_PROFILE_FUNCTION_PHYSICS();
+
+        struct QueryBatchTask final : public ITaskSet
+        {
+            // Chunk size is a trade-off between scheduling overhead and the per-chunk lock acquisition
+            constexpr static uint32_t const s_minQueriesPerChunk = 32;
+
+            QueryBatchTask( PhysicsWorld* pWorld, QueryBatch& batch )
+                : m_pWorld( pWorld )
+                , m_batch( batch )
+            {
+                m_SetSize = (uint32_t) batch.m_queries.size();
+                m_MinRange = s_minQueriesPerChunk;
+            }
+
+            virtual void ExecuteRange( TaskSetPartition range, uint32_t threadnum ) override final
+            {
+                EE_PROFILE_SCOPE_PHYSICS( "Execute Query Batch Chunk" );
+
+                // PhysX tracks read locks per thread, so each chunk needs to acquire its own lock
+                m_pWorld->AcquireReadLock();
+                for ( uint32_t i = range.start; i < range.end; ++i )
+                {
+                    m_pWorld->ExecuteBatchedQuery( m_batch, (int32_t) i );
+                }
+                m_pWorld->ReleaseReadLock();
+            }
+
+        private:
+
+            PhysicsWorld*                   m_pWorld = nullptr;
+            QueryBatch&                     m_batch;
+        };
+
+        //-------------------------------------------------------------------------
+
+        Threading::ScopeLock const lock( batch.m_mutex );
+        EE_ASSERT( !batch.m_wasExecuted );
+
+        // Size the result slots up front, so that the tasks never modify the containers
+        batch.m_rayCastResults.resize( batch.m_numRayCasts );
+        batch.m_sweepResults.resize( batch.m_numSweeps );
+
+        QueryBatchTask queryTask( this, batch );
+        if ( m_pTaskSystem != nullptr && batch.m_queries.size() > QueryBatchTask::s_minQueriesPerChunk )
+        {
+            m_pTaskSystem->ScheduleTask( &queryTask );
+            m_pTaskSystem->WaitForTask( &queryTask );
+        }
+        else
+        {
+            queryTask.ExecuteRange( { 0u, (uint32_t) batch.m_queries.size() }, 0 );
+        }
+
+        batch.m_wasExecuted = true;
+    }
+
+    void PhysicsWorld::ExecuteBatchedQuery( QueryBatch& batch, int32_t queryIdx )
+    {
+        QueryBatch::Query const& query = batch.m_queries[queryIdx];
+
+        if ( query.m_type == QueryBatch::Query::Type::RayCast )
+        {
+            RayCastResults& results = batch.m_rayCastResults[query.m_resultIdx];
+            results.Reset();
+            RayCastInternal( query.m_start, query.m_direction, query.m_distance, query.m_rules, results );
+            return;
+        }
+
+        //-------------------------------------------------------------------------
+
+        SweepResults& results = batch.m_sweepResults[query.m_resultIdx];
+        results.Reset();
+
+        switch ( query.m_type )
+        {
+            case QueryBatch::Query::Type::SphereSweep:
+            {
+                SphereSweepInternal( query.m_shapeDimensions.GetX(), query.m_start, query.m_direction, query.m_distance, query.m_rules, results );
+            }
+            break;
+
+            case QueryBatch::Query::Type::CapsuleSweep:
+            {
+                CapsuleSweepInternal( query.m_shapeDimensions.GetX(), query.m_shapeDimensions.GetY(), query.m_orientation, query.m_start, query.m_direction, query.m_distance, query.m_rules, results );
+            }
+            break;
+
+            case QueryBatch::Query::Type::CylinderSweep:
+            {
+                CylinderSweepInternal( query.m_shapeDimensions.GetX(), query.m_shapeDimensions.GetY(), query.m_orientation, query.m_start, query.m_direction, query.m_distance, query.m_rules, results );
+            }
+            break;
+
+            case QueryBatch::Query::Type::BoxSweep:
+            {
+                BoxSweepInternal( query.m_shapeDimensions, query.m_orientation, query.m_start, query.m_direction, query.m_distance, query.m_rules, results );
+            }
+            break;
+
+            default:
+            {
+                EE_UNREACHABLE_CODE();
+            }
+            break;
+        }
+    }
+
     //-------------------------------------------------------------------------
     // Actors and Shapes
     //-------------------------------------------------------------------------
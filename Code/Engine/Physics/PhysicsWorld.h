@@ -3,7 +3,10 @@
 #include "Engine/Physics/PhysicsQuery.h"
 #include "Base/Time/Time.h"
 #include "Base/Math/Transform.h"
+#include "Base/Threading/TaskSystem.h"
+#include "Base/Threading/Threading.h"
 #include <atomic>
+#include <thread>
 
 //-------------------------------------------------------------------------
 
@@ -30,11 +33,14 @@ namespace EE::Physics
     class Ragdoll;
     struct RagdollDefinition;
 
+    namespace PX { class TaskDispatcher; }
+
     //-------------------------------------------------------------------------
 
     class EE_ENGINE_API PhysicsWorld final
     {
         friend class PhysicsWorldSystem;
+        friend class QueryBatchBenchmark;
 
     public:
 
@@ -43,9 +49,23 @@ namespace EE::Physics
 
     public:
 
-        PhysicsWorld( MaterialRegistry const* pRegistry, bool isGameWorld );
+        PhysicsWorld( MaterialRegistry const* pRegistry, TaskSystem* pTaskSystem, bool isGameWorld );
         ~PhysicsWorld();
 
+        // Simulation
+        //-------------------------------------------------------------------------
+        // In async mode, the simulation step is run on a worker thread and its results are only fetched by the first user that needs them.
+        // Scene queries issued while the step is in flight are allowed (under a read lock) and will return the pre-step state.
+
+        inline bool IsAsyncSimulationEnabled() const { return m_isAsyncSimulationEnabled; }
+        void SetAsyncSimulationEnabled( bool isEnabled );
+
+        inline bool IsSimulationInFlight() const { return m_isSimulationInFlight; }
+
+        // Wait for the in-flight simulation step (if any) and fetch its results, needs to be called before reading any simulated state
+        // Note: This needs to be called without holding a read or write lock on this world!
+        void WaitForSimulationToComplete();
+
         // Locks
         //-------------------------------------------------------------------------
 
@@ -194,6 +214,13 @@ namespace EE::Physics
             return BoxOverlap( halfExtents, shapeTransform.GetRotation(), shapeTransform.GetTranslation(), rules, outResults );
         }
 
+        // Batched Queries
+        //-------------------------------------------------------------------------
+
+        // Execute all queued queries in parallel and fill the batch's result slots. The read lock is acquired once per chunk of queries,
+        // so unlike the individual queries, this needs to be called without holding a lock on this world.
+        void ExecuteQueryBatch( QueryBatch& batch );
+
         // Debug
         //-------------------------------------------------------------------------
 
@@ -220,7 +247,7 @@ namespace EE::Physics
         // Simulation
         //-------------------------------------------------------------------------
 
-        void Simulate( Seconds deltaTime );
+        void StartSimulation( Seconds deltaTime );
 
         // Queries
         //-------------------------------------------------------------------------
@@ -232,6 +259,7 @@ namespace EE::Physics
         bool BoxSweepInternal( Vector halfExtents, Quaternion const& orientation, Vector const& start, Vector const& direction, float distance, QueryRules const& rules, SweepResults& outResults );
         bool SweepInternal( physx::PxGeometry const& geo, Transform const& startTransform, Vector const& direction, float distance, QueryRules const& rules, SweepResults& outResults );
         bool OverlapInternal( physx::PxGeometry const& geo, Transform const& transform, QueryRules const& rules, OverlapResults& outResults );
+        void ExecuteBatchedQuery( QueryBatch& batch, int32_t queryIdx );
 
         // Actors and Shapes
         //-------------------------------------------------------------------------
@@ -245,10 +273,17 @@ namespace EE::Physics
     private:
 
         MaterialRegistry const*                                 m_pMaterialRegistry = nullptr;
+        TaskSystem*                                             m_pTaskSystem = nullptr;
+        PX::TaskDispatcher*                                     m_pTaskDispatcher = nullptr;
         physx::PxScene*                                         m_pScene = nullptr;
         physx::PxControllerManager*                             m_pControllerManager = nullptr;
         bool                                                    m_isGameWorld = false;
 
+        AsyncTask                                               m_simulationTask;
+        std::atomic<bool>                                       m_isFetchingResults = false;
+        std::atomic<bool>                                       m_isSimulationInFlight = false;
+        bool                                                    m_isAsyncSimulationEnabled = false;
+
         #if EE_DEVELOPMENT_TOOLS
         uint32_t                                                m_sceneDebugFlags = 0;
         float                                                   m_debugDrawDistance = 10.0f;
@@ -29,12 +29,17 @@ namespace EE::Physics
 
         //-------------------------------------------------------------------------
 
-        m_pWorld = EE::New<PhysicsWorld>( systemRegistry.GetSystem<MaterialRegistry>(), IsInAGameWorld() );
+        m_pWorld = EE::New<PhysicsWorld>( systemRegistry.GetSystem<MaterialRegistry>(), systemRegistry.GetSystem<TaskSystem>(), IsInAGameWorld() );
         EE_ASSERT( m_pWorld != nullptr );
+
+        m_pFrameQueryBatch = EE::New<QueryBatch>();
+        m_pFrameQueryResults = EE::New<QueryBatch>();
     }
 
     void PhysicsWorldSystem::ShutdownSystem()
     {
+        EE::Delete( m_pFrameQueryBatch );
+        EE::Delete( m_pFrameQueryResults );
         EE::Delete( m_pWorld );
 
         PhysicsShapeComponent::OnRebuildBodyRequested().Unbind( m_actorRebuildBindingID );
@@ -181,6 +186,14 @@ namespace EE::Physics
 
     //-------------------------------------------------------------------------
 
+    WorldSystemAccess PhysicsWorldSystem::GetUpdateAccess() const
+    {
+        // Actor rebuilds modify the physics components and the post-physics update writes the simulated poses back to the dynamic components
+        WorldSystemAccess access;
+        access.Writes<SpatialEntityComponent>();
+        return access;
+    }
+
     void PhysicsWorldSystem::UpdateSystem( EntityWorldUpdateContext const& ctx )
     {
         // HACK HACK
@@ -288,9 +301,23 @@ namespace EE::Physics
         {
             PostPhysicsUpdate( ctx );
         }
-        else
+        else if ( ctx.GetUpdateStage() == UpdateStage::Paused )
+        {
+            // The physics stage doesnt run for paused worlds, so we need to execute any gathered queries here
+            ExecuteFrameQueries();
+        }
+    }
+
+    void PhysicsWorldSystem::ExecuteFrameQueries()
+    {
+        // The entity updates for this stage have completed and any system reading the results conflicts with this one, so nothing can still be reading the previous results
+        // Discard them and start gathering the next frame's queries into that batch
+        m_pFrameQueryResults->Reset();
+        std::swap( m_pFrameQueryBatch, m_pFrameQueryResults );
+
+        if ( !m_pFrameQueryResults->IsEmpty() )
         {
-           // Do nothing for now
+            m_pWorld->ExecuteQueryBatch( *m_pFrameQueryResults );
         }
     }
 
@@ -298,13 +325,19 @@ namespace EE::Physics
     {
         EE_PROFILE_FUNCTION_PHYSICS();
 
-        m_pWorld->Simulate( ctx.GetDeltaTime() );
+        // Run all the queries gathered this frame against the pre-step state
+        ExecuteFrameQueries();
+
+        m_pWorld->StartSimulation( ctx.GetDeltaTime() );
     }
 
     void PhysicsWorldSystem::PostPhysicsUpdate( EntityWorldUpdateContext const& ctx )
     {
         EE_PROFILE_FUNCTION_PHYSICS();
 
+        // If no one else needed the simulation results, we need to fetch them now
+        m_pWorld->WaitForSimulationToComplete();
+
         // Transfer physics poses back to dynamic components
         //-------------------------------------------------------------------------
 
@@ -24,6 +24,7 @@ namespace EE::Physics
     class CharacterComponent;
     class PhysicsTestComponent;
     class PhysicsWorld;
+    class QueryBatch;
     enum class DynamicMotionType;
 
     //-------------------------------------------------------------------------
@@ -41,7 +42,7 @@ namespace EE::Physics
 
     public:
 
-        EE_ENTITY_WORLD_SYSTEM( PhysicsWorldSystem, RequiresUpdate( UpdateStage::Physics ), RequiresUpdate( UpdateStage::PostPhysics ), RequiresUpdate( UpdateStage::Paused ) );
+        EE_ENTITY_WORLD_SYSTEM( PhysicsWorldSystem, RequiresUpdate( UpdateStage::Physics, UpdatePriority::Highest ), RequiresUpdate( UpdateStage::PostPhysics ), RequiresUpdate( UpdateStage::Paused, UpdatePriority::Highest ) );
 
     public:
 
@@ -50,6 +51,15 @@ namespace EE::Physics
         PhysicsWorld const* GetWorld() const { return m_pWorld; }
         PhysicsWorld* GetWorld() { return m_pWorld; }
 
+        // The frame queries are double buffered: queries can be added to this batch from any thread until the physics stage (the paused stage for paused worlds),
+        // at which point they are all executed together (before the simulation step) and the batch becomes the frame query results.
+        // Any queries added after that point will be executed in the next frame's physics stage.
+        QueryBatch& GetFrameQueryBatch() { return *m_pFrameQueryBatch; }
+
+        // The results of the queries executed in the last physics stage, these remain valid until the next physics stage.
+        // The result indices are the ones returned when adding the queries to the frame query batch.
+        QueryBatch const& GetFrameQueryResults() const { return *m_pFrameQueryResults; }
+
     private:
 
         virtual void InitializeSystem( SystemRegistry const& systemRegistry ) override;
@@ -57,18 +67,22 @@ namespace EE::Physics
         virtual void RegisterComponent( Entity const* pEntity, EntityComponent* pComponent ) override final;
         virtual void UnregisterComponent( Entity const* pEntity, EntityComponent* pComponent ) override final;
         virtual void UpdateSystem( EntityWorldUpdateContext const& ctx ) override final;
+        virtual WorldSystemAccess GetUpdateAccess() const override final;
 
         void RegisterDynamicComponent( PhysicsShapeComponent* pComponent );
         void UnregisterDynamicComponent( PhysicsShapeComponent* pComponent );
 
         void ProcessActorRebuildRequests( EntityWorldUpdateContext const& ctx );
 
+        void ExecuteFrameQueries();
         void PhysicsUpdate( EntityWorldUpdateContext const& ctx );
         void PostPhysicsUpdate( EntityWorldUpdateContext const& ctx );
 
     private:
 
         PhysicsWorld*                                           m_pWorld = nullptr;
+        QueryBatch*                                             m_pFrameQueryBatch = nullptr;
+        QueryBatch*                                             m_pFrameQueryResults = nullptr;
 
         TIDVector<ComponentID, CharacterComponent*>             m_characterComponents;
         TIDVector<ComponentID, PhysicsShapeComponent*>          m_physicsShapeComponents;
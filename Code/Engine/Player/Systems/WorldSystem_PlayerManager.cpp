@@ -110,7 +110,7 @@ namespace EE
         //-------------------------------------------------------------------------
 
         // For now we only support a single spawn point
-        pPersistentMap->AddEntityCollection( pTaskSystem, *pTypeRegistry, *m_spawnPoints[0]->GetEntityCollectionDesc(), m_spawnPoints[0]->GetWorldTransform() );
+        pPersistentMap->AddEntityCollection( pTaskSystem, *pTypeRegistry, *m_spawnPoints[0]->GetEntityCollectionDesc(), m_spawnPoints[0]->GetWorldTransform(), nullptr, Resource::ResourceLoadPriority::Critical );
         return true;
     }
 
@@ -137,6 +137,14 @@ namespace EE
 
     //-------------------------------------------------------------------------
 
+    WorldSystemAccess PlayerManager::GetUpdateAccess() const
+    {
+        // Spawning reads the spawn points, and player state changes enable/disable the player component
+        WorldSystemAccess access;
+        access.Reads<Player::PlayerSpawnComponent>().Writes<Player::PlayerComponent>();
+        return access;
+    }
+
     void PlayerManager::UpdateSystem( EntityWorldUpdateContext const& ctx )
     {
         if ( ctx.GetUpdateStage() == UpdateStage::FrameStart )
@@ -0,0 +1,200 @@
+#include "OcclusionBuffer.h"
+#include "Engine/Render/Mesh/StaticMesh.h"
+#include "Base/Render/RenderVertexFormats.h"
+
+//-------------------------------------------------------------------------
+
+namespace EE::Render
+{
+    // Anything closer than this (in clip space W) is treated as crossing the near plane
+    constexpr static float const g_minClipW = 1.0e-4f;
+
+    //-------------------------------------------------------------------------
+
+    OcclusionBuffer::OcclusionBuffer()
+        : m_viewProjectionMatrix( Matrix::Identity )
+    {
+        m_depth.resize( s_width * s_height, 1.0f );
+    }
+
+    void OcclusionBuffer::Reset( Matrix const& viewProjectionMatrix )
+    {
+        m_viewProjectionMatrix = viewProjectionMatrix;
+        eastl::fill( m_depth.begin(), m_depth.end(), 1.0f );
+        m_numRasterizedTriangles = 0;
+    }
+
+    //-------------------------------------------------------------------------
+
+    void OcclusionBuffer::RasterizeOccluder( StaticMesh const* pMesh, Matrix const& worldMatrix )
+    {
+        EE_ASSERT( pMesh != nullptr );
+
+        Matrix const worldViewProjectionMatrix = worldMatrix * m_viewProjectionMatrix;
+
+        Blob const& vertexData = pMesh->GetVertexData();
+        uint32_t const vertexStride = pMesh->GetVertexBuffer().m_byteStride;
+        EE_ASSERT( vertexStride >= sizeof( StaticMeshVertex ) );
+
+        // All mesh vertex formats start with the position
+        auto GetClipSpaceVertex = [&] ( uint32_t vertexIdx )
+        {
+            auto pVertex = reinterpret_cast<StaticMeshVertex const*>( vertexData.data() + ( vertexIdx * vertexStride ) );
+            return worldViewProjectionMatrix.TransformVector3( Vector( pVertex->m_position ) );
+        };
+
+        TVector<uint32_t> const& indices = pMesh->GetIndices();
+        EE_ASSERT( indices.size() % 3 == 0 );
+
+        for ( size_t i = 0; i < indices.size(); i += 3 )
+        {
+            RasterizeTriangle( GetClipSpaceVertex( indices[i] ), GetClipSpaceVertex( indices[i + 1] ), GetClipSpaceVertex( indices[i + 2] ) );
+        }
+    }
+
+    void OcclusionBuffer::RasterizeTriangle( Vector const& clip0, Vector const& clip1, Vector const& clip2 )
+    {
+        // Skip any triangles crossing the near plane, not rasterizing an occluder is always safe
+        if ( clip0.GetW() < g_minClipW || clip1.GetW() < g_minClipW || clip2.GetW() < g_minClipW )
+        {
+            return;
+        }
+
+        // Project to screen space ( X = pixel X, Y = pixel Y, Z = depth )
+        auto ToScreenSpace = [] ( Vector const& clip )
+        {
+            Vector const ndc = clip / clip.GetSplatW();
+            return Float3( ( ndc.GetX() * 0.5f + 0.5f ) * s_width, ( 0.5f - ndc.GetY() * 0.5f ) * s_height, ndc.GetZ() );
+        };
+
+        Float3 const v0 = ToScreenSpace( clip0 );
+        Float3 const v1 = ToScreenSpace( clip1 );
+        Float3 const v2 = ToScreenSpace( clip2 );
+
+        // EE uses CCW front faces, the Y flip above means that front faces have a negative area in screen space
+        float const area = ( v1.m_x - v0.m_x ) * ( v2.m_y - v0.m_y ) - ( v2.m_x - v0.m_x ) * ( v1.m_y - v0.m_y );
+        if ( area >= 0.0f )
+        {
+            return;
+        }
+
+        // Clamp the triangle bounds to the buffer
+        int32_t const minX = Math::Max( 0, (int32_t) Math::Floor( Math::Min( v0.m_x, Math::Min( v1.m_x, v2.m_x ) ) ) );
+        int32_t const maxX = Math::Min( s_width - 1, (int32_t) Math::Ceiling( Math::Max( v0.m_x, Math::Max( v1.m_x, v2.m_x ) ) ) );
+        int32_t const minY = Math::Max( 0, (int32_t) Math::Floor( Math::Min( v0.m_y, Math::Min( v1.m_y, v2.m_y ) ) ) );
+        int32_t const maxY = Math::Min( s_height - 1, (int32_t) Math::Ceiling( Math::Max( v0.m_y, Math::Max( v1.m_y, v2.m_y ) ) ) );
+        if ( minX > maxX || minY > maxY )
+        {
+            return;
+        }
+
+        m_numRasterizedTriangles++;
+
+        // Edge functions, evaluated at pixel centers
+        //-------------------------------------------------------------------------
+
+        // Each edge function evaluates to -area at its opposite vertex, so this normalizes them into barycentric weights
+        float const invArea = -1.0f / area;
+
+        float const e0dx = ( v2.m_y - v1.m_y ), e0dy = ( v1.m_x - v2.m_x );
+        float const e1dx = ( v0.m_y - v2.m_y ), e1dy = ( v2.m_x - v0.m_x );
+        float const e2dx = ( v1.m_y - v0.m_y ), e2dy = ( v0.m_x - v1.m_x );
+
+        float const startX = minX + 0.5f;
+        float const startY = minY + 0.5f;
+        float e0Row = ( startX - v1.m_x ) * e0dx + ( startY - v1.m_y ) * e0dy;
+        float e1Row = ( startX - v2.m_x ) * e1dx + ( startY - v2.m_y ) * e1dy;
+        float e2Row = ( startX - v0.m_x ) * e2dx + ( startY - v0.m_y ) * e2dy;
+
+        for ( int32_t y = minY; y <= maxY; y++ )
+        {
+            float e0 = e0Row, e1 = e1Row, e2 = e2Row;
+            float* pDepthRow = &m_depth[y * s_width];
+
+            for ( int32_t x = minX; x <= maxX; x++ )
+            {
+                // Front faces have a negative area, so all edge functions are non-negative inside the triangle
+                if ( e0 >= 0.0f && e1 >= 0.0f && e2 >= 0.0f )
+                {
+                    float const depth = ( e0 * v0.m_z + e1 * v1.m_z + e2 * v2.m_z ) * invArea;
+                    pDepthRow[x] = Math::Min( pDepthRow[x], depth );
+                }
+
+                e0 += e0dx;
+                e1 += e1dx;
+                e2 += e2dx;
+            }
+
+            e0Row += e0dy;
+            e1Row += e1dy;
+            e2Row += e2dy;
+        }
+    }
+
+    //-------------------------------------------------------------------------
+
+    bool OcclusionBuffer::IsOccluded( AABB const& aabb ) const
+    {
+        if ( m_numRasterizedTriangles == 0 )
+        {
+            return false;
+        }
+
+        // Get the screen rect and nearest depth of the box
+        //-------------------------------------------------------------------------
+
+        Vector const min = aabb.GetMin();
+        Vector const max = aabb.GetMax();
+
+        float minScreenX = FLT_MAX, minScreenY = FLT_MAX, maxScreenX = -FLT_MAX, maxScreenY = -FLT_MAX;
+        float nearestDepth = FLT_MAX;
+
+        for ( auto i = 0; i < 8; i++ )
+        {
+            Vector const corner( ( i & 1 ) ? max.GetX() : min.GetX(), ( i & 2 ) ? max.GetY() : min.GetY(), ( i & 4 ) ? max.GetZ() : min.GetZ() );
+            Vector const clip = m_viewProjectionMatrix.TransformVector3( corner );
+
+            // Boxes crossing the near plane are always considered visible
+            if ( clip.GetW() < g_minClipW )
+            {
+                return false;
+            }
+
+            Vector const ndc = clip / clip.GetSplatW();
+            minScreenX = Math::Min( minScreenX, ndc.GetX() );
+            maxScreenX = Math::Max( maxScreenX, ndc.GetX() );
+            minScreenY = Math::Min( minScreenY, ndc.GetY() );
+            maxScreenY = Math::Max( maxScreenY, ndc.GetY() );
+            nearestDepth = Math::Min( nearestDepth, ndc.GetZ() );
+        }
+
+        // Convert to pixels, the Y axis is flipped so the max NDC Y is the min pixel Y
+        int32_t const minX = Math::Max( 0, (int32_t) Math::Floor( ( minScreenX * 0.5f + 0.5f ) * s_width ) );
+        int32_t const maxX = Math::Min( s_width - 1, (int32_t) Math::Floor( ( maxScreenX * 0.5f + 0.5f ) * s_width ) );
+        int32_t const minY = Math::Max( 0, (int32_t) Math::Floor( ( 0.5f - maxScreenY * 0.5f ) * s_height ) );
+        int32_t const maxY = Math::Min( s_height - 1, (int32_t) Math::Floor( ( 0.5f - minScreenY * 0.5f ) * s_height ) );
+
+        // Entirely off screen, this should have been frustum culled, so dont make any claims about it
+        if ( minX > maxX || minY > maxY )
+        {
+            return false;
+        }
+
+        // The box is occluded only if every pixel it covers has an occluder in front of it
+        //-------------------------------------------------------------------------
+
+        for ( int32_t y = minY; y <= maxY; y++ )
+        {
+            float const* pDepthRow = &m_depth[y * s_width];
+            for ( int32_t x = minX; x <= maxX; x++ )
+            {
+                if ( pDepthRow[x] >= nearestDepth )
+                {
+                    return false;
+                }
+            }
+        }
+
+        return true;
+    }
+}
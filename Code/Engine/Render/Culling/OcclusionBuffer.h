@@ -0,0 +1,58 @@
+#pragma once
+
+#include "Engine/_Module/API.h"
+#include "Base/Math/Matrix.h"
+#include "Base/Math/BoundingVolumes.h"
+#include "Base/Types/Arrays.h"
+
+//-------------------------------------------------------------------------
+// Software Occlusion Buffer
+//-------------------------------------------------------------------------
+// A low resolution depth buffer that a small set of large occluder meshes are rasterized into on the CPU.
+// Bounding boxes are then tested against it to remove objects that are hidden before we submit them for drawing.
+//
+// The test is conservative with respect to the geometry we rasterize:
+// * Only front facing triangles are rasterized
+// * Triangles that cross the near plane are skipped rather than clipped
+// * Boxes that cross the near plane are never occluded
+// Depth is stored as the post-projection Z (which is linear in screen space), with 1.0 meaning empty
+
+namespace EE::Render
+{
+    class StaticMesh;
+
+    //-------------------------------------------------------------------------
+
+    class EE_ENGINE_API OcclusionBuffer
+    {
+    public:
+
+        constexpr static int32_t const s_width = 256;
+        constexpr static int32_t const s_height = 128;
+
+    public:
+
+        OcclusionBuffer();
+
+        // Clear the buffer and set the view that all occluders and tests will be projected with
+        void Reset( Matrix const& viewProjectionMatrix );
+
+        // Rasterize all the triangles of a mesh into the buffer
+        void RasterizeOccluder( StaticMesh const* pMesh, Matrix const& worldMatrix );
+
+        // Returns true if the box is fully hidden behind the occluders rasterized so far
+        bool IsOccluded( AABB const& aabb ) const;
+
+        inline int32_t GetNumRasterizedTriangles() const { return m_numRasterizedTriangles; }
+
+    private:
+
+        void RasterizeTriangle( Vector const& v0, Vector const& v1, Vector const& v2 );
+
+    private:
+
+        Matrix                  m_viewProjectionMatrix;
+        TVector<float>          m_depth;
+        int32_t                 m_numRasterizedTriangles = 0;
+    };
+}
@@ -0,0 +1,48 @@
+#include "SunShadowVolume.h"
+
+//-------------------------------------------------------------------------
+
+namespace EE::Render
+{
+    Math::ViewVolume SunShadows::CalculateShadowVolume( Math::ViewVolume const& cameraViewVolume, Transform const& lightWorldTransform, float shadowDistance )
+    {
+        Transform lightTransform = lightWorldTransform;
+        lightTransform.SetTranslation( Vector::Zero );
+        Transform const invLightTransform = lightTransform.GetInverse();
+
+        // Get a modified camera view volume that has the shadow distance as the z far.
+        // This will get us the appropriate corners to translate into light space.
+
+        // To make these cascade, you do this in a loop and move the depth range along by your
+        // cascade distance.
+        Math::ViewVolume camVolume = cameraViewVolume;
+        camVolume.SetDepthRange( FloatRange( 1.0f, shadowDistance ) );
+
+        Math::ViewVolume::VolumeCorners corners = camVolume.GetCorners();
+
+        // Translate into light space.
+        for ( int32_t i = 0; i < 8; i++ )
+        {
+            corners.m_points[i] = invLightTransform.TransformPoint( corners.m_points[i] );
+        }
+
+        // Note for understanding, cornersMin and cornersMax are in light space, not world space.
+        Vector cornersMin = Vector::One * FLT_MAX;
+        Vector cornersMax = Vector::One * -FLT_MAX;
+
+        for ( int32_t i = 0; i < 8; i++ )
+        {
+            cornersMin = Vector::Min( cornersMin, corners.m_points[i] );
+            cornersMax = Vector::Max( cornersMax, corners.m_points[i] );
+        }
+
+        Vector lightPosition = Vector::Lerp( cornersMin, cornersMax, 0.5f );
+        lightPosition = Vector::Select( lightPosition, cornersMax, Vector::Select0100 ); //force lightPosition to the "back" of the box.
+        lightPosition = lightTransform.TransformPoint( lightPosition );   //Light position now in world space.
+        lightTransform.SetTranslation( lightPosition );   //Assign to the lightTransform, now it's positioned above our view frustum.
+
+        Float3 const delta = ( cornersMax - cornersMin ).ToFloat3();
+        float dim = Math::Max( delta.m_x, delta.m_z );
+        return Math::ViewVolume( Float2( dim ), FloatRange( 1.0, delta.m_y ), lightTransform.ToMatrix() );
+    }
+}
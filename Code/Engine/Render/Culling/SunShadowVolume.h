@@ -0,0 +1,21 @@
+#pragma once
+
+#include "Engine/_Module/API.h"
+#include "Base/Math/ViewVolume.h"
+#include "Base/Math/Transform.h"
+
+//-------------------------------------------------------------------------
+// Sun Shadow Volume
+//-------------------------------------------------------------------------
+// The sun shadow map is an orthographic projection along the light direction that covers the camera view volume up to the shadow distance.
+// The same volume is used to cull shadow casters and to render the shadow map, so any mesh outside of it cannot affect the shadow map.
+
+namespace EE::Render
+{
+    namespace SunShadows
+    {
+        constexpr static float const s_shadowDistance = 50.0f; // TODO: configure
+
+        EE_ENGINE_API Math::ViewVolume CalculateShadowVolume( Math::ViewVolume const& cameraViewVolume, Transform const& lightWorldTransform, float shadowDistance = s_shadowDistance );
+    }
+}
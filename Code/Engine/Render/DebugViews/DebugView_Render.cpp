@@ -49,6 +49,19 @@ namespace EE::Render
 
         DrawRenderVisualizationModesMenu( m_pWorld );
 
+        ImGuiX::TextSeparator( "Culling" );
+
+        auto const& cullingStats = m_pWorldRendererSystem->GetCullingStats();
+        ImGui::Text( "Static Meshes: %d / %d visible", cullingStats.m_numVisibleStaticMeshes, cullingStats.m_numStaticMeshes );
+        ImGui::Text( "Skeletal Meshes: %d / %d visible", cullingStats.m_numVisibleSkeletalMeshes, cullingStats.m_numSkeletalMeshes );
+        ImGui::Text( "Frustum Culled: %d", cullingStats.m_numFrustumCulled );
+        ImGui::Text( "Occlusion Culled: %d", cullingStats.m_numOcclusionCulled );
+        ImGui::Text( "Occluders: %d (%d triangles)", cullingStats.m_numOccluders, cullingStats.m_numOccluderTriangles );
+        ImGui::Text( "Shadow Casters: %d (%d not visible)", cullingStats.m_numShadowCasters, cullingStats.m_numShadowOnlyCasters );
+
+        ImGui::Checkbox( "Enable Occlusion Culling", &m_pWorldRendererSystem->m_isOcclusionCullingEnabled );
+        ImGui::Checkbox( "Show Occluders", &m_pWorldRendererSystem->m_showOccluders );
+
         ImGuiX::TextSeparator( "Static Meshes" );
 
         ImGui::Checkbox( "Show Static Mesh Bounds", &m_pWorldRendererSystem->m_showStaticMeshBounds );
@@ -44,8 +44,20 @@ namespace EE::Render
         virtual uint32_t GetRendererID() const = 0;
         virtual int32_t GetPriority() const = 0;
 
+        // Prepare is always called on the main thread, once the simulation for the frame has completed. Any state needed for rendering
+        // needs to be copied out of the world/viewport here since, with pipelined rendering, the next frame will be simulating while we render.
+        virtual void PrepareWorld( Seconds const deltaTime, Viewport const& viewport, EntityWorld* pWorld ) {};
+        virtual void PrepareViewport( Seconds const deltaTime, Viewport const& viewport ) {};
+
+        // Render may be called from a worker thread, only the state copied during prepare may be accessed
         virtual void RenderWorld( Seconds const deltaTime, Viewport const& viewport, RenderTarget const& renderTarget, EntityWorld* pWorld ) {};
         virtual void RenderViewport( Seconds const deltaTime, Viewport const& viewport, RenderTarget const& renderTarget ) {};
+
+        // Does this renderer only access the prepared state when rendering - i.e. can it render while the next frame is being simulated
+        virtual bool SupportsPipelinedRendering() const { return false; }
+
+        // Called on the main thread before a world is destroyed, any state prepared for the world needs to be released
+        virtual void OnWorldDestroyed( EntityWorld const* pWorld ) {};
     };
 }
 
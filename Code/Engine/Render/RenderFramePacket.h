@@ -0,0 +1,132 @@
+#pragma once
+
+#include "Base/Math/Matrix.h"
+#include "Base/Math/Transform.h"
+#include "Base/Types/Arrays.h"
+
+//-------------------------------------------------------------------------
+// Render Frame Packet
+//-------------------------------------------------------------------------
+// A copy of all the world state needed to render a single frame of a world. This is filled in at the end of the world update and
+// is then the only world data the world renderer is allowed to touch. This allows us to render a frame while the next one simulates.
+//
+// Mesh instances contain everything visible from the camera as well as any shadow casters that are only inside the sun shadow volume.
+//
+// Note: resource ptrs are not copied and no references are held. This is safe since resources are only released by unload requests
+// and the engine waits for the in-flight frame to complete before the resource system starts processing any unload requests.
+
+namespace EE::Render
+{
+    class StaticMesh;
+    class SkeletalMesh;
+    class Material;
+    class CubemapTexture;
+
+    //-------------------------------------------------------------------------
+
+    struct RenderFramePacket
+    {
+        struct StaticMeshInstance
+        {
+            StaticMesh const*                   m_pMesh = nullptr;
+            Matrix                              m_worldTransform;           // Includes the component's local scale
+            uint64_t                            m_sectionVisibilityMask = 0;
+            uint64_t                            m_entityID = 0;
+            uint64_t                            m_componentID = 0;
+            int32_t                             m_firstMaterialIdx = 0;
+            int32_t                             m_numMaterials = 0;
+            bool                                m_isVisible = false;        // Is this mesh visible from the camera
+            bool                                m_castsShadow = false;      // Is this mesh inside the sun shadow volume
+        };
+
+        struct SkeletalMeshInstance
+        {
+            SkeletalMesh const*                 m_pMesh = nullptr;
+            Matrix                              m_worldTransform;
+            uint64_t                            m_sectionVisibilityMask = 0;
+            uint64_t                            m_entityID = 0;
+            uint64_t                            m_componentID = 0;
+            int32_t                             m_firstMaterialIdx = 0;
+            int32_t                             m_numMaterials = 0;
+            int32_t                             m_firstSkinningTransformIdx = 0;
+            int32_t                             m_numSkinningTransforms = 0;
+            bool                                m_isVisible = false;        // Is this mesh visible from the camera
+            bool                                m_castsShadow = false;      // Is this mesh inside the sun shadow volume
+        };
+
+        struct DirectionalLight
+        {
+            Transform                           m_worldTransform;
+            Vector                              m_direction;
+            Vector                              m_colorIntensity;
+            Matrix                              m_shadowViewProjectionMatrix;   // The shadow casters were culled against this volume, so it must also be used for rendering the shadow map
+            bool                                m_isShadowed = false;
+        };
+
+        struct PointLight
+        {
+            Vector                              m_position;
+            Vector                              m_colorIntensity;
+            float                               m_radius = 0.0f;
+        };
+
+        struct SpotLight
+        {
+            Vector                              m_position;
+            Vector                              m_direction;
+            Vector                              m_colorIntensity;
+            float                               m_radius = 0.0f;
+            Radians                             m_innerUmbraAngle = 0.0f;
+            Radians                             m_outerUmbraAngle = 0.0f;
+        };
+
+    public:
+
+        void Clear()
+        {
+            m_staticMeshes.clear();
+            m_skeletalMeshes.clear();
+            m_materials.clear();
+            m_skinningTransforms.clear();
+            m_pointLights.clear();
+            m_spotLights.clear();
+            m_hasDirectionalLight = false;
+            m_pSkyboxTexture = nullptr;
+            m_pSkyboxRadianceTexture = nullptr;
+            m_skyboxIntensity = 0.0f;
+            m_exposure = -1.0f;
+            m_visualizationMode = 0;
+        }
+
+        // Get the material for a given mesh instance section, returns null if no material is set
+        template<typename T>
+        inline Material const* GetMaterial( T const& instance, uint32_t sectionIdx ) const
+        {
+            return ( (int32_t) sectionIdx < instance.m_numMaterials ) ? m_materials[instance.m_firstMaterialIdx + sectionIdx] : nullptr;
+        }
+
+        inline Matrix const* GetSkinningTransforms( SkeletalMeshInstance const& instance ) const
+        {
+            return m_skinningTransforms.data() + instance.m_firstSkinningTransformIdx;
+        }
+
+    public:
+
+        TVector<StaticMeshInstance>             m_staticMeshes;
+        TVector<SkeletalMeshInstance>           m_skeletalMeshes;
+        TVector<Material const*>                m_materials;
+        TVector<Matrix>                         m_skinningTransforms;
+
+        DirectionalLight                        m_directionalLight;
+        TVector<PointLight>                     m_pointLights;
+        TVector<SpotLight>                      m_spotLights;
+        bool                                    m_hasDirectionalLight = false;
+
+        CubemapTexture const*                   m_pSkyboxTexture = nullptr;
+        CubemapTexture const*                   m_pSkyboxRadianceTexture = nullptr;
+        float                                   m_skyboxIntensity = 0.0f;
+        float                                   m_exposure = -1.0f;
+
+        uint32_t                                m_visualizationMode = 0;
+    };
+}
@@ -52,10 +52,6 @@ namespace EE::Render
 
     void DebugRenderer::Shutdown()
     {
-        m_drawCommands.Clear();
-
-        //-------------------------------------------------------------------------
-
         if ( m_pRenderDevice != nullptr )
         {
             m_textRS.Shutdown( m_pRenderDevice );
@@ -390,11 +386,27 @@ namespace EE::Render
 
     //-------------------------------------------------------------------------
 
-    void DebugRenderer::RenderWorld( Seconds const deltaTime, Viewport const& viewport, RenderTarget const& renderTarget, EntityWorld* pWorld )
+    void DebugRenderer::OnWorldDestroyed( EntityWorld const* pWorld )
+    {
+        // Nothing to do, the frame command buffers are owned by the world's drawing system
+        EE_ASSERT( Threading::IsMainThread() );
+    }
+
+    void DebugRenderer::PrepareWorld( Seconds const deltaTime, Viewport const& viewport, EntityWorld* pWorld )
     {
         EE_ASSERT( IsInitialized() && Threading::IsMainThread() );
         EE_PROFILE_FUNCTION_RENDER();
 
+        auto pDebugDrawingSystem = pWorld->GetDebugDrawingSystem();
+        EE_ASSERT( pDebugDrawingSystem != nullptr );
+        pDebugDrawingSystem->FlipFrameCommandBuffers( deltaTime );
+    }
+
+    void DebugRenderer::RenderWorld( Seconds const deltaTime, Viewport const& viewport, RenderTarget const& renderTarget, EntityWorld* pWorld )
+    {
+        EE_ASSERT( IsInitialized() );
+        EE_PROFILE_FUNCTION_RENDER();
+
         if ( !viewport.IsValid() )
         {
             return;
@@ -402,7 +414,13 @@ namespace EE::Render
 
         auto pDebugDrawingSystem = pWorld->GetDebugDrawingSystem();
         EE_ASSERT( pDebugDrawingSystem != nullptr );
-        pDebugDrawingSystem->ReflectFrameCommandBuffer( deltaTime, m_drawCommands );
+
+        TInlineVector<Drawing::ThreadCommandBuffer const*, 32> threadBuffers;
+        pDebugDrawingSystem->GetFrameCommandBuffers( threadBuffers );
+        if ( threadBuffers.empty() )
+        {
+            return;
+        }
 
         //-------------------------------------------------------------------------
 
@@ -419,18 +437,18 @@ namespace EE::Render
             m_pointRS.SetState( renderContext, viewport );
 
             renderContext.SetDepthTestMode( DepthTestMode::On );
-            DebugRenderer::DrawPoints( renderContext, viewport, m_drawCommands.m_opaqueDepthOn.m_pointCommands );
+            for ( auto pBuffer : threadBuffers ) { DebugRenderer::DrawPoints( renderContext, viewport, pBuffer->GetOpaqueDepthTestEnabledBuffer().m_pointCommands ); }
 
             renderContext.SetDepthTestMode( DepthTestMode::Off );
-            DebugRenderer::DrawPoints( renderContext, viewport, m_drawCommands.m_opaqueDepthOff.m_pointCommands );
+            for ( auto pBuffer : threadBuffers ) { DebugRenderer::DrawPoints( renderContext, viewport, pBuffer->GetOpaqueDepthTestDisabledBuffer().m_pointCommands ); }
 
             //-------------------------------------------------------------------------
 
             renderContext.SetDepthTestMode( DepthTestMode::On );
-            DebugRenderer::DrawPoints( renderContext, viewport, m_drawCommands.m_transparentDepthOn.m_pointCommands );
+            for ( auto pBuffer : threadBuffers ) { DebugRenderer::DrawPoints( renderContext, viewport, pBuffer->GetTransparentDepthTestEnabledBuffer().m_pointCommands ); }
 
             renderContext.SetDepthTestMode( DepthTestMode::Off );
-            DebugRenderer::DrawPoints( renderContext, viewport, m_drawCommands.m_transparentDepthOff.m_pointCommands );
+            for ( auto pBuffer : threadBuffers ) { DebugRenderer::DrawPoints( renderContext, viewport, pBuffer->GetTransparentDepthTestDisabledBuffer().m_pointCommands ); }
         }
 
         //-------------------------------------------------------------------------
@@ -442,18 +460,18 @@ namespace EE::Render
             m_lineRS.SetState( renderContext, viewport );
 
             renderContext.SetDepthTestMode( DepthTestMode::On );
-            DebugRenderer::DrawLines( renderContext, viewport, m_drawCommands.m_opaqueDepthOn.m_lineCommands );
+            for ( auto pBuffer : threadBuffers ) { DebugRenderer::DrawLines( renderContext, viewport, pBuffer->GetOpaqueDepthTestEnabledBuffer().m_lineCommands ); }
 
             renderContext.SetDepthTestMode( DepthTestMode::Off );
-            DebugRenderer::DrawLines( renderContext, viewport, m_drawCommands.m_opaqueDepthOff.m_lineCommands );
+            for ( auto pBuffer : threadBuffers ) { DebugRenderer::DrawLines( renderContext, viewport, pBuffer->GetOpaqueDepthTestDisabledBuffer().m_lineCommands ); }
 
             //-------------------------------------------------------------------------
 
             renderContext.SetDepthTestMode( DepthTestMode::On );
-            DebugRenderer::DrawLines( renderContext, viewport, m_drawCommands.m_transparentDepthOn.m_lineCommands );
+            for ( auto pBuffer : threadBuffers ) { DebugRenderer::DrawLines( renderContext, viewport, pBuffer->GetTransparentDepthTestEnabledBuffer().m_lineCommands ); }
 
             renderContext.SetDepthTestMode( DepthTestMode::Off );
-            DebugRenderer::DrawLines( renderContext, viewport, m_drawCommands.m_transparentDepthOff.m_lineCommands );
+            for ( auto pBuffer : threadBuffers ) { DebugRenderer::DrawLines( renderContext, viewport, pBuffer->GetTransparentDepthTestDisabledBuffer().m_lineCommands ); }
         }
 
         //-------------------------------------------------------------------------
@@ -465,18 +483,18 @@ namespace EE::Render
             m_primitiveRS.SetState( renderContext, viewport );
 
             renderContext.SetDepthTestMode( DepthTestMode::On );
-            DebugRenderer::DrawTriangles( renderContext, viewport, m_drawCommands.m_opaqueDepthOn.m_triangleCommands );
+            for ( auto pBuffer : threadBuffers ) { DebugRenderer::DrawTriangles( renderContext, viewport, pBuffer->GetOpaqueDepthTestEnabledBuffer().m_triangleCommands ); }
 
             renderContext.SetDepthTestMode( DepthTestMode::Off );
-            DebugRenderer::DrawTriangles( renderContext, viewport, m_drawCommands.m_opaqueDepthOff.m_triangleCommands );
+            for ( auto pBuffer : threadBuffers ) { DebugRenderer::DrawTriangles( renderContext, viewport, pBuffer->GetOpaqueDepthTestDisabledBuffer().m_triangleCommands ); }
 
             //-------------------------------------------------------------------------
 
             renderContext.SetDepthTestMode( DepthTestMode::On );
-            DebugRenderer::DrawTriangles( renderContext, viewport, m_drawCommands.m_transparentDepthOn.m_triangleCommands );
+            for ( auto pBuffer : threadBuffers ) { DebugRenderer::DrawTriangles( renderContext, viewport, pBuffer->GetTransparentDepthTestEnabledBuffer().m_triangleCommands ); }
 
             renderContext.SetDepthTestMode( DepthTestMode::Off );
-            DebugRenderer::DrawTriangles( renderContext, viewport, m_drawCommands.m_transparentDepthOff.m_triangleCommands );
+            for ( auto pBuffer : threadBuffers ) { DebugRenderer::DrawTriangles( renderContext, viewport, pBuffer->GetTransparentDepthTestDisabledBuffer().m_triangleCommands ); }
         }
 
         //-------------------------------------------------------------------------
@@ -490,12 +508,18 @@ namespace EE::Render
             auto textRenderfunc = [this] ( RenderContext const& renderContext, Viewport const& viewport, TVector<TextCommand> const& commands, IntRange cmdRange ) { DebugRenderer::DrawText( renderContext, viewport, commands, cmdRange ); };
 
             renderContext.SetDepthTestMode( DepthTestMode::On );
-            DrawTextCommands( m_drawCommands.m_opaqueDepthOn.m_textCommands, renderContext, viewport, textRenderfunc );
-            DrawTextCommands( m_drawCommands.m_transparentDepthOn.m_textCommands, renderContext, viewport, textRenderfunc );
+            for ( auto pBuffer : threadBuffers )
+            {
+                DrawTextCommands( pBuffer->GetOpaqueDepthTestEnabledBuffer().m_textCommands, renderContext, viewport, textRenderfunc );
+                DrawTextCommands( pBuffer->GetTransparentDepthTestEnabledBuffer().m_textCommands, renderContext, viewport, textRenderfunc );
+            }
 
             renderContext.SetDepthTestMode( DepthTestMode::Off );
-            DrawTextCommands( m_drawCommands.m_opaqueDepthOff.m_textCommands, renderContext, viewport, textRenderfunc );
-            DrawTextCommands( m_drawCommands.m_transparentDepthOff.m_textCommands, renderContext, viewport, textRenderfunc );
+            for ( auto pBuffer : threadBuffers )
+            {
+                DrawTextCommands( pBuffer->GetOpaqueDepthTestDisabledBuffer().m_textCommands, renderContext, viewport, textRenderfunc );
+                DrawTextCommands( pBuffer->GetTransparentDepthTestDisabledBuffer().m_textCommands, renderContext, viewport, textRenderfunc );
+            }
         }
     }
 }
@@ -21,7 +21,10 @@ namespace EE::Render
         bool IsInitialized() const { return m_initialized; }
         bool Initialize( RenderDevice* pRenderDevice );
         void Shutdown();
+        void PrepareWorld( Seconds const deltaTime, Viewport const& viewport, EntityWorld* pWorld ) override final;
         void RenderWorld( Seconds const deltaTime, Viewport const& viewport, RenderTarget const& renderTarget, EntityWorld* pWorld ) override final;
+        bool SupportsPipelinedRendering() const override final { return true; }
+        void OnWorldDestroyed( EntityWorld const* pWorld ) override final;
 
     private:
 
@@ -39,7 +42,6 @@ namespace EE::Render
         DebugPrimitiveRenderState                   m_primitiveRS;
         DebugTextRenderState                        m_textRS;
 
-        Drawing::FrameCommandBuffer                 m_drawCommands;
         bool                                        m_initialized = false;
 
         // Text rendering
@@ -64,6 +64,21 @@ namespace EE::Render
 
     //-------------------------------------------------------------------------
 
+    void ImguiRenderer::PreparedDrawData::Clear()
+    {
+        for ( auto pDrawList : m_drawLists )
+        {
+            IM_DELETE( pDrawList );
+        }
+
+        m_drawLists.clear();
+        m_drawData.Clear();
+        m_pRenderWindow = nullptr;
+        m_clearRenderTarget = false;
+    }
+
+    //-------------------------------------------------------------------------
+
     bool ImguiRenderer::Initialize( RenderDevice* pRenderDevice )
     {
         EE_ASSERT( m_pRenderDevice == nullptr && pRenderDevice != nullptr );
@@ -201,6 +216,13 @@ namespace EE::Render
 
         //-------------------------------------------------------------------------
 
+        m_mainViewportDrawData.Clear();
+        for ( auto& preparedDrawData : m_secondaryViewportDrawData )
+        {
+            preparedDrawData.Clear();
+        }
+        m_secondaryViewportDrawData.clear();
+
         ImGui::DestroyPlatformWindows();
 
         //-------------------------------------------------------------------------
@@ -256,29 +278,48 @@ namespace EE::Render
         m_initialized = false;
     }
 
-    void ImguiRenderer::RenderViewport( Seconds const deltaTime, Viewport const& viewport, RenderTarget const& renderTarget )
+    void ImguiRenderer::CopyDrawData( ImDrawData const* pSourceDrawData, PreparedDrawData& outPreparedDrawData ) const
+    {
+        outPreparedDrawData.Clear();
+
+        if ( pSourceDrawData == nullptr || !pSourceDrawData->Valid )
+        {
+            return;
+        }
+
+        outPreparedDrawData.m_drawData = *pSourceDrawData;
+        outPreparedDrawData.m_drawData.OwnerViewport = nullptr;
+
+        outPreparedDrawData.m_drawLists.reserve( pSourceDrawData->CmdListsCount );
+        for ( int32_t n = 0; n < pSourceDrawData->CmdListsCount; n++ )
+        {
+            outPreparedDrawData.m_drawLists.emplace_back( pSourceDrawData->CmdLists[n]->CloneOutput() );
+        }
+
+        outPreparedDrawData.m_drawData.CmdLists = outPreparedDrawData.m_drawLists.data();
+    }
+
+    void ImguiRenderer::PrepareViewport( Seconds const deltaTime, Viewport const& viewport )
     {
         EE_ASSERT( IsInitialized() && Threading::IsMainThread() );
         EE_PROFILE_FUNCTION_RENDER();
 
         ImGuiIO& io = ImGui::GetIO();
 
-        // Render main imgui viewport
+        // Main imgui viewport
         //-------------------------------------------------------------------------
 
         ImGui::Render();
+        CopyDrawData( ImGui::GetDrawData(), m_mainViewportDrawData );
 
-        auto const& renderContext = m_pRenderDevice->GetImmediateContext();
-        renderContext.SetRenderTarget( renderTarget );
+        // Viewport Support
+        //-------------------------------------------------------------------------
 
-        ImDrawData const* pData = ImGui::GetDrawData();
-        if ( pData != nullptr )
+        for ( auto& preparedDrawData : m_secondaryViewportDrawData )
         {
-            RenderImguiData( renderContext, pData );
+            preparedDrawData.Clear();
         }
-
-        // Viewport Support
-        //-------------------------------------------------------------------------
+        m_secondaryViewportDrawData.clear();
 
         if ( io.ConfigFlags & ImGuiConfigFlags_ViewportsEnable )
         {
@@ -288,6 +329,18 @@ namespace EE::Render
 
             ImGuiPlatformIO& platformIO = ImGui::GetPlatformIO();
 
+            // Size the array up front, since the copied draw data points into the element's draw list array
+            int32_t numViewportsToDraw = 0;
+            for ( int i = 1; i < platformIO.Viewports.Size; i++ )
+            {
+                numViewportsToDraw += ( platformIO.Viewports[i]->Flags & ImGuiViewportFlags_IsMinimized ) ? 0 : 1;
+            }
+
+            m_secondaryViewportDrawData.resize( numViewportsToDraw );
+
+            //-------------------------------------------------------------------------
+
+            int32_t drawDataIdx = 0;
             for ( int i = 1; i < platformIO.Viewports.Size; i++ )
             {
                 ImGuiViewport* pViewport = platformIO.Viewports[i];
@@ -299,14 +352,39 @@ namespace EE::Render
                 auto pSecondarySwapChain = (RenderWindow*) pViewport->RendererUserData;
                 EE_ASSERT( pSecondarySwapChain != nullptr );
 
-                renderContext.SetRenderTarget( *pSecondarySwapChain->GetRenderTarget() );
-                if ( !( pViewport->Flags & ImGuiViewportFlags_NoRendererClear ) )
-                {
-                    renderContext.ClearRenderTargetViews( *pSecondarySwapChain->GetRenderTarget() );
-                }
-                RenderImguiData( renderContext, pViewport->DrawData );
-                renderContext.Present( *pSecondarySwapChain );
+                PreparedDrawData& preparedDrawData = m_secondaryViewportDrawData[drawDataIdx++];
+                CopyDrawData( pViewport->DrawData, preparedDrawData );
+                preparedDrawData.m_pRenderWindow = pSecondarySwapChain;
+                preparedDrawData.m_clearRenderTarget = !( pViewport->Flags & ImGuiViewportFlags_NoRendererClear );
+            }
+        }
+    }
+
+    void ImguiRenderer::RenderViewport( Seconds const deltaTime, Viewport const& viewport, RenderTarget const& renderTarget )
+    {
+        EE_ASSERT( IsInitialized() );
+        EE_PROFILE_FUNCTION_RENDER();
+
+        // Render main imgui viewport
+        //-------------------------------------------------------------------------
+
+        auto const& renderContext = m_pRenderDevice->GetImmediateContext();
+        renderContext.SetRenderTarget( renderTarget );
+        RenderImguiData( renderContext, &m_mainViewportDrawData.m_drawData );
+
+        // Viewport Support
+        //-------------------------------------------------------------------------
+
+        for ( PreparedDrawData const& preparedDrawData : m_secondaryViewportDrawData )
+        {
+            RenderWindow* pSecondarySwapChain = preparedDrawData.m_pRenderWindow;
+            renderContext.SetRenderTarget( *pSecondarySwapChain->GetRenderTarget() );
+            if ( preparedDrawData.m_clearRenderTarget )
+            {
+                renderContext.ClearRenderTargetViews( *pSecondarySwapChain->GetRenderTarget() );
             }
+            RenderImguiData( renderContext, &preparedDrawData.m_drawData );
+            renderContext.Present( *pSecondarySwapChain );
         }
     }
 
@@ -28,15 +28,31 @@ namespace EE::Render
             uint32_t                              m_numVertices;
         };
 
+        // A copy of the draw data for a single imgui viewport, imgui reuses its draw lists each frame so we need our own copy to render from
+        struct PreparedDrawData
+        {
+            void Clear();
+
+        public:
+
+            ImDrawData                          m_drawData;
+            TVector<ImDrawList*>                m_drawLists;
+            RenderWindow*                       m_pRenderWindow = nullptr;
+            bool                                m_clearRenderTarget = false;
+        };
+
     public:
 
         bool IsInitialized() const { return m_initialized; }
         bool Initialize( RenderDevice* pRenderDevice );
         void Shutdown();
+        void PrepareViewport( Seconds const deltaTime, Viewport const& viewport ) override final;
         void RenderViewport( Seconds const deltaTime, Viewport const& viewport, RenderTarget const& renderTarget ) override final;
+        bool SupportsPipelinedRendering() const override final { return true; }
 
     private:
 
+        void CopyDrawData( ImDrawData const* pSourceDrawData, PreparedDrawData& outPreparedDrawData ) const;
         void RenderImguiData( RenderContext const& renderContext, ImDrawData const* pDrawData );
 
     private:
@@ -54,6 +70,9 @@ namespace EE::Render
         VertexBuffer                    m_vertexBuffer;
         Texture                         m_fontTexture;
 
+        PreparedDrawData                m_mainViewportDrawData;
+        TVector<PreparedDrawData>       m_secondaryViewportDrawData;
+
         // TODO: we change the origin PipelineState to RasterPipelineState
         RasterPipelineState             m_PSO;
         bool                            m_initialized = false;
@@ -1,8 +1,7 @@
 #include "WorldRenderer.h"
-#include "Engine/Render/Components/Component_EnvironmentMaps.h"
-#include "Engine/Render/Components/Component_Lights.h"
-#include "Engine/Render/Components/Component_StaticMesh.h"
-#include "Engine/Render/Components/Component_SkeletalMesh.h"
+#include "Engine/Render/Mesh/StaticMesh.h"
+#include "Engine/Render/Mesh/SkeletalMesh.h"
+#include "Engine/Render/Material/RenderMaterial.h"
 #include "Engine/Render/Shaders/EngineShaders.h"
 #include "Engine/Render/Systems/WorldSystem_Renderer.h"
 #include "Engine/Entity/Entity.h"
@@ -16,56 +15,6 @@
 
 namespace EE::Render
 {
-    static Matrix ComputeShadowMatrix( Viewport const& viewport, Transform const& lightWorldTransform, float shadowDistance )
-    {
-        Transform lightTransform = lightWorldTransform;
-        lightTransform.SetTranslation( Vector::Zero );
-        Transform const invLightTransform = lightTransform.GetInverse();
-
-        // Get a modified camera view volume that has the shadow distance as the z far.
-        // This will get us the appropriate corners to translate into light space.
-
-        // To make these cascade, you do this in a loop and move the depth range along by your
-        // cascade distance.
-        EE::Math::ViewVolume camVolume = viewport.GetViewVolume();
-        camVolume.SetDepthRange( FloatRange( 1.0f, shadowDistance ) );
-
-        Math::ViewVolume::VolumeCorners corners = camVolume.GetCorners();
-
-        // Translate into light space.
-        for ( int32_t i = 0; i < 8; i++ )
-        {
-            corners.m_points[i] = invLightTransform.TransformPoint( corners.m_points[i] );
-        }
-
-        // Note for understanding, cornersMin and cornersMax are in light space, not world space.
-        Vector cornersMin = Vector::One * FLT_MAX;
-        Vector cornersMax = Vector::One * -FLT_MAX;
-
-        for ( int32_t i = 0; i < 8; i++ )
-        {
-            cornersMin = Vector::Min( cornersMin, corners.m_points[i] );
-            cornersMax = Vector::Max( cornersMax, corners.m_points[i] );
-        }
-
-        Vector lightPosition = Vector::Lerp( cornersMin, cornersMax, 0.5f );
-        lightPosition = Vector::Select( lightPosition, cornersMax, Vector::Select0100 ); //force lightPosition to the "back" of the box.
-        lightPosition = lightTransform.TransformPoint( lightPosition );   //Light position now in world space.
-        lightTransform.SetTranslation( lightPosition );   //Assign to the lightTransform, now it's positioned above our view frustum.
-
-        Float3 const delta = ( cornersMax - cornersMin ).ToFloat3();
-        float dim = Math::Max( delta.m_x, delta.m_z );
-        Math::ViewVolume lightViewVolume( Float2( dim ), FloatRange( 1.0, delta.m_y ), lightTransform.ToMatrix() );
-
-        Matrix viewProjMatrix = lightViewVolume.GetViewProjectionMatrix();
-        Matrix viewMatrix = lightViewVolume.GetViewMatrix();
-        Matrix projMatrix = lightViewVolume.GetProjectionMatrix();
-        Matrix viewProj = lightViewVolume.GetViewProjectionMatrix(); // TODO: inverse z???
-        return viewProj;
-    }
-
-    //-------------------------------------------------------------------------
-
     bool WorldRenderer::Initialize( RenderDevice* pRenderDevice )
     {
         EE_ASSERT( m_pRenderDevice == nullptr && pRenderDevice != nullptr );
@@ -538,29 +487,30 @@ namespace EE::Render
 
         //-------------------------------------------------------------------------
 
-        for ( StaticMeshComponent const* pMeshComponent : data.m_staticMeshComponents )
+        for ( RenderFramePacket::StaticMeshInstance const& meshInstance : data.m_framePacket.m_staticMeshes )
         {
-            auto pMesh = pMeshComponent->GetMesh();
-            Vector const finalScale = pMeshComponent->GetLocalScale() * pMeshComponent->GetWorldTransform().GetScale();
-            Matrix const worldTransform = Matrix( pMeshComponent->GetWorldTransform().GetRotation(), pMeshComponent->GetWorldTransform().GetTranslation(), finalScale );
+            if ( !meshInstance.m_isVisible )
+            {
+                continue;
+            }
+
+            auto pMesh = meshInstance.m_pMesh;
 
             ObjectTransforms transforms = data.m_transforms;
-            transforms.m_worldTransform = worldTransform;
-            transforms.m_worldTransform.SetTranslation( worldTransform.GetTranslation() );
+            transforms.m_worldTransform = meshInstance.m_worldTransform;
             transforms.m_normalTransform = transforms.m_worldTransform.GetInverse().Transpose();
             renderContext.WriteToBuffer( m_vertexShaderStatic.GetConstBuffer( 0 ), &transforms, sizeof( transforms ) );
 
             if ( renderTarget.HasPickingRT() )
             {
-                PickingData const pd( pMeshComponent->GetEntityID().m_value, pMeshComponent->GetID().m_value );
+                PickingData const pd( meshInstance.m_entityID, meshInstance.m_componentID );
                 renderContext.WriteToBuffer( m_pixelShaderPicking.GetConstBuffer( 2 ), &pd, sizeof( PickingData ) );
             }
 
             renderContext.SetVertexBuffer( pMesh->GetVertexBuffer() );
             renderContext.SetIndexBuffer( pMesh->GetIndexBuffer() );
 
-            TVector<Material const*> const& materials = pMeshComponent->GetMaterials();
-            uint64_t const visibility = pMeshComponent->GetSectionVisibilityMask();
+            uint64_t const visibility = meshInstance.m_sectionVisibilityMask;
 
             auto const numSubMeshes = pMesh->GetNumSections();
             for ( auto i = 0u; i < numSubMeshes; i++ )
@@ -572,9 +522,9 @@ namespace EE::Render
                 }
 
                 // Set material
-                if ( i < materials.size() && materials[i] )
+                if ( Material const* pMaterial = data.m_framePacket.GetMaterial( meshInstance, i ) )
                 {
-                    SetMaterial( renderContext, *pPipelineState->m_pPixelShader, materials[i] );
+                    SetMaterial( renderContext, *pPipelineState->m_pPixelShader, pMaterial );
                 }
                 else // Use default material
                 {
@@ -608,11 +558,16 @@ namespace EE::Render
 
         SkeletalMesh const* pCurrentMesh = nullptr;
 
-        for ( SkeletalMeshComponent const* pMeshComponent : data.m_skeletalMeshComponents )
+        for ( RenderFramePacket::SkeletalMeshInstance const& meshInstance : data.m_framePacket.m_skeletalMeshes )
         {
-            if ( pMeshComponent->GetMesh() != pCurrentMesh )
+            if ( !meshInstance.m_isVisible )
             {
-                pCurrentMesh = pMeshComponent->GetMesh();
+                continue;
+            }
+
+            if ( meshInstance.m_pMesh != pCurrentMesh )
+            {
+                pCurrentMesh = meshInstance.m_pMesh;
                 EE_ASSERT( pCurrentMesh != nullptr && pCurrentMesh->IsValid() );
 
                 renderContext.SetVertexBuffer( pCurrentMesh->GetVertexBuffer() );
@@ -622,29 +577,25 @@ namespace EE::Render
             // Update Bones and Transforms
             //-------------------------------------------------------------------------
 
-            Matrix worldTransform = pMeshComponent->GetWorldTransform().ToMatrix();
             ObjectTransforms transforms = data.m_transforms;
-            transforms.m_worldTransform = worldTransform;
-            transforms.m_worldTransform.SetTranslation( worldTransform.GetTranslation() );
+            transforms.m_worldTransform = meshInstance.m_worldTransform;
             transforms.m_normalTransform = transforms.m_worldTransform.GetInverse().Transpose();
             renderContext.WriteToBuffer( m_vertexShaderSkeletal.GetConstBuffer( 0 ), &transforms, sizeof( transforms ) );
 
             auto const& bonesConstBuffer = m_vertexShaderSkeletal.GetConstBuffer( 1 );
-            auto const& boneTransforms = pMeshComponent->GetSkinningTransforms();
-            EE_ASSERT( boneTransforms.size() == pCurrentMesh->GetNumBones() );
-            renderContext.WriteToBuffer( bonesConstBuffer, boneTransforms.data(), sizeof( Matrix ) * pCurrentMesh->GetNumBones() );
+            EE_ASSERT( meshInstance.m_numSkinningTransforms == pCurrentMesh->GetNumBones() );
+            renderContext.WriteToBuffer( bonesConstBuffer, data.m_framePacket.GetSkinningTransforms( meshInstance ), sizeof( Matrix ) * pCurrentMesh->GetNumBones() );
 
             if ( renderTarget.HasPickingRT() )
             {
-                PickingData const pd( pMeshComponent->GetEntityID().m_value, pMeshComponent->GetID().m_value );
+                PickingData const pd( meshInstance.m_entityID, meshInstance.m_componentID );
                 renderContext.WriteToBuffer( m_pixelShaderPicking.GetConstBuffer( 2 ), &pd, sizeof( PickingData ) );
             }
 
             // Draw sub-meshes
             //-------------------------------------------------------------------------
 
-            TVector<Material const*> const& materials = pMeshComponent->GetMaterials();
-            uint64_t const visibility = pMeshComponent->GetSectionVisibilityMask();
+            uint64_t const visibility = meshInstance.m_sectionVisibilityMask;
 
             auto const numSubMeshes = pCurrentMesh->GetNumSections();
             for ( auto i = 0u; i < numSubMeshes; i++ )
@@ -656,9 +607,9 @@ namespace EE::Render
                 }
 
                 // Set material
-                if ( i < materials.size() && materials[i] )
+                if ( Material const* pMaterial = data.m_framePacket.GetMaterial( meshInstance, i ) )
                 {
-                    SetMaterial( renderContext, *pPipelineState->m_pPixelShader, materials[i] );
+                    SetMaterial( renderContext, *pPipelineState->m_pPixelShader, pMaterial );
                 }
                 else // Use default material
                 {
@@ -693,13 +644,13 @@ namespace EE::Render
         }
     }
 
-    void WorldRenderer::RenderSunShadows( Viewport const& viewport, DirectionalLightComponent* pDirectionalLightComponent, RenderData const& data )
+    void WorldRenderer::RenderSunShadows( Viewport const& viewport, RenderData const& data )
     {
         EE_PROFILE_FUNCTION_RENDER();
 
         auto const& renderContext = m_pRenderDevice->GetImmediateContext();
 
-        if ( !pDirectionalLightComponent || !pDirectionalLightComponent->GetShadowed() ) return;
+        if ( !data.m_framePacket.m_hasDirectionalLight || !data.m_framePacket.m_directionalLight.m_isShadowed ) return;
 
         // Set primary render state and clear the render buffer
         //-------------------------------------------------------------------------
@@ -719,11 +670,15 @@ namespace EE::Render
         renderContext.SetShaderInputBinding( m_inputBindingStatic );
         renderContext.SetPrimitiveTopology( Topology::TriangleList );
 
-        for ( StaticMeshComponent const* pMeshComponent : data.m_staticMeshComponents )
+        for ( RenderFramePacket::StaticMeshInstance const& meshInstance : data.m_framePacket.m_staticMeshes )
         {
-            auto pMesh = pMeshComponent->GetMesh();
-            Matrix worldTransform = pMeshComponent->GetWorldTransform().ToMatrix();
-            transforms.m_worldTransform = worldTransform;
+            if ( !meshInstance.m_castsShadow )
+            {
+                continue;
+            }
+
+            auto pMesh = meshInstance.m_pMesh;
+            transforms.m_worldTransform = meshInstance.m_worldTransform;
             renderContext.WriteToBuffer( m_vertexShaderStatic.GetConstBuffer( 0 ), &transforms, sizeof( transforms ) );
 
             renderContext.SetVertexBuffer( pMesh->GetVertexBuffer() );
@@ -744,22 +699,24 @@ namespace EE::Render
         renderContext.SetShaderInputBinding( m_inputBindingSkeletal );
         renderContext.SetPrimitiveTopology( Topology::TriangleList );
 
-        for ( SkeletalMeshComponent const* pMeshComponent : data.m_skeletalMeshComponents )
+        for ( RenderFramePacket::SkeletalMeshInstance const& meshInstance : data.m_framePacket.m_skeletalMeshes )
         {
-            auto pMesh = pMeshComponent->GetMesh();
+            if ( !meshInstance.m_castsShadow )
+            {
+                continue;
+            }
+
+            auto pMesh = meshInstance.m_pMesh;
 
             // Update Bones and Transforms
             //-------------------------------------------------------------------------
 
-            Matrix worldTransform = pMeshComponent->GetWorldTransform().ToMatrix();
-            transforms.m_worldTransform = worldTransform;
-            transforms.m_worldTransform.SetTranslation( worldTransform.GetTranslation() );
+            transforms.m_worldTransform = meshInstance.m_worldTransform;
             renderContext.WriteToBuffer( m_vertexShaderSkeletal.GetConstBuffer( 0 ), &transforms, sizeof( transforms ) );
 
             auto const& bonesConstBuffer = m_vertexShaderSkeletal.GetConstBuffer( 1 );
-            auto const& boneTransforms = pMeshComponent->GetSkinningTransforms();
-            EE_ASSERT( boneTransforms.size() == pMesh->GetNumBones() );
-            renderContext.WriteToBuffer( bonesConstBuffer, boneTransforms.data(), sizeof( Matrix ) * pMesh->GetNumBones() );
+            EE_ASSERT( meshInstance.m_numSkinningTransforms == pMesh->GetNumBones() );
+            renderContext.WriteToBuffer( bonesConstBuffer, data.m_framePacket.GetSkinningTransforms( meshInstance ), sizeof( Matrix ) * pMesh->GetNumBones() );
 
             renderContext.SetVertexBuffer( pMesh->GetVertexBuffer() );
             renderContext.SetIndexBuffer( pMesh->GetIndexBuffer() );
@@ -778,9 +735,18 @@ namespace EE::Render
 
     //-------------------------------------------------------------------------
 
-    void WorldRenderer::RenderWorld( Seconds const deltaTime, Viewport const& viewport, RenderTarget const& renderTarget, EntityWorld* pWorld )
+    void WorldRenderer::PrepareWorld( Seconds const deltaTime, Viewport const& viewport, EntityWorld* pWorld )
     {
         EE_ASSERT( IsInitialized() && Threading::IsMainThread() );
+
+        auto pWorldSystem = pWorld->GetWorldSystem<RendererWorldSystem>();
+        EE_ASSERT( pWorldSystem != nullptr );
+        pWorldSystem->PublishFramePacket();
+    }
+
+    void WorldRenderer::RenderWorld( Seconds const deltaTime, Viewport const& viewport, RenderTarget const& renderTarget, EntityWorld* pWorld )
+    {
+        EE_ASSERT( IsInitialized() );
         EE_PROFILE_FUNCTION_RENDER();
 
         if ( !viewport.IsValid() )
@@ -792,6 +758,7 @@ namespace EE::Render
 
         auto pWorldSystem = pWorld->GetWorldSystem<RendererWorldSystem>();
         EE_ASSERT( pWorldSystem != nullptr );
+        RenderFramePacket const& framePacket = pWorldSystem->GetRenderFramePacket();
 
         //-------------------------------------------------------------------------
 
@@ -801,8 +768,7 @@ namespace EE::Render
             LightData(),
             nullptr,
             nullptr,
-            pWorldSystem->m_visibleStaticMeshComponents,
-            pWorldSystem->m_visibleSkeletalMeshComponents,
+            framePacket,
         };
 
         renderData.m_transforms.m_viewprojTransform = viewport.GetViewVolume().GetViewProjectionMatrix();
@@ -811,59 +777,52 @@ namespace EE::Render
 
         uint32_t lightingFlags = 0;
 
-        DirectionalLightComponent* pDirectionalLightComponent = nullptr;
-        if ( !pWorldSystem->m_registeredDirectionLightComponents.empty() )
+        if ( framePacket.m_hasDirectionalLight )
         {
-            pDirectionalLightComponent = pWorldSystem->m_registeredDirectionLightComponents[0];
+            RenderFramePacket::DirectionalLight const& directionalLight = framePacket.m_directionalLight;
             lightingFlags |= LIGHTING_ENABLE_SUN;
-            lightingFlags |= pDirectionalLightComponent->GetShadowed() ? LIGHTING_ENABLE_SUN_SHADOW : 0;
-            renderData.m_lightData.m_SunDirIndirectIntensity = -pDirectionalLightComponent->GetLightDirection();
-            Float4 colorIntensity = pDirectionalLightComponent->GetLightColor();
-            renderData.m_lightData.m_SunColorRoughnessOneLevel = colorIntensity * pDirectionalLightComponent->GetLightIntensity();
-            // TODO: conditional
-            renderData.m_lightData.m_sunShadowMapMatrix = ComputeShadowMatrix( viewport, pDirectionalLightComponent->GetWorldTransform(), 50.0f/*TODO: configure*/ );
+            lightingFlags |= directionalLight.m_isShadowed ? LIGHTING_ENABLE_SUN_SHADOW : 0;
+            renderData.m_lightData.m_SunDirIndirectIntensity = -directionalLight.m_direction;
+            renderData.m_lightData.m_SunColorRoughnessOneLevel = directionalLight.m_colorIntensity;
+            renderData.m_lightData.m_sunShadowMapMatrix = directionalLight.m_shadowViewProjectionMatrix;
         }
 
         renderData.m_lightData.m_SunColorRoughnessOneLevel.SetW0();
-        if ( !pWorldSystem->m_registeredGlobalEnvironmentMaps.empty() )
+        if ( framePacket.m_pSkyboxRadianceTexture != nullptr )
         {
-            GlobalEnvironmentMapComponent* pGlobalEnvironmentMapComponent = pWorldSystem->m_registeredGlobalEnvironmentMaps[0];
-            if ( pGlobalEnvironmentMapComponent->HasSkyboxRadianceTexture() && pGlobalEnvironmentMapComponent->HasSkyboxTexture() )
-            {
-                lightingFlags |= LIGHTING_ENABLE_SKYLIGHT;
-                renderData.m_pSkyboxRadianceTexture = pGlobalEnvironmentMapComponent->GetSkyboxRadianceTexture();
-                renderData.m_pSkyboxTexture = pGlobalEnvironmentMapComponent->GetSkyboxTexture();
-                renderData.m_lightData.m_SunColorRoughnessOneLevel.SetW( Math::Max( Math::Floor( Math::Log2f( (float) renderData.m_pSkyboxRadianceTexture->GetDimensions().m_x ) ) - 1.0f, 0.0f ) );
-                renderData.m_lightData.m_SunDirIndirectIntensity.SetW( pGlobalEnvironmentMapComponent->GetSkyboxIntensity() );
-                renderData.m_lightData.m_manualExposure = pGlobalEnvironmentMapComponent->GetExposure();
-            }
+            lightingFlags |= LIGHTING_ENABLE_SKYLIGHT;
+            renderData.m_pSkyboxRadianceTexture = framePacket.m_pSkyboxRadianceTexture;
+            renderData.m_pSkyboxTexture = framePacket.m_pSkyboxTexture;
+            renderData.m_lightData.m_SunColorRoughnessOneLevel.SetW( Math::Max( Math::Floor( Math::Log2f( (float) renderData.m_pSkyboxRadianceTexture->GetDimensions().m_x ) ) - 1.0f, 0.0f ) );
+            renderData.m_lightData.m_SunDirIndirectIntensity.SetW( framePacket.m_skyboxIntensity );
+            renderData.m_lightData.m_manualExposure = framePacket.m_exposure;
         }
 
-        int32_t const numPointLights = Math::Min( pWorldSystem->m_registeredPointLightComponents.size(), (int32_t) s_maxPunctualLights );
+        int32_t const numPointLights = Math::Min( (int32_t) framePacket.m_pointLights.size(), (int32_t) s_maxPunctualLights );
         uint32_t lightIndex = 0;
         for ( int32_t i = 0; i < numPointLights; ++i )
         {
             EE_ASSERT( lightIndex < s_maxPunctualLights );
-            PointLightComponent* pPointLightComponent = pWorldSystem->m_registeredPointLightComponents[i];
-            renderData.m_lightData.m_punctualLights[lightIndex].m_positionInvRadiusSqr = pPointLightComponent->GetLightPosition();
-            renderData.m_lightData.m_punctualLights[lightIndex].m_positionInvRadiusSqr.SetW( Math::Sqr( 1.0f / pPointLightComponent->GetLightRadius() ) );
+            RenderFramePacket::PointLight const& pointLight = framePacket.m_pointLights[i];
+            renderData.m_lightData.m_punctualLights[lightIndex].m_positionInvRadiusSqr = pointLight.m_position;
+            renderData.m_lightData.m_punctualLights[lightIndex].m_positionInvRadiusSqr.SetW( Math::Sqr( 1.0f / pointLight.m_radius ) );
             renderData.m_lightData.m_punctualLights[lightIndex].m_dir = Vector::Zero;
-            renderData.m_lightData.m_punctualLights[lightIndex].m_color = Vector( pPointLightComponent->GetLightColor().ToFloat4() ) * pPointLightComponent->GetLightIntensity();
+            renderData.m_lightData.m_punctualLights[lightIndex].m_color = pointLight.m_colorIntensity;
             renderData.m_lightData.m_punctualLights[lightIndex].m_spotAngles = Vector( -1.0f, 1.0f, 0.0f );
             ++lightIndex;
         }
 
-        int32_t const numSpotLights = Math::Min( pWorldSystem->m_registeredSpotLightComponents.size(), (int32_t) s_maxPunctualLights - numPointLights );
+        int32_t const numSpotLights = Math::Min( (int32_t) framePacket.m_spotLights.size(), (int32_t) s_maxPunctualLights - numPointLights );
         for ( int32_t i = 0; i < numSpotLights; ++i )
         {
             EE_ASSERT( lightIndex < s_maxPunctualLights );
-            SpotLightComponent* pSpotLightComponent = pWorldSystem->m_registeredSpotLightComponents[i];
-            renderData.m_lightData.m_punctualLights[lightIndex].m_positionInvRadiusSqr = pSpotLightComponent->GetLightPosition();
-            renderData.m_lightData.m_punctualLights[lightIndex].m_positionInvRadiusSqr.SetW( Math::Sqr( 1.0f / pSpotLightComponent->GetLightRadius() ) );
-            renderData.m_lightData.m_punctualLights[lightIndex].m_dir = -pSpotLightComponent->GetLightDirection();
-            renderData.m_lightData.m_punctualLights[lightIndex].m_color = Vector( pSpotLightComponent->GetLightColor().ToFloat4() ) * pSpotLightComponent->GetLightIntensity();
-            Radians innerAngle = pSpotLightComponent->GetLightInnerUmbraAngle().ToRadians();
-            Radians outerAngle = pSpotLightComponent->GetLightOuterUmbraAngle().ToRadians();
+            RenderFramePacket::SpotLight const& spotLight = framePacket.m_spotLights[i];
+            renderData.m_lightData.m_punctualLights[lightIndex].m_positionInvRadiusSqr = spotLight.m_position;
+            renderData.m_lightData.m_punctualLights[lightIndex].m_positionInvRadiusSqr.SetW( Math::Sqr( 1.0f / spotLight.m_radius ) );
+            renderData.m_lightData.m_punctualLights[lightIndex].m_dir = -spotLight.m_direction;
+            renderData.m_lightData.m_punctualLights[lightIndex].m_color = spotLight.m_colorIntensity;
+            Radians innerAngle = spotLight.m_innerUmbraAngle;
+            Radians outerAngle = spotLight.m_outerUmbraAngle;
             innerAngle.Clamp( 0, Math::PiDivTwo );
             outerAngle.Clamp( 0, Math::PiDivTwo );
 
@@ -880,14 +839,14 @@ namespace EE::Render
         renderData.m_lightData.m_lightingFlags = lightingFlags;
 
         #if EE_DEVELOPMENT_TOOLS
-        renderData.m_lightData.m_lightingFlags = renderData.m_lightData.m_lightingFlags | ( (int32_t) pWorldSystem->GetVisualizationMode() << (int32_t) RendererWorldSystem::VisualizationMode::BitShift );
+        renderData.m_lightData.m_lightingFlags = renderData.m_lightData.m_lightingFlags | ( framePacket.m_visualizationMode << (int32_t) RendererWorldSystem::VisualizationMode::BitShift );
         #endif
 
         //-------------------------------------------------------------------------
 
         auto const& immediateContext = m_pRenderDevice->GetImmediateContext();
 
-        RenderSunShadows( viewport, pDirectionalLightComponent, renderData );
+        RenderSunShadows( viewport, renderData );
         {
             immediateContext.SetRenderTarget( renderTarget );
             RenderStaticMeshes( viewport, renderTarget, renderData );
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "Engine/Render/IRenderer.h"
+#include "Engine/Render/RenderFramePacket.h"
 #include "Base/Render/RenderDevice.h"
 #include "Base/Math/Matrix.h"
 
@@ -8,11 +9,6 @@
 
 namespace EE::Render
 {
-    class DirectionalLightComponent;
-    class GlobalEnvironmentMapComponent;
-    class PointLightComponent;
-    class StaticMeshComponent;
-    class SkeletalMeshComponent;
     class SkeletalMesh;
     class StaticMesh;
     class Viewport;
@@ -97,8 +93,7 @@ namespace EE::Render
             LightData                                   m_lightData;
             CubemapTexture const*                       m_pSkyboxRadianceTexture;
             CubemapTexture const*                       m_pSkyboxTexture;
-            TVector<StaticMeshComponent const*>&        m_staticMeshComponents;
-            TVector<SkeletalMeshComponent const*>&      m_skeletalMeshComponents;
+            RenderFramePacket const&                    m_framePacket;
         };
 
     public:
@@ -114,11 +109,13 @@ namespace EE::Render
         bool Initialize( RenderDevice* pRenderDevice );
         void Shutdown();
 
+        virtual void PrepareWorld( Seconds const deltaTime, Viewport const& viewport, EntityWorld* pWorld ) override final;
         virtual void RenderWorld( Seconds const deltaTime, Viewport const& viewport, RenderTarget const& renderTarget, EntityWorld* pWorld ) override final;
+        virtual bool SupportsPipelinedRendering() const override final { return true; }
 
     private:
 
-        void RenderSunShadows( Viewport const& viewport, DirectionalLightComponent* pDirectionalLightComponent, RenderData const& data );
+        void RenderSunShadows( Viewport const& viewport, RenderData const& data );
         void RenderStaticMeshes( Viewport const& viewport, RenderTarget const& renderTarget, RenderData const& data );
         void RenderSkeletalMeshes( Viewport const& viewport, RenderTarget const& renderTarget, RenderData const& data );
         void RenderSkybox( Viewport const& viewport, RenderData const& data );
@@ -7,6 +7,7 @@
 #include "Engine/Render/Components/Component_Lights.h"
 #include "Engine/Render/Components/Component_EnvironmentMaps.h"
 #include "Engine/Render/Shaders/EngineShaders.h"
+#include "Engine/Render/Culling/SunShadowVolume.h"
 #include "Base/Render/RenderCoreResources.h"
 #include "Base/Render/RenderViewport.h"
 #include "Base/Drawing/DebugDrawing.h"
@@ -237,6 +238,15 @@ namespace EE::Render
 
     //-------------------------------------------------------------------------
 
+    WorldSystemAccess RendererWorldSystem::GetUpdateAccess() const
+    {
+        WorldSystemAccess access;
+        access.Reads<StaticMeshComponent>().Reads<SkeletalMeshComponent>();
+        access.Reads<DirectionalLightComponent>().Reads<PointLightComponent>().Reads<SpotLightComponent>();
+        access.Reads<GlobalEnvironmentMapComponent>().Reads<LocalEnvironmentMapComponent>();
+        return access;
+    }
+
     void RendererWorldSystem::UpdateSystem( EntityWorldUpdateContext const& ctx )
     {
         EE_PROFILE_FUNCTION_RENDER();
@@ -292,49 +302,37 @@ namespace EE::Render
         // Culling
         //-------------------------------------------------------------------------
 
-        AABB const viewBounds = ctx.GetViewport()->GetViewVolume().GetAABB();
+        Math::ViewVolume const& viewVolume = ctx.GetViewport()->GetViewVolume();
 
-        m_visibleStaticMeshComponents.clear();
-        {
-            EE_PROFILE_SCOPE_RENDER( "Static Mesh AABB Cull" );
-            m_staticMobilityTree.FindOverlaps( viewBounds, m_visibleStaticMeshComponents );
+        m_cullingStats = CullingStats();
+        FrustumCull( viewVolume );
 
-            for ( int32_t i = int32_t( m_visibleStaticMeshComponents.size() ) - 1; i >= 0 ; i-- )
-            {
-                if ( !m_visibleStaticMeshComponents[i]->IsVisible() )
-                {
-                    m_visibleStaticMeshComponents.erase_unsorted( m_visibleStaticMeshComponents.begin() + i );
-                }
-            }
-        }
-
-        for ( auto pMeshComponent : m_dynamicStaticMeshComponents )
+        if ( m_isOcclusionCullingEnabled )
         {
-            EE_PROFILE_SCOPE_RENDER( "Static Mesh Dynamic Cull" );
-
-            if ( pMeshComponent->IsVisible() && viewBounds.Overlaps( pMeshComponent->GetWorldBounds() ) )
-            {
-                m_visibleStaticMeshComponents.emplace_back( pMeshComponent );
-            }
+            OcclusionCull( viewVolume );
         }
 
-        //-------------------------------------------------------------------------
+        m_cullingStats.m_numVisibleStaticMeshes = (int32_t) m_visibleStaticMeshComponents.size();
+        m_cullingStats.m_numVisibleSkeletalMeshes = (int32_t) m_visibleSkeletalMeshComponents.size();
 
-        m_visibleSkeletalMeshComponents.clear();
+        // The shadow map is rendered from the same volume so we only need to cull once
+        m_shadowCasterStaticMeshComponents.clear();
+        m_shadowCasterSkeletalMeshComponents.clear();
 
-        for ( auto const& meshGroup : m_skeletalMeshGroups )
+        DirectionalLightComponent const* pSunComponent = m_registeredDirectionLightComponents.empty() ? nullptr : m_registeredDirectionLightComponents[0];
+        if ( pSunComponent != nullptr && pSunComponent->GetShadowed() )
         {
-            EE_PROFILE_SCOPE_RENDER( "Skeletal Mesh Dynamic Cull" );
-
-            for ( auto pMeshComponent : meshGroup.m_components )
-            {
-                if ( pMeshComponent->IsVisible() && viewBounds.Overlaps( pMeshComponent->GetWorldBounds() ) )
-                {
-                    m_visibleSkeletalMeshComponents.emplace_back( pMeshComponent );
-                }
-            }
+            Math::ViewVolume const shadowVolume = SunShadows::CalculateShadowVolume( viewVolume, pSunComponent->GetWorldTransform() );
+            m_sunShadowViewProjectionMatrix = shadowVolume.GetViewProjectionMatrix();
+            ShadowCasterCull( shadowVolume );
         }
 
+        //-------------------------------------------------------------------------
+        // Frame Packet
+        //-------------------------------------------------------------------------
+
+        BuildFramePacket();
+
         //-------------------------------------------------------------------------
         // Debug
         //-------------------------------------------------------------------------
@@ -342,6 +340,14 @@ namespace EE::Render
         #if EE_DEVELOPMENT_TOOLS
         Drawing::DrawContext drawCtx = ctx.GetDrawingContext();
 
+        if ( m_showOccluders )
+        {
+            for ( auto const& pOccluder : m_occluders )
+            {
+                drawCtx.DrawWireBox( pOccluder->GetWorldBounds(), Colors::Orange );
+            }
+        }
+
         if ( m_showStaticMeshBounds )
         {
             for ( auto const& pMeshComponent : m_registeredStaticMeshComponents )
@@ -390,6 +396,386 @@ namespace EE::Render
 
     //-------------------------------------------------------------------------
 
+    void RendererWorldSystem::BuildFramePacket()
+    {
+        EE_PROFILE_FUNCTION_RENDER();
+
+        RenderFramePacket& packet = m_framePackets[1 - m_publishedFramePacketIdx];
+        packet.Clear();
+
+        // Meshes
+        //-------------------------------------------------------------------------
+
+        // Visible meshes are added first, any shadow casters that are already in the packet are just flagged
+
+        auto AddStaticMesh = [&packet] ( StaticMeshComponent const* pMeshComponent )
+        {
+            Transform const& worldTransform = pMeshComponent->GetWorldTransform();
+            Vector const finalScale = pMeshComponent->GetLocalScale() * worldTransform.GetScale();
+            TVector<Material const*> const& materials = pMeshComponent->GetMaterials();
+
+            auto& instance = packet.m_staticMeshes.emplace_back();
+            instance.m_pMesh = pMeshComponent->GetMesh();
+            instance.m_worldTransform = Matrix( worldTransform.GetRotation(), worldTransform.GetTranslation(), finalScale );
+            instance.m_sectionVisibilityMask = pMeshComponent->GetSectionVisibilityMask();
+            instance.m_entityID = pMeshComponent->GetEntityID().m_value;
+            instance.m_componentID = pMeshComponent->GetID().m_value;
+            instance.m_firstMaterialIdx = (int32_t) packet.m_materials.size();
+            instance.m_numMaterials = (int32_t) materials.size();
+            packet.m_materials.insert( packet.m_materials.end(), materials.begin(), materials.end() );
+            return &instance;
+        };
+
+        m_packetInstanceLookup.clear();
+        packet.m_staticMeshes.reserve( m_visibleStaticMeshComponents.size() + m_shadowCasterStaticMeshComponents.size() );
+
+        for ( StaticMeshComponent const* pMeshComponent : m_visibleStaticMeshComponents )
+        {
+            m_packetInstanceLookup.insert( eastl::make_pair( pMeshComponent, (int32_t) packet.m_staticMeshes.size() ) );
+            AddStaticMesh( pMeshComponent )->m_isVisible = true;
+        }
+
+        for ( StaticMeshComponent const* pMeshComponent : m_shadowCasterStaticMeshComponents )
+        {
+            auto foundIter = m_packetInstanceLookup.find( pMeshComponent );
+            if ( foundIter != m_packetInstanceLookup.end() )
+            {
+                packet.m_staticMeshes[foundIter->second].m_castsShadow = true;
+            }
+            else
+            {
+                AddStaticMesh( pMeshComponent )->m_castsShadow = true;
+                m_cullingStats.m_numShadowOnlyCasters++;
+            }
+        }
+
+        //-------------------------------------------------------------------------
+
+        auto AddSkeletalMesh = [&packet] ( SkeletalMeshComponent const* pMeshComponent )
+        {
+            TVector<Material const*> const& materials = pMeshComponent->GetMaterials();
+            TVector<Matrix> const& skinningTransforms = pMeshComponent->GetSkinningTransforms();
+
+            auto& instance = packet.m_skeletalMeshes.emplace_back();
+            instance.m_pMesh = pMeshComponent->GetMesh();
+            instance.m_worldTransform = pMeshComponent->GetWorldTransform().ToMatrix();
+            instance.m_sectionVisibilityMask = pMeshComponent->GetSectionVisibilityMask();
+            instance.m_entityID = pMeshComponent->GetEntityID().m_value;
+            instance.m_componentID = pMeshComponent->GetID().m_value;
+            instance.m_firstMaterialIdx = (int32_t) packet.m_materials.size();
+            instance.m_numMaterials = (int32_t) materials.size();
+            instance.m_firstSkinningTransformIdx = (int32_t) packet.m_skinningTransforms.size();
+            instance.m_numSkinningTransforms = (int32_t) skinningTransforms.size();
+            packet.m_materials.insert( packet.m_materials.end(), materials.begin(), materials.end() );
+            packet.m_skinningTransforms.insert( packet.m_skinningTransforms.end(), skinningTransforms.begin(), skinningTransforms.end() );
+            return &instance;
+        };
+
+        m_packetInstanceLookup.clear();
+        packet.m_skeletalMeshes.reserve( m_visibleSkeletalMeshComponents.size() + m_shadowCasterSkeletalMeshComponents.size() );
+
+        for ( SkeletalMeshComponent const* pMeshComponent : m_visibleSkeletalMeshComponents )
+        {
+            m_packetInstanceLookup.insert( eastl::make_pair( pMeshComponent, (int32_t) packet.m_skeletalMeshes.size() ) );
+            AddSkeletalMesh( pMeshComponent )->m_isVisible = true;
+        }
+
+        for ( SkeletalMeshComponent const* pMeshComponent : m_shadowCasterSkeletalMeshComponents )
+        {
+            auto foundIter = m_packetInstanceLookup.find( pMeshComponent );
+            if ( foundIter != m_packetInstanceLookup.end() )
+            {
+                packet.m_skeletalMeshes[foundIter->second].m_castsShadow = true;
+            }
+            else
+            {
+                AddSkeletalMesh( pMeshComponent )->m_castsShadow = true;
+                m_cullingStats.m_numShadowOnlyCasters++;
+            }
+        }
+
+        // Lights
+        //-------------------------------------------------------------------------
+
+        if ( !m_registeredDirectionLightComponents.empty() )
+        {
+            DirectionalLightComponent const* pLightComponent = m_registeredDirectionLightComponents[0];
+            packet.m_hasDirectionalLight = true;
+            packet.m_directionalLight.m_worldTransform = pLightComponent->GetWorldTransform();
+            packet.m_directionalLight.m_direction = pLightComponent->GetLightDirection();
+            packet.m_directionalLight.m_colorIntensity = Vector( pLightComponent->GetLightColor().ToFloat4() ) * pLightComponent->GetLightIntensity();
+            packet.m_directionalLight.m_isShadowed = pLightComponent->GetShadowed();
+            packet.m_directionalLight.m_shadowViewProjectionMatrix = m_sunShadowViewProjectionMatrix;
+        }
+
+        for ( PointLightComponent const* pLightComponent : m_registeredPointLightComponents )
+        {
+            auto& light = packet.m_pointLights.emplace_back();
+            light.m_position = pLightComponent->GetLightPosition();
+            light.m_colorIntensity = Vector( pLightComponent->GetLightColor().ToFloat4() ) * pLightComponent->GetLightIntensity();
+            light.m_radius = pLightComponent->GetLightRadius();
+        }
+
+        for ( SpotLightComponent const* pLightComponent : m_registeredSpotLightComponents )
+        {
+            auto& light = packet.m_spotLights.emplace_back();
+            light.m_position = pLightComponent->GetLightPosition();
+            light.m_direction = pLightComponent->GetLightDirection();
+            light.m_colorIntensity = Vector( pLightComponent->GetLightColor().ToFloat4() ) * pLightComponent->GetLightIntensity();
+            light.m_radius = pLightComponent->GetLightRadius();
+            light.m_innerUmbraAngle = pLightComponent->GetLightInnerUmbraAngle().ToRadians();
+            light.m_outerUmbraAngle = pLightComponent->GetLightOuterUmbraAngle().ToRadians();
+        }
+
+        if ( !m_registeredGlobalEnvironmentMaps.empty() )
+        {
+            GlobalEnvironmentMapComponent const* pEnvironmentMapComponent = m_registeredGlobalEnvironmentMaps[0];
+            if ( pEnvironmentMapComponent->HasSkyboxRadianceTexture() && pEnvironmentMapComponent->HasSkyboxTexture() )
+            {
+                packet.m_pSkyboxTexture = pEnvironmentMapComponent->GetSkyboxTexture();
+                packet.m_pSkyboxRadianceTexture = pEnvironmentMapComponent->GetSkyboxRadianceTexture();
+                packet.m_skyboxIntensity = pEnvironmentMapComponent->GetSkyboxIntensity();
+                packet.m_exposure = pEnvironmentMapComponent->GetExposure();
+            }
+        }
+
+        #if EE_DEVELOPMENT_TOOLS
+        packet.m_visualizationMode = (uint32_t) m_visualizationMode;
+        #endif
+
+        m_wasFramePacketBuilt = true;
+    }
+
+    void RendererWorldSystem::PublishFramePacket()
+    {
+        EE_ASSERT( Threading::IsMainThread() );
+
+        m_publishedFramePacketIdx = 1 - m_publishedFramePacketIdx;
+
+        // If the world wasnt updated since the last publish, dont render stale state
+        if ( !m_wasFramePacketBuilt )
+        {
+            m_framePackets[m_publishedFramePacketIdx].Clear();
+        }
+
+        m_wasFramePacketBuilt = false;
+    }
+
+    //-------------------------------------------------------------------------
+
+    void RendererWorldSystem::FrustumCull( Math::ViewVolume const& viewVolume )
+    {
+        EE_PROFILE_FUNCTION_RENDER();
+
+        // Static mobility meshes are culled hierarchically via the tree
+        //-------------------------------------------------------------------------
+
+        m_visibleStaticMeshComponents.clear();
+        {
+            EE_PROFILE_SCOPE_RENDER( "Static Mesh Tree Cull" );
+            m_staticMobilityTree.FindVisible( viewVolume, m_visibleStaticMeshComponents );
+
+            for ( int32_t i = int32_t( m_visibleStaticMeshComponents.size() ) - 1; i >= 0 ; i-- )
+            {
+                if ( !m_visibleStaticMeshComponents[i]->IsVisible() )
+                {
+                    m_visibleStaticMeshComponents.erase_unsorted( m_visibleStaticMeshComponents.begin() + i );
+                }
+            }
+        }
+
+        // Dynamic meshes are tested individually
+        //-------------------------------------------------------------------------
+
+        {
+            EE_PROFILE_SCOPE_RENDER( "Static Mesh Dynamic Cull" );
+
+            for ( auto pMeshComponent : m_dynamicStaticMeshComponents )
+            {
+                uint32_t planeMask = Math::ViewVolume::s_allPlanesMask;
+                if ( pMeshComponent->IsVisible() && viewVolume.Intersect( pMeshComponent->GetWorldBounds().GetAABB(), planeMask ) != Math::ViewVolume::IntersectionResult::FullyOutside )
+                {
+                    m_visibleStaticMeshComponents.emplace_back( pMeshComponent );
+                }
+            }
+        }
+
+        //-------------------------------------------------------------------------
+
+        m_visibleSkeletalMeshComponents.clear();
+        {
+            EE_PROFILE_SCOPE_RENDER( "Skeletal Mesh Dynamic Cull" );
+
+            for ( auto const& meshGroup : m_skeletalMeshGroups )
+            {
+                for ( auto pMeshComponent : meshGroup.m_components )
+                {
+                    uint32_t planeMask = Math::ViewVolume::s_allPlanesMask;
+                    if ( pMeshComponent->IsVisible() && viewVolume.Intersect( pMeshComponent->GetWorldBounds().GetAABB(), planeMask ) != Math::ViewVolume::IntersectionResult::FullyOutside )
+                    {
+                        m_visibleSkeletalMeshComponents.emplace_back( pMeshComponent );
+                    }
+                }
+
+                m_cullingStats.m_numSkeletalMeshes += (int32_t) meshGroup.m_components.size();
+            }
+        }
+
+        //-------------------------------------------------------------------------
+
+        m_cullingStats.m_numStaticMeshes = (int32_t) m_registeredStaticMeshComponents.size();
+        m_cullingStats.m_numFrustumCulled = ( m_cullingStats.m_numStaticMeshes + m_cullingStats.m_numSkeletalMeshes ) - (int32_t) ( m_visibleStaticMeshComponents.size() + m_visibleSkeletalMeshComponents.size() );
+    }
+
+    void RendererWorldSystem::OcclusionCull( Math::ViewVolume const& viewVolume )
+    {
+        EE_PROFILE_FUNCTION_RENDER();
+
+        // Only meshes that cover a large part of the view and are cheap to rasterize are used as occluders
+        constexpr static float const minOccluderScreenSize = 0.1f;
+        constexpr static int32_t const maxOccluderTriangles = 2048;
+        constexpr static int32_t const maxOccluders = 16;
+
+        // Select occluders
+        //-------------------------------------------------------------------------
+        // We use the ratio of bounding radius to view distance as a cheap approximation of screen coverage
+
+        TInlineVector<eastl::pair<float, StaticMeshComponent const*>, maxOccluders> occluders;
+
+        for ( auto pMeshComponent : m_visibleStaticMeshComponents )
+        {
+            StaticMesh const* pMesh = pMeshComponent->GetMesh();
+            if ( pMesh->GetNumIndices() / 3 > maxOccluderTriangles )
+            {
+                continue;
+            }
+
+            AABB const bounds = pMeshComponent->GetWorldBounds().GetAABB();
+            float const radius = bounds.GetExtents().Length3().ToFloat();
+            float const distance = Math::Max( bounds.GetCenter().GetDistance3( viewVolume.GetViewPosition() ), Math::Epsilon );
+            float const screenSize = radius / distance;
+            if ( screenSize < minOccluderScreenSize )
+            {
+                continue;
+            }
+
+            // Keep the largest occluders, sorted from largest to smallest
+            auto const SortPredicate = [] ( eastl::pair<float, StaticMeshComponent const*> const& occluder, float size ) { return occluder.first > size; };
+            auto insertIter = eastl::lower_bound( occluders.begin(), occluders.end(), screenSize, SortPredicate );
+            if ( occluders.size() < maxOccluders )
+            {
+                occluders.insert( insertIter, eastl::pair<float, StaticMeshComponent const*>( screenSize, pMeshComponent ) );
+            }
+            else if ( insertIter != occluders.end() )
+            {
+                occluders.pop_back();
+                occluders.insert( insertIter, eastl::pair<float, StaticMeshComponent const*>( screenSize, pMeshComponent ) );
+            }
+        }
+
+        m_occluders.clear();
+        if ( occluders.empty() )
+        {
+            return;
+        }
+
+        // Rasterize occluders
+        //-------------------------------------------------------------------------
+
+        {
+            EE_PROFILE_SCOPE_RENDER( "Rasterize Occluders" );
+
+            m_occlusionBuffer.Reset( viewVolume.GetViewProjectionMatrix() );
+
+            for ( auto const& occluder : occluders )
+            {
+                StaticMeshComponent const* pMeshComponent = occluder.second;
+                Transform const& worldTransform = pMeshComponent->GetWorldTransform();
+                Vector const finalScale = pMeshComponent->GetLocalScale() * worldTransform.GetScale();
+                Matrix const worldMatrix( worldTransform.GetRotation(), worldTransform.GetTranslation(), finalScale );
+
+                m_occlusionBuffer.RasterizeOccluder( pMeshComponent->GetMesh(), worldMatrix );
+                m_occluders.emplace_back( pMeshComponent );
+            }
+
+            m_cullingStats.m_numOccluders = (int32_t) m_occluders.size();
+            m_cullingStats.m_numOccluderTriangles = m_occlusionBuffer.GetNumRasterizedTriangles();
+        }
+
+        // Test visible meshes
+        //-------------------------------------------------------------------------
+
+        {
+            EE_PROFILE_SCOPE_RENDER( "Occlusion Test" );
+
+            size_t const numVisibleMeshes = m_visibleStaticMeshComponents.size() + m_visibleSkeletalMeshComponents.size();
+
+            for ( int32_t i = int32_t( m_visibleStaticMeshComponents.size() ) - 1; i >= 0; i-- )
+            {
+                if ( m_occlusionBuffer.IsOccluded( m_visibleStaticMeshComponents[i]->GetWorldBounds().GetAABB() ) )
+                {
+                    m_visibleStaticMeshComponents.erase_unsorted( m_visibleStaticMeshComponents.begin() + i );
+                }
+            }
+
+            for ( int32_t i = int32_t( m_visibleSkeletalMeshComponents.size() ) - 1; i >= 0; i-- )
+            {
+                if ( m_occlusionBuffer.IsOccluded( m_visibleSkeletalMeshComponents[i]->GetWorldBounds().GetAABB() ) )
+                {
+                    m_visibleSkeletalMeshComponents.erase_unsorted( m_visibleSkeletalMeshComponents.begin() + i );
+                }
+            }
+
+            m_cullingStats.m_numOcclusionCulled = int32_t( numVisibleMeshes - ( m_visibleStaticMeshComponents.size() + m_visibleSkeletalMeshComponents.size() ) );
+        }
+    }
+
+    void RendererWorldSystem::ShadowCasterCull( Math::ViewVolume const& shadowVolume )
+    {
+        EE_PROFILE_FUNCTION_RENDER();
+
+        // Static mobility meshes
+        //-------------------------------------------------------------------------
+
+        m_staticMobilityTree.FindVisible( shadowVolume, m_shadowCasterStaticMeshComponents );
+
+        for ( int32_t i = int32_t( m_shadowCasterStaticMeshComponents.size() ) - 1; i >= 0; i-- )
+        {
+            if ( !m_shadowCasterStaticMeshComponents[i]->IsVisible() )
+            {
+                m_shadowCasterStaticMeshComponents.erase_unsorted( m_shadowCasterStaticMeshComponents.begin() + i );
+            }
+        }
+
+        // Dynamic meshes
+        //-------------------------------------------------------------------------
+
+        for ( auto pMeshComponent : m_dynamicStaticMeshComponents )
+        {
+            uint32_t planeMask = Math::ViewVolume::s_allPlanesMask;
+            if ( pMeshComponent->IsVisible() && shadowVolume.Intersect( pMeshComponent->GetWorldBounds().GetAABB(), planeMask ) != Math::ViewVolume::IntersectionResult::FullyOutside )
+            {
+                m_shadowCasterStaticMeshComponents.emplace_back( pMeshComponent );
+            }
+        }
+
+        for ( auto const& meshGroup : m_skeletalMeshGroups )
+        {
+            for ( auto pMeshComponent : meshGroup.m_components )
+            {
+                uint32_t planeMask = Math::ViewVolume::s_allPlanesMask;
+                if ( pMeshComponent->IsVisible() && shadowVolume.Intersect( pMeshComponent->GetWorldBounds().GetAABB(), planeMask ) != Math::ViewVolume::IntersectionResult::FullyOutside )
+                {
+                    m_shadowCasterSkeletalMeshComponents.emplace_back( pMeshComponent );
+                }
+            }
+        }
+
+        m_cullingStats.m_numShadowCasters = (int32_t) ( m_shadowCasterStaticMeshComponents.size() + m_shadowCasterSkeletalMeshComponents.size() );
+    }
+
+    //-------------------------------------------------------------------------
+
     void RendererWorldSystem::OnStaticMeshMobilityUpdated( StaticMeshComponent* pComponent )
     {
         EE_ASSERT( pComponent != nullptr && pComponent->IsInitialized() );
@@ -4,11 +4,14 @@
 #include "Engine/Entity/EntityWorldSystem.h"
 #include "Engine/Render/Components/Component_StaticMesh.h"
 #include "Engine/Render/Mesh/SkeletalMesh.h"
+#include "Engine/Render/Culling/OcclusionBuffer.h"
+#include "Engine/Render/RenderFramePacket.h"
 #include "Base/Render/RenderDevice.h"
 #include "Base/Math/AABBTree.h"
 #include "Base/Types/Event.h"
 #include "Base/Systems.h"
 #include "Base/Types/IDVector.h"
+#include "Base/Types/HashMap.h"
 
 //-------------------------------------------------------------------------
 
@@ -46,6 +49,21 @@ namespace EE::Render
         };
         #endif
 
+        // Per-frame culling results
+        struct CullingStats
+        {
+            int32_t                                             m_numStaticMeshes = 0;
+            int32_t                                             m_numSkeletalMeshes = 0;
+            int32_t                                             m_numFrustumCulled = 0;
+            int32_t                                             m_numOcclusionCulled = 0;
+            int32_t                                             m_numVisibleStaticMeshes = 0;
+            int32_t                                             m_numVisibleSkeletalMeshes = 0;
+            int32_t                                             m_numOccluders = 0;
+            int32_t                                             m_numOccluderTriangles = 0;
+            int32_t                                             m_numShadowCasters = 0;
+            int32_t                                             m_numShadowOnlyCasters = 0;    // Shadow casters that are not visible from the camera
+        };
+
     private:
 
         // Track all instances of a given mesh together - to limit the number of vertex buffer changes
@@ -63,6 +81,20 @@ namespace EE::Render
 
     public:
 
+        // Culling
+        //-------------------------------------------------------------------------
+
+        inline CullingStats const& GetCullingStats() const { return m_cullingStats; }
+
+        inline bool IsOcclusionCullingEnabled() const { return m_isOcclusionCullingEnabled; }
+        inline void SetOcclusionCullingEnabled( bool isEnabled ) { m_isOcclusionCullingEnabled = isEnabled; }
+
+        // Rendering
+        //-------------------------------------------------------------------------
+
+        // Get the last published frame packet, this is the only world render state that is safe to access while the world is updating
+        inline RenderFramePacket const& GetRenderFramePacket() const { return m_framePackets[m_publishedFramePacketIdx]; }
+
         // Debug
         //-------------------------------------------------------------------------
 
@@ -79,6 +111,7 @@ namespace EE::Render
         virtual void InitializeSystem( SystemRegistry const& systemRegistry ) override final;
         virtual void ShutdownSystem() override final;
         virtual void UpdateSystem( EntityWorldUpdateContext const& ctx ) override final;
+        virtual WorldSystemAccess GetUpdateAccess() const override final;
         virtual void RegisterComponent( Entity const* pEntity, EntityComponent* pComponent ) override final;
         virtual void UnregisterComponent( Entity const* pEntity, EntityComponent* pComponent ) override final;
 
@@ -96,6 +129,24 @@ namespace EE::Render
         void RegisterSkeletalMeshComponent( Entity const* pEntity, SkeletalMeshComponent* pMeshComponent );
         void UnregisterSkeletalMeshComponent( Entity const* pEntity, SkeletalMeshComponent* pMeshComponent );
 
+        // Culling
+        //-------------------------------------------------------------------------
+
+        void FrustumCull( Math::ViewVolume const& viewVolume );
+        void OcclusionCull( Math::ViewVolume const& viewVolume );
+
+        // Find all the meshes inside the sun shadow volume, this is independent of the camera culling so off-screen and occluded meshes still cast shadows
+        void ShadowCasterCull( Math::ViewVolume const& shadowVolume );
+
+        // Frame Packets
+        //-------------------------------------------------------------------------
+
+        // Copy all the visible render state into the unpublished frame packet
+        void BuildFramePacket();
+
+        // Swap the frame packets so the last one built is used for rendering, needs to be called from the main thread once any previous rendering has completed
+        void PublishFramePacket();
+
     private:
 
         // Static meshes
@@ -115,6 +166,23 @@ namespace EE::Render
         TIDVector<uint32_t, SkeletalMeshGroup>                          m_skeletalMeshGroups;
         TVector<SkeletalMeshComponent const*>                           m_visibleSkeletalMeshComponents;
 
+        // Culling
+        OcclusionBuffer                                                 m_occlusionBuffer;
+        TVector<StaticMeshComponent const*>                             m_occluders;
+        CullingStats                                                    m_cullingStats;
+        bool                                                            m_isOcclusionCullingEnabled = true;
+
+        // Shadow casters
+        TVector<StaticMeshComponent const*>                             m_shadowCasterStaticMeshComponents;
+        TVector<SkeletalMeshComponent const*>                           m_shadowCasterSkeletalMeshComponents;
+        Matrix                                                          m_sunShadowViewProjectionMatrix;
+        THashMap<void const*, int32_t>                                  m_packetInstanceLookup;                 // Used to merge the visible and shadow caster lists when building the frame packet
+
+        // Frame packets
+        RenderFramePacket                                               m_framePackets[2];
+        int32_t                                                         m_publishedFramePacketIdx = 0;
+        bool                                                            m_wasFramePacketBuilt = false;
+
         // Lights
         TIDVector<ComponentID, DirectionalLightComponent*>              m_registeredDirectionLightComponents;
         TIDVector<ComponentID, PointLightComponent*>                    m_registeredPointLightComponents;
@@ -128,6 +196,7 @@ namespace EE::Render
         bool                                                            m_showSkeletalMeshBounds = false;
         bool                                                            m_showSkeletalMeshBones = false;
         bool                                                            m_showSkeletalMeshBindPoses = false;
+        bool                                                            m_showOccluders = false;
         #endif
     };
 }
\ No newline at end of file
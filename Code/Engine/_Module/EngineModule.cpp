@@ -386,10 +386,12 @@ namespace EE
         //m_renderGraph.AddNode( "Post Processing" );
         //m_renderGraph.AddNode( "Draw Debug" );
 
+        // The shadow map is used outside of the graph, any node not contributing to it will be culled
+        m_renderGraph.ExportResource( handle2 );
+
         m_renderGraph.LogGraphNodes();
 
         m_renderGraph.Compile( m_pRenderDevice->GetRHIDevice() );
-        m_renderGraph.Execute();
 
         if ( Trait::IsPointerIncludeSmartPointer<TSharedPtr<int>>::value )
         {
@@ -26,6 +26,34 @@ namespace EE::Animation
 
     //-------------------------------------------------------------------------
 
+    struct QuantizationRange
+    {
+        QuantizationRange() = default;
+
+        QuantizationRange( float start, float length )
+            : m_rangeStart( start )
+            , m_rangeLength( length )
+        {}
+
+    public:
+
+        float                                           m_rangeStart = 0;
+        float                                           m_rangeLength = -1;
+    };
+
+    struct TrackCompressionSettings
+    {
+        QuantizationRange                               m_translationRangeX;
+        QuantizationRange                               m_translationRangeY;
+        QuantizationRange                               m_translationRangeZ;
+        QuantizationRange                               m_scaleRange;
+        bool                                            m_isRotationStatic = false;
+        bool                                            m_isTranslationStatic = false;
+        bool                                            m_isScaleStatic = false;
+    };
+
+    //-------------------------------------------------------------------------
+
     AnimationClipCompiler::AnimationClipCompiler()
         : Resource::Compiler( "AnimationCompiler", s_version )
     {
@@ -430,14 +458,13 @@ namespace EE::Animation
 
         static constexpr float const defaultQuantizationRangeLength = 0.1f;
 
+        TVector<TrackCompressionSettings> trackSettings;
+        trackSettings.resize( numBones );
+
         for ( uint32_t boneIdx = 0; boneIdx < numBones; boneIdx++ )
         {
-            TrackCompressionSettings trackSettings;
-
-            //-------------------------------------------------------------------------
-
-            trackSettings.m_isRotationStatic = rawTrackData[boneIdx].m_isRotationConstant;
-            trackSettings.m_constantRotation = trackSettings.m_isRotationStatic ? rawTrackData[boneIdx].m_localTransforms.front().GetRotation() : Quaternion::Identity;
+            TrackCompressionSettings& settings = trackSettings[boneIdx];
+            settings.m_isRotationStatic = rawTrackData[boneIdx].m_isRotationConstant;
 
             //-------------------------------------------------------------------------
 
@@ -450,97 +477,162 @@ namespace EE::Animation
             float const& rawTranslationValueRangeLengthZ = rawTranslationValueRangeZ.GetLength();
 
             // We could arguably compress more by saving each component individually at the cost of sampling performance. If we absolutely need more compression, we can do it here
-            bool const isTranslationConstant = Math::IsNearZero( rawTranslationValueRangeLengthX ) && Math::IsNearZero( rawTranslationValueRangeLengthY ) && Math::IsNearZero( rawTranslationValueRangeLengthZ );
-            if ( isTranslationConstant )
+            settings.m_isTranslationStatic = Math::IsNearZero( rawTranslationValueRangeLengthX ) && Math::IsNearZero( rawTranslationValueRangeLengthY ) && Math::IsNearZero( rawTranslationValueRangeLengthZ );
+            if ( !settings.m_isTranslationStatic )
             {
-                Transform const& rawBoneTransform = rawTrackData[boneIdx].m_localTransforms[0];
-                Vector const& translation = rawBoneTransform.GetTranslation();
+                settings.m_translationRangeX = { rawTranslationValueRangeX.m_begin, Math::IsNearZero( rawTranslationValueRangeLengthX ) ? defaultQuantizationRangeLength : rawTranslationValueRangeLengthX };
+                settings.m_translationRangeY = { rawTranslationValueRangeY.m_begin, Math::IsNearZero( rawTranslationValueRangeLengthY ) ? defaultQuantizationRangeLength : rawTranslationValueRangeLengthY };
+                settings.m_translationRangeZ = { rawTranslationValueRangeZ.m_begin, Math::IsNearZero( rawTranslationValueRangeLengthZ ) ? defaultQuantizationRangeLength : rawTranslationValueRangeLengthZ };
+            }
 
-                trackSettings.m_translationRangeX = { translation.GetX(), defaultQuantizationRangeLength };
-                trackSettings.m_translationRangeY = { translation.GetY(), defaultQuantizationRangeLength };
-                trackSettings.m_translationRangeZ = { translation.GetZ(), defaultQuantizationRangeLength };
-                trackSettings.m_isTranslationStatic = true;
+            //-------------------------------------------------------------------------
+
+            FloatRange const& rawScaleValueRange = rawTrackData[boneIdx].m_scaleValueRange;
+            float const rawScaleValueRangeLength = rawScaleValueRange.GetLength();
+
+            settings.m_isScaleStatic = Math::IsNearZero( rawScaleValueRangeLength );
+            if ( !settings.m_isScaleStatic )
+            {
+                settings.m_scaleRange = { rawScaleValueRange.m_begin, rawScaleValueRangeLength };
+            }
+        }
+
+        //-------------------------------------------------------------------------
+        // Create static pose and track layout
+        //-------------------------------------------------------------------------
+        // Static track values are stored once in the static pose, dynamic tracks are grouped by type (see AnimationClip for the layout)
+
+        animClip.m_staticPose.resize( numBones );
+
+        for ( uint32_t boneIdx = 0; boneIdx < numBones; boneIdx++ )
+        {
+            TrackCompressionSettings const& settings = trackSettings[boneIdx];
+            Transform const& rawBoneTransform = rawTrackData[boneIdx].m_localTransforms[frameIdxStart];
+
+            Transform staticTransform = Transform::Identity;
+
+            if ( settings.m_isRotationStatic )
+            {
+                staticTransform.SetRotation( rawBoneTransform.GetRotation() );
             }
             else
             {
-                trackSettings.m_translationRangeX = { rawTranslationValueRangeX.m_begin, Math::IsNearZero( rawTranslationValueRangeLengthX ) ? defaultQuantizationRangeLength : rawTranslationValueRangeLengthX };
-                trackSettings.m_translationRangeY = { rawTranslationValueRangeY.m_begin, Math::IsNearZero( rawTranslationValueRangeLengthY ) ? defaultQuantizationRangeLength : rawTranslationValueRangeLengthY };
-                trackSettings.m_translationRangeZ = { rawTranslationValueRangeZ.m_begin, Math::IsNearZero( rawTranslationValueRangeLengthZ ) ? defaultQuantizationRangeLength : rawTranslationValueRangeLengthZ };
+                animClip.m_dynamicRotationBoneIndices.emplace_back( (uint16_t) boneIdx );
             }
 
-            //-------------------------------------------------------------------------
-
-            FloatRange const& rawScaleValueRange = rawTrackData[boneIdx].m_scaleValueRange;
-            float const rawScaleValueRangeLengthX = rawScaleValueRange.GetLength();
+            if ( settings.m_isTranslationStatic )
+            {
+                staticTransform.SetTranslation( rawBoneTransform.GetTranslation() );
+            }
+            else
+            {
+                animClip.m_dynamicTranslationBoneIndices.emplace_back( (uint16_t) boneIdx );
+            }
 
-            // We could arguably compress more by saving each component individually at the cost of sampling performance. If we absolutely need more compression, we can do it here
-            bool const isScaleConstant = Math::IsNearZero( rawScaleValueRangeLengthX );
-            if ( isScaleConstant )
+            if ( settings.m_isScaleStatic )
             {
-                Transform const& rawBoneTransform = rawTrackData[boneIdx].m_localTransforms[0];
-                trackSettings.m_scaleRange = { rawBoneTransform.GetScale(), defaultQuantizationRangeLength };
-                trackSettings.m_isScaleStatic = true;
+                staticTransform.SetScale( rawBoneTransform.GetScale() );
             }
             else
             {
-                trackSettings.m_scaleRange = { rawScaleValueRange.m_begin, Math::IsNearZero( rawScaleValueRangeLengthX ) ? defaultQuantizationRangeLength : rawScaleValueRangeLengthX };
+                animClip.m_dynamicScaleBoneIndices.emplace_back( (uint16_t) boneIdx );
             }
 
-            //-------------------------------------------------------------------------
+            animClip.m_staticPose[boneIdx] = staticTransform;
+        }
+
+        int32_t const numRotationTracks = (int32_t) animClip.m_dynamicRotationBoneIndices.size();
+        int32_t const numTranslationTracks = (int32_t) animClip.m_dynamicTranslationBoneIndices.size();
+        int32_t const numScaleTracks = (int32_t) animClip.m_dynamicScaleBoneIndices.size();
+
+        int32_t const numRotationGroups = AnimationClip::GetNumTrackGroups( numRotationTracks );
+        int32_t const numTranslationGroups = AnimationClip::GetNumTrackGroups( numTranslationTracks );
+        int32_t const numScaleGroups = AnimationClip::GetNumTrackGroups( numScaleTracks );
+
+        // Create quantization ranges, padding tracks use a valid default range
+        //-------------------------------------------------------------------------
+
+        animClip.m_translationQuantizationRanges.resize( numTranslationGroups * AnimationClip::s_translationGroupRangeSize, defaultQuantizationRangeLength );
+        for ( int32_t trackIdx = 0; trackIdx < numTranslationTracks; trackIdx++ )
+        {
+            TrackCompressionSettings const& settings = trackSettings[animClip.m_dynamicTranslationBoneIndices[trackIdx]];
+            float* pRanges = animClip.m_translationQuantizationRanges.data() + ( ( trackIdx / AnimationClip::s_trackGroupSize ) * AnimationClip::s_translationGroupRangeSize );
+            int32_t const laneIdx = trackIdx % AnimationClip::s_trackGroupSize;
 
-            animClip.m_trackCompressionSettings.emplace_back( trackSettings );
+            pRanges[laneIdx] = settings.m_translationRangeX.m_rangeStart;
+            pRanges[laneIdx + 4] = settings.m_translationRangeY.m_rangeStart;
+            pRanges[laneIdx + 8] = settings.m_translationRangeZ.m_rangeStart;
+            pRanges[laneIdx + 12] = settings.m_translationRangeX.m_rangeLength;
+            pRanges[laneIdx + 16] = settings.m_translationRangeY.m_rangeLength;
+            pRanges[laneIdx + 20] = settings.m_translationRangeZ.m_rangeLength;
+        }
+
+        animClip.m_scaleQuantizationRanges.resize( numScaleGroups * AnimationClip::s_scaleGroupRangeSize, defaultQuantizationRangeLength );
+        for ( int32_t trackIdx = 0; trackIdx < numScaleTracks; trackIdx++ )
+        {
+            TrackCompressionSettings const& settings = trackSettings[animClip.m_dynamicScaleBoneIndices[trackIdx]];
+            float* pRanges = animClip.m_scaleQuantizationRanges.data() + ( ( trackIdx / AnimationClip::s_trackGroupSize ) * AnimationClip::s_scaleGroupRangeSize );
+            int32_t const laneIdx = trackIdx % AnimationClip::s_trackGroupSize;
+
+            pRanges[laneIdx] = settings.m_scaleRange.m_rangeStart;
+            pRanges[laneIdx + 4] = settings.m_scaleRange.m_rangeLength;
         }
 
         //-------------------------------------------------------------------------
         // Create 'pose wise' compressed data
         //-------------------------------------------------------------------------
 
+        animClip.m_compressedFrameSize = ( numRotationGroups * AnimationClip::s_rotationGroupDataSize ) + ( numTranslationGroups * AnimationClip::s_translationGroupDataSize ) + ( numScaleGroups * AnimationClip::s_scaleGroupDataSize );
+        animClip.m_compressedPoseData.resize( animClip.m_numFrames * animClip.m_compressedFrameSize, 0 );
+
+        // Padding rotation tracks are set to identity so that the decoded padding lanes are always valid
+        Quantization::EncodedQuaternion const encodedIdentity( Quaternion::Identity );
+
         for ( int32_t frameIdx = frameIdxStart; frameIdx < frameIdxEnd; frameIdx++ )
         {
-            animClip.m_compressedPoseOffsets.emplace_back( (int32_t) animClip.m_compressedPoseData2.size() );
+            uint16_t* pFrameData = animClip.m_compressedPoseData.data() + ( ( frameIdx - frameIdxStart ) * animClip.m_compressedFrameSize );
 
             // Record all bone rotations
-            for ( uint32_t boneIdx = 0; boneIdx < numBones; boneIdx++ )
+            for ( int32_t trackIdx = 0; trackIdx < numRotationGroups * AnimationClip::s_trackGroupSize; trackIdx++ )
             {
-                TrackCompressionSettings const& trackSettings = animClip.m_trackCompressionSettings[boneIdx];
-
-                if ( !trackSettings.IsRotationTrackStatic() )
+                Quantization::EncodedQuaternion encodedQuat = encodedIdentity;
+                if ( trackIdx < numRotationTracks )
                 {
-                    Transform const& rawBoneTransform = rawTrackData[boneIdx].m_localTransforms[frameIdx];
-                    Quaternion const rotation = rawBoneTransform.GetRotation();
-
-                    Quantization::EncodedQuaternion const encodedQuat( rotation );
-                    animClip.m_compressedPoseData2.push_back( encodedQuat.GetData0() );
-                    animClip.m_compressedPoseData2.push_back( encodedQuat.GetData1() );
-                    animClip.m_compressedPoseData2.push_back( encodedQuat.GetData2() );
+                    Transform const& rawBoneTransform = rawTrackData[animClip.m_dynamicRotationBoneIndices[trackIdx]].m_localTransforms[frameIdx];
+                    encodedQuat = Quantization::EncodedQuaternion( rawBoneTransform.GetRotation() );
                 }
+
+                uint16_t* pGroupData = pFrameData + ( ( trackIdx / AnimationClip::s_trackGroupSize ) * AnimationClip::s_rotationGroupDataSize );
+                int32_t const laneIdx = trackIdx % AnimationClip::s_trackGroupSize;
+                pGroupData[laneIdx] = encodedQuat.GetData0();
+                pGroupData[laneIdx + 4] = encodedQuat.GetData1();
+                pGroupData[laneIdx + 8] = encodedQuat.GetData2();
             }
+            pFrameData += numRotationGroups * AnimationClip::s_rotationGroupDataSize;
 
-            // Record all bone translation and scale
-            for ( uint32_t boneIdx = 0; boneIdx < numBones; boneIdx++ )
+            // Record all bone translations
+            for ( int32_t trackIdx = 0; trackIdx < numTranslationTracks; trackIdx++ )
             {
-                TrackCompressionSettings const& trackSettings = animClip.m_trackCompressionSettings[boneIdx];
-
-                if ( !trackSettings.IsTranslationTrackStatic() )
-                {
-                    Transform const& rawBoneTransform = rawTrackData[boneIdx].m_localTransforms[frameIdx];
-                    Vector const& translation = rawBoneTransform.GetTranslation();
+                TrackCompressionSettings const& settings = trackSettings[animClip.m_dynamicTranslationBoneIndices[trackIdx]];
+                Transform const& rawBoneTransform = rawTrackData[animClip.m_dynamicTranslationBoneIndices[trackIdx]].m_localTransforms[frameIdx];
+                Vector const& translation = rawBoneTransform.GetTranslation();
 
-                    uint16_t const m_x = Quantization::EncodeFloat( translation.GetX(), trackSettings.m_translationRangeX.m_rangeStart, trackSettings.m_translationRangeX.m_rangeLength );
-                    uint16_t const m_y = Quantization::EncodeFloat( translation.GetY(), trackSettings.m_translationRangeY.m_rangeStart, trackSettings.m_translationRangeY.m_rangeLength );
-                    uint16_t const m_z = Quantization::EncodeFloat( translation.GetZ(), trackSettings.m_translationRangeZ.m_rangeStart, trackSettings.m_translationRangeZ.m_rangeLength );
+                uint16_t* pGroupData = pFrameData + ( ( trackIdx / AnimationClip::s_trackGroupSize ) * AnimationClip::s_translationGroupDataSize );
+                int32_t const laneIdx = trackIdx % AnimationClip::s_trackGroupSize;
+                pGroupData[laneIdx] = Quantization::EncodeFloat( translation.GetX(), settings.m_translationRangeX.m_rangeStart, settings.m_translationRangeX.m_rangeLength );
+                pGroupData[laneIdx + 4] = Quantization::EncodeFloat( translation.GetY(), settings.m_translationRangeY.m_rangeStart, settings.m_translationRangeY.m_rangeLength );
+                pGroupData[laneIdx + 8] = Quantization::EncodeFloat( translation.GetZ(), settings.m_translationRangeZ.m_rangeStart, settings.m_translationRangeZ.m_rangeLength );
+            }
+            pFrameData += numTranslationGroups * AnimationClip::s_translationGroupDataSize;
 
-                    animClip.m_compressedPoseData2.push_back( m_x );
-                    animClip.m_compressedPoseData2.push_back( m_y );
-                    animClip.m_compressedPoseData2.push_back( m_z );
-                }
+            // Record all bone scales
+            for ( int32_t trackIdx = 0; trackIdx < numScaleTracks; trackIdx++ )
+            {
+                TrackCompressionSettings const& settings = trackSettings[animClip.m_dynamicScaleBoneIndices[trackIdx]];
+                Transform const& rawBoneTransform = rawTrackData[animClip.m_dynamicScaleBoneIndices[trackIdx]].m_localTransforms[frameIdx];
 
-                if ( !trackSettings.IsScaleTrackStatic() )
-                {
-                    Transform const& rawBoneTransform = rawTrackData[boneIdx].m_localTransforms[frameIdx];
-                    uint16_t const m_x = Quantization::EncodeFloat( rawBoneTransform.GetScale(), trackSettings.m_scaleRange.m_rangeStart, trackSettings.m_scaleRange.m_rangeLength );
-                    animClip.m_compressedPoseData2.push_back( m_x );
-                }
+                uint16_t* pGroupData = pFrameData + ( ( trackIdx / AnimationClip::s_trackGroupSize ) * AnimationClip::s_scaleGroupDataSize );
+                pGroupData[trackIdx % AnimationClip::s_trackGroupSize] = Quantization::EncodeFloat( rawBoneTransform.GetScale(), settings.m_scaleRange.m_rangeStart, settings.m_scaleRange.m_rangeLength );
             }
         }
 
@@ -6383,7 +6383,7 @@ namespace EE::Animation
             auto pSkeletonFileEntry = m_pGraphWorkspace->m_pToolsContext->m_pResourceDatabase->GetFileEntry( skeletonResourceID );
             if ( pSkeletonFileEntry != nullptr )
             {
-                SkeletonResourceDescriptor const* pSkeletonDescriptor = Cast<SkeletonResourceDescriptor>( pSkeletonFileEntry->m_pDescriptor );
+                SkeletonResourceDescriptor const* pSkeletonDescriptor = Cast<SkeletonResourceDescriptor>( pSkeletonFileEntry->GetDescriptor() );
                 for ( auto const& boneMaskID : pSkeletonDescriptor->GetBoneMaskIDs() )
                 {
                     if ( !boneMaskID.IsValid() )
@@ -18,6 +18,16 @@ namespace EE::Resource
         SuccessWithWarnings = 2,
     };
 
+    // Persistent compiler workers
+    //-------------------------------------------------------------------------
+    // A compiler started with "-worker" stays alive and reads one request per line from stdin: "<force 0/1> <package 0/1> <resource path>"
+    // All the output for a request is followed by a single result line: "<result marker> <CompilationResult>"
+
+    namespace CompilerWorker
+    {
+        constexpr static char const* const s_resultMarker = "#EE_COMPILATION_RESULT#";
+    }
+
     // Context for a single compilation operation
     //-------------------------------------------------------------------------
 
@@ -1,6 +1,8 @@
 #include "ResourceDatabase.h"
+#include "ResourceDatabaseSnapshot.h"
 #include "ResourceDescriptor.h"
 #include "Base/FileSystem/FileSystemUtils.h"
+#include "Base/Encoding/Hash.h"
 #include "Base/TypeSystem/TypeRegistry.h"
 #include "Base/Types/Function.h"
 
@@ -13,19 +15,60 @@ namespace EE::Resource
         EE::Delete( m_pDescriptor );
     }
 
-    void ResourceDatabase::FileEntry::LoadDescriptor( TypeSystem::TypeRegistry const& typeRegistry )
+    ResourceDescriptor const* ResourceDatabase::FileEntry::GetDescriptor() const
+    {
+        if ( !m_isDescriptorDeserialized && !m_serializedDescriptor.empty() )
+        {
+            EE_ASSERT( m_isRegisteredResourceType && m_pDescriptor == nullptr );
+            m_isDescriptorDeserialized = true;
+
+            m_pDescriptor = ResourceDescriptor::TryReadFromString( *m_pTypeRegistry, m_serializedDescriptor.c_str() );
+            if ( m_pDescriptor == nullptr )
+            {
+                EE_LOG_ERROR( "Resource", "Resource Descriptor", "Failed to read resource descriptor file: %s", m_filePath.c_str() );
+            }
+        }
+
+        return m_pDescriptor;
+    }
+
+    void ResourceDatabase::FileEntry::LoadDescriptor()
     {
         EE_ASSERT( m_isRegisteredResourceType );
         EE_ASSERT( m_pDescriptor == nullptr );
         EE_ASSERT( m_filePath.IsValid() );
 
-        m_pDescriptor = ResourceDescriptor::TryReadFromFile( typeRegistry, m_filePath );
+        UpdateFileInfo();
+
+        // Keep the file contents around so that they can be written to the snapshot
+        Blob fileData;
+        if ( !FileSystem::LoadFile( m_filePath, fileData ) )
+        {
+            EE_LOG_ERROR( "Resource", "Resource Descriptor", "Failed to read resource descriptor file: %s", m_filePath.c_str() );
+            m_contentHash = 0;
+            m_serializedDescriptor.clear();
+            m_isDescriptorDeserialized = true;
+            return;
+        }
+
+        m_contentHash = Hash::GetHash64( fileData );
+        m_serializedDescriptor.assign( (char const*) fileData.data(), fileData.size() );
+        m_isDescriptorDeserialized = false;
+        GetDescriptor();
     }
 
-    void ResourceDatabase::FileEntry::ReloadDescriptor( TypeSystem::TypeRegistry const& typeRegistry )
+    void ResourceDatabase::FileEntry::ReloadDescriptor()
     {
         EE::Delete( m_pDescriptor );
-        LoadDescriptor( typeRegistry );
+        LoadDescriptor();
+    }
+
+    void ResourceDatabase::FileEntry::UpdateFileInfo()
+    {
+        if ( !FileSystem::GetFileSizeAndModifiedTime( m_filePath, m_fileSize, m_modifiedTime ) )
+        {
+            m_fileSize = m_modifiedTime = 0;
+        }
     }
 
     //-------------------------------------------------------------------------
@@ -80,6 +123,7 @@ namespace EE::Resource
     ResourceDatabase::~ResourceDatabase()
     {
         EE_ASSERT( m_state == DatabaseState::Empty );
+        EE_ASSERT( m_pSnapshot == nullptr && m_pValidationTask == nullptr );
         EE_ASSERT( m_reflectedDataDirectory.IsEmpty() && m_resourcesPerType.empty() && m_resourcesPerPath.empty() );
     }
 
@@ -95,13 +139,14 @@ namespace EE::Resource
         m_rawResourceDirPath = rawResourceDirPath;
         m_compiledResourceDirPath = compiledResourceDirPath;
         m_dataDirectoryPathDepth = m_rawResourceDirPath.GetDirectoryDepth();
+        m_snapshotFilePath = m_compiledResourceDirPath + "ResourceDatabase.snapshot";
         m_pTaskSystem = pTaskSystem;
         m_pTypeRegistry = pTypeRegistry;
 
         // Start database build
         //-------------------------------------------------------------------------
 
-        StartFilesystemCacheBuild();
+        StartFilesystemCacheBuild( true );
 
         // Start file system watcher
         //-------------------------------------------------------------------------
@@ -119,6 +164,14 @@ namespace EE::Resource
 
         m_fileSystemWatcher.StopWatching();
 
+        // Save any changes made since the snapshot was last written
+        //-------------------------------------------------------------------------
+
+        if ( m_state == DatabaseState::Ready && m_isSnapshotDirty )
+        {
+            WriteSnapshot();
+        }
+
         //-------------------------------------------------------------------------
 
         ClearDatabase();
@@ -136,6 +189,8 @@ namespace EE::Resource
 
     bool ResourceDatabase::Update()
     {
+        bool changesDetected = false;
+
         // Wait for rebuild to complete
         //-------------------------------------------------------------------------
 
@@ -152,14 +207,22 @@ namespace EE::Resource
                     // Notify users that the DB has been rebuilt
                     m_filesystemCacheUpdatedEvent.Execute();
 
+                    // Restored descriptors are loaded on demand so we only need to check the snapshot against the file system
+                    if ( m_pSnapshot != nullptr )
+                    {
+                        EE_ASSERT( m_descriptorsToLoad.empty() );
+                        m_state = DatabaseState::Ready;
+                        StartSnapshotValidation();
+                    }
                     // Start loading descriptors
-                    if ( !m_descriptorsToLoad.empty() )
+                    else if ( !m_descriptorsToLoad.empty() )
                     {
                         StartDescriptorCacheBuild();
                     }
                     else // Nothing else to do
                     {
                         m_state = DatabaseState::Ready;
+                        WriteSnapshot();
                     }
                 }
                 else if ( m_state == DatabaseState::BuildingDescriptorCache )
@@ -168,6 +231,7 @@ namespace EE::Resource
 
                     m_descriptorsToLoad.clear();
                     m_state = DatabaseState::Ready;
+                    WriteSnapshot();
                 }
                 else // Error
                 {
@@ -176,18 +240,30 @@ namespace EE::Resource
             }
         }
 
+        // Wait for snapshot validation to complete
+        //-------------------------------------------------------------------------
+
+        if ( m_pValidationTask != nullptr )
+        {
+            if ( m_pValidationTask->GetIsComplete() )
+            {
+                EE::Delete( m_pValidationTask );
+                changesDetected |= ApplySnapshotValidationResults();
+            }
+        }
+
         // Update file watcher
         //-------------------------------------------------------------------------
 
         if ( m_fileSystemWatcher.Update() )
         {
             ProcessFileSystemChanges();
-            return true;
+            changesDetected = true;
         }
 
         //-------------------------------------------------------------------------
 
-        return false;
+        return changesDetected;
     }
 
     //-------------------------------------------------------------------------
@@ -196,7 +272,7 @@ namespace EE::Resource
     {
         CancelDatabaseBuild();
         ClearDatabase();
-        StartFilesystemCacheBuild();
+        StartFilesystemCacheBuild( false );
     }
 
     void ResourceDatabase::ClearDatabase()
@@ -204,13 +280,27 @@ namespace EE::Resource
         m_resourcesPerType.clear();
         m_resourcesPerPath.clear();
         m_reflectedDataDirectory.Clear();
-        m_descriptorsToLoad.empty();
+        m_descriptorsToLoad.clear();
         m_numItemsProcessed = m_totalItemsToProcess = 0;
         m_state = DatabaseState::Empty;
+        EE::Delete( m_pSnapshot );
+        m_isSnapshotDirty = false;
     }
 
     void ResourceDatabase::CancelDatabaseBuild()
     {
+        // Cancelling the validation leaves the DB in the restored state, this is fine since the snapshot is validated again on the next startup
+        if ( m_pValidationTask != nullptr )
+        {
+            m_cancelActiveTask = true;
+            m_pTaskSystem->WaitForTask( m_pValidationTask );
+            EE::Delete( m_pValidationTask );
+            EE::Delete( m_pSnapshot );
+            m_cancelActiveTask = false;
+        }
+
+        //-------------------------------------------------------------------------
+
         if ( m_pAsyncTask != nullptr )
         {
             m_cancelActiveTask = true;
@@ -223,11 +313,17 @@ namespace EE::Resource
         }
     }
 
-    void ResourceDatabase::StartFilesystemCacheBuild()
+    void ResourceDatabase::StartFilesystemCacheBuild( bool useSnapshot )
     {
         EE_ASSERT( m_state == DatabaseState::Empty );
         EE_ASSERT( m_pAsyncTask == nullptr );
         EE_ASSERT( m_descriptorsToLoad.empty() );
+        EE_ASSERT( m_pSnapshot == nullptr );
+
+        if ( useSnapshot && FileSystem::Exists( m_snapshotFilePath ) )
+        {
+            m_pSnapshot = EE::New<ResourceDatabaseSnapshot>();
+        }
 
         //-------------------------------------------------------------------------
 
@@ -255,53 +351,82 @@ namespace EE::Resource
             m_reflectedDataDirectory.m_name = StringID( m_rawResourceDirPath.GetDirectoryName() );
             m_reflectedDataDirectory.m_filePath = m_rawResourceDirPath;
 
-            // Get all files in the data directory
+            // Try to restore the DB from the snapshot
             //-------------------------------------------------------------------------
 
-            if ( m_cancelActiveTask )
+            if ( m_pSnapshot != nullptr )
             {
-                return;
+                if ( TryRestoreFromSnapshot() )
+                {
+                    return;
+                }
+
+                EE_LOG_WARNING( "Resource", "Resource Database", "Failed to read resource database snapshot (%s), rebuilding from the file system", m_snapshotFilePath.c_str() );
+                EE::Delete( m_pSnapshot );
             }
 
-            TVector<FileSystem::Path> foundPaths;
-            if ( !FileSystem::GetDirectoryContents( m_rawResourceDirPath, foundPaths, FileSystem::DirectoryReaderOutput::All, FileSystem::DirectoryReaderMode::Expand ) )
+            // Get all files in the data directory
+            //-------------------------------------------------------------------------
+
+            if ( m_cancelActiveTask )
             {
-                EE_HALT();
+                return;
             }
 
-            // Add record for all files
+            // Walk the directory tree one directory at a time, recording each directory's modified time before reading its contents
+            // Any change made while we are reading a directory will then be newer than the recorded time and will be picked up by the next startup
             //-------------------------------------------------------------------------
 
-            m_totalItemsToProcess = (int32_t) foundPaths.size();
-            for ( int32_t i = 0; i < m_totalItemsToProcess; i++ )
-            {
-                auto const& filePath = foundPaths[i];
+            m_numItemsProcessed = 0;
+            m_totalItemsToProcess = 0;
+
+            uint64_t directorySize = 0;
+            TVector<FileSystem::Path> directoriesToVisit = { m_rawResourceDirPath };
+            TVector<FileSystem::Path> directoryContents;
 
+            for ( size_t directoryIdx = 0; directoryIdx < directoriesToVisit.size(); directoryIdx++ )
+            {
                 if ( m_cancelActiveTask )
                 {
                     m_numItemsProcessed = m_totalItemsToProcess;
                     return;
                 }
 
-                //-------------------------------------------------------------------------
+                // Copy the path since visiting the directory can grow the queue
+                FileSystem::Path const directoryPath = directoriesToVisit[directoryIdx];
+                DirectoryEntry* pDirectory = FindOrCreateDirectory( directoryPath );
+                EE_ASSERT( pDirectory != nullptr );
+                FileSystem::GetFileSizeAndModifiedTime( directoryPath, directorySize, pDirectory->m_modifiedTime );
 
-                if ( filePath.IsDirectoryPath() )
+                directoryContents.clear();
+                if ( !FileSystem::GetDirectoryContents( directoryPath, directoryContents, FileSystem::DirectoryReaderOutput::All, FileSystem::DirectoryReaderMode::DontExpand ) )
                 {
-                    DirectoryEntry* pDirectory = FindOrCreateDirectory( filePath );
-                    EE_ASSERT( pDirectory != nullptr );
+                    EE_HALT();
                 }
-                else
-                {
-                    auto pCreatedFileEntry = AddFileRecord( filePath, false );
 
-                    // Queue for descriptor load
-                    if ( pCreatedFileEntry->m_isRegisteredResourceType )
+                // Add record for all files, sub-directories are recorded when they are visited
+                //-------------------------------------------------------------------------
+
+                m_totalItemsToProcess += (int32_t) directoryContents.size();
+                for ( auto const& path : directoryContents )
+                {
+                    if ( path.IsDirectoryPath() )
                     {
-                        m_descriptorsToLoad.emplace_back( pCreatedFileEntry );
+                        directoriesToVisit.emplace_back( path );
                     }
-                }
+                    else
+                    {
+                        auto pCreatedFileEntry = AddFileRecord( path, false );
 
-                m_numItemsProcessed++;
+                        // Queue for descriptor load
+                        if ( pCreatedFileEntry->m_isRegisteredResourceType )
+                        {
+                            m_descriptorsToLoad.emplace_back( pCreatedFileEntry );
+                        }
+                    }
+
+                    m_numItemsProcessed++;
+                }
             }
 
             EE_ASSERT( m_numItemsProcessed == m_totalItemsToProcess );
@@ -329,7 +454,7 @@ namespace EE::Resource
         {
             for ( uint32_t i = range.start; i < range.end; i++ )
             {
-                m_descriptorsToLoad[i]->LoadDescriptor( *m_pTypeRegistry );
+                m_descriptorsToLoad[i]->LoadDescriptor();
                 m_descriptorsToLoad[i] = nullptr;
                 m_numItemsProcessed++;
             }
@@ -345,6 +470,333 @@ namespace EE::Resource
         m_pTaskSystem->ScheduleTask( m_pAsyncTask );
     }
 
+    // Snapshot
+    //-------------------------------------------------------------------------
+
+    bool ResourceDatabase::TryRestoreFromSnapshot()
+    {
+        EE_ASSERT( m_pSnapshot != nullptr );
+
+        if ( !m_pSnapshot->ReadFromFile( m_snapshotFilePath, m_rawResourceDirPath ) )
+        {
+            return false;
+        }
+
+        auto& directoryRecords = m_pSnapshot->m_directories;
+        auto& fileRecords = m_pSnapshot->m_files;
+        int32_t const numDirectories = (int32_t) directoryRecords.size();
+        int32_t const numFiles = (int32_t) fileRecords.size();
+
+        // Reserve all directory storage up front so that directory entry ptrs remain stable while we restore the tree
+        //-------------------------------------------------------------------------
+
+        TVector<int32_t> numChildDirectories( numDirectories, 0 );
+        TVector<int32_t> numChildFiles( numDirectories, 0 );
+
+        for ( int32_t i = 1; i < numDirectories; i++ )
+        {
+            numChildDirectories[directoryRecords[i].m_parentIdx]++;
+        }
+
+        for ( auto const& fileRecord : fileRecords )
+        {
+            numChildFiles[fileRecord.m_directoryIdx]++;
+        }
+
+        // Restore directories, the first record is always the root directory
+        //-------------------------------------------------------------------------
+
+        TVector<DirectoryEntry*> directories( numDirectories, nullptr );
+        directories[0] = &m_reflectedDataDirectory;
+        m_reflectedDataDirectory.m_modifiedTime = directoryRecords[0].m_modifiedTime;
+        m_reflectedDataDirectory.m_directories.reserve( numChildDirectories[0] );
+        m_reflectedDataDirectory.m_files.reserve( numChildFiles[0] );
+
+        for ( int32_t i = 1; i < numDirectories; i++ )
+        {
+            auto const& directoryRecord = directoryRecords[i];
+
+            auto& newDirectory = directories[directoryRecord.m_parentIdx]->m_directories.emplace_back( DirectoryEntry() );
+            newDirectory.m_filePath = FileSystem::Path::FromNormalizedPathString( directoryRecord.m_path );
+            newDirectory.m_name = StringID( newDirectory.m_filePath.GetDirectoryName() );
+            newDirectory.m_resourcePath = ResourcePath::FromFileSystemPath( m_rawResourceDirPath, newDirectory.m_filePath );
+            newDirectory.m_modifiedTime = directoryRecord.m_modifiedTime;
+            newDirectory.m_directories.reserve( numChildDirectories[i] );
+            newDirectory.m_files.reserve( numChildFiles[i] );
+            directories[i] = &newDirectory;
+        }
+
+        // Restore files
+        //-------------------------------------------------------------------------
+
+        m_totalItemsToProcess = numFiles;
+        for ( auto& fileRecord : fileRecords )
+        {
+            if ( m_cancelActiveTask )
+            {
+                m_numItemsProcessed = m_totalItemsToProcess;
+                return true;
+            }
+
+            FileEntry* pEntry = CreateFileEntry( directories[fileRecord.m_directoryIdx], FileSystem::Path::FromNormalizedPathString( fileRecord.m_path ) );
+            pEntry->m_fileSize = fileRecord.m_fileSize;
+            pEntry->m_modifiedTime = fileRecord.m_modifiedTime;
+            pEntry->m_contentHash = fileRecord.m_contentHash;
+            pEntry->m_serializedDescriptor = eastl::move( fileRecord.m_serializedDescriptor );
+
+            // Descriptors that couldnt be read when the snapshot was written (or whose type was since registered) always need to be reloaded
+            fileRecord.m_isDescriptor = pEntry->m_isRegisteredResourceType;
+            if ( pEntry->m_isRegisteredResourceType && pEntry->m_serializedDescriptor.empty() )
+            {
+                fileRecord.m_modifiedTime = pEntry->m_modifiedTime = 0;
+            }
+
+            m_numItemsProcessed++;
+        }
+
+        //-------------------------------------------------------------------------
+
+        m_pSnapshot->BeginValidation();
+        return true;
+    }
+
+    void ResourceDatabase::StartSnapshotValidation()
+    {
+        EE_ASSERT( m_state == DatabaseState::Ready );
+        EE_ASSERT( m_pSnapshot != nullptr && m_pValidationTask == nullptr );
+
+        //-------------------------------------------------------------------------
+
+        int32_t const numDirectories = (int32_t) m_pSnapshot->m_directories.size();
+        int32_t const numFiles = (int32_t) m_pSnapshot->m_files.size();
+
+        auto ValidateSnapshot = [this, numDirectories] ( TaskSetPartition range, uint32_t threadnum )
+        {
+            for ( uint32_t i = range.start; i < range.end; i++ )
+            {
+                if ( m_cancelActiveTask )
+                {
+                    return;
+                }
+
+                if ( (int32_t) i < numDirectories )
+                {
+                    m_pSnapshot->ValidateDirectory( (int32_t) i );
+                }
+                else
+                {
+                    m_pSnapshot->ValidateFile( (int32_t) i - numDirectories );
+                }
+            }
+        };
+
+        //-------------------------------------------------------------------------
+
+        auto pValidationTask = EE::New<AsyncTask>( numDirectories + numFiles, ValidateSnapshot );
+        pValidationTask->m_MinRange = 64;
+        m_pValidationTask = pValidationTask;
+        m_pTaskSystem->ScheduleTask( m_pValidationTask );
+    }
+
+    bool ResourceDatabase::ApplySnapshotValidationResults()
+    {
+        EE_ASSERT( m_state == DatabaseState::Ready );
+        EE_ASSERT( m_pSnapshot != nullptr && m_pValidationTask == nullptr );
+
+        bool changesDetected = false;
+
+        // Files - skip any entries that were modified by the file system watcher while we were validating
+        //-------------------------------------------------------------------------
+
+        int32_t const numFiles = (int32_t) m_pSnapshot->m_files.size();
+        for ( int32_t i = 0; i < numFiles; i++ )
+        {
+            auto& validatedFile = m_pSnapshot->m_validatedFiles[i];
+            if ( validatedFile.m_status == ResourceDatabaseSnapshot::FileStatus::Unchanged )
+            {
+                continue;
+            }
+
+            auto const& fileRecord = m_pSnapshot->m_files[i];
+            FileSystem::Path const filePath = FileSystem::Path::FromNormalizedPathString( fileRecord.m_path );
+            FileEntry* pEntry = FindFileEntry( filePath );
+            if ( pEntry == nullptr || pEntry->m_fileSize != fileRecord.m_fileSize || pEntry->m_modifiedTime != fileRecord.m_modifiedTime )
+            {
+                continue;
+            }
+
+            switch ( validatedFile.m_status )
+            {
+                case ResourceDatabaseSnapshot::FileStatus::Deleted:
+                {
+                    RemoveFileRecord( filePath );
+                }
+                break;
+
+                case ResourceDatabaseSnapshot::FileStatus::MetadataChanged:
+                {
+                    pEntry->m_fileSize = validatedFile.m_fileSize;
+                    pEntry->m_modifiedTime = validatedFile.m_modifiedTime;
+                }
+                break;
+
+                case ResourceDatabaseSnapshot::FileStatus::ContentChanged:
+                {
+                    pEntry->m_fileSize = validatedFile.m_fileSize;
+                    pEntry->m_modifiedTime = validatedFile.m_modifiedTime;
+                    pEntry->m_contentHash = validatedFile.m_contentHash;
+                    pEntry->m_serializedDescriptor = eastl::move( validatedFile.m_serializedDescriptor );
+                    EE::Delete( pEntry->m_pDescriptor );
+                    pEntry->m_isDescriptorDeserialized = false;
+                }
+                break;
+
+                default:
+                {
+                    EE_UNREACHABLE_CODE();
+                }
+                break;
+            }
+
+            changesDetected = true;
+        }
+
+        // Directories - record the new modified times for any directories that were enumerated
+        //-------------------------------------------------------------------------
+
+        int32_t const numDirectories = (int32_t) m_pSnapshot->m_directories.size();
+        for ( int32_t i = 0; i < numDirectories; i++ )
+        {
+            auto const& directoryRecord = m_pSnapshot->m_directories[i];
+            auto const& validatedDirectory = m_pSnapshot->m_validatedDirectories[i];
+            if ( validatedDirectory.m_isDeleted || validatedDirectory.m_modifiedTime == directoryRecord.m_modifiedTime )
+            {
+                continue;
+            }
+
+            DirectoryEntry* pDirectory = FindDirectory( FileSystem::Path::FromNormalizedPathString( directoryRecord.m_path ) );
+            if ( pDirectory != nullptr && pDirectory->m_modifiedTime == directoryRecord.m_modifiedTime )
+            {
+                pDirectory->m_modifiedTime = validatedDirectory.m_modifiedTime;
+                m_isSnapshotDirty = true;
+            }
+        }
+
+        // Remove deleted directories, children are always stored after their parents so iterate in reverse to remove children first
+        for ( int32_t i = numDirectories - 1; i > 0; i-- )
+        {
+            if ( !m_pSnapshot->m_validatedDirectories[i].m_isDeleted )
+            {
+                continue;
+            }
+
+            FileSystem::Path const directoryPath = FileSystem::Path::FromNormalizedPathString( m_pSnapshot->m_directories[i].m_path );
+            DirectoryEntry* pParentDirectory = FindDirectory( directoryPath.GetParentDirectory() );
+            if ( pParentDirectory == nullptr || directoryPath.Exists() )
+            {
+                continue;
+            }
+
+            int32_t const numSubDirectories = (int32_t) pParentDirectory->m_directories.size();
+            for ( int32_t j = 0; j < numSubDirectories; j++ )
+            {
+                // Only remove directories whose contents were removed above
+                if ( pParentDirectory->m_directories[j].m_filePath == directoryPath && pParentDirectory->m_directories[j].IsEmpty() )
+                {
+                    pParentDirectory->m_directories.erase_unsorted( pParentDirectory->m_directories.begin() + j );
+                    changesDetected = true;
+                    break;
+                }
+            }
+        }
+
+        // Add everything that was created while the editor wasnt running
+        //-------------------------------------------------------------------------
+
+        for ( auto const& directoryPath : m_pSnapshot->m_newDirectories )
+        {
+            if ( directoryPath.Exists() && FindDirectory( directoryPath ) == nullptr )
+            {
+                FindOrCreateDirectory( directoryPath );
+                changesDetected = true;
+            }
+        }
+
+        for ( auto const& filePath : m_pSnapshot->m_newFiles )
+        {
+            if ( filePath.Exists() && FindFileEntry( filePath ) == nullptr )
+            {
+                AddFileRecord( filePath, true );
+                changesDetected = true;
+            }
+        }
+
+        //-------------------------------------------------------------------------
+
+        EE::Delete( m_pSnapshot );
+
+        if ( changesDetected )
+        {
+            m_isSnapshotDirty = true;
+
+            if ( m_filesystemCacheUpdatedEvent.HasBoundUsers() )
+            {
+                m_filesystemCacheUpdatedEvent.Execute();
+            }
+        }
+
+        return changesDetected;
+    }
+
+    void ResourceDatabase::WriteSnapshot()
+    {
+        EE_ASSERT( m_state == DatabaseState::Ready );
+        EE_ASSERT( m_pSnapshot == nullptr );
+
+        ResourceDatabaseSnapshot snapshot;
+
+        // Gather all records, this is a pre-order traversal so parents are always recorded before their children
+        //-------------------------------------------------------------------------
+
+        TVector<TPair<DirectoryEntry const*, int32_t>> directoriesToVisit = { TPair<DirectoryEntry const*, int32_t>( &m_reflectedDataDirectory, InvalidIndex ) };
+        while ( !directoriesToVisit.empty() )
+        {
+            auto const directoryToVisit = directoriesToVisit.back();
+            directoriesToVisit.pop_back();
+
+            int32_t const directoryIdx = (int32_t) snapshot.m_directories.size();
+            auto& directoryRecord = snapshot.m_directories.emplace_back();
+            directoryRecord.m_path = directoryToVisit.first->m_filePath.GetString();
+            directoryRecord.m_parentIdx = directoryToVisit.second;
+            directoryRecord.m_modifiedTime = directoryToVisit.first->m_modifiedTime;
+
+            for ( auto pFile : directoryToVisit.first->m_files )
+            {
+                auto& fileRecord = snapshot.m_files.emplace_back();
+                fileRecord.m_path = pFile->m_filePath.GetString();
+                fileRecord.m_directoryIdx = directoryIdx;
+                fileRecord.m_fileSize = pFile->m_fileSize;
+                fileRecord.m_modifiedTime = pFile->m_modifiedTime;
+                fileRecord.m_contentHash = pFile->m_contentHash;
+                fileRecord.m_serializedDescriptor = pFile->m_serializedDescriptor;
+            }
+
+            for ( auto const& childDirectory : directoryToVisit.first->m_directories )
+            {
+                directoriesToVisit.emplace_back( &childDirectory, directoryIdx );
+            }
+        }
+
+        //-------------------------------------------------------------------------
+
+        if ( !snapshot.WriteToFile( m_snapshotFilePath, m_rawResourceDirPath ) )
+        {
+            EE_LOG_WARNING( "Resource", "Resource Database", "Failed to write resource database snapshot: %s", m_snapshotFilePath.c_str() );
+        }
+
+        m_isSnapshotDirty = false;
+    }
+
     //-------------------------------------------------------------------------
 
     ResourceDatabase::FileEntry const* ResourceDatabase::GetFileEntry( ResourcePath const& resourcePath ) const
@@ -413,7 +865,7 @@ namespace EE::Resource
         auto const& foundEntries = m_resourcesPerType.at( resourceTypeID );
         for ( auto const& entry : foundEntries )
         {
-            if ( filter( entry->m_pDescriptor ) )
+            if ( filter( entry->GetDescriptor() ) )
             {
                 results.emplace_back( entry->m_resourceID );
             }
@@ -429,7 +881,7 @@ namespace EE::Resource
                 auto const& derivedResources = m_resourcesPerType.at( derivedResourceTypeID );
                 for ( auto const& entry : derivedResources )
                 {
-                    if ( filter( entry->m_pDescriptor ) )
+                    if ( filter( entry->GetDescriptor() ) )
                     {
                         results.emplace_back( entry->m_resourceID );
                     }
@@ -516,20 +968,21 @@ namespace EE::Resource
         return pCurrentDir;
     }
 
-    ResourceDatabase::FileEntry* ResourceDatabase::AddFileRecord( FileSystem::Path const& path, bool loadDescriptor )
+    ResourceDatabase::FileEntry* ResourceDatabase::CreateFileEntry( DirectoryEntry* pDirectory, FileSystem::Path const& path )
     {
+        EE_ASSERT( pDirectory != nullptr );
+
         auto const resourcePath = ResourcePath::FromFileSystemPath( m_rawResourceDirPath, path );
         EE_ASSERT( resourcePath.IsFile() );
 
         // Create entry
         auto pNewEntry = EE::New<FileEntry>();
+        pNewEntry->m_pTypeRegistry = m_pTypeRegistry;
         pNewEntry->m_filePath = path;
         pNewEntry->m_resourceID = resourcePath;
         pNewEntry->m_isRegisteredResourceType = m_pTypeRegistry->IsRegisteredResourceType( pNewEntry->m_resourceID.GetResourceTypeID() );
 
         // Add to directory list
-        DirectoryEntry* pDirectory = FindOrCreateDirectory( path.GetParentDirectory() );
-        EE_ASSERT( pDirectory != nullptr );
         pDirectory->m_files.emplace_back( pNewEntry );
 
         // Add to per-type lists
@@ -541,10 +994,25 @@ namespace EE::Resource
         // Add to file map
         m_resourcesPerPath[resourcePath] = pNewEntry;
 
-        // Load descriptor
-        if ( pNewEntry->m_isRegisteredResourceType && loadDescriptor )
+        return pNewEntry;
+    }
+
+    ResourceDatabase::FileEntry* ResourceDatabase::AddFileRecord( FileSystem::Path const& path, bool loadDescriptor )
+    {
+        DirectoryEntry* pDirectory = FindOrCreateDirectory( path.GetParentDirectory() );
+        auto pNewEntry = CreateFileEntry( pDirectory, path );
+
+        // Load descriptor - this also reads the file info, descriptors that are loaded later will read it at that point
+        if ( pNewEntry->m_isRegisteredResourceType )
+        {
+            if ( loadDescriptor )
+            {
+                pNewEntry->LoadDescriptor();
+            }
+        }
+        else
         {
-            pNewEntry->LoadDescriptor( *m_pTypeRegistry );
+            pNewEntry->UpdateFileInfo();
         }
 
         return pNewEntry;
@@ -591,6 +1059,25 @@ namespace EE::Resource
         }
     }
 
+    ResourceDatabase::FileEntry* ResourceDatabase::FindFileEntry( FileSystem::Path const& path )
+    {
+        auto fileEntryIter = m_resourcesPerPath.find( ResourcePath::FromFileSystemPath( m_rawResourceDirPath, path ) );
+        if ( fileEntryIter != m_resourcesPerPath.end() )
+        {
+            return fileEntryIter->second;
+        }
+
+        return nullptr;
+    }
+
+    void ResourceDatabase::InvalidateDirectoryModifiedTime( FileSystem::Path const& dirPath )
+    {
+        if ( DirectoryEntry* pDirectory = FindDirectory( dirPath ) )
+        {
+            pDirectory->m_modifiedTime = 0;
+        }
+    }
+
     // Watcher Events
     //-------------------------------------------------------------------------
 
@@ -601,8 +1088,12 @@ namespace EE::Resource
             m_filesystemCacheUpdatedEvent.Execute();
         }
 
+        // Any change means that the snapshot needs to be rewritten, the modified times of the parent directories of any added or
+        // removed entries are reset since we dont know whether the directory modified time on disk includes all the changes we processed
         //-------------------------------------------------------------------------
 
+        m_isSnapshotDirty = true;
+
         auto const& fsEvents = m_fileSystemWatcher.GetFileSystemChangeEvents();
         for ( auto const& fsEvent : fsEvents )
         {
@@ -611,6 +1102,7 @@ namespace EE::Resource
                 case FileSystem::Watcher::Event::FileCreated:
                 {
                     AddFileRecord( fsEvent.m_path, true );
+                    InvalidateDirectoryModifiedTime( fsEvent.m_path.GetParentDirectory() );
                 }
                 break;
 
@@ -619,6 +1111,7 @@ namespace EE::Resource
                 case FileSystem::Watcher::Event::FileDeleted:
                 {
                     RemoveFileRecord( fsEvent.m_path );
+                    InvalidateDirectoryModifiedTime( fsEvent.m_path.GetParentDirectory() );
                 }
                 break;
 
@@ -628,6 +1121,8 @@ namespace EE::Resource
                 {
                     RemoveFileRecord( fsEvent.m_oldPath );
                     AddFileRecord( fsEvent.m_path, true );
+                    InvalidateDirectoryModifiedTime( fsEvent.m_oldPath.GetParentDirectory() );
+                    InvalidateDirectoryModifiedTime( fsEvent.m_path.GetParentDirectory() );
                 }
                 break;
 
@@ -645,7 +1140,11 @@ namespace EE::Resource
                         {
                             if ( pDirectory->m_files[i]->m_isRegisteredResourceType )
                             {
-                                pDirectory->m_files[i]->ReloadDescriptor( *m_pTypeRegistry );
+                                pDirectory->m_files[i]->ReloadDescriptor();
+                            }
+                            else
+                            {
+                                pDirectory->m_files[i]->UpdateFileInfo();
                             }
 
                             break;
@@ -677,6 +1176,8 @@ namespace EE::Resource
                             AddFileRecord( filePath, true );
                         }
                     }
+
+                    InvalidateDirectoryModifiedTime( fsEvent.m_path.GetParentDirectory() );
                 }
                 break;
 
@@ -692,12 +1193,38 @@ namespace EE::Resource
                     {
                         if ( pParentDirectory->m_directories[i].m_filePath == fsEvent.m_path )
                         {
+                            // Remove all file records first so that the lookups are updated and users are notified
+                            TVector<FileSystem::Path> filesToRemove;
+                            TVector<DirectoryEntry const*> directoriesToVisit = { &pParentDirectory->m_directories[i] };
+                            while ( !directoriesToVisit.empty() )
+                            {
+                                DirectoryEntry const* pDirectoryToVisit = directoriesToVisit.back();
+                                directoriesToVisit.pop_back();
+
+                                for ( auto pFile : pDirectoryToVisit->m_files )
+                                {
+                                    filesToRemove.emplace_back( pFile->m_filePath );
+                                }
+
+                                for ( auto const& childDirectory : pDirectoryToVisit->m_directories )
+                                {
+                                    directoriesToVisit.emplace_back( &childDirectory );
+                                }
+                            }
+
+                            for ( auto const& filePath : filesToRemove )
+                            {
+                                RemoveFileRecord( filePath );
+                            }
+
                             // Delete all children and remove directory
                             pParentDirectory->m_directories[i].Clear();
                             pParentDirectory->m_directories.erase_unsorted( pParentDirectory->m_directories.begin() + i );
                             break;
                         }
                     }
+
+                    pParentDirectory->m_modifiedTime = 0;
                 }
                 break;
 
@@ -753,6 +1280,9 @@ namespace EE::Resource
 
                     EE_ASSERT( pDirectory != nullptr );
                     pDirectory->ChangePath( m_rawResourceDirPath, fsEvent.m_path );
+
+                    InvalidateDirectoryModifiedTime( oldParentPath );
+                    InvalidateDirectoryModifiedTime( newParentPath );
                 }
                 break;
 
@@ -20,9 +20,15 @@ namespace EE
 
 namespace EE::Resource
 {
+    struct ResourceDescriptor;
+    class ResourceDatabaseSnapshot;
+
+    //-------------------------------------------------------------------------
+
     // Maintains a DB of all source resources in the source data folder
     //-------------------------------------------------------------------------
-    // The way we load descriptors is pretty naive and can definitely be improved
+    // The DB is saved to a snapshot whenever it changes and restored from it on startup (see ResourceDatabaseSnapshot)
+    // Restored descriptors are only deserialized when first requested
 
     class EE_ENGINETOOLS_API ResourceDatabase final
     {
@@ -46,16 +52,34 @@ namespace EE::Resource
             FileEntry& operator=( FileEntry& ) = delete;
             FileEntry& operator=( FileEntry const& ) = delete;
 
-            // Descriptor
-            void LoadDescriptor( TypeSystem::TypeRegistry const& typeRegistry );
-            void ReloadDescriptor( TypeSystem::TypeRegistry const& typeRegistry );
+            // Get the descriptor for this file, returns null for non-descriptor files or if the descriptor couldnt be read
+            // Descriptors restored from the snapshot are deserialized on first access so this is not thread-safe
+            ResourceDescriptor const* GetDescriptor() const;
+
+            // Read the descriptor file, this also updates the file info and content hash
+            void LoadDescriptor();
+            void ReloadDescriptor();
+
+            // Update the size and modified time from the file system
+            void UpdateFileInfo();
 
         public:
 
             ResourceID                                              m_resourceID;
             FileSystem::Path                                        m_filePath;
             bool                                                    m_isRegisteredResourceType = false;
-            struct ResourceDescriptor*                              m_pDescriptor = nullptr;
+            uint64_t                                                m_fileSize = 0;
+            uint64_t                                                m_modifiedTime = 0;
+            uint64_t                                                m_contentHash = 0;          // Only tracked for descriptors
+            String                                                  m_serializedDescriptor;     // Descriptor file contents
+
+        private:
+
+            friend class ResourceDatabase;
+
+            TypeSystem::TypeRegistry const*                         m_pTypeRegistry = nullptr;
+            mutable ResourceDescriptor*                             m_pDescriptor = nullptr;
+            mutable bool                                            m_isDescriptorDeserialized = false;
         };
 
         struct DirectoryEntry
@@ -71,6 +95,7 @@ namespace EE::Resource
             StringID                                                m_name;
             FileSystem::Path                                        m_filePath;
             ResourcePath                                            m_resourcePath;
+            uint64_t                                                m_modifiedTime = 0;         // Last time the contents were enumerated, zero if unknown
             TVector<DirectoryEntry>                                 m_directories;
             TVector<FileEntry*>                                     m_files;
         };
@@ -152,7 +177,8 @@ namespace EE::Resource
 
         void ClearDatabase();
 
-        void StartFilesystemCacheBuild();
+        // Build the file system cache, this will restore the DB from the snapshot if requested and available
+        void StartFilesystemCacheBuild( bool useSnapshot );
 
         void StartDescriptorCacheBuild();
 
@@ -164,8 +190,19 @@ namespace EE::Resource
         DirectoryEntry* FindOrCreateDirectory( FileSystem::Path const& dirPath );
 
         // Add/Remove records
+        FileEntry* CreateFileEntry( DirectoryEntry* pDirectory, FileSystem::Path const& path );
         FileEntry* AddFileRecord( FileSystem::Path const& path, bool loadDescriptor );
         void RemoveFileRecord( FileSystem::Path const& path );
+        FileEntry* FindFileEntry( FileSystem::Path const& path );
+
+        // Reset the recorded modified time so that the directory contents will be re-enumerated when the snapshot is next validated
+        void InvalidateDirectoryModifiedTime( FileSystem::Path const& dirPath );
+
+        // Snapshot
+        bool TryRestoreFromSnapshot();
+        void StartSnapshotValidation();
+        bool ApplySnapshotValidationResults();
+        void WriteSnapshot();
 
         // File system listener
         void ProcessFileSystemChanges();
@@ -195,5 +232,11 @@ namespace EE::Resource
         std::atomic<int32_t>                                        m_numItemsProcessed = 0;
         int32_t                                                     m_totalItemsToProcess = 1;
         TVector<FileEntry*>                                         m_descriptorsToLoad;
+
+        // Snapshot
+        FileSystem::Path                                            m_snapshotFilePath;
+        ResourceDatabaseSnapshot*                                   m_pSnapshot = nullptr;
+        ITaskSet*                                                   m_pValidationTask = nullptr;
+        bool                                                        m_isSnapshotDirty = false;
     };
 }
\ No newline at end of file
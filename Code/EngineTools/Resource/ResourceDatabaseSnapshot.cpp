@@ -0,0 +1,226 @@
+#include "ResourceDatabaseSnapshot.h"
+#include "Base/FileSystem/FileSystemUtils.h"
+#include "Base/Encoding/Hash.h"
+
+//-------------------------------------------------------------------------
+
+namespace EE::Resource
+{
+    bool ResourceDatabaseSnapshot::ReadFromFile( FileSystem::Path const& snapshotPath, FileSystem::Path const& rawResourceDirPath )
+    {
+        m_directories.clear();
+        m_files.clear();
+
+        Serialization::BinaryInputArchive archive;
+        if ( !archive.ReadFromFile( snapshotPath ) )
+        {
+            return false;
+        }
+
+        // Header
+        //-------------------------------------------------------------------------
+
+        uint32_t version = 0;
+        String serializedRawResourceDirPath;
+        archive << version;
+        if ( version != s_version )
+        {
+            return false;
+        }
+
+        archive << serializedRawResourceDirPath;
+        if ( serializedRawResourceDirPath != rawResourceDirPath.GetString() )
+        {
+            return false;
+        }
+
+        // Records
+        //-------------------------------------------------------------------------
+
+        archive << m_directories;
+        archive << m_files;
+
+        // Validate the record hierarchy, the first record is always the root directory
+        //-------------------------------------------------------------------------
+
+        int32_t const numDirectories = (int32_t) m_directories.size();
+        bool isValidSnapshot = numDirectories > 0 && m_directories[0].m_path == rawResourceDirPath.GetString() && m_directories[0].m_parentIdx == InvalidIndex;
+
+        for ( int32_t i = 1; i < numDirectories && isValidSnapshot; i++ )
+        {
+            isValidSnapshot = m_directories[i].m_parentIdx >= 0 && m_directories[i].m_parentIdx < i;
+        }
+
+        for ( auto const& fileRecord : m_files )
+        {
+            if ( !isValidSnapshot )
+            {
+                break;
+            }
+
+            isValidSnapshot = fileRecord.m_directoryIdx >= 0 && fileRecord.m_directoryIdx < numDirectories;
+        }
+
+        if ( !isValidSnapshot )
+        {
+            m_directories.clear();
+            m_files.clear();
+        }
+
+        return isValidSnapshot;
+    }
+
+    bool ResourceDatabaseSnapshot::WriteToFile( FileSystem::Path const& snapshotPath, FileSystem::Path const& rawResourceDirPath ) const
+    {
+        EE_ASSERT( !m_directories.empty() && m_directories[0].m_path == rawResourceDirPath.GetString() );
+
+        Serialization::BinaryOutputArchive archive;
+        archive << s_version;
+        archive << rawResourceDirPath.GetString();
+        archive << m_directories;
+        archive << m_files;
+        return archive.WriteToFile( snapshotPath );
+    }
+
+    //-------------------------------------------------------------------------
+
+    void ResourceDatabaseSnapshot::BeginValidation()
+    {
+        m_validatedDirectories.clear();
+        m_validatedDirectories.resize( m_directories.size() );
+
+        m_validatedFiles.clear();
+        m_validatedFiles.resize( m_files.size() );
+
+        m_newDirectories.clear();
+        m_newFiles.clear();
+
+        //-------------------------------------------------------------------------
+
+        m_knownDirectories.clear();
+        m_knownDirectories.reserve( m_directories.size() );
+        for ( auto const& directoryRecord : m_directories )
+        {
+            m_knownDirectories.insert( FileSystem::Path::FromNormalizedPathString( directoryRecord.m_path ) );
+        }
+
+        m_knownFiles.clear();
+        m_knownFiles.reserve( m_files.size() );
+        for ( auto const& fileRecord : m_files )
+        {
+            m_knownFiles.insert( FileSystem::Path::FromNormalizedPathString( fileRecord.m_path ) );
+        }
+    }
+
+    void ResourceDatabaseSnapshot::ValidateDirectory( int32_t directoryIdx )
+    {
+        DirectoryRecord const& record = m_directories[directoryIdx];
+        ValidatedDirectory& result = m_validatedDirectories[directoryIdx];
+
+        uint64_t directorySize = 0;
+        if ( !FileSystem::GetFileSizeAndModifiedTime( record.m_path.c_str(), directorySize, result.m_modifiedTime ) )
+        {
+            result.m_isDeleted = true;
+            return;
+        }
+
+        if ( result.m_modifiedTime == record.m_modifiedTime )
+        {
+            return;
+        }
+
+        // The directory contents changed, so look for any files or sub-directories that were not in the snapshot
+        // Existing sub-directories are validated separately so we only need to look at the immediate children
+        //-------------------------------------------------------------------------
+
+        TVector<FileSystem::Path> directoryContents;
+        if ( !FileSystem::GetDirectoryContents( FileSystem::Path::FromNormalizedPathString( record.m_path ), directoryContents, FileSystem::DirectoryReaderOutput::All, FileSystem::DirectoryReaderMode::DontExpand ) )
+        {
+            result.m_isDeleted = true;
+            return;
+        }
+
+        for ( auto const& path : directoryContents )
+        {
+            if ( path.IsDirectoryPath() )
+            {
+                if ( m_knownDirectories.find( path ) != m_knownDirectories.end() )
+                {
+                    continue;
+                }
+
+                // Everything in a new directory is new
+                TVector<FileSystem::Path> newDirectoryContents;
+                if ( FileSystem::GetDirectoryContents( path, newDirectoryContents, FileSystem::DirectoryReaderOutput::All, FileSystem::DirectoryReaderMode::Expand ) )
+                {
+                    AddNewPath( path );
+                    for ( auto const& newPath : newDirectoryContents )
+                    {
+                        AddNewPath( newPath );
+                    }
+                }
+            }
+            else if ( m_knownFiles.find( path ) == m_knownFiles.end() )
+            {
+                AddNewPath( path );
+            }
+        }
+    }
+
+    void ResourceDatabaseSnapshot::ValidateFile( int32_t fileIdx )
+    {
+        FileRecord const& record = m_files[fileIdx];
+        ValidatedFile& result = m_validatedFiles[fileIdx];
+
+        if ( !FileSystem::GetFileSizeAndModifiedTime( record.m_path.c_str(), result.m_fileSize, result.m_modifiedTime ) )
+        {
+            result.m_status = FileStatus::Deleted;
+            return;
+        }
+
+        if ( result.m_fileSize == record.m_fileSize && result.m_modifiedTime == record.m_modifiedTime )
+        {
+            result.m_status = FileStatus::Unchanged;
+            return;
+        }
+
+        // We dont track the contents of any non-descriptor files
+        if ( !record.m_isDescriptor )
+        {
+            result.m_status = FileStatus::MetadataChanged;
+            return;
+        }
+
+        // Only descriptors whose contents actually changed need to be reloaded
+        //-------------------------------------------------------------------------
+
+        Blob fileData;
+        if ( FileSystem::LoadFile( record.m_path.c_str(), fileData ) )
+        {
+            result.m_contentHash = Hash::GetHash64( fileData );
+            if ( result.m_contentHash == record.m_contentHash )
+            {
+                result.m_status = FileStatus::MetadataChanged;
+                return;
+            }
+
+            result.m_serializedDescriptor.assign( (char const*) fileData.data(), fileData.size() );
+        }
+
+        result.m_status = FileStatus::ContentChanged;
+    }
+
+    void ResourceDatabaseSnapshot::AddNewPath( FileSystem::Path const& path )
+    {
+        Threading::ScopeLock lock( m_newPathsMutex );
+
+        if ( path.IsDirectoryPath() )
+        {
+            m_newDirectories.emplace_back( path );
+        }
+        else
+        {
+            m_newFiles.emplace_back( path );
+        }
+    }
+}
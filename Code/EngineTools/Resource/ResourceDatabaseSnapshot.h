@@ -0,0 +1,111 @@
+#pragma once
+
+#include "EngineTools/_Module/API.h"
+#include "Base/Serialization/BinarySerialization.h"
+#include "Base/FileSystem/FileSystemPath.h"
+#include "Base/Threading/Threading.h"
+#include "Base/Types/Set.h"
+
+//-------------------------------------------------------------------------
+// Resource Database Snapshot
+//-------------------------------------------------------------------------
+// A serialized copy of the raw resource file tree and the contents of all descriptors, written whenever the database changes.
+// On startup the database is restored from the snapshot instead of walking the data directory and reading every descriptor.
+// The restored records are then validated against the file system in the background so only changed files need to be read.
+//
+// Files are checked via their size and modified time, descriptors also store a content hash so that a touched but otherwise
+// unchanged descriptor doesnt need to be reloaded. Files added while the editor was closed are found via the directory modified
+// times, only directories whose modified time doesnt match the snapshot need to be enumerated.
+
+namespace EE::Resource
+{
+    class ResourceDatabaseSnapshot
+    {
+    public:
+
+        constexpr static uint32_t const s_version = 1;
+
+        struct DirectoryRecord
+        {
+            EE_SERIALIZE( m_path, m_parentIdx, m_modifiedTime );
+
+            String                                                  m_path;
+            int32_t                                                 m_parentIdx = InvalidIndex;     // Parents are always stored before their children
+            uint64_t                                                m_modifiedTime = 0;             // Zero means that the contents need to be re-enumerated
+        };
+
+        struct FileRecord
+        {
+            EE_SERIALIZE( m_path, m_directoryIdx, m_fileSize, m_modifiedTime, m_contentHash, m_serializedDescriptor );
+
+            String                                                  m_path;
+            int32_t                                                 m_directoryIdx = InvalidIndex;
+            uint64_t                                                m_fileSize = 0;
+            uint64_t                                                m_modifiedTime = 0;
+            uint64_t                                                m_contentHash = 0;              // Only tracked for descriptors
+            String                                                  m_serializedDescriptor;         // Descriptor file contents
+            bool                                                    m_isDescriptor = false;         // Not serialized, set when restoring the database
+        };
+
+        // Validation
+        //-------------------------------------------------------------------------
+
+        enum class FileStatus : uint8_t
+        {
+            Unchanged,
+            MetadataChanged,
+            ContentChanged,
+            Deleted
+        };
+
+        struct ValidatedFile
+        {
+            FileStatus                                              m_status = FileStatus::Unchanged;
+            uint64_t                                                m_fileSize = 0;
+            uint64_t                                                m_modifiedTime = 0;
+            uint64_t                                                m_contentHash = 0;
+            String                                                  m_serializedDescriptor;
+        };
+
+        struct ValidatedDirectory
+        {
+            bool                                                    m_isDeleted = false;
+            uint64_t                                                m_modifiedTime = 0;
+        };
+
+    public:
+
+        // Read a snapshot, this will fail if the snapshot is out of date or was created for a different raw resource directory
+        bool ReadFromFile( FileSystem::Path const& snapshotPath, FileSystem::Path const& rawResourceDirPath );
+
+        bool WriteToFile( FileSystem::Path const& snapshotPath, FileSystem::Path const& rawResourceDirPath ) const;
+
+        // Allocate the validation results and create the lookups needed to detect new files, needs to be called before validating any records
+        void BeginValidation();
+
+        // Validate a record against the file system - these are thread-safe as long as each record is only validated once
+        void ValidateDirectory( int32_t directoryIdx );
+        void ValidateFile( int32_t fileIdx );
+
+    private:
+
+        void AddNewPath( FileSystem::Path const& path );
+
+    public:
+
+        TVector<DirectoryRecord>                                    m_directories;
+        TVector<FileRecord>                                         m_files;
+
+        // Validation results
+        TVector<ValidatedDirectory>                                 m_validatedDirectories;
+        TVector<ValidatedFile>                                      m_validatedFiles;
+        TVector<FileSystem::Path>                                   m_newDirectories;
+        TVector<FileSystem::Path>                                   m_newFiles;
+
+    private:
+
+        TUnorderedSet<FileSystem::Path>                             m_knownDirectories;
+        TUnorderedSet<FileSystem::Path>                             m_knownFiles;
+        Threading::Mutex                                            m_newPathsMutex;
+    };
+}
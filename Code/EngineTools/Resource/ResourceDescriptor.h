@@ -49,6 +49,35 @@ namespace EE::Resource
             return Cast<ResourceDescriptor>( pDescriptor );
         }
 
+        // Try to read a descriptor from an in-memory copy of a descriptor file without knowing the type
+        static inline ResourceDescriptor* TryReadFromString( TypeSystem::TypeRegistry const& typeRegistry, char const* pDescriptorString )
+        {
+            Serialization::TypeArchiveReader typeReader( typeRegistry );
+
+            if ( !typeReader.ReadFromString( pDescriptorString ) )
+            {
+                return nullptr;
+            }
+
+            //-------------------------------------------------------------------------
+
+            auto pDescriptor = typeReader.TryReadType();
+            if ( pDescriptor == nullptr )
+            {
+                return nullptr;
+            }
+
+            //-------------------------------------------------------------------------
+
+            if ( !pDescriptor->GetTypeInfo()->IsDerivedFrom( ResourceDescriptor::GetStaticTypeID() ) )
+            {
+                EE::Delete( pDescriptor );
+                return nullptr;
+            }
+
+            return Cast<ResourceDescriptor>( pDescriptor );
+        }
+
         // Try to read a specific descriptor from a file
         template<typename T>
         static bool TryReadFromFile( TypeSystem::TypeRegistry const& typeRegistry, FileSystem::Path const& descriptorPath, T& outData )
@@ -26,6 +26,7 @@ namespace EE
         virtual void RegisterComponent( Entity const* pEntity, EntityComponent* pComponent ) override final;
         virtual void UnregisterComponent( Entity const* pEntity, EntityComponent* pComponent ) override final;
         virtual void UpdateSystem( EntityWorldUpdateContext const& ctx ) override;
+        virtual WorldSystemAccess GetUpdateAccess() const override { return WorldSystemAccess(); }
 
     private:
 
@@ -24,23 +24,27 @@ namespace EE::Player
 
     void WeaponGraphController::DrawWeapon()
     {
-        m_weaponState.Set( StringID( "Draw" ) );
+        constexpr static StringID const s_drawStateID = StringID::FromLiteral( "Draw" );
+        m_weaponState.Set( s_drawStateID );
     }
 
     void WeaponGraphController::HolsterWeapon()
     {
-        m_weaponState.Set( StringID( "Holster" ) );
+        constexpr static StringID const s_holsterStateID = StringID::FromLiteral( "Holster" );
+        m_weaponState.Set( s_holsterStateID );
     }
 
     void WeaponGraphController::Aim( Vector const& targetWS )
     {
         float angleH = 0.0f;
         float angleV = 0.0f;
-        m_weaponState.Set( StringID( "Aim" ) );
+        constexpr static StringID const s_aimStateID = StringID::FromLiteral( "Aim" );
+        m_weaponState.Set( s_aimStateID );
 
         // This is stupid but it's a demo
         Animation::Pose const* pPose = GetCurrentPose();
-        int32_t const headIdx = pPose->GetSkeleton()->GetBoneIndex( StringID( "head" ) );
+        constexpr static StringID const s_headBoneID = StringID::FromLiteral( "head" );
+        int32_t const headIdx = pPose->GetSkeleton()->GetBoneIndex( s_headBoneID );
         if ( headIdx != InvalidIndex )
         {
             Vector headPos = pPose->GetGlobalTransform( headIdx ).GetTranslation();
@@ -51,6 +51,13 @@ namespace EE::Player
 
     //-------------------------------------------------------------------------
 
+    WorldSystemAccess PlayerInteractionSystem::GetUpdateAccess() const
+    {
+        WorldSystemAccess access;
+        access.Reads<SpatialEntityComponent>().Reads<PlayerInteractibleComponent>().Writes<MainPlayerComponent>();
+        return access;
+    }
+
     void PlayerInteractionSystem::UpdateSystem( EntityWorldUpdateContext const& ctx )
     {
         if ( !ctx.IsGameWorld() )